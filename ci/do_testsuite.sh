@@ -20,6 +20,24 @@ if [ "$TEST" = "FAST" -o "$TEST" = "ALL" ]; then
 		cat ./output.testsuite
 		$DIST_PATH/testsuite/check-blistest.sh ./output.testsuite
 	done
+
+	# Repeat with dynamic scheduling of the jr and ir loops, which only
+	# takes effect when those loops are parallelized.
+	for impl in $(echo $THR | sed 's/none//' | tr , ' '); do
+		BLIS_THREAD_IMPL="$impl" BLIS_JRIR_DYNAMIC=1 \
+		BLIS_IC_NT=1 BLIS_JR_NT=2 BLIS_IR_NT=2 make testblis-fast
+		cat ./output.testsuite
+		$DIST_PATH/testsuite/check-blistest.sh ./output.testsuite
+	done
+
+	# Repeat with the pc loop parallelized, which gemm implements with a
+	# reduction into C.
+	for impl in $(echo $THR | sed 's/none//' | tr , ' '); do
+		BLIS_THREAD_IMPL="$impl" \
+		BLIS_IC_NT=1 BLIS_PC_NT=2 make testblis-fast
+		cat ./output.testsuite
+		$DIST_PATH/testsuite/check-blistest.sh ./output.testsuite
+	done
 fi
 
 if [ "$TEST" = "MD" -o "$TEST" = "ALL" ]; then
@@ -55,6 +55,9 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_haswell_asm_6x8,
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_3x8,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_3x4,
+
+	  // gemm (uint8 x int8 -> int32)
+	  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT, bli_u8s8s32gemm_haswell_int_6x16,
 #else
 	  BLIS_GEMM_UKR,       BLIS_FLOAT,    bli_sgemm_haswell_asm_16x6,
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_haswell_asm_8x6,
@@ -75,6 +78,10 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_PACKM_KER, BLIS_DOUBLE,   bli_dpackm_haswell_asm_6x8,
 	  BLIS_PACKM_KER, BLIS_SCOMPLEX, bli_cpackm_haswell_asm_3x8,
 	  BLIS_PACKM_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_3x4,
+
+	  // packm (bfloat16, float16 -> float)
+	  BLIS_PACKM_BF16_KER, BLIS_FLOAT, bli_sbpackm_haswell_int_6x16,
+	  BLIS_PACKM_F16_KER,  BLIS_FLOAT, bli_shpackm_haswell_int_6x16,
 #endif
 
 	  // axpyf
@@ -132,9 +139,42 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCR_UKR, BLIS_FLOAT, bli_sgemmsup_rv_haswell_asm_6x16n,
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT, bli_sgemmsup_rv_haswell_asm_6x16n,
 
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
+
 	  BLIS_VA_END
 	);
 
+	// Use vpdpbusd for 8-bit integer gemm if the hardware supports AVX-VNNI.
+	uint32_t family, model, features;
+	bli_cpuid_query( &family, &model, &features );
+	if ( bli_cpuid_has_features( features, FEATURE_AVXVNNI ) )
+	{
+		bli_cntx_set_ukrs
+		(
+		  cntx,
+
+		  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT, bli_u8s8s32gemm_haswell_int_6x16_avxvnni,
+
+		  BLIS_VA_END
+		);
+	}
+
 	// Update the context with storage preferences.
 	bli_cntx_set_ukr_prefs
 	(
@@ -179,6 +219,24 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
 	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
 
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+
 	  BLIS_VA_END
 	);
 
@@ -207,19 +265,19 @@ void bli_cntx_init_haswell( cntx_t* cntx )
 
 	// Initialize sup thresholds with architecture-appropriate values.
 	//                                          s     d     c     z
-	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  201,  201,   -1,   -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  201,  201,   -1,   -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  201,  201,   -1,   -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  201,  201,  201,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  201,  201,  201,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  201,  201,  201,  128 );
 
 	// Initialize level-3 sup blocksize objects with architecture-specific
 	// values.
 	//                                           s      d      c      z
-	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,    -1,    -1,
-	                                                 9,     9,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   168,    72,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  4080,  4080,    -1,    -1 );
+	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,     3,     3,
+	                                                 9,     9,     3,     3 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,     8,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   168,    72,    72,    36 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,   128,    64 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  4080,  4080,  2040,  1020 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
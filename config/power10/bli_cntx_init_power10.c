@@ -55,6 +55,21 @@ void bli_cntx_init_power10( cntx_t* cntx )
 	  BLIS_VA_END
 	);
 
+	// Reduced-precision (bfloat16, float16) gemm. A and B are packed in
+	// pairs of k indices and computed with the rank-2 MMA instructions,
+	// using the same register blocksizes as sgemm.
+	bli_cntx_set_ukrs
+	(
+	  cntx,
+
+	  BLIS_PACKM_BF16_KER, BLIS_FLOAT, bli_sbpackm_power10_int_8x16,
+	  BLIS_PACKM_F16_KER,  BLIS_FLOAT, bli_shpackm_power10_int_8x16,
+	  BLIS_GEMM_BF16_UKR,  BLIS_FLOAT, bli_sbgemm_power10_mma_8x16,
+	  BLIS_GEMM_F16_UKR,   BLIS_FLOAT, bli_shgemm_power10_mma_8x16,
+
+	  BLIS_VA_END
+	);
+
 	// Update the context with storage preferences.
 	bli_cntx_set_ukr_prefs
 	(
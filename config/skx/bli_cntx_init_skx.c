@@ -51,72 +51,253 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  // level-3
 	  BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,
+	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_skx_asm_24x4,
+	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_skx_asm_12x4,
+
+	  // gemmtrsm_l
+	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_skx_int_32x12,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_skx_int_16x14,
+
+	  // gemmtrsm_u
+	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_skx_int_32x12,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_skx_int_16x14,
+
+	  // packm
+	  BLIS_PACKM_KER,      BLIS_FLOAT,    bli_spackm_skx_int_32x12,
+	  BLIS_PACKM_KER,      BLIS_DOUBLE,   bli_dpackm_skx_int_16x14,
+	  BLIS_PACKM_DIAG_KER, BLIS_FLOAT,    bli_spackm_diag_skx_int_32x12,
+	  BLIS_PACKM_DIAG_KER, BLIS_DOUBLE,   bli_dpackm_diag_skx_int_16x14,
 
 	  // axpyf
-	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
-	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,  BLIS_FLOAT,    bli_saxpyf_skx_int_8,
+	  BLIS_AXPYF_KER,  BLIS_DOUBLE,   bli_daxpyf_skx_int_8,
+	  BLIS_AXPYF_KER,  BLIS_SCOMPLEX, bli_caxpyf_skx_int_8,
+	  BLIS_AXPYF_KER,  BLIS_DCOMPLEX, bli_zaxpyf_skx_int_8,
 
 	  // dotxf
-	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
-	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,  BLIS_FLOAT,    bli_sdotxf_skx_int_8,
+	  BLIS_DOTXF_KER,  BLIS_DOUBLE,   bli_ddotxf_skx_int_8,
+	  BLIS_DOTXF_KER,  BLIS_SCOMPLEX, bli_cdotxf_skx_int_8,
+	  BLIS_DOTXF_KER,  BLIS_DCOMPLEX, bli_zdotxf_skx_int_8,
 
-#if 1
 	  // amaxv
-	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
-	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
-#endif
+	  BLIS_AMAXV_KER,  BLIS_FLOAT,    bli_samaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_DOUBLE,   bli_damaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_SCOMPLEX, bli_camaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_DCOMPLEX, bli_zamaxv_skx_int,
 
 	  // axpyv
-#if 0
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int,
-#else
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
-#endif
+	  BLIS_AXPYV_KER,  BLIS_FLOAT,    bli_saxpyv_skx_int,
+	  BLIS_AXPYV_KER,  BLIS_DOUBLE,   bli_daxpyv_skx_int,
+	  BLIS_AXPYV_KER,  BLIS_SCOMPLEX, bli_caxpyv_skx_int,
+	  BLIS_AXPYV_KER,  BLIS_DCOMPLEX, bli_zaxpyv_skx_int,
+
+	  // copyv
+	  BLIS_COPYV_KER,  BLIS_FLOAT,    bli_scopyv_skx_int,
+	  BLIS_COPYV_KER,  BLIS_DOUBLE,   bli_dcopyv_skx_int,
+	  BLIS_COPYV_KER,  BLIS_SCOMPLEX, bli_ccopyv_skx_int,
+	  BLIS_COPYV_KER,  BLIS_DCOMPLEX, bli_zcopyv_skx_int,
 
 	  // dotv
-	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_zen_int,
-	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_FLOAT,    bli_sdotv_skx_int,
+	  BLIS_DOTV_KER,   BLIS_DOUBLE,   bli_ddotv_skx_int,
+	  BLIS_DOTV_KER,   BLIS_SCOMPLEX, bli_cdotv_skx_int,
+	  BLIS_DOTV_KER,   BLIS_DCOMPLEX, bli_zdotv_skx_int,
 
 	  // dotxv
-	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
-	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_FLOAT,    bli_sdotxv_skx_int,
+	  BLIS_DOTXV_KER,  BLIS_DOUBLE,   bli_ddotxv_skx_int,
+	  BLIS_DOTXV_KER,  BLIS_SCOMPLEX, bli_cdotxv_skx_int,
+	  BLIS_DOTXV_KER,  BLIS_DCOMPLEX, bli_zdotxv_skx_int,
 
 	  // scalv
-#if 0
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int,
-#else
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
-#endif
+	  BLIS_SCALV_KER,  BLIS_FLOAT,    bli_sscalv_skx_int,
+	  BLIS_SCALV_KER,  BLIS_DOUBLE,   bli_dscalv_skx_int,
+	  BLIS_SCALV_KER,  BLIS_SCOMPLEX, bli_cscalv_skx_int,
+	  BLIS_SCALV_KER,  BLIS_DCOMPLEX, bli_zscalv_skx_int,
+
+	  // setv
+	  BLIS_SETV_KER,   BLIS_FLOAT,    bli_ssetv_skx_int,
+	  BLIS_SETV_KER,   BLIS_DOUBLE,   bli_dsetv_skx_int,
+	  BLIS_SETV_KER,   BLIS_SCOMPLEX, bli_csetv_skx_int,
+	  BLIS_SETV_KER,   BLIS_DCOMPLEX, bli_zsetv_skx_int,
+
+	  // swapv
+	  BLIS_SWAPV_KER,  BLIS_FLOAT,    bli_sswapv_skx_int,
+	  BLIS_SWAPV_KER,  BLIS_DOUBLE,   bli_dswapv_skx_int,
+	  BLIS_SWAPV_KER,  BLIS_SCOMPLEX, bli_cswapv_skx_int,
+	  BLIS_SWAPV_KER,  BLIS_DCOMPLEX, bli_zswapv_skx_int,
+
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DOUBLE, bli_dgemmsup_rd_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_skx_int_12x16n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_FLOAT, bli_sgemmsup_rd_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_FLOAT, bli_sgemmsup_rd_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT, bli_sgemmsup_rv_skx_int_12x32n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_skx_int_6x16m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_skx_int_6x16n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_skx_int_6x16n,
+
+	  BLIS_GEMMSUP_RRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_skx_int_6x8m,
+	  BLIS_GEMMSUP_RCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8m,
+	  BLIS_GEMMSUP_RCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_skx_int_6x8n,
+	  BLIS_GEMMSUP_CCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8n,
+	  BLIS_GEMMSUP_CCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_skx_int_6x8n,
 
 	  BLIS_VA_END
 	);
 
+	// Reduced-precision (bfloat16, float16) gemm. By default, A and B are
+	// converted to single precision while packing and computed with the
+	// sgemm microkernel. If the hardware supports AVX512_BF16, bfloat16
+	// operands are instead packed in pairs and computed with vdpbf16ps.
+	// Likewise, 8-bit integer gemm uses vpdpbusd if AVX512_VNNI is present
+	// and an (exact) AVX512BW emulation of it otherwise.
+	bli_cntx_set_ukrs
+	(
+	  cntx,
+
+	  BLIS_PACKM_BF16_KER,   BLIS_FLOAT,  bli_sbpackm_skx_int_32x12,
+	  BLIS_PACKM_F16_KER,    BLIS_FLOAT,  bli_shpackm_skx_int_32x12,
+	  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT,  bli_u8s8s32gemm_skx_int_32x12,
+
+	  BLIS_VA_END
+	);
+
+	uint32_t family, model, features;
+	bli_cpuid_query( &family, &model, &features );
+	if ( bli_cpuid_has_features( features, FEATURE_AVX512BF16 ) )
+	{
+		bli_cntx_set_ukrs
+		(
+		  cntx,
+
+		  BLIS_PACKM_BF16_KER, BLIS_FLOAT,    bli_sbpackm_skx_int_32x12_dpbf16,
+		  BLIS_GEMM_BF16_UKR,  BLIS_FLOAT,    bli_sbgemm_skx_asm_32x12_l2,
+
+		  BLIS_VA_END
+		);
+	}
+
+	if ( bli_cpuid_has_features( features, FEATURE_AVX512VNNI ) )
+	{
+		bli_cntx_set_ukrs
+		(
+		  cntx,
+
+		  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT,  bli_u8s8s32gemm_skx_int_32x12_vnni,
+
+		  BLIS_VA_END
+		);
+	}
+
 	// Update the context with storage preferences.
 	bli_cntx_set_ukr_prefs
 	(
 	  cntx,
 
 	  // level-3
-	  BLIS_GEMM_UKR_ROW_PREF, BLIS_FLOAT , FALSE,
-	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DOUBLE, FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_FLOAT ,   FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DOUBLE,   FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_SCOMPLEX, FALSE,
+	  BLIS_GEMM_UKR_ROW_PREF, BLIS_DCOMPLEX, FALSE,
+
+	  // gemmtrsm_l
+	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_FLOAT,    FALSE,
+	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_DOUBLE,   FALSE,
+
+	  // gemmtrsm_u
+	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_FLOAT,    FALSE,
+	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_DOUBLE,   FALSE,
+
+	  // gemmsup
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+
+	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 
 	  BLIS_VA_END
 	);
 
 	// Initialize level-3 blocksize objects with architecture-specific values.
 	//                                           s      d      c      z
-	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,    -1,    -1 );
-	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   256,    -1,    -1,
-	                                           480,   320,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],    32,    16,    24,    12 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    12,    14,     4,     4 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],   480,   240,   240,   120 );
+	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   256,   256,   256,
+	                                           480,   320,   320,   320 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,  3072,  3072 );
+	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,     8,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,     8,     8 );
+
+	// -------------------------------------------------------------------------
+
+	// Initialize sup thresholds with architecture-appropriate values.
+	//                                          s     d     c     z
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],  240,  201,  201,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],  240,  201,  201,  128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],  240,  201,  201,  128 );
+
+	// Initialize level-3 sup blocksize objects with architecture-specific
+	// values.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR_SUP ],    12,    12,     6,     6 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    32,    16,    16,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   480,   240,   240,   120 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,   128,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  3072,  3072,  1536,  1536 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
@@ -135,6 +316,18 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
 
+	  // gemmsup thresholds
+	  BLIS_MT, &blkszs[ BLIS_MT ], BLIS_MT,
+	  BLIS_NT, &blkszs[ BLIS_NT ], BLIS_NT,
+	  BLIS_KT, &blkszs[ BLIS_KT ], BLIS_KT,
+
+	  // level-3 sup
+	  BLIS_NC_SUP, &blkszs[ BLIS_NC_SUP ], BLIS_NR_SUP,
+	  BLIS_KC_SUP, &blkszs[ BLIS_KC_SUP ], BLIS_KR_SUP,
+	  BLIS_MC_SUP, &blkszs[ BLIS_MC_SUP ], BLIS_MR_SUP,
+	  BLIS_NR_SUP, &blkszs[ BLIS_NR_SUP ], BLIS_NR_SUP,
+	  BLIS_MR_SUP, &blkszs[ BLIS_MR_SUP ], BLIS_MR_SUP,
+
 	  BLIS_VA_END
 	);
 }
@@ -57,6 +57,9 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_3x8,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_3x4,
 
+	  // gemm (uint8 x int8 -> int32)
+	  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT, bli_u8s8s32gemm_haswell_int_6x16,
+
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_haswell_asm_6x8,
@@ -95,22 +98,23 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_FLOAT, bli_sgemmsup_rv_zen_asm_6x16n,
 #endif
 
-#if 0
-	  // NOTE: This set of kernels is likely broken and therefore disabled.
 	  BLIS_GEMMSUP_RRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8m,
 	  BLIS_GEMMSUP_RCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
-	  BLIS_GEMMSUP_CRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
 	  BLIS_GEMMSUP_RCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rd_zen_int_3x8n,
 	  BLIS_GEMMSUP_CCR_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_SCOMPLEX, bli_cgemmsup_rv_zen_asm_3x8n,
 
 	  BLIS_GEMMSUP_RRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
+	  BLIS_GEMMSUP_RRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4m,
 	  BLIS_GEMMSUP_RCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
-	  BLIS_GEMMSUP_CRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
 	  BLIS_GEMMSUP_RCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
+	  BLIS_GEMMSUP_CRR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4m,
+	  BLIS_GEMMSUP_CRC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rd_zen_int_3x4n,
 	  BLIS_GEMMSUP_CCR_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
 	  BLIS_GEMMSUP_CCC_UKR, BLIS_DCOMPLEX, bli_zgemmsup_rv_zen_asm_3x4n,
-#endif
 
 	  // packm
 	  BLIS_PACKM_KER, BLIS_FLOAT,    bli_spackm_haswell_asm_6x16,
@@ -118,6 +122,10 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_PACKM_KER, BLIS_SCOMPLEX, bli_cpackm_haswell_asm_3x8,
 	  BLIS_PACKM_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_3x4,
 
+	  // packm (bfloat16, float16 -> float)
+	  BLIS_PACKM_BF16_KER, BLIS_FLOAT, bli_sbpackm_haswell_int_6x16,
+	  BLIS_PACKM_F16_KER,  BLIS_FLOAT, bli_shpackm_haswell_int_6x16,
+
 	  // axpyf
 	  BLIS_AXPYF_KER,  BLIS_FLOAT,  bli_saxpyf_zen_int_8,
 	  BLIS_AXPYF_KER,  BLIS_DOUBLE, bli_daxpyf_zen_int_8,
@@ -161,6 +169,21 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_VA_END
 	);
 
+	// Use vpdpbusd for 8-bit integer gemm if the hardware supports AVX-VNNI.
+	uint32_t family, model, features;
+	bli_cpuid_query( &family, &model, &features );
+	if ( bli_cpuid_has_features( features, FEATURE_AVXVNNI ) )
+	{
+		bli_cntx_set_ukrs
+		(
+		  cntx,
+
+		  BLIS_GEMM_U8S8S32_UKR, BLIS_FLOAT, bli_u8s8s32gemm_haswell_int_6x16_avxvnni,
+
+		  BLIS_VA_END
+		);
+	}
+
 	// Update the context with storage preferences.
 	bli_cntx_set_ukr_prefs
 	(
@@ -199,22 +222,23 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_FLOAT,  TRUE,
 	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_FLOAT,  TRUE,
 
-#if 0
-	  // NOTE: This set of kernels is likely broken and therefore disabled.
 	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
-	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
 
 	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_RRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_RCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
-	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_RCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
+	  BLIS_GEMMSUP_CRC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_CCR_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 	  BLIS_GEMMSUP_CCC_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
-#endif
 
 	  BLIS_VA_END
 	);
@@ -259,27 +283,19 @@ void bli_cntx_init_zen( cntx_t* cntx )
 
 	// Initialize sup thresholds with architecture-appropriate values.
 	//                                           s      d      c      z
-	bli_blksz_init_easy( &blkszs[ BLIS_MT ],   512,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NT ],   512,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KT ],   440,   220,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MT ],   512,   256,   256,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NT ],   512,   256,   256,   128 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KT ],   440,   220,   220,   110 );
 
 	// Initialize level-3 sup blocksize objects with architecture-specific
 	// values.
 	//                                               s      d      c      z
-	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,    -1,    -1,
-	                                                 9,     9,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   144,    72,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  8160,  4080,    -1,    -1 );
-#if 0
 	bli_blksz_init     ( &blkszs[ BLIS_MR_SUP ],     6,     6,     3,     3,
 	                                                 9,     9,     3,     3 );
 	bli_blksz_init_easy( &blkszs[ BLIS_NR_SUP ],    16,     8,     8,     4 );
 	bli_blksz_init_easy( &blkszs[ BLIS_MC_SUP ],   144,    72,    72,    36 );
-	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   512,   256,   128,    64 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC_SUP ],   256,   256,   128,    64 );
 	bli_blksz_init_easy( &blkszs[ BLIS_NC_SUP ],  8160,  4080,  2040,  1020 );
-#endif
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
@@ -71,11 +71,10 @@ void bli_packm_blk_var1
 	if ( bli_error_checking_is_enabled() )
 		bli_packm_int_check( c, p );
 
-	// dt_p is updated by bli_packm_init for real-only packing
-	num_t   dt_c           = bli_obj_dt( c );
-	        dt_p           = bli_obj_dt( p );
-	dim_t   dt_c_size      = bli_dt_size( dt_c );
-	dim_t   dt_p_size      = bli_dt_size( dt_p );
+	// The element size of P is updated by bli_packm_init for real-only
+	// packing, or if the packed elements are narrower than dt_p.
+	dim_t   dt_c_size      = bli_obj_elem_size( c );
+	dim_t   dt_p_size      = bli_obj_elem_size( p );
 
 	struc_t strucc         = bli_obj_struc( c );
 	doff_t  diagoffc       = bli_obj_diag_offset( c );
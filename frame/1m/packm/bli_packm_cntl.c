@@ -93,6 +93,7 @@ void bli_packm_def_cntl_init_node
 	cntl->rev_iter_if_lower  = rev_iter_if_lower;
 	cntl->pack_schema        = pack_schema;
 	cntl->pack_buf_type      = pack_buf_type;
+	cntl->elem_size_pack     = 0;
 	cntl->params             = cntl;
 
 	bli_packm_cntl_init_node
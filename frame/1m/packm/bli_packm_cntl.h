@@ -87,6 +87,7 @@ struct packm_def_cntl_s
 	bool         rev_iter_if_lower;
 	pack_t       pack_schema;
 	packbuf_t    pack_buf_type;
+	siz_t        elem_size_pack;
 	const void*  params;
 };
 typedef struct packm_def_cntl_s packm_def_cntl_t;
@@ -143,6 +144,11 @@ BLIS_INLINE packbuf_t bli_packm_def_cntl_pack_buf_type( const cntl_t* cntl )
 	return ( ( const packm_def_cntl_t* ) cntl )->pack_buf_type;
 }
 
+BLIS_INLINE siz_t bli_packm_def_cntl_pack_elem_size( const cntl_t* cntl )
+{
+	return ( ( const packm_def_cntl_t* ) cntl )->elem_size_pack;
+}
+
 BLIS_INLINE packm_ker_ft bli_packm_def_cntl_ukr( const cntl_t* cntl )
 {
 	return ( ( const packm_def_cntl_t* ) cntl )->ukr;
@@ -202,6 +208,13 @@ BLIS_INLINE void bli_packm_def_cntl_set_pack_buf_type( packbuf_t pack_buf_type,
 	( ( packm_def_cntl_t* ) cntl )->pack_buf_type = pack_buf_type;
 }
 
+// Override the size of the elements stored in the packed buffer. A value of
+// zero (the default) means the size of the target datatype.
+BLIS_INLINE void bli_packm_def_cntl_set_pack_elem_size( siz_t elem_size_pack, cntl_t* cntl )
+{
+	( ( packm_def_cntl_t* ) cntl )->elem_size_pack = elem_size_pack;
+}
+
 BLIS_INLINE void bli_packm_def_cntl_set_ukr( const func2_t* ukr, cntl_t* cntl_ )
 {
 	packm_def_cntl_t* cntl = ( packm_def_cntl_t* )cntl_;
@@ -85,9 +85,13 @@ siz_t bli_packm_init
 	if ( schema == BLIS_PACKED_PANELS_RO )
 		dt_p = bli_dt_proj_to_real( dt_p );
 
-	// Update the storage datatype of P to be the target datatype of A.
+	// Update the storage datatype of P to be the target datatype of A. The
+	// control tree may override the element size when the packed elements
+	// are stored in a narrower format than the target (computation) datatype.
+	siz_t elem_size_pack = bli_packm_def_cntl_pack_elem_size( cntl );
 	bli_obj_set_dt( dt_p, p );
-	bli_obj_set_elem_size( bli_dt_size( dt_p ), p );
+	bli_obj_set_elem_size( elem_size_pack != 0 ? elem_size_pack
+	                                           : bli_dt_size( dt_p ), p );
 
 	// Store the pack schema to the object.
 	bli_obj_set_pack_schema( schema, p );
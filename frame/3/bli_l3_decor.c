@@ -41,34 +41,46 @@
 
 struct l3_decor_params_s
 {
-	const obj_t*   a;
-	const obj_t*   b;
-	const obj_t*   c;
-	const cntx_t*  cntx;
-	const cntl_t*  cntl;
-	      rntm_t*  rntm;
-	      array_t* array;
+	const obj_t*              a;
+	const obj_t*              b;
+	const obj_t*              c;
+	const cntx_t*             cntx;
+	const cntl_t*             cntl;
+	      rntm_t*             rntm;
+	      array_t*            array;
+	      l3_thrinfo_cache_t* cache;
 };
 typedef struct l3_decor_params_s l3_decor_params_t;
 
 static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
 {
-	const l3_decor_params_t* data    = data_void;
+	const l3_decor_params_t*  data    = data_void;
 
-	const obj_t*             a       = data->a;
-	const obj_t*             b       = data->b;
-	const obj_t*             c       = data->c;
-	const cntx_t*            cntx    = data->cntx;
-	const cntl_t*            cntl    = data->cntl;
-	      rntm_t*            rntm    = data->rntm;
-	      array_t*           array   = data->array;
+	const obj_t*              a       = data->a;
+	const obj_t*              b       = data->b;
+	const obj_t*              c       = data->c;
+	const cntx_t*             cntx    = data->cntx;
+	const cntl_t*             cntl    = data->cntl;
+	      rntm_t*             rntm    = data->rntm;
+	      array_t*            array   = data->array;
+	      l3_thrinfo_cache_t* cache   = data->cache;
 
 	bli_l3_thread_decorator_thread_check( gl_comm, rntm );
 
-	// Create the root node of the current thread's thrinfo_t structure.
-	// The root node is the *parent* of the node corresponding to the first
-	// control tree node.
-	thrinfo_t* thread = bli_l3_thrinfo_create( tid, gl_comm, array, rntm, cntl );
+	// Bind the thread to a cpu if the rntm_t asks for it. Otherwise, bind
+	// the thread to the cpus of the NUMA node that owns its thread id (if
+	// there is more than one node) so that the blocks it packs are allocated
+	// from, and placed on, that node.
+	const dim_t nt = bli_thrcomm_num_threads( gl_comm );
+
+	if ( !bli_affinity_bind_thread( bli_rntm_affinity( rntm ), tid, nt ) )
+		bli_numa_bind_thread( tid, nt );
+
+	// Create the root node of the current thread's thrinfo_t structure, or
+	// reuse the one built by an earlier operation with the same
+	// parallelization. The root node is the *parent* of the node
+	// corresponding to the first control tree node.
+	thrinfo_t* thread = bli_l3_thrinfo_cache_get( tid, gl_comm, cache, array, rntm, cntl );
 
 	bli_l3_int
 	(
@@ -80,13 +92,26 @@ static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const
 	  thread
 	);
 
-	// Free the current thread's thrinfo_t structure.
-	// NOTE: The barrier here is very important as it prevents memory being
-	// released by the chief of some thread sub-group before its peers are done
-	// using it. See PR #702 for more info [1].
-	// [1] https://github.com/flame/blis/pull/702
-	bli_thrinfo_barrier( thread );
-	bli_thrinfo_free( thread );
+	// Free the current thread's thrinfo_t structure, unless it is being
+	// kept for reuse.
+	bli_l3_thrinfo_cache_put( thread, cache );
+
+	// Restore the thread's original affinity.
+	bli_cpuset_unbind_thread();
+}
+
+// Return whether the control tree has a node that parallelizes the pc loop
+// on its own. The gemm control tree has one unless the operation cannot
+// reduce partial products into C (see bli_gemm_cntl_init()); other trees
+// either have none or, as for trsm, fold the pc ways into other loops.
+static bool bli_l3_cntl_has_pc_par( const cntl_t* cntl )
+{
+	for ( ; cntl != NULL; cntl = bli_cntl_sub_node( 0, cntl ) )
+	{
+		if ( bli_cntl_ways( 0, cntl ) == BLIS_THREAD_KC ) return TRUE;
+	}
+
+	return FALSE;
 }
 
 void bli_l3_thread_decorator
@@ -104,14 +129,24 @@ void bli_l3_thread_decorator
 	else bli_rntm_init_from_global( &rntm_l );
 
 	// Set the number of ways for each loop, if needed, depending on what
-	// kind of information is already stored in the rntm_t object.
-	bli_rntm_factorize
-	(
-	  bli_obj_length( c ),
-	  bli_obj_width( c ),
-	  bli_obj_width( a ),
-	  &rntm_l
-	);
+	// kind of information is already stored in the rntm_t object. Threads
+	// are only set aside for the pc loop if the control tree can use them.
+	if ( bli_l3_cntl_has_pc_par( cntl ) )
+		bli_rntm_factorize_pc
+		(
+		  bli_obj_length( c ),
+		  bli_obj_width( c ),
+		  bli_obj_width( a ),
+		  &rntm_l
+		);
+	else
+		bli_rntm_factorize
+		(
+		  bli_obj_length( c ),
+		  bli_obj_width( c ),
+		  bli_obj_width( a ),
+		  &rntm_l
+		);
 
 	// Query the threading implementation and the number of threads requested.
 	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
@@ -158,11 +193,16 @@ void bli_l3_thread_decorator
 	        ( ti == BLIS_OPENMP ? "openmp" : "pthreads" ) ) );
 #endif
 
-	// Check out an array_t from the small block allocator. This is done
-	// with an internal lock to ensure only one application thread accesses
-	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* array = bli_sba_checkout_array( nt );
+	// Check out a set of thrinfo_t trees left by an earlier operation with
+	// the same parallelization, if there is one. The set carries its own
+	// array_t of sba pools, from which its trees were allocated.
+	l3_thrinfo_cache_t* cache = bli_l3_thrinfo_cache_checkout( ti, nt, &rntm_l, cntl );
+
+	// Otherwise, check out an array_t from the small block allocator. This is
+	// done with an internal lock to ensure only one application thread
+	// accesses the sba at a time. bli_sba_checkout_array() will also
+	// automatically resize the array_t, if necessary.
+	array_t* array = ( cache != NULL ? cache->array : bli_sba_checkout_array( nt ) );
 
 	l3_decor_params_t params;
 	params.a        = a;
@@ -172,16 +212,18 @@ void bli_l3_thread_decorator
 	params.cntl     = cntl;
 	params.rntm     = &rntm_l;
 	params.array    = array;
+	params.cache    = cache;
 
 	// Launch the threads using the threading implementation specified by ti,
 	// and use bli_l3_thread_decorator_entry() as their entry points. The
 	// params struct will be passed along to each thread.
 	bli_thread_launch( ti, nt, bli_l3_thread_decorator_entry, &params );
 
-	// Check the array_t back into the small block allocator. Similar to the
-	// check-out, this is done using a lock embedded within the sba to ensure
-	// mutual exclusion.
-	bli_sba_checkin_array( array );
+	// Return the trees to the cache, or check the array_t back into the
+	// small block allocator. Similar to the check-out, this is done using a
+	// lock to ensure mutual exclusion.
+	if ( cache != NULL ) bli_l3_thrinfo_cache_checkin( cache );
+	else                 bli_sba_checkin_array( array );
 }
 
 void bli_l3_thread_decorator_check
@@ -57,94 +57,9 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
        const rntm_t* rntm
      )
 {
-	bli_init_once();
-
-	// Check the operands.
-	if ( bli_error_checking_is_enabled() )
-		bli_gemm_check( alpha, a, b, beta, c, cntx );
-
-	// Check for zero dimensions, alpha == 0, or other conditions which
-	// mean that we don't actually have to perform a full l3 operation.
-	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
-		return;
-
-	// Execute the small/unpacked oapi handler. If it finds that the problem
-	// does not fall within the thresholds that define "small", or for some
-	// other reason decides not to use the small/unpacked implementation,
-	// the function returns with BLIS_FAILURE, which causes execution to
-	// proceed towards the conventional implementation.
-	if ( bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
-		return;
-
-	// Default to using native execution.
-	num_t dt = bli_obj_dt( c );
-	ind_t im = BLIS_NAT;
-
-	// If each matrix operand has a complex storage datatype, try to get an
-	// induced method (if one is available and enabled). NOTE: Allowing
-	// precisions to vary while using 1m, which is what we do here, is unique
-	// to gemm; other level-3 operations use 1m only if all storage datatypes
-	// are equal (and they ignore the computation precision).
-	if ( bli_obj_is_complex( c ) &&
-	     bli_obj_is_complex( a ) &&
-	     bli_obj_is_complex( b ) )
-	{
-		// Find the highest priority induced method that is both enabled and
-		// available for the current operation. (If an induced method is
-		// available but not enabled, or simply unavailable, BLIS_NAT will
-		// be returned here.)
-		im = bli_gemmind_find_avail( dt );
-	}
-
-	// If necessary, obtain a valid context from the gks using the induced
-	// method id determined above.
-	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
-
-#if 0
-#ifdef BLIS_ENABLE_SMALL_MATRIX
-	// Only handle small problems separately for homogeneous datatypes.
-	if ( bli_obj_dt( a ) == bli_obj_dt( b ) &&
-	     bli_obj_dt( a ) == bli_obj_dt( c ) &&
-	     bli_obj_comp_prec( c ) == bli_obj_prec( c ) )
-	{
-		err_t status = bli_gemm_small( alpha, a, b, beta, c, cntx, cntl );
-		if ( status == BLIS_SUCCESS ) return;
-	}
-#endif
-#endif
-
-	// Alias A, B, and C in case we need to apply transformations.
-	obj_t a_local;
-	obj_t b_local;
-	obj_t c_local;
-	bli_obj_alias_submatrix( a, &a_local );
-	bli_obj_alias_submatrix( b, &b_local );
-	bli_obj_alias_submatrix( c, &c_local );
-
-	gemm_cntl_t cntl;
-	bli_gemm_cntl_init
-	(
-	  im,
-	  BLIS_GEMM,
-	  alpha,
-	  &a_local,
-	  &b_local,
-	  beta,
-	  &c_local,
-	  cntx,
-	  &cntl
-	);
-
-	// Invoke the internal back-end via the thread handler.
-	bli_l3_thread_decorator
-	(
-	  &a_local,
-	  &b_local,
-	  &c_local,
-	  cntx,
-	  ( cntl_t* )&cntl,
-	  rntm
-	);
+	// The conventional gemm implementation is shared with bli_gemm_epi_ex(),
+	// which reduces to gemm when no epilogue is given.
+	PASTEMAC(gemm_epi,BLIS_OAPI_EX_SUF)( alpha, a, b, beta, c, NULL, cntx, rntm );
 }
 
 
@@ -199,6 +114,10 @@ void PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)
 	bli_obj_alias_submatrix( b, &b_local );
 	bli_obj_alias_submatrix( c, &c_local );
 
+	// The gemmt macrokernels treat the diagonal of a Hermitian C specially
+	// (see bli_gemmt_r2k_ex()), which does not apply to gemmt proper.
+	bli_obj_set_struc( BLIS_GENERAL, &c_local );
+
 	gemm_cntl_t cntl;
 	bli_gemm_cntl_init
 	(
@@ -250,17 +169,14 @@ void PASTEMAC(her2k,BLIS_OAPI_EX_SUF)
 	bli_obj_alias_with_trans( BLIS_CONJ_TRANSPOSE, a, &ah );
 	bli_obj_alias_with_trans( BLIS_CONJ_TRANSPOSE, b, &bh );
 
-	// Invoke gemmt twice, using beta only the first time.
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)(   alpha, a, &bh,      beta, c, cntx, rntm );
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( &alphah, b, &ah, &BLIS_ONE, c, cntx, rntm );
-
-	// The Hermitian rank-2k product was computed as alpha*A*B'+alpha'*B*A', even for
-	// the diagonal elements. Mathematically, the imaginary components of
+	// Compute both rank-k products in a single pass over C. The Hermitian
+	// rank-2k product is computed as alpha*A*B'+alpha'*B*A', even for the
+	// diagonal elements. Mathematically, the imaginary components of
 	// diagonal elements of a Hermitian rank-2k product should always be
 	// zero. However, in practice, they sometimes accumulate meaningless
-	// non-zero values. To prevent this, we explicitly set those values
-	// to zero before returning.
-	bli_setid( &BLIS_ZERO, c );
+	// non-zero values. Because C is Hermitian, bli_gemmt_r2k_ex() sets
+	// those values to zero as it stores the diagonal elements.
+	bli_gemmt_r2k_ex( alpha, a, &bh, &alphah, b, &ah, beta, c, cntx, rntm );
 }
 
 
@@ -286,9 +202,8 @@ void PASTEMAC(syr2k,BLIS_OAPI_EX_SUF)
 	bli_obj_alias_with_trans( BLIS_TRANSPOSE, a, &at );
 	bli_obj_alias_with_trans( BLIS_TRANSPOSE, b, &bt );
 
-	// Invoke gemmt twice, using beta only the first time.
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, a, &bt,      beta, c, cntx, rntm );
-	PASTEMAC(gemmt,BLIS_OAPI_EX_SUF)( alpha, b, &at, &BLIS_ONE, c, cntx, rntm );
+	// Compute both rank-k products in a single pass over C.
+	bli_gemmt_r2k_ex( alpha, a, &bt, alpha, b, &at, beta, c, cntx, rntm );
 }
 
 
@@ -45,6 +45,25 @@ void bli_l3_packa
              thrinfo_t* thread_par
      )
 {
+	// If A was packed ahead of time (see bli_gemm_pack()), proceed with
+	// execution using A as-is. Skipping packm also skips its barrier, so
+	// consecutive ic iterations are separated only by the barrier that ends
+	// the macrokernel's dynamically scheduled loop (see
+	// bli_thread_range_dyn_finish()); that barrier must stay.
+	if ( bli_obj_is_panel_packed( a ) )
+	{
+		bli_l3_int
+		(
+		  a,
+		  b,
+		  c,
+		  cntx,
+		  bli_cntl_sub_node( 0, cntl ),
+		  bli_thrinfo_sub_node( 0, thread_par )
+		);
+		return;
+	}
+
 	obj_t a_local, a_pack;
 
 	bli_obj_alias_to( a, &a_local );
@@ -88,6 +107,22 @@ void bli_l3_packb
              thrinfo_t* thread_par
      )
 {
+	// If B was packed ahead of time (see bli_gemm_pack()), proceed with
+	// execution using B as-is.
+	if ( bli_obj_is_panel_packed( b ) )
+	{
+		bli_l3_int
+		(
+		  a,
+		  b,
+		  c,
+		  cntx,
+		  bli_cntl_sub_node( 0, cntl ),
+		  bli_thrinfo_sub_node( 0, thread_par )
+		);
+		return;
+	}
+
 	obj_t bt_local, bt_pack;
 
 	// We always pass B^T to bli_l3_packm.
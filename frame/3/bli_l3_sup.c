@@ -55,6 +55,13 @@ err_t bli_gemmsup
 	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
 	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
 
+	// Return early if either operand was packed ahead of time (see
+	// bli_gemm_pack()). Such operands are in the micropanel format of the
+	// conventional implementation, which, with the cost of packing already
+	// paid, is the better choice even for small problems.
+	if ( bli_obj_is_panel_packed( a ) ||
+	     bli_obj_is_panel_packed( b ) ) return BLIS_FAILURE;
+
 	// Obtain a valid (native) context from the gks if necessary.
 	// NOTE: This must be done before calling the _check() function, since
 	// that function assumes the context pointer is valid.
@@ -90,6 +97,11 @@ err_t bli_gemmsup
 	if ( !bli_rntm_l3_sup( &rntm_l ) )
 		return BLIS_FAILURE;
 
+	// Return early if parallelism was requested in the pc loop, since the
+	// sup variants do not implement the reduction that this requires.
+	if ( 1 < bli_rntm_pc_ways( &rntm_l ) )
+		return BLIS_FAILURE;
+
 #if 0
 const num_t dt = bli_obj_dt( c );
 const dim_t m  = bli_obj_length( c );
@@ -178,6 +190,11 @@ err_t bli_gemmtsup
 	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
 	else                { rntm_l = *rntm;                       }
 
+	// Return early if parallelism was requested in the pc loop, since the
+	// sup variants do not implement the reduction that this requires.
+	if ( 1 < bli_rntm_pc_ways( &rntm_l ) )
+		return BLIS_FAILURE;
+
 	// We've now ruled out the possibility that the sup thresholds are
 	// unsatisfied.
 	// This implies that the sup thresholds (at least one of them) are met.
@@ -69,6 +69,15 @@ static void bli_l3_sup_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, co
 
 	bli_l3_thread_decorator_thread_check( gl_comm, rntm );
 
+	// Bind the thread to a cpu if the rntm_t asks for it. Otherwise, bind
+	// the thread to the cpus of the NUMA node that owns its thread id (if
+	// there is more than one node) so that the blocks it packs are allocated
+	// from, and placed on, that node.
+	const dim_t nt = bli_thrcomm_num_threads( gl_comm );
+
+	if ( !bli_affinity_bind_thread( bli_rntm_affinity( rntm ), tid, nt ) )
+		bli_numa_bind_thread( tid, nt );
+
 	// Create the root node of the thread's thrinfo_t structure.
 	pool_t*    pool   = bli_sba_array_elem( tid, array );
 	thrinfo_t* thread = bli_l3_sup_thrinfo_create( tid, gl_comm, pool, rntm );
@@ -92,6 +101,9 @@ static void bli_l3_sup_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, co
 	// [1] https://github.com/flame/blis/pull/702
 	bli_thrinfo_barrier( thread );
 	bli_thrinfo_free( thread );
+
+	// Restore the thread's original affinity.
+	bli_cpuset_unbind_thread();
 }
 
 err_t bli_l3_sup_thread_decorator
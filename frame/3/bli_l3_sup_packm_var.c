@@ -89,14 +89,31 @@ void PASTEMAC(ch,varname) \
 		bli_toggle_trans( &transc ); \
 	} \
 \
-	/* Prepare to pack to row-stored column panels. */ \
-	iter_dim       = n; \
-	panel_len_full = m; \
-	panel_len_max  = m_max; \
-	panel_dim_max  = pd_p; \
-	vs_c           = cs_c; \
-	ldc            = rs_c; \
-	ldp            = rs_p; \
+	/* If the strides of p indicate row storage, then we are packing to
+	   column panels; otherwise, if the strides indicate column storage,
+	   we are packing to row panels. */ \
+	if ( bli_is_row_stored_f( m_max, n_max, rs_p, cs_p ) ) \
+	{ \
+		/* Prepare to pack to row-stored column panels. */ \
+		iter_dim       = n; \
+		panel_len_full = m; \
+		panel_len_max  = m_max; \
+		panel_dim_max  = pd_p; \
+		vs_c           = cs_c; \
+		ldc            = rs_c; \
+		ldp            = rs_p; \
+	} \
+	else /* if ( bli_is_col_stored_f( m_max, n_max, rs_p, cs_p ) ) */ \
+	{ \
+		/* Prepare to pack to column-stored row panels. */ \
+		iter_dim       = m; \
+		panel_len_full = n; \
+		panel_len_max  = n_max; \
+		panel_dim_max  = pd_p; \
+		vs_c           = rs_c; \
+		ldc            = cs_c; \
+		ldp            = cs_p; \
+	} \
 \
 	num_t  dt      = PASTEMAC(ch,type); \
 	ukr_t ker_id   = BLIS_PACKM_KER; \
@@ -328,13 +345,29 @@ void PASTEMAC(ch,varname) \
 		bli_toggle_trans( &transc ); \
 	} \
 \
-	/* Prepare to pack to a column-stored matrix. */ \
-	iter_dim       = n; \
-	vector_len     = m; \
-	incc           = rs_c; \
-	ldc            = cs_c; \
-	incp           = 1; \
-	ldp            = cs_p; \
+	/* If the strides of p indicate row storage, then we are packing to a
+	   row-stored matrix; otherwise, we are packing to a column-stored
+	   matrix. */ \
+	if ( bli_is_row_stored_f( m, n, rs_p, cs_p ) ) \
+	{ \
+		/* Prepare to pack to a row-stored matrix. */ \
+		iter_dim       = m; \
+		vector_len     = n; \
+		incc           = cs_c; \
+		ldc            = rs_c; \
+		incp           = 1; \
+		ldp            = rs_p; \
+	} \
+	else /* if ( bli_is_col_stored_f( m, n, rs_p, cs_p ) ) */ \
+	{ \
+		/* Prepare to pack to a column-stored matrix. */ \
+		iter_dim       = n; \
+		vector_len     = m; \
+		incc           = rs_c; \
+		ldc            = cs_c; \
+		incp           = 1; \
+		ldp            = cs_p; \
+	} \
 \
 	/* Compute the total number of iterations we'll need. */ \
 	n_iter = iter_dim; \
@@ -47,6 +47,10 @@ thrinfo_t* bli_l3_thrinfo_create
 {
 	pool_t* sba_pool = bli_sba_array_elem( id, array );
 
+	// Apply the barrier spin budget requested by the rntm_t to the global
+	// communicator, from which all other communicators inherit it.
+	bli_thrcomm_set_spin( bli_rntm_barrier_spin( rntm ), gl_comm );
+
 	// Create the root thrinfo_t node.
 	thrinfo_t* root = bli_thrinfo_create_root
 	(
@@ -56,6 +60,10 @@ thrinfo_t* bli_l3_thrinfo_create
 	  bli_pba_query()
 	);
 
+	// Record whether the macrokernels should schedule the jr/ir loops
+	// dynamically. The setting is inherited by all nodes split from the root.
+	bli_thrinfo_set_jrir_dyn( bli_rntm_jrir_dyn( rntm ), root );
+
 	bli_l3_thrinfo_grow( root, rntm, cntl );
 
 	return root;
@@ -102,6 +110,242 @@ void bli_l3_thrinfo_grow
 
 // -----------------------------------------------------------------------------
 
+// The sets of trees kept for reuse, most recently used first, and the mutex
+// that protects them.
+static l3_thrinfo_cache_t*  l3_thrinfo_cache_head = NULL;
+static dim_t                l3_thrinfo_cache_len  = 0;
+static bli_pthread_mutex_t  l3_thrinfo_cache_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// Return whether a tree built by bli_l3_thrinfo_grow() for nt threads has
+// the shape that the given control tree and rntm_t would now produce. This
+// only looks at the n_way fields, since the communicator of the root is
+// stale while the tree sits in the cache.
+static bool bli_l3_thrinfo_matches
+     (
+       const thrinfo_t* thread,
+             dim_t      nt,
+       const rntm_t*    rntm,
+       const cntl_t*    cntl
+     )
+{
+	if ( bli_cntl_is_leaf( cntl ) )
+	{
+		const thrinfo_t* thread_sub = bli_thrinfo_sub_node( 0, thread );
+
+		return thread_sub != NULL && bli_thrinfo_n_way( thread_sub ) == nt;
+	}
+
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+	{
+		const cntl_t*    sub_node   = bli_cntl_sub_node( i, cntl );
+		const thrinfo_t* thread_sub = bli_thrinfo_sub_node( i, thread );
+
+		if ( sub_node == NULL ) return thread_sub == NULL;
+		if ( thread_sub == NULL ) return FALSE;
+
+		const dim_t n_way = bli_rntm_total_ways_for( bli_cntl_ways( i, cntl ), rntm );
+
+		if ( bli_thrinfo_n_way( thread_sub ) != n_way ||
+		     !bli_l3_thrinfo_matches( thread_sub, nt / n_way, rntm, sub_node ) )
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void bli_l3_thrinfo_cache_free
+     (
+       l3_thrinfo_cache_t* cache
+     )
+{
+	for ( dim_t i = 0; i < cache->nt; i++ )
+		bli_thrinfo_free( cache->roots[ i ] );
+
+	bli_sba_checkin_array( cache->array );
+	bli_free_intl( cache );
+}
+
+l3_thrinfo_cache_t* bli_l3_thrinfo_cache_checkout
+     (
+             timpl_t     ti,
+             dim_t       nt,
+       const rntm_t*     rntm,
+       const cntl_t*     cntl
+     )
+{
+	if ( BLIS_THRINFO_CACHE_SIZE <= 0 ) return NULL;
+
+	const bool   jrir_dyn = bli_rntm_jrir_dyn( rntm );
+	const tbar_t barrier  = bli_thrcomm_barrier_kind();
+	      dim_t  spin     = bli_rntm_barrier_spin( rntm );
+
+	if ( spin < 0 ) spin = BLIS_BARRIER_SPIN_COUNT;
+
+	// Look for a set of trees built with the same parameters and remove it
+	// from the cache.
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+
+	l3_thrinfo_cache_t** prev = &l3_thrinfo_cache_head;
+
+	for ( l3_thrinfo_cache_t* cache = *prev; cache != NULL; cache = *prev )
+	{
+		if ( cache->ti == ti && cache->nt == nt &&
+		     cache->jrir_dyn == jrir_dyn && cache->barrier == barrier &&
+		     cache->spin == spin &&
+		     bli_l3_thrinfo_matches( cache->roots[ 0 ], nt, rntm, cntl ) )
+		{
+			*prev = cache->next;
+			l3_thrinfo_cache_len--;
+
+			bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+
+			return cache;
+		}
+
+		prev = &cache->next;
+	}
+
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+
+	// Otherwise, start a new set. Its trees are built by the threads of the
+	// operation as usual (see bli_l3_thrinfo_cache_get()).
+	err_t r_val;
+	l3_thrinfo_cache_t* cache = bli_malloc_intl( sizeof( l3_thrinfo_cache_t ) +
+	                                             nt * sizeof( thrinfo_t* ), &r_val );
+
+	cache->ti       = ti;
+	cache->nt       = nt;
+	cache->jrir_dyn = jrir_dyn;
+	cache->barrier  = barrier;
+	cache->spin     = spin;
+	cache->array    = bli_sba_checkout_array( nt );
+	cache->roots    = ( thrinfo_t** )( cache + 1 );
+	cache->discard  = FALSE;
+	cache->next     = NULL;
+
+	for ( dim_t i = 0; i < nt; i++ ) cache->roots[ i ] = NULL;
+
+	return cache;
+}
+
+void bli_l3_thrinfo_cache_checkin
+     (
+       l3_thrinfo_cache_t* cache
+     )
+{
+	if ( cache->discard )
+	{
+		bli_l3_thrinfo_cache_free( cache );
+		return;
+	}
+
+	// All threads of the operation have returned, so the trees can be reset
+	// without synchronization.
+	for ( dim_t i = 0; i < cache->nt; i++ )
+		bli_thrinfo_reset( cache->roots[ i ] );
+
+	l3_thrinfo_cache_t* evicted = NULL;
+
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+
+	cache->next = l3_thrinfo_cache_head;
+	l3_thrinfo_cache_head = cache;
+	l3_thrinfo_cache_len++;
+
+	// Evict the least recently used set if the cache is over capacity.
+	if ( BLIS_THRINFO_CACHE_SIZE < l3_thrinfo_cache_len )
+	{
+		l3_thrinfo_cache_t** prev = &l3_thrinfo_cache_head;
+
+		while ( ( *prev )->next != NULL ) prev = &( *prev )->next;
+
+		evicted = *prev;
+		*prev   = NULL;
+		l3_thrinfo_cache_len--;
+	}
+
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+
+	if ( evicted != NULL ) bli_l3_thrinfo_cache_free( evicted );
+}
+
+void bli_l3_thrinfo_cache_finalize( void )
+{
+	bli_pthread_mutex_lock( &l3_thrinfo_cache_mutex );
+
+	while ( l3_thrinfo_cache_head != NULL )
+	{
+		l3_thrinfo_cache_t* cache = l3_thrinfo_cache_head;
+
+		l3_thrinfo_cache_head = cache->next;
+		bli_l3_thrinfo_cache_free( cache );
+	}
+
+	l3_thrinfo_cache_len = 0;
+
+	bli_pthread_mutex_unlock( &l3_thrinfo_cache_mutex );
+}
+
+thrinfo_t* bli_l3_thrinfo_cache_get
+     (
+             dim_t               id,
+             thrcomm_t*          gl_comm,
+             l3_thrinfo_cache_t* cache,
+             array_t*            array,
+       const rntm_t*             rntm,
+       const cntl_t*             cntl
+     )
+{
+	if ( cache == NULL )
+		return bli_l3_thrinfo_create( id, gl_comm, array, rntm, cntl );
+
+	// If fewer threads were launched than requested (which can happen with
+	// OpenMP; see bli_l3_thread_decorator_thread_check()), the tree built
+	// for this call does not fit the set, which is then dropped.
+	if ( bli_thrcomm_num_threads( gl_comm ) != cache->nt )
+	{
+		cache->discard = TRUE;
+		return bli_l3_thrinfo_create( id, gl_comm, cache->array, rntm, cntl );
+	}
+
+	thrinfo_t* root = cache->roots[ id ];
+
+	if ( root == NULL )
+	{
+		root = bli_l3_thrinfo_create( id, gl_comm, cache->array, rntm, cntl );
+		cache->roots[ id ] = root;
+	}
+	else
+	{
+		// The communicators below the root kept their spin budget, which is
+		// part of the cache key; only the global communicator is new.
+		bli_thrcomm_set_spin( bli_rntm_barrier_spin( rntm ), gl_comm );
+		bli_thrinfo_set_root_comm( gl_comm, root );
+	}
+
+	return root;
+}
+
+void bli_l3_thrinfo_cache_put
+     (
+       thrinfo_t*          thread,
+       l3_thrinfo_cache_t* cache
+     )
+{
+	// Trees that belong to the cache are reset when the set is checked back
+	// in, once every thread has returned.
+	if ( cache != NULL && !cache->discard ) return;
+
+	// NOTE: The barrier here is very important as it prevents memory being
+	// released by the chief of some thread sub-group before its peers are done
+	// using it. See PR #702 for more info [1].
+	// [1] https://github.com/flame/blis/pull/702
+	bli_thrinfo_barrier( thread );
+	bli_thrinfo_free( thread );
+}
+
+// -----------------------------------------------------------------------------
+
 thrinfo_t* bli_l3_sup_thrinfo_create
      (
              dim_t      id,
@@ -110,6 +354,9 @@ thrinfo_t* bli_l3_sup_thrinfo_create
        const rntm_t*    rntm
      )
 {
+	// Apply the barrier spin budget requested by the rntm_t.
+	bli_thrcomm_set_spin( bli_rntm_barrier_spin( rntm ), gl_comm );
+
 	// Create the root thrinfo_t node.
 	thrinfo_t* root = bli_thrinfo_create_root
 	(
@@ -122,8 +369,14 @@ thrinfo_t* bli_l3_sup_thrinfo_create
 	const dim_t n_way_jc = bli_rntm_ways_for( BLIS_NC, rntm );
 	const dim_t n_way_pc = bli_rntm_ways_for( BLIS_KC, rntm );
 	const dim_t n_way_ic = bli_rntm_ways_for( BLIS_MC, rntm );
-	const dim_t n_way_jr = bli_rntm_ways_for( BLIS_NR, rntm );
-	const dim_t n_way_ir = bli_rntm_ways_for( BLIS_MR, rntm );
+
+	// The sup variants only partition the jr loop among the threads of an ic
+	// group (the ir loop is inside the millikernel), so any ways requested
+	// for the ir loop are folded into the jr loop. Otherwise, the threads
+	// of each ir group would all compute the same microtiles.
+	const dim_t n_way_jr = bli_rntm_ways_for( BLIS_NR, rntm ) *
+	                       bli_rntm_ways_for( BLIS_MR, rntm );
+	const dim_t n_way_ir = 1;
 
 	thrinfo_t* thread_jc = bli_thrinfo_split( n_way_jc,      root );
 	thrinfo_t* thread_pc = bli_thrinfo_split( n_way_pc, thread_jc );
@@ -86,6 +86,65 @@ void bli_l3_thrinfo_grow
        const cntl_t*    cntl
      );
 
+// -----------------------------------------------------------------------------
+
+// A set of thrinfo_t trees, one per thread, kept between level-3 operations.
+// Building the trees splits the global communicator into the communicators
+// of every loop, which costs several barriers and small allocations per
+// level. A later operation that would build identical trees instead checks
+// the set out of the cache and only needs to attach its global communicator
+// to the roots.
+typedef struct l3_thrinfo_cache_s
+{
+	// The parameters that determine the trees, besides the control tree.
+	timpl_t     ti;
+	dim_t       nt;
+	bool        jrir_dyn;
+	tbar_t      barrier;
+	dim_t       spin;
+
+	// The sba array from which the nodes of the trees were allocated, and
+	// the root of each thread's tree (NULL until it has been built).
+	array_t*    array;
+	thrinfo_t** roots;
+
+	// Set if the trees cannot be kept after the current operation.
+	bool        discard;
+
+	struct l3_thrinfo_cache_s* next;
+} l3_thrinfo_cache_t;
+
+l3_thrinfo_cache_t* bli_l3_thrinfo_cache_checkout
+     (
+             timpl_t     ti,
+             dim_t       nt,
+       const rntm_t*     rntm,
+       const cntl_t*     cntl
+     );
+
+void bli_l3_thrinfo_cache_checkin
+     (
+       l3_thrinfo_cache_t* cache
+     );
+
+void bli_l3_thrinfo_cache_finalize( void );
+
+thrinfo_t* bli_l3_thrinfo_cache_get
+     (
+             dim_t               id,
+             thrcomm_t*          gl_comm,
+             l3_thrinfo_cache_t* cache,
+             array_t*            array,
+       const rntm_t*             rntm,
+       const cntl_t*             cntl
+     );
+
+void bli_l3_thrinfo_cache_put
+     (
+       thrinfo_t*          thread,
+       l3_thrinfo_cache_t* cache
+     );
+
 thrinfo_t* bli_l3_sup_thrinfo_create
      (
              dim_t      id,
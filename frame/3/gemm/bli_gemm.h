@@ -32,6 +32,11 @@
 
 */
 
+#include "bli_gemm_epi.h"
 #include "bli_gemm_cntl.h"
 
 #include "bli_gemm_var.h"
+
+#include "bli_gemm_batch.h"
+#include "bli_gemm_pack.h"
+#include "bli_gemm_lp.h"
@@ -0,0 +1,662 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Define the batched gemm engine.
+//
+
+typedef struct
+{
+	      dim_t             batch_size;
+	      gemm_batch_get_ft get;
+	const void*             params;
+	const cntx_t*           cntx;
+	const rntm_t*           rntm;
+	      dim_t*            next;
+} gemm_batch_params_t;
+
+static bool bli_gemm_batch_is_coop
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* c
+     )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// If alpha is zero, all that is left to do is to scale C by beta (see
+	// bli_l3_return_early_if_trivial()), which is left to a single thread.
+	return BLIS_GEMM_BATCH_COOP_MNK <= m * n * k &&
+	       !bli_obj_equals( alpha, &BLIS_ZERO );
+}
+
+static void bli_gemm_batch_thread_entry
+     (
+             thrcomm_t* gl_comm,
+             dim_t      tid,
+       const void*      params_void
+     )
+{
+	const gemm_batch_params_t* params = params_void;
+
+	while ( TRUE )
+	{
+		// Claim the next problem that no other thread has claimed yet.
+		const dim_t i = __atomic_fetch_add( params->next, 1, __ATOMIC_RELAXED );
+
+		if ( params->batch_size <= i ) break;
+
+		obj_t alpha, a, b, beta, c;
+		params->get( i, params->params, &alpha, &a, &b, &beta, &c );
+
+		// Large problems are skipped here and executed by all threads once
+		// the small problems are finished.
+		if ( bli_gemm_batch_is_coop( &alpha, &a, &c ) ) continue;
+
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c, params->cntx, params->rntm );
+	}
+}
+
+void bli_gemm_batch_int
+     (
+             dim_t             batch_size,
+             gemm_batch_get_ft get,
+       const void*             params,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     )
+{
+	if ( batch_size < 1 ) return;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	rntm_t rntm_l;
+	if ( rntm != NULL ) rntm_l = *rntm;
+	else bli_rntm_init_from_global( &rntm_l );
+
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( ti == BLIS_SINGLE ) nt = 1;
+
+	// If there is nothing to distribute, execute the problems one after the
+	// other with whatever parallelism was requested.
+	if ( nt == 1 || batch_size == 1 )
+	{
+		for ( dim_t i = 0; i < batch_size; i++ )
+		{
+			obj_t alpha, a, b, beta, c;
+			get( i, params, &alpha, &a, &b, &beta, &c );
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, cntx, &rntm_l );
+		}
+
+		return;
+	}
+
+	// Small problems are executed in their entirety by a single thread, with
+	// the threads claiming problems dynamically. Since the problems of a
+	// group share their dimensions, all of them are executed with the same
+	// rntm_t: one that requests a single thread for small problems, and the
+	// caller's for large ones. If there are fewer problems than threads, only
+	// as many threads are launched as there are problems.
+	rntm_t rntm_s = rntm_l;
+	bli_rntm_set_thread_impl_only( BLIS_SINGLE, &rntm_s );
+	bli_rntm_set_num_threads_only( 1, &rntm_s );
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_s );
+	bli_rntm_set_auto_factor_only( FALSE, &rntm_s );
+	bli_rntm_clear_affinity( &rntm_s );
+
+	dim_t next = 0;
+
+	gemm_batch_params_t params_l;
+	params_l.batch_size = batch_size;
+	params_l.get        = get;
+	params_l.params     = params;
+	params_l.cntx       = cntx;
+	params_l.rntm       = &rntm_s;
+	params_l.next       = &next;
+
+	bli_thread_launch( ti, bli_min( nt, batch_size ),
+	                   bli_gemm_batch_thread_entry, &params_l );
+
+	// Large problems are then executed one at a time, with all threads
+	// cooperating on each of them via the level-3 thread decorator.
+	for ( dim_t i = 0; i < batch_size; i++ )
+	{
+		obj_t alpha, a, b, beta, c;
+		get( i, params, &alpha, &a, &b, &beta, &c );
+
+		if ( !bli_gemm_batch_is_coop( &alpha, &a, &c ) ) continue;
+
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c, cntx, &rntm_l );
+	}
+}
+
+dim_t bli_gemm_batch_find_group
+     (
+             dim_t  i,
+             dim_t  group_count,
+       const dim_t* group_offs
+     )
+{
+	// Binary search for the group g such that
+	//   group_offs[ g ] <= i < group_offs[ g + 1 ].
+	dim_t lo = 0;
+	dim_t hi = group_count - 1;
+
+	while ( lo < hi )
+	{
+		const dim_t mid = lo + ( hi - lo + 1 ) / 2;
+
+		if ( group_offs[ mid ] <= i ) lo = mid;
+		else                          hi = mid - 1;
+	}
+
+	return lo;
+}
+
+//
+// Define the strided batched gemm engine.
+//
+
+typedef struct
+{
+	const obj_t* alpha;
+	const obj_t* a; inc_t stride_a;
+	const obj_t* b; inc_t stride_b;
+	const obj_t* beta;
+	const obj_t* c; inc_t stride_c;
+} gemm_batch_strided_params_t;
+
+static void bli_gemm_batch_strided_alias
+     (
+             dim_t  i,
+       const obj_t* x,
+             inc_t  stride,
+             obj_t* xi
+     )
+{
+	bli_obj_alias_to( x, xi );
+	bli_obj_set_buffer( ( char* )bli_obj_buffer( x ) +
+	                    i * stride * bli_obj_elem_size( x ), xi );
+}
+
+static void bli_gemm_batch_strided_get
+     (
+             dim_t  i,
+       const void*  params_void,
+             obj_t* alpha,
+             obj_t* a,
+             obj_t* b,
+             obj_t* beta,
+             obj_t* c
+     )
+{
+	const gemm_batch_strided_params_t* params = params_void;
+
+	bli_obj_alias_to( params->alpha, alpha );
+	bli_obj_alias_to( params->beta,  beta );
+
+	bli_gemm_batch_strided_alias( i, params->a, params->stride_a, a );
+	bli_gemm_batch_strided_alias( i, params->b, params->stride_b, b );
+	bli_gemm_batch_strided_alias( i, params->c, params->stride_c, c );
+}
+
+void bli_gemm_batch_strided_int
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	// The problems of a strided batch form a single group, so they are
+	// either all executed by single threads or all executed cooperatively.
+	gemm_batch_strided_params_t params;
+	params.alpha    = alpha;
+	params.a        = a;
+	params.stride_a = stride_a;
+	params.b        = b;
+	params.stride_b = stride_b;
+	params.beta     = beta;
+	params.c        = c;
+	params.stride_c = stride_c;
+
+	bli_gemm_batch_int
+	(
+	  batch_size,
+	  bli_gemm_batch_strided_get,
+	  &params,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// Define object-based interfaces (basic and expert).
+//
+
+typedef struct
+{
+	const obj_t* alpha;
+	const obj_t* a;
+	const obj_t* b;
+	const obj_t* beta;
+	const obj_t* c;
+} gemm_batch_obj_params_t;
+
+static void bli_gemm_batch_obj_get
+     (
+             dim_t  i,
+       const void*  params_void,
+             obj_t* alpha,
+             obj_t* a,
+             obj_t* b,
+             obj_t* beta,
+             obj_t* c
+     )
+{
+	const gemm_batch_obj_params_t* params = params_void;
+
+	bli_obj_alias_to( &params->alpha[ i ], alpha );
+	bli_obj_alias_to( &params->a[ i ],     a );
+	bli_obj_alias_to( &params->b[ i ],     b );
+	bli_obj_alias_to( &params->beta[ i ],  beta );
+	bli_obj_alias_to( &params->c[ i ],     c );
+}
+
+void bli_gemm_batch
+     (
+             dim_t  batch_size,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* b,
+       const obj_t* beta,
+       const obj_t* c
+     )
+{
+	bli_gemm_batch_ex( batch_size, alpha, a, b, beta, c, NULL, NULL );
+}
+
+void PASTEMAC(gemm_batch,BLIS_OAPI_EX_SUF)
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	gemm_batch_obj_params_t params;
+	params.alpha = alpha;
+	params.a     = a;
+	params.b     = b;
+	params.beta  = beta;
+	params.c     = c;
+
+	bli_gemm_batch_int( batch_size, bli_gemm_batch_obj_get, &params, cntx, rntm );
+}
+
+void bli_gemm_batch_strided
+     (
+             dim_t  batch_size,
+       const obj_t* alpha,
+       const obj_t* a, inc_t stride_a,
+       const obj_t* b, inc_t stride_b,
+       const obj_t* beta,
+       const obj_t* c, inc_t stride_c
+     )
+{
+	bli_gemm_batch_strided_ex
+	(
+	  batch_size,
+	  alpha,
+	  a, stride_a,
+	  b, stride_b,
+	  beta,
+	  c, stride_c,
+	  NULL,
+	  NULL
+	);
+}
+
+void PASTEMAC(gemm_batch_strided,BLIS_OAPI_EX_SUF)
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	bli_gemm_batch_strided_int
+	(
+	  batch_size,
+	  alpha,
+	  a, stride_a,
+	  b, stride_b,
+	  beta,
+	  c, stride_c,
+	  cntx,
+	  rntm
+	);
+}
+
+//
+// Define BLAS-like interfaces with typed operands (basic and expert).
+//
+
+typedef struct
+{
+	      dim_t          group_count;
+	const dim_t*         group_offs;
+	const trans_t*       transa;
+	const trans_t*       transb;
+	const dim_t*         m;
+	const dim_t*         n;
+	const dim_t*         k;
+	const void*          alpha;
+	const void* const*   a; const inc_t* rs_a; const inc_t* cs_a;
+	const void* const*   b; const inc_t* rs_b; const inc_t* cs_b;
+	const void*          beta;
+	      void* const*   c; const inc_t* rs_c; const inc_t* cs_c;
+} gemm_batch_typed_params_t;
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname,_get) \
+     ( \
+             dim_t  i, \
+       const void*  params_void, \
+             obj_t* alpha, \
+             obj_t* a, \
+             obj_t* b, \
+             obj_t* beta, \
+             obj_t* c  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	const gemm_batch_typed_params_t* params = params_void; \
+\
+	const dim_t g = bli_gemm_batch_find_group( i, params->group_count, \
+	                                              params->group_offs ); \
+\
+	const trans_t transa = params->transa[ g ]; \
+	const trans_t transb = params->transb[ g ]; \
+	const dim_t   m      = params->m[ g ]; \
+	const dim_t   n      = params->n[ g ]; \
+	const dim_t   k      = params->k[ g ]; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_init_finish_1x1( dt, ( ctype* )params->alpha + g, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( ctype* )params->beta  + g, &betao  ); \
+\
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )params->a[ i ], \
+	                     params->rs_a[ g ], params->cs_a[ g ], &ao ); \
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )params->b[ i ], \
+	                     params->rs_b[ g ], params->cs_b[ g ], &bo ); \
+	bli_obj_init_finish( dt, m,   n,            params->c[ i ], \
+	                     params->rs_c[ g ], params->cs_c[ g ], &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	*alpha = alphao; \
+	*a     = ao; \
+	*b     = bo; \
+	*beta  = betao; \
+	*c     = co; \
+} \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t          group_count, \
+       const dim_t*         group_size, \
+       const trans_t*       transa, \
+       const trans_t*       transb, \
+       const dim_t*         m, \
+       const dim_t*         n, \
+       const dim_t*         k, \
+       const ctype*         alpha, \
+       const ctype* const*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype* const*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*         beta, \
+             ctype* const*  c, const inc_t* rs_c, const inc_t* cs_c  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  group_count, group_size, \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             dim_t          group_count, \
+       const dim_t*         group_size, \
+       const trans_t*       transa, \
+       const trans_t*       transb, \
+       const dim_t*         m, \
+       const dim_t*         n, \
+       const dim_t*         k, \
+       const ctype*         alpha, \
+       const ctype* const*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype* const*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*         beta, \
+             ctype* const*  c, const inc_t* rs_c, const inc_t* cs_c, \
+       const cntx_t*        cntx, \
+       const rntm_t*        rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	if ( group_count < 1 ) return; \
+\
+	/* Compute the index of the first problem of each group so that the
+	   group to which any given problem belongs can be found quickly. */ \
+	err_t  r_val; \
+	dim_t* group_offs = bli_malloc_intl( ( group_count + 1 ) * sizeof( dim_t ), \
+	                                     &r_val ); \
+\
+	group_offs[ 0 ] = 0; \
+	for ( dim_t g = 0; g < group_count; g++ ) \
+		group_offs[ g + 1 ] = group_offs[ g ] + group_size[ g ]; \
+\
+	gemm_batch_typed_params_t params; \
+	params.group_count = group_count; \
+	params.group_offs  = group_offs; \
+	params.transa      = transa; \
+	params.transb      = transb; \
+	params.m           = m; \
+	params.n           = n; \
+	params.k           = k; \
+	params.alpha       = alpha; \
+	params.a           = ( const void* const* )a; \
+	params.rs_a        = rs_a; \
+	params.cs_a        = cs_a; \
+	params.b           = ( const void* const* )b; \
+	params.rs_b        = rs_b; \
+	params.cs_b        = cs_b; \
+	params.beta        = beta; \
+	params.c           = ( void* const* )c; \
+	params.rs_c        = rs_c; \
+	params.cs_c        = cs_c; \
+\
+	bli_gemm_batch_int \
+	( \
+	  group_offs[ group_count ], \
+	  PASTEMAC(ch,opname,_get), \
+	  &params, \
+	  cntx, \
+	  rntm  \
+	); \
+\
+	bli_free_intl( group_offs ); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype*   alpha, \
+       const ctype*   a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*   b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*   beta, \
+             ctype*   c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t    batch_size  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, stride_a, \
+	  b, rs_b, cs_b, stride_b, \
+	  beta, \
+	  c, rs_c, cs_c, stride_c, \
+	  batch_size, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype*   alpha, \
+       const ctype*   a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*   b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*   beta, \
+             ctype*   c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t    batch_size, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_init_finish_1x1( dt, ( void* )alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( void* )beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )b, rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m,   n,            c, rs_c, cs_c, &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemm_batch_strided_int \
+	( \
+	  batch_size, \
+	  &alphao, \
+	  &ao, stride_a, \
+	  &bo, stride_b, \
+	  &betao, \
+	  &co, stride_c, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_batch_strided )
+
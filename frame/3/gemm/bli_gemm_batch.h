@@ -0,0 +1,211 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype the function type used to query the problems of a batch.
+//
+
+// The batched gemm engine only needs to be able to materialize the operands
+// of the i-th problem of a batch as objects. Each front-end describes its
+// batch in its own way (an array of objects, groups of typed operands, etc.)
+// and provides a function of this type to translate index i into objects.
+
+typedef void (*gemm_batch_get_ft)
+     (
+             dim_t  i,
+       const void*  params,
+             obj_t* alpha,
+             obj_t* a,
+             obj_t* b,
+             obj_t* beta,
+             obj_t* c
+     );
+
+void bli_gemm_batch_int
+     (
+             dim_t             batch_size,
+             gemm_batch_get_ft get,
+       const void*             params,
+       const cntx_t*           cntx,
+       const rntm_t*           rntm
+     );
+
+dim_t bli_gemm_batch_find_group
+     (
+             dim_t  i,
+             dim_t  group_count,
+       const dim_t* group_offs
+     );
+
+void bli_gemm_batch_strided_int
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+//
+// Prototype object-based interfaces (basic and expert).
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_batch
+     (
+             dim_t  batch_size,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* b,
+       const obj_t* beta,
+       const obj_t* c
+     );
+
+BLIS_EXPORT_BLIS void PASTEMAC(gemm_batch,BLIS_OAPI_EX_SUF)
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_batch_strided
+     (
+             dim_t  batch_size,
+       const obj_t* alpha,
+       const obj_t* a, inc_t stride_a,
+       const obj_t* b, inc_t stride_b,
+       const obj_t* beta,
+       const obj_t* c, inc_t stride_c
+     );
+
+BLIS_EXPORT_BLIS void PASTEMAC(gemm_batch_strided,BLIS_OAPI_EX_SUF)
+     (
+             dim_t   batch_size,
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             dim_t          group_count, \
+       const dim_t*         group_size, \
+       const trans_t*       transa, \
+       const trans_t*       transb, \
+       const dim_t*         m, \
+       const dim_t*         n, \
+       const dim_t*         k, \
+       const ctype*         alpha, \
+       const ctype* const*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype* const*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*         beta, \
+             ctype* const*  c, const inc_t* rs_c, const inc_t* cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             dim_t          group_count, \
+       const dim_t*         group_size, \
+       const trans_t*       transa, \
+       const trans_t*       transb, \
+       const dim_t*         m, \
+       const dim_t*         n, \
+       const dim_t*         k, \
+       const ctype*         alpha, \
+       const ctype* const*  a, const inc_t* rs_a, const inc_t* cs_a, \
+       const ctype* const*  b, const inc_t* rs_b, const inc_t* cs_b, \
+       const ctype*         beta, \
+             ctype* const*  c, const inc_t* rs_c, const inc_t* cs_c, \
+       const cntx_t*        cntx, \
+       const rntm_t*        rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_batch )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype*   alpha, \
+       const ctype*   a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*   b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*   beta, \
+             ctype*   c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t    batch_size  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype*   alpha, \
+       const ctype*   a, inc_t rs_a, inc_t cs_a, inc_t stride_a, \
+       const ctype*   b, inc_t rs_b, inc_t cs_b, inc_t stride_b, \
+       const ctype*   beta, \
+             ctype*   c, inc_t rs_c, inc_t cs_c, inc_t stride_c, \
+             dim_t    batch_size, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_batch_strided )
+
@@ -60,12 +60,43 @@ void bli_gemm_blk_var3
 	// Query dimension in partitioning direction.
 	dim_t k_trans = bli_obj_width_after_trans( &ap );
 
+	// Determine the current thread group's subpartition range. If the pc loop
+	// is being parallelized, each thread group accumulates its partial
+	// product into a private copy of C (except for the first group, which
+	// updates C directly), and the copies are reduced into C at the end.
+	const dim_t n_way   = bli_thrinfo_n_way( thread );
+	const dim_t work_id = bli_thrinfo_work_id( thread );
+	const dim_t bf      = bli_part_cntl_blksz_mult( cntl );
+
+	dim_t my_start, my_end;
+	bli_gemm_blk_var3_range( work_id, n_way, k_trans, bf, &my_start, &my_end );
+
+	mem_t mem_c = BLIS_MEM_INITIALIZER;
+	inc_t ps_cw = 0;
+	obj_t cr;
+
+	if ( 1 < n_way )
+	{
+		// Save an alias to C for use during the reduction.
+		bli_obj_alias_to( &cs, &cr );
+
+		bli_gemm_blk_var3_acquire_c( n_way, &cr, &mem_c, &ps_cw, thread_par );
+
+		// Thread groups other than the first compute into their own copy
+		// of C, with a beta of zero.
+		if ( work_id != 0 )
+		{
+			bli_gemm_blk_var3_alias_c( work_id, &mem_c, ps_cw, &cr, &cs );
+			bli_obj_scalar_apply_scalar( &BLIS_ZERO, &cs );
+		}
+	}
+
 	// Partition along the k dimension.
 	dim_t b_alg;
-	for ( dim_t i = 0; i < k_trans; i += b_alg )
+	for ( dim_t i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize( direct, i, k_trans,
+		b_alg = bli_determine_blocksize( direct, i, my_end,
 		                                 bli_part_cntl_blksz_alg( cntl ),
 		                                 bli_part_cntl_blksz_max( cntl ) );
 
@@ -76,6 +107,13 @@ void bli_gemm_blk_var3
 		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
 		                        i, b_alg, &bp, &b1 );
 
+		// Mark whether more rank-k updates to C will follow this one, so
+		// that the macrokernel knows whether the final value of C (to which
+		// an epilogue may be applied) is computed during this iteration.
+		// When the pc loop is parallelized, the final value of C is not
+		// known until after the reduction.
+		bli_obj_set_pending_updates( 1 < n_way || i + b_alg < my_end, &cs );
+
 		// Perform gemm subproblem.
 		bli_l3_int
 		(
@@ -107,9 +145,169 @@ void bli_gemm_blk_var3
 		// row-panel of C, and thus beta is applied to all of C exactly once.
 		// Thus, for neither trmm nor trmm3 should we reset the scalar on C
 		// after the first iteration.
-		if ( i == 0 && !bli_obj_is_triangular( a ) &&
-		               !bli_obj_is_triangular( b ) )
+		if ( i == my_start && !bli_obj_is_triangular( a ) &&
+		                      !bli_obj_is_triangular( b ) )
 		    bli_obj_scalar_reset( &cs );
 	}
+
+	if ( 1 < n_way )
+	{
+		// Wait for all thread groups to finish computing their partial
+		// products, then reduce them into C.
+		bli_thrinfo_barrier( thread_par );
+
+		bli_gemm_blk_var3_reduce( n_way, k_trans, bf, &mem_c, ps_cw, &cr,
+		                          thread_par );
+
+		// Wait for the reduction to complete before releasing the buffer.
+		bli_thrinfo_barrier( thread_par );
+
+		if ( bli_thrinfo_am_chief( thread_par ) )
+			bli_pba_release( bli_thrinfo_pba( thread_par ), &mem_c );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_blk_var3_range
+     (
+       dim_t  work_id,
+       dim_t  n_way,
+       dim_t  k,
+       dim_t  bf,
+       dim_t* start,
+       dim_t* end
+     )
+{
+	// If the k dimension is too small to give every thread group at least
+	// one unit of work, assign all of it to the first group. Otherwise, the
+	// first group (which is responsible for applying beta to C) could end
+	// up with an empty range.
+	if ( n_way == 1 || k < n_way * bf )
+	{
+		*start = 0;
+		*end   = ( work_id == 0 ? k : 0 );
+		return;
+	}
+
+	bli_thread_range_sub( work_id, n_way, k, bf, FALSE, start, end );
+}
+
+void bli_gemm_blk_var3_acquire_c
+     (
+             dim_t      n_way,
+       const obj_t*     c,
+             mem_t*     mem,
+             inc_t*     ps,
+             thrinfo_t* thread_par
+     )
+{
+	const dim_t m       = bli_obj_length( c );
+	const dim_t n       = bli_obj_width( c );
+	const siz_t dt_size = bli_obj_elem_size( c );
+
+	// Pad each copy of C so that it begins on a cache line boundary.
+	const siz_t align   = BLIS_CACHE_LINE_SIZE / dt_size;
+	      inc_t ps_c    = ( m * n + align - 1 ) / align * align;
+
+	// The chief of the parent thread group acquires one block large enough
+	// to hold a copy of C for each thread group except the first.
+	void* buf = NULL;
+	if ( bli_thrinfo_am_chief( thread_par ) )
+	{
+		bli_pba_acquire_m
+		(
+		  bli_thrinfo_pba( thread_par ),
+		  ( n_way - 1 ) * ps_c * dt_size,
+		  BLIS_BUFFER_FOR_C_PANEL,
+		  mem
+		);
+		buf = bli_mem_buffer( mem );
+	}
+
+	buf = bli_thrinfo_broadcast( thread_par, buf );
+
+	// Only the chief needs the full mem_t (to release the block later). The
+	// other threads only need the buffer address.
+	if ( !bli_thrinfo_am_chief( thread_par ) )
+		bli_mem_set_buffer( buf, mem );
+
+	*ps = ps_c;
+}
+
+void bli_gemm_blk_var3_alias_c
+     (
+             dim_t  work_id,
+       const mem_t* mem,
+             inc_t  ps,
+       const obj_t* c,
+             obj_t* cw
+     )
+{
+	const dim_t m       = bli_obj_length( c );
+	const dim_t n       = bli_obj_width( c );
+	const siz_t dt_size = bli_obj_elem_size( c );
+
+	char* buf = ( char* )bli_mem_buffer( mem ) + ( work_id - 1 ) * ps * dt_size;
+
+	// Store the copy with the same orientation as C so that the microkernel
+	// accesses it in its preferred manner.
+	inc_t rs, cs;
+	if ( bli_obj_is_row_tilted( c ) ) { rs = n; cs = 1; }
+	else                              { rs = 1; cs = m; }
+
+	bli_obj_alias_to( c, cw );
+	bli_obj_set_buffer( buf, cw );
+	bli_obj_set_strides( rs, cs, cw );
+	bli_obj_set_offs( 0, 0, cw );
 }
 
+void bli_gemm_blk_var3_reduce
+     (
+             dim_t      n_way,
+             dim_t      k,
+             dim_t      bf,
+       const mem_t*     mem,
+             inc_t      ps,
+       const obj_t*     c,
+             thrinfo_t* thread_par
+     )
+{
+	const dim_t nt  = bli_thrinfo_num_threads( thread_par );
+	const dim_t tid = bli_thrinfo_thread_id( thread_par );
+
+	// Partition C among all threads in the parent group along the dimension
+	// with the larger stride so that each thread touches contiguous memory.
+	const bool  row_tilt = bli_obj_is_row_tilted( c );
+	const dim_t m_use    = row_tilt ? bli_obj_length( c ) : bli_obj_width( c );
+
+	dim_t start, end;
+	bli_thread_range_sub( tid, nt, m_use, 1, FALSE, &start, &end );
+
+	if ( start == end ) return;
+
+	obj_t c1;
+	if ( row_tilt )
+		bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1, start, end - start, c, &c1 );
+	else
+		bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1, start, end - start, c, &c1 );
+
+	for ( dim_t g = 1; g < n_way; ++g )
+	{
+		// Skip thread groups that were not assigned any part of the k
+		// dimension (and thus never wrote to their copy of C).
+		dim_t k_start, k_end;
+		bli_gemm_blk_var3_range( g, n_way, k, bf, &k_start, &k_end );
+		if ( k_start == k_end ) continue;
+
+		obj_t cw, cw1;
+		bli_gemm_blk_var3_alias_c( g, mem, ps, c, &cw );
+
+		if ( row_tilt )
+			bli_acquire_mpart_mdim( BLIS_FWD, BLIS_SUBPART1, start, end - start, &cw, &cw1 );
+		else
+			bli_acquire_mpart_ndim( BLIS_FWD, BLIS_SUBPART1, start, end - start, &cw, &cw1 );
+
+		bli_addm_ex( &cw1, &c1, NULL, NULL );
+	}
+}
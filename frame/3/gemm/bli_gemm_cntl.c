@@ -60,6 +60,7 @@ void bli_gemm_var_cntl_init_node
 	cntl->ukr      = ukr;
 	cntl->real_ukr = real_ukr;
 	cntl->row_pref = row_pref;
+	cntl->epi      = NULL;
 	cntl->mr       = mr;
 	cntl->nr       = nr;
 	cntl->mr_scale = mr_scale;
@@ -145,6 +146,12 @@ bool bli_gemm_cntl_init
 		needs_swap = row_pref;
 	}
 
+	// Operands that were packed ahead of time (see bli_gemm_pack()) are
+	// already laid out for use on a particular side of the operation, so
+	// we forgo the swap. This is only an optimization for plain gemm.
+	if ( bli_obj_is_panel_packed( a ) || bli_obj_is_panel_packed( b ) )
+		needs_swap = FALSE;
+
 	// Swap the A and B operands if required. This transforms the operation
 	// C = alpha A B + beta C into C^T = alpha B^T A^T + beta C^T.
 	if ( needs_swap )
@@ -391,6 +398,28 @@ bool bli_gemm_cntl_init
 		}
 	}
 
+	// Operands that were packed ahead of time must have been packed with the
+	// register blocksizes of the current context.
+	if ( bli_obj_is_panel_packed( a ) )
+	{
+		if ( bli_obj_panel_dim( a )  != mr_def / mr_scale ||
+		     bli_obj_col_stride( a ) != mr_pack / mr_pack_scale ||
+		     bli_obj_row_stride( a ) != mr_bcast ||
+		     bli_obj_pack_schema( a ) != schema_a ||
+		     bli_obj_dt( a ) != dt_ap )
+			bli_check_error_code( BLIS_INCOMPATIBLE_PACKED_OBJECT );
+	}
+
+	if ( bli_obj_is_panel_packed( b ) )
+	{
+		if ( bli_obj_panel_dim( b )  != nr_def / nr_scale ||
+		     bli_obj_row_stride( b ) != nr_pack / nr_pack_scale ||
+		     bli_obj_col_stride( b ) != nr_bcast ||
+		     bli_obj_pack_schema( b ) != schema_b ||
+		     bli_obj_dt( b ) != dt_bp )
+			bli_check_error_code( BLIS_INCOMPATIBLE_PACKED_OBJECT );
+	}
+
 	//printf("MR: %lld/%lld,  %lld/%lld\n", mr_def, mr_scale, mr_pack, mr_pack_scale);
 	//printf("NR: %lld/%lld,  %lld/%lld\n", nr_def, nr_scale, nr_pack, nr_pack_scale);
 
@@ -522,9 +551,20 @@ bool bli_gemm_cntl_init
 	  FALSE,
 	  &cntl->part_pc
 	);
+	// Parallelism in the pc loop is obtained by having each thread group
+	// accumulate into a private copy of C, which is then reduced into C
+	// (see bli_gemm_blk_var3()). This is currently only supported for gemm
+	// proper, and only if neither A nor B is triangular. For all other
+	// operations, any pc ways of parallelism are instead absorbed into the
+	// ir loop (see bli_l3_thrinfo_grow()).
+	const bool pc_par = family == BLIS_GEMM &&
+	                    !bli_obj_is_triangular( a ) &&
+	                    !bli_obj_is_triangular( b );
+
 	bli_cntl_attach_sub_node
 	(
-	  BLIS_THREAD_KC,
+	  pc_par ? BLIS_THREAD_KC
+	         : BLIS_THREAD_NONE,
 	  ( cntl_t* )&cntl->pack_b,
 	  ( cntl_t* )&cntl->part_pc
 	);
@@ -46,6 +46,7 @@ struct gemm_var_cntl_s
 	gemm_ukr_ft real_ukr;
 	const void* params;
 	const void* real_params;
+	const gemm_epi_params_t* epi;
 	dim_t       mr;
 	dim_t       nr;
 	dim_t       mr_scale;
@@ -81,6 +82,11 @@ BLIS_INLINE const void* bli_gemm_var_cntl_real_params( const cntl_t* cntl )
 	return ( ( const gemm_var_cntl_t* ) cntl )->real_params;
 }
 
+BLIS_INLINE const gemm_epi_params_t* bli_gemm_var_cntl_epi( const cntl_t* cntl )
+{
+	return ( ( const gemm_var_cntl_t* ) cntl )->epi;
+}
+
 BLIS_INLINE dim_t bli_gemm_var_cntl_mr( const cntl_t* cntl )
 {
 	return ( ( const gemm_var_cntl_t* ) cntl )->mr;
@@ -153,6 +159,11 @@ BLIS_INLINE void bli_gemm_var_cntl_set_real_params( const void* params, cntl_t*
 	( ( gemm_var_cntl_t* ) cntl )->real_params = params;
 }
 
+BLIS_INLINE void bli_gemm_var_cntl_set_epi( const gemm_epi_params_t* epi, cntl_t* cntl )
+{
+	( ( gemm_var_cntl_t* ) cntl )->epi = epi;
+}
+
 BLIS_INLINE void bli_gemm_var_cntl_set_mr( dim_t mr, cntl_t* cntl )
 {
 	( ( gemm_var_cntl_t* ) cntl )->mr = mr / ( ( gemm_var_cntl_t* ) cntl )->mr_scale;
@@ -381,6 +392,18 @@ BLIS_INLINE void bli_gemm_cntl_set_params( const void* params, gemm_cntl_t* cntl
 	}
 }
 
+BLIS_INLINE void bli_gemm_cntl_set_epi( const gemm_epi_params_t* epi, gemm_cntl_t* cntl )
+{
+	bli_gemm_var_cntl_set_epi( epi, ( cntl_t* )&cntl->ker );
+
+	// The epilogue may only be applied once the final value of C is known,
+	// which precludes accumulating partial products into private copies of
+	// C in the pc loop. Any pc ways of parallelism are instead absorbed into
+	// the ir loop.
+	if ( epi != NULL )
+		bli_cntl_set_ways( 0, BLIS_THREAD_NONE, ( cntl_t* )&cntl->part_pc );
+}
+
 BLIS_INLINE void bli_gemm_cntl_set_var( l3_var_oft var, gemm_cntl_t* cntl )
 {
 	bli_cntl_set_var_func( ( void_fp )var, ( cntl_t* )&cntl->ker );
@@ -471,3 +494,20 @@ BLIS_INLINE void bli_gemm_cntl_set_kc( const blksz_t* kc, gemm_cntl_t* cntl )
 	bli_part_cntl_set_blksz( kc, ( cntl_t* )&cntl->part_pc );
 }
 
+BLIS_INLINE void bli_gemm_cntl_set_kr( const blksz_t* kr, gemm_cntl_t* cntl )
+{
+	bli_packm_def_cntl_set_bmult_n( kr, ( cntl_t* )&cntl->pack_a );
+	bli_packm_def_cntl_set_bmult_n( kr, ( cntl_t* )&cntl->pack_b );
+	bli_part_cntl_set_blksz_mult( kr, ( cntl_t* )&cntl->part_pc );
+}
+
+BLIS_INLINE void bli_gemm_cntl_set_packa_elem_size( siz_t elem_size, gemm_cntl_t* cntl )
+{
+	bli_packm_def_cntl_set_pack_elem_size( elem_size, ( cntl_t* )&cntl->pack_a );
+}
+
+BLIS_INLINE void bli_gemm_cntl_set_packb_elem_size( siz_t elem_size, gemm_cntl_t* cntl )
+{
+	bli_packm_def_cntl_set_pack_elem_size( elem_size, ( cntl_t* )&cntl->pack_b );
+}
+
@@ -0,0 +1,486 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// -- Activation functions -----------------------------------------------------
+//
+
+// Apply the activation function and the clamp of an epilogue to an m x n
+// tile of a real matrix. The inner loop walks along the columns of the tile,
+// so the caller should transpose the tile if it is stored by rows.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, mfs ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+             dim_t              m, \
+             dim_t              n, \
+             ctype*    restrict c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_params_t* params  \
+     ) \
+{ \
+	const ctype half    = 0.5; \
+	const ctype one     = 1.0; \
+	const ctype zero    = 0.0; \
+	const ctype rsqrt2  = 0.70710678118654752440; /* 1/sqrt(2)    */ \
+	const ctype sqrt2pi = 0.79788456080286535588; /* sqrt(2/pi)   */ \
+	const ctype gcoef   = 0.044715; \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		ctype* restrict c1 = c + j*cs_c; \
+\
+		switch ( params->act ) \
+		{ \
+			case BLIS_EPI_ACT_RELU: \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				c1[ i*rs_c ] = ( x > zero ? x : zero ); \
+			} \
+			break; \
+\
+			case BLIS_EPI_ACT_GELU: \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				c1[ i*rs_c ] = half * x * ( one + PASTECH(erf,mfs)( x * rsqrt2 ) ); \
+			} \
+			break; \
+\
+			case BLIS_EPI_ACT_GELU_TANH: \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				ctype u = sqrt2pi * ( x + gcoef * x * x * x ); \
+				c1[ i*rs_c ] = half * x * ( one + PASTECH(tanh,mfs)( u ) ); \
+			} \
+			break; \
+\
+			case BLIS_EPI_ACT_SIGMOID: \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				c1[ i*rs_c ] = one / ( one + PASTECH(exp,mfs)( -x ) ); \
+			} \
+			break; \
+\
+			case BLIS_EPI_ACT_TANH: \
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				c1[ i*rs_c ] = PASTECH(tanh,mfs)( x ); \
+			} \
+			break; \
+\
+			default: \
+			break; \
+		} \
+\
+		if ( params->clamp ) \
+		{ \
+			const ctype lo = params->clamp_lo; \
+			const ctype hi = params->clamp_hi; \
+\
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype x = c1[ i*rs_c ]; \
+				c1[ i*rs_c ] = bli_min( bli_max( x, lo ), hi ); \
+			} \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, gemm_epi_act, f )
+GENTFUNC( double, d, gemm_epi_act, )
+
+// Activation functions and the clamp are not defined for complex matrices
+// (see bli_gemm_epi_check()).
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+             dim_t              m, \
+             dim_t              n, \
+             ctype*    restrict c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_params_t* params  \
+     ) \
+{ \
+	( void )m; ( void )n; ( void )c; ( void )rs_c; ( void )cs_c; ( void )params; \
+}
+
+GENTFUNC( scomplex, c, gemm_epi_act )
+GENTFUNC( dcomplex, z, gemm_epi_act )
+
+//
+// -- Epilogue kernels ---------------------------------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t                     m, \
+             dim_t                     n, \
+             void*                     c, inc_t rs_c, inc_t cs_c, \
+             dim_t                     off_m, \
+             dim_t                     off_n, \
+       const struct gemm_epi_params_s* params  \
+     ) \
+{ \
+	ctype* restrict c_cast = c; \
+\
+	const ctype* restrict scale = params->scale; \
+	const ctype* restrict bias  = params->bias; \
+\
+	/* Determine the strides through the scale and bias vectors along the
+	   m and n dimensions of the tile, and locate the elements that
+	   correspond to its top-left element. */ \
+	inc_t rs_s = 0, cs_s = 0; \
+	inc_t rs_b = 0, cs_b = 0; \
+\
+	if ( scale != NULL ) \
+	{ \
+		if ( params->scale_on_m ) { rs_s = params->inc_scale; scale += off_m * rs_s; } \
+		else                      { cs_s = params->inc_scale; scale += off_n * cs_s; } \
+	} \
+	if ( bias != NULL ) \
+	{ \
+		if ( params->bias_on_m ) { rs_b = params->inc_bias; bias += off_m * rs_b; } \
+		else                     { cs_b = params->inc_bias; bias += off_n * cs_b; } \
+	} \
+\
+	/* If the tile is stored by rows, transpose it so that the inner loops
+	   below have unit stride. */ \
+	if ( bli_abs( cs_c ) < bli_abs( rs_c ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_swap_incs( &rs_s, &cs_s ); \
+		bli_swap_incs( &rs_b, &cs_b ); \
+	} \
+\
+	if ( scale != NULL ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			bli_tscals( ch,ch,ch, scale[ i*rs_s + j*cs_s ], c_cast[ i*rs_c + j*cs_c ] ); \
+	} \
+\
+	if ( bias != NULL ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			bli_tadds( ch,ch,ch, bias[ i*rs_b + j*cs_b ], c_cast[ i*rs_c + j*cs_c ] ); \
+	} \
+\
+	if ( params->act != BLIS_EPI_ACT_NONE || params->clamp ) \
+		PASTEMAC(ch,gemm_epi_act)( m, n, c_cast, rs_c, cs_c, params ); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_epi_ker )
+
+static gemm_epi_ft GENARRAY(ftypes,gemm_epi_ker);
+
+//
+// -- Epilogue setup -----------------------------------------------------------
+//
+
+// Return whether the vector x holds one element per row of C (rather than
+// one element per column).
+static bool bli_gemm_epi_vector_is_on_m
+     (
+       const obj_t* x,
+       const obj_t* c
+     )
+{
+	return bli_obj_width_after_trans( x ) == 1 &&
+	       bli_obj_length_after_trans( x ) == bli_obj_length_after_trans( c );
+}
+
+static void bli_gemm_epi_check_vector
+     (
+       const obj_t* x,
+       const obj_t* c
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+
+	// The vector must either be a column vector with one element per row of
+	// C or a row vector with one element per column of C.
+	if ( !bli_gemm_epi_vector_is_on_m( x, c ) &&
+	     !( bli_obj_length_after_trans( x ) == 1 &&
+	        bli_obj_width_after_trans( x ) == bli_obj_width_after_trans( c ) ) )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+}
+
+void bli_gemm_epi_check
+     (
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     )
+{
+	err_t e_val;
+
+	if ( epi->act < BLIS_EPI_ACT_NONE || BLIS_NUM_EPI_ACTS <= epi->act )
+		bli_check_error_code( BLIS_INVALID_EPI_ACT );
+
+	if ( epi->act != BLIS_EPI_ACT_NONE || epi->clamp )
+	{
+		e_val = bli_check_real_object( c );
+		bli_check_error_code( e_val );
+	}
+
+	if ( epi->scale != NULL ) bli_gemm_epi_check_vector( epi->scale, c );
+	if ( epi->bias  != NULL ) bli_gemm_epi_check_vector( epi->bias,  c );
+}
+
+void bli_gemm_epi_params_init
+     (
+       const gemm_epi_t*        epi,
+       const obj_t*             c,
+             bool               trans,
+             gemm_epi_params_t* params
+     )
+{
+	params->ker = ftypes[ bli_obj_dt( c ) ];
+
+	// A vector that runs along the m dimension of C runs along the n
+	// dimension of C^T, so the orientation of each vector is flipped if the
+	// macrokernel will see C^T rather than C.
+	params->scale      = NULL;
+	params->inc_scale  = 0;
+	params->scale_on_m = FALSE;
+
+	if ( epi->scale != NULL )
+	{
+		params->scale      = bli_obj_buffer_at_off( epi->scale );
+		params->inc_scale  = bli_obj_vector_inc( epi->scale );
+		params->scale_on_m = bli_gemm_epi_vector_is_on_m( epi->scale, c ) != trans;
+	}
+
+	params->bias      = NULL;
+	params->inc_bias  = 0;
+	params->bias_on_m = FALSE;
+
+	if ( epi->bias != NULL )
+	{
+		params->bias      = bli_obj_buffer_at_off( epi->bias );
+		params->inc_bias  = bli_obj_vector_inc( epi->bias );
+		params->bias_on_m = bli_gemm_epi_vector_is_on_m( epi->bias, c ) != trans;
+	}
+
+	params->act      = epi->act;
+	params->clamp    = epi->clamp;
+	params->clamp_lo = epi->clamp_lo;
+	params->clamp_hi = epi->clamp_hi;
+}
+
+void bli_gemm_epi_apply
+     (
+       const gemm_epi_t* epi,
+       const obj_t*      c
+     )
+{
+	gemm_epi_params_t params;
+	bli_gemm_epi_params_init( epi, c, FALSE, &params );
+
+	// Apply the epilogue to C as a single tile. Any transposition of C is
+	// induced here, so the tile has the logical orientation of C.
+	obj_t c_local;
+	bli_obj_alias_submatrix( c, &c_local );
+
+	bli_gemm_epi_apply_tile
+	(
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_buffer_at_off( &c_local ),
+	  bli_obj_row_stride( &c_local ),
+	  bli_obj_col_stride( &c_local ),
+	  0,
+	  0,
+	  &params
+	);
+}
+
+//
+// -- Object-based interfaces (basic and expert) -------------------------------
+//
+
+void bli_gemm_epi
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     )
+{
+	PASTEMAC(gemm_epi,BLIS_OAPI_EX_SUF)( alpha, a, b, beta, c, epi, NULL, NULL );
+}
+
+void PASTEMAC(gemm_epi,BLIS_OAPI_EX_SUF)
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi,
+       const cntx_t*     cntx,
+       const rntm_t*     rntm
+     )
+{
+	bli_init_once();
+
+	// Check the operands.
+	if ( bli_error_checking_is_enabled() )
+	{
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+		if ( epi != NULL )
+			bli_gemm_epi_check( c, epi );
+	}
+
+	// Check for zero dimensions, alpha == 0, or other conditions which
+	// mean that we don't actually have to perform a full l3 operation. The
+	// epilogue must still be applied to whatever remains in C.
+	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
+	{
+		if ( epi != NULL ) bli_gemm_epi_apply( epi, c );
+		return;
+	}
+
+	// Execute the small/unpacked oapi handler. If it finds that the problem
+	// does not fall within the thresholds that define "small", or for some
+	// other reason decides not to use the small/unpacked implementation,
+	// the function returns with BLIS_FAILURE, which causes execution to
+	// proceed towards the conventional implementation. The sup code path
+	// does not support epilogues, so these are applied afterwards as a
+	// separate pass over C (which is small, by definition).
+	if ( bli_gemmsup( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+	{
+		if ( epi != NULL ) bli_gemm_epi_apply( epi, c );
+		return;
+	}
+
+	// Default to using native execution.
+	num_t dt = bli_obj_dt( c );
+	ind_t im = BLIS_NAT;
+
+	// If each matrix operand has a complex storage datatype, try to get an
+	// induced method (if one is available and enabled). NOTE: Allowing
+	// precisions to vary while using 1m, which is what we do here, is unique
+	// to gemm; other level-3 operations use 1m only if all storage datatypes
+	// are equal (and they ignore the computation precision). Operands that
+	// were packed ahead of time (see bli_gemm_pack()) were packed for native
+	// execution, which precludes the use of 1m.
+	if ( bli_obj_is_complex( c ) &&
+	     bli_obj_is_complex( a ) &&
+	     bli_obj_is_complex( b ) &&
+	     !bli_obj_is_panel_packed( a ) &&
+	     !bli_obj_is_panel_packed( b ) )
+	{
+		// Find the highest priority induced method that is both enabled and
+		// available for the current operation. (If an induced method is
+		// available but not enabled, or simply unavailable, BLIS_NAT will
+		// be returned here.)
+		im = bli_gemmind_find_avail( dt );
+	}
+
+	// If necessary, obtain a valid context from the gks using the induced
+	// method id determined above.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Alias A, B, and C in case we need to apply transformations.
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	gemm_cntl_t cntl;
+	const bool swapped = bli_gemm_cntl_init
+	(
+	  im,
+	  BLIS_GEMM,
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  beta,
+	  &c_local,
+	  cntx,
+	  &cntl
+	);
+
+	// Resolve the epilogue against C as it will be seen by the macrokernel
+	// (i.e., transposed if the operation was swapped above) and attach it
+	// to the control tree.
+	gemm_epi_params_t epi_params;
+	if ( epi != NULL )
+	{
+		bli_gemm_epi_params_init( epi, c, swapped, &epi_params );
+		bli_gemm_cntl_set_epi( &epi_params, &cntl );
+	}
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  &a_local,
+	  &b_local,
+	  &c_local,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  rntm
+	);
+}
+
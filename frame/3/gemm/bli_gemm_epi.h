@@ -0,0 +1,204 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// -- Fused gemm epilogues -----------------------------------------------------
+//
+
+// An epilogue is applied to each element of C once its final value has been
+// computed, i.e.,
+//
+//   C := clamp( act( scale .* ( beta * C + alpha * A * B ) + bias ) )
+//
+// where scale and bias are optional vectors that are broadcast along the
+// rows or columns of C. A column vector (of length m) holds one element per
+// row of C, while a row vector (of width n) holds one element per column of
+// C. Both vectors must have the same datatype as C. The activation function
+// and the clamp are only supported when C is real.
+
+typedef enum
+{
+	BLIS_EPI_ACT_NONE = 0,
+	BLIS_EPI_ACT_RELU,
+	BLIS_EPI_ACT_GELU,
+	BLIS_EPI_ACT_GELU_TANH,
+	BLIS_EPI_ACT_SIGMOID,
+	BLIS_EPI_ACT_TANH,
+} epi_act_t;
+
+#define BLIS_NUM_EPI_ACTS 6
+
+typedef struct
+{
+	const obj_t* scale;
+	const obj_t* bias;
+	epi_act_t    act;
+	bool         clamp;
+	double       clamp_lo;
+	double       clamp_hi;
+} gemm_epi_t;
+
+#define BLIS_GEMM_EPI_INITIALIZER \
+        { \
+          .scale    = NULL, \
+          .bias     = NULL, \
+          .act      = BLIS_EPI_ACT_NONE, \
+          .clamp    = FALSE, \
+          .clamp_lo = 0.0, \
+          .clamp_hi = 0.0, \
+        }
+
+// -----------------------------------------------------------------------------
+
+// The internal form of an epilogue, in which the scale and bias vectors have
+// been resolved against the m and n dimensions of C as it is seen by the
+// macrokernel (i.e., after any transposition of the operation), along with
+// the datatype-specific function that applies the epilogue to a tile of C.
+
+struct gemm_epi_params_s;
+
+typedef void (*gemm_epi_ft)
+     (
+             dim_t                     m,
+             dim_t                     n,
+             void*                     c, inc_t rs_c, inc_t cs_c,
+             dim_t                     off_m,
+             dim_t                     off_n,
+       const struct gemm_epi_params_s* params
+     );
+
+typedef struct gemm_epi_params_s
+{
+	gemm_epi_ft ker;
+
+	const void* scale;
+	inc_t       inc_scale;
+	bool        scale_on_m;
+
+	const void* bias;
+	inc_t       inc_bias;
+	bool        bias_on_m;
+
+	epi_act_t   act;
+	bool        clamp;
+	double      clamp_lo;
+	double      clamp_hi;
+} gemm_epi_params_t;
+
+void bli_gemm_epi_params_init
+     (
+       const gemm_epi_t*        epi,
+       const obj_t*             c,
+             bool               trans,
+             gemm_epi_params_t* params
+     );
+
+// Apply the epilogue to the m x n tile of C at c, whose top-left element is
+// located at (off_m, off_n) within the matrix against which the epilogue was
+// resolved.
+BLIS_INLINE void bli_gemm_epi_apply_tile
+     (
+             dim_t              m,
+             dim_t              n,
+             void*              c, inc_t rs_c, inc_t cs_c,
+             dim_t              off_m,
+             dim_t              off_n,
+       const gemm_epi_params_t* params
+     )
+{
+	params->ker( m, n, c, rs_c, cs_c, off_m, off_n, params );
+}
+
+void bli_gemm_epi_check
+     (
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     );
+
+// Apply the epilogue to all of C as a separate pass. This is used when the
+// product was not computed by the conventional (packed) implementation,
+// e.g. by the sup code path.
+void bli_gemm_epi_apply
+     (
+       const gemm_epi_t* epi,
+       const obj_t*      c
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t                     m, \
+             dim_t                     n, \
+             void*                     c, inc_t rs_c, inc_t cs_c, \
+             dim_t                     off_m, \
+             dim_t                     off_n, \
+       const struct gemm_epi_params_s* params  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_epi_ker )
+
+//
+// Prototype object-based interfaces (basic and expert).
+//
+
+// These functions perform gemm and then apply the epilogue epi to C. In the
+// conventional code path, the epilogue is applied to each microtile of C
+// immediately after the microkernel has computed its final value, while
+// the microtile is still resident in the L1 cache, rather than in a separate
+// pass over C. If epi is NULL, the operation is equivalent to bli_gemm().
+
+BLIS_EXPORT_BLIS void bli_gemm_epi
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     );
+
+BLIS_EXPORT_BLIS void PASTEMAC(gemm_epi,BLIS_OAPI_EX_SUF)
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi,
+       const cntx_t*     cntx,
+       const rntm_t*     rntm
+     );
+
@@ -45,10 +45,6 @@ void bli_gemm_ker_var2
              thrinfo_t* thread_par
      )
 {
-	const num_t  dt_a      = bli_obj_dt( a );
-	const num_t  dt_b      = bli_obj_dt( b );
-	const num_t  dt_c      = bli_obj_dt( c );
-
 	const pack_t schema_a  = bli_obj_pack_schema( a );
 	const pack_t schema_b  = bli_obj_pack_schema( b );
 
@@ -93,9 +89,9 @@ void bli_gemm_ker_var2
 	const char* alpha_cast = bli_obj_internal_scalar_buffer( &scalar_b );
 	const char* beta_cast  = bli_obj_internal_scalar_buffer( c );
 
-	const siz_t dt_a_size = bli_dt_size( dt_a );
-	const siz_t dt_b_size = bli_dt_size( dt_b );
-	const siz_t dt_c_size = bli_dt_size( dt_c );
+	const siz_t dt_a_size = bli_obj_elem_size( a );
+	const siz_t dt_b_size = bli_obj_elem_size( b );
+	const siz_t dt_c_size = bli_obj_elem_size( c );
 
 	// Alias some constants to simpler names.
 	const dim_t MR = pd_a;
@@ -150,6 +146,14 @@ void bli_gemm_ker_var2
 	bli_auxinfo_set_ukr( gemm_ukr, &aux );
 	bli_auxinfo_set_params( params, &aux );
 
+	// Query the epilogue, if any. It is applied only during the last rank-k
+	// update, once the final value of C has been computed.
+	const gemm_epi_params_t* epi = bli_obj_has_pending_updates( c )
+	                               ? NULL : bli_gemm_var_cntl_epi( cntl );
+
+	// Save the epilogue to the auxinfo_t object.
+	bli_auxinfo_set_epi( epi, &aux );
+
 	dim_t jr_start, jr_end, jr_inc;
 	dim_t ir_start, ir_end, ir_inc;
 
@@ -161,8 +165,8 @@ void bli_gemm_ker_var2
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
 
-	const dim_t ir_nt  = 1;
-	const dim_t ir_tid = 0;
+	dim_t ir_nt  = 1;
+	dim_t ir_tid = 0;
 
 	dim_t n_ut_for_me
 	=
@@ -179,7 +183,7 @@ void bli_gemm_ker_var2
 	ir_end = m_iter;
 
 	// Successive iterations of the ir loop should start at 0.
-	const dim_t ir_next = 0;
+	dim_t ir_next = 0;
 
 #else // ifdef ( _SLAB || _RR )
 
@@ -189,8 +193,8 @@ void bli_gemm_ker_var2
 	thrinfo_t* caucus = bli_thrinfo_sub_node( 0, thread );
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
-	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
-	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+	dim_t ir_nt  = bli_thrinfo_n_way( caucus );
+	dim_t ir_tid = bli_thrinfo_work_id( caucus );
 
 	// Determine the thread range and increment for the 2nd and 1st loops.
 	// NOTE: The definition of bli_thread_range_slrr() will depend on whether
@@ -203,79 +207,132 @@ void bli_gemm_ker_var2
 	                    ( ( jr_end + jr_inc - 1 - jr_start ) / jr_inc );
 
 	// Each succesive iteration of the ir loop always starts at ir_start.
-	const dim_t ir_next = ir_start;
+	dim_t ir_next = ir_start;
 
 #endif
 
+	// If dynamic scheduling was requested, the static assignment above is
+	// ignored. Instead, the threads of the team repeatedly claim contiguous
+	// ranges of microtiles (in column-major order) until none are left, and
+	// so each range is traversed exactly as in the tlb case.
+	const bool jrir_dyn = bli_thrinfo_jrir_dyn( thread_par ) &&
+	                      bli_thrinfo_num_threads( thread_par ) > 1;
+
+	if ( jrir_dyn )
+	{
+		ir_nt   = 1;
+		ir_tid  = 0;
+		jr_inc  = 1;
+		ir_inc  = 1;
+		jr_end  = n_iter;
+		ir_end  = m_iter;
+		ir_next = 0;
+	}
+
 	// It's possible that there are so few microtiles relative to the number
 	// of threads that one or more threads gets no work. If that happens, those
 	// threads can return early.
-	if ( n_ut_for_me == 0 ) return;
+	if ( !jrir_dyn && n_ut_for_me == 0 ) return;
 
-	// Loop over the n dimension (NR columns at a time).
-	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
-	{
-		const char* b1 = b_cast + j * cstep_b;
-		      char* c1 = c_cast + j * cstep_c;
+	dim_t ut_start = 0, ut_end = 0;
 
-		// Compute the current microtile's width.
-		const dim_t n_cur = ( bli_is_not_edge_f( j, n_iter, n_left )
-		                      ? NR : n_left );
-
-		// Initialize our next panel of B to be the current panel of B.
-		const char* b2 = b1;
+	while ( !jrir_dyn ||
+	        bli_thread_range_dyn( thread_par, m_iter * n_iter, &ut_start, &ut_end ) )
+	{
+		if ( jrir_dyn )
+		{
+			jr_start    = ut_start / m_iter;
+			ir_start    = ut_start % m_iter;
+			n_ut_for_me = ut_end - ut_start;
+		}
 
-		// Loop over the m dimension (MR rows at a time).
-		for ( dim_t i = ir_start; i < ir_end; i += ir_inc )
+		// Loop over the n dimension (NR columns at a time).
+		for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 		{
-			const char* a1  = a_cast + i * rstep_a;
-			      char* c11 = c1     + i * rstep_c;
+			const char* b1 = b_cast + j * cstep_b;
+			      char* c1 = c_cast + j * cstep_c;
 
-			// Compute the current microtile's length.
-			const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left )
-			                      ? MR : m_left );
+			// Compute the current microtile's width.
+			const dim_t n_cur = ( bli_is_not_edge_f( j, n_iter, n_left )
+			                      ? NR : n_left );
 
-			// Compute the addresses of the next panels of A and B.
-			const char* a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc );
-			if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+			// Initialize our next panel of B to be the current panel of B.
+			const char* b2 = b1;
+
+			// Loop over the m dimension (MR rows at a time).
+			for ( dim_t i = ir_start; i < ir_end; i += ir_inc )
 			{
-				a2 = a_cast;
-				b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc );
+				const char* a1  = a_cast + i * rstep_a;
+				      char* c11 = c1     + i * rstep_c;
+
+				// Compute the current microtile's length.
+				const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left )
+				                      ? MR : m_left );
+
+				// Compute the addresses of the next panels of A and B.
+				const char* a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc );
+				if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+				{
+					a2 = a_cast;
+					b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc );
+				}
+
+				// Save addresses of next panels of A and B to the auxinfo_t
+				// object.
+				bli_auxinfo_set_next_a( a2, &aux );
+				bli_auxinfo_set_next_b( b2, &aux );
+
+				// Set the current offset into the C matrix in the auxinfo_t
+				// object.
+				bli_auxinfo_set_off_m( off_m + i * MR, &aux );
+				bli_auxinfo_set_off_n( off_n + j * NR, &aux );
+
+				// Edge case handling now occurs within the microkernel itself.
+				// Invoke the gemm micro-kernel.
+				gemm_ukr
+				(
+				  m_cur,
+				  n_cur,
+				  k,
+				  ( void* )alpha_cast,
+				  ( void* )a1,
+				  ( void* )b1,
+				  ( void* )beta_cast,
+				           c11, rs_c, cs_c,
+				  &aux,
+				  ( cntx_t* )cntx
+				);
+
+				// Apply the epilogue (if any) to the microtile while it is
+				// still resident in the L1 cache.
+				if ( epi != NULL )
+					bli_gemm_epi_apply_tile
+					(
+					  m_cur,
+					  n_cur,
+					  c11, rs_c, cs_c,
+					  off_m + i * MR,
+					  off_n + j * NR,
+					  epi
+					);
+
+				// Decrement the number of microtiles assigned to the thread; once
+				// it reaches zero, stop.
+				n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) break;
 			}
 
-			// Save addresses of next panels of A and B to the auxinfo_t
-			// object.
-			bli_auxinfo_set_next_a( a2, &aux );
-			bli_auxinfo_set_next_b( b2, &aux );
-
-			// Set the current offset into the C matrix in the auxinfo_t
-			// object.
-			bli_auxinfo_set_off_m( off_m + i, &aux );
-			bli_auxinfo_set_off_m( off_n + j, &aux );
-
-			// Edge case handling now occurs within the microkernel itself.
-			// Invoke the gemm micro-kernel.
-			gemm_ukr
-			(
-			  m_cur,
-			  n_cur,
-			  k,
-			  ( void* )alpha_cast,
-			  ( void* )a1,
-			  ( void* )b1,
-			  ( void* )beta_cast,
-			           c11, rs_c, cs_c,
-			  &aux,
-			  ( cntx_t* )cntx
-			);
-
-			// Decrement the number of microtiles assigned to the thread; once
-			// it reaches zero, return immediately.
-			n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) return;
+			if ( n_ut_for_me == 0 ) break;
+
+			ir_start = ir_next;
 		}
 
-		ir_start = ir_next;
+		// Under static scheduling, we are done after a single pass.
+		if ( !jrir_dyn ) return;
 	}
+
+	// Wait for the rest of the team, so that the counters from which the
+	// microtiles were claimed are reset before they are used again.
+	bli_thread_range_dyn_finish( thread_par, m_iter * n_iter, &ut_start, &ut_end );
 }
 
 //PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var2: b1", k, NR, b1, NR, 1, "%4.1f", "" );
@@ -0,0 +1,695 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The packm kernels in the context have the packm_cxk signature, whereas the
+// packm control tree node expects a kernel that also handles matrix structure.
+// Since A and B are always general matrices here, a thin wrapper suffices; the
+// context kernel to call (and its own parameters) are passed in via the params
+// field (see gemm_lp_packm_params_t).
+
+static void bli_gemm_lp_packm
+     (
+             struc_t strucc,
+             diag_t  diagc,
+             uplo_t  uploc,
+             conj_t  conjc,
+             pack_t  schema,
+             bool    invdiag,
+             dim_t   panel_dim,
+             dim_t   panel_len,
+             dim_t   panel_dim_max,
+             dim_t   panel_len_max,
+             dim_t   panel_dim_off,
+             dim_t   panel_len_off,
+             dim_t   panel_bcast,
+       const void*   kappa,
+       const void*   c, inc_t incc, inc_t ldc,
+             void*   p,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	( void )strucc; ( void )diagc; ( void )uploc; ( void )invdiag;
+	( void )panel_dim_off; ( void )panel_len_off;
+
+	const gemm_lp_packm_params_t* lp_params = params;
+
+	lp_params->ukr
+	(
+	  conjc,
+	  schema,
+	  panel_dim,
+	  panel_dim_max,
+	  panel_bcast,
+	  panel_len,
+	  panel_len_max,
+	  kappa,
+	  c, incc, ldc,
+	  p,       ldp,
+	  lp_params->params,
+	  cntx
+	);
+}
+
+bool bli_gemm_lp_cntl_init
+     (
+       const obj_t*                  alpha,
+             obj_t*                  a,
+             obj_t*                  b,
+       const obj_t*                  beta,
+             obj_t*                  c,
+             kerid_t                 packm_ker_id,
+             kerid_t                 gemm_ukr_id,
+             bool                    c_is_int,
+       const cntx_t*                 cntx,
+             gemm_lp_packm_params_t* params,
+             gemm_cntl_t*            cntl
+     )
+{
+	const num_t   dt       = bli_obj_dt( c );
+	const siz_t   elem_a   = bli_obj_elem_size( a );
+	const siz_t   elem_b   = bli_obj_elem_size( b );
+	const func_t* gemm_ukr = bli_cntx_get_ukrs( gemm_ukr_id, cntx );
+	const bool    native   = bli_func_get_dt( dt, gemm_ukr ) != NULL;
+
+	params->ukr    = bli_cntx_get_ukr_dt( dt, packm_ker_id, cntx );
+	params->params = NULL;
+
+	// The packed formats are defined only for operands whose elements are
+	// narrower than the computation datatype, and the reference pack kernels
+	// must always be available.
+	if ( params->ukr == NULL || elem_a != elem_b ||
+	     elem_a == 0 || bli_dt_size( dt ) % elem_a != 0 )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	const bool swapped = bli_gemm_cntl_init
+	(
+	  BLIS_NAT,
+	  BLIS_GEMM,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  cntl
+	);
+
+	// Threads that share the k dimension accumulate into private copies of C,
+	// which bli_gemm_blk_var3() then reduces with bli_addm(). Since that
+	// would add integer elements as single-precision values, any pc ways of
+	// parallelism are instead absorbed into the ir loop for integer C.
+	if ( c_is_int )
+		bli_cntl_set_ways( 0, BLIS_THREAD_NONE, ( cntl_t* )&cntl->part_pc );
+
+	// Use our wrapper (with the selected context kernel) to pack both A
+	// and B.
+	bli_func_init( &params->wrapper, NULL, NULL, NULL, NULL );
+	bli_func_set_dt( ( void_fp )bli_gemm_lp_packm, dt, &params->wrapper );
+
+	bli_gemm_cntl_set_packa_ukr_simple( &params->wrapper, cntl );
+	bli_gemm_cntl_set_packb_ukr_simple( &params->wrapper, cntl );
+	bli_gemm_cntl_set_packa_params( params, cntl );
+	bli_gemm_cntl_set_packb_params( params, cntl );
+
+	if ( native )
+	{
+		// The native microkernel consumes groups of elements that together
+		// occupy one element of the computation datatype. Since the k
+		// dimension of each micropanel is padded to a whole number of groups,
+		// the packed buffers shrink by the same factor, which we use to
+		// enlarge KC.
+		const dim_t group = bli_dt_size( dt ) / elem_a;
+
+		blksz_t kr, kc;
+		bli_blksz_init_easy( &kr, group, group, group, group );
+		bli_blksz_copy( bli_cntx_get_blksz( BLIS_KC, cntx ), &kc );
+		bli_blksz_scale_def_max( group, 1, dt, &kc );
+
+		bli_gemm_cntl_set_kr( &kr, cntl );
+		bli_gemm_cntl_set_kc( &kc, cntl );
+		bli_gemm_cntl_set_packa_elem_size( elem_a, cntl );
+		bli_gemm_cntl_set_packb_elem_size( elem_b, cntl );
+
+		// The operation is real, so the "virtual" and real microkernels
+		// are one and the same.
+		bli_gemm_var_cntl_set_ukr_simple( gemm_ukr, ( cntl_t* )&cntl->ker );
+		bli_gemm_var_cntl_set_real_ukr_simple( gemm_ukr, ( cntl_t* )&cntl->ker );
+	}
+
+	bli_gemm_cntl_finalize
+	(
+	  BLIS_GEMM,
+	  a,
+	  b,
+	  c,
+	  cntl
+	);
+
+	return swapped;
+}
+
+void bli_gemm_lp_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             kerid_t packm_ker_id,
+             kerid_t gemm_ukr_id,
+             bool    c_is_int,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Check for zero dimensions, alpha == 0, or other conditions which
+	// mean that we don't actually have to perform a full l3 operation.
+	if ( bli_l3_return_early_if_trivial( alpha, a, b, beta, c ) == BLIS_SUCCESS )
+		return;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Alias A, B, and C in case we need to apply transformations.
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	gemm_cntl_t            cntl;
+	gemm_lp_packm_params_t params;
+	bli_gemm_lp_cntl_init
+	(
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  beta,
+	  &c_local,
+	  packm_ker_id,
+	  gemm_ukr_id,
+	  c_is_int,
+	  cntx,
+	  &params,
+	  &cntl
+	);
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  &a_local,
+	  &b_local,
+	  &c_local,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  rntm
+	);
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_ab, ch, opname, elem_size, packm_ker_id, gemm_ukr_id ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             float*    c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             float*    c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*   cntx, \
+       const rntm_t*   rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = BLIS_FLOAT; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_init_finish_1x1( dt, ( void* )alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, ( void* )beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )b, rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m,   n,            c, rs_c, cs_c, &co ); \
+\
+	/* A and B are computed on as single precision but stored in 16 bits. */ \
+	bli_obj_set_elem_size( elem_size, &ao ); \
+	bli_obj_set_elem_size( elem_size, &bo ); \
+\
+	bli_obj_set_onlytrans( transa, &ao ); \
+	bli_obj_set_onlytrans( transb, &bo ); \
+\
+	bli_gemm_lp_ex \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co, \
+	  packm_ker_id, \
+	  gemm_ukr_id, \
+	  FALSE, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+GENTFUNC( bfloat16, sb, gemm, sizeof( bfloat16 ), BLIS_PACKM_BF16_KER, BLIS_GEMM_BF16_UKR )
+GENTFUNC( float16,  sh, gemm, sizeof( float16 ),  BLIS_PACKM_F16_KER,  BLIS_GEMM_F16_UKR )
+
+
+
+//
+// 8-bit integer gemm.
+//
+
+// The epilogue of bli_u8s8s32gemm(), which multiplies each element (i,j) of
+// C by mul and adds the zero point compensation
+//
+//   alpha * ( c0 - coef_m * sum_m(i) - coef_n * sum_n(j) )
+//
+// to it, where sum_m and sum_n are the row sums of A and
+// column sums of B (or vice versa, if the operation was transposed), and
+// optionally requantizes the result into Q. All indices are relative to C as
+// it is seen by the macrokernel. The common part must appear first since the
+// epilogue kernel is handed a pointer to it.
+
+typedef struct
+{
+	gemm_epi_params_t common;
+
+	uint32_t          mul;
+	int32_t           alpha;
+	int64_t           c0;
+	const int64_t*    sum_m;
+	int64_t           coef_m;
+	const int64_t*    sum_n;
+	int64_t           coef_n;
+
+	void*             q;
+	inc_t             rs_q;
+	inc_t             cs_q;
+	bool              q_signed;
+	const float*      q_scale;
+	inc_t             inc_q_scale;
+	bool              q_scale_on_m;
+	int32_t           q_zp;
+} gemm_i8_epi_params_t;
+
+static void bli_u8s8s32gemm_epi_ker
+     (
+             dim_t                     m,
+             dim_t                     n,
+             void*                     c0,
+             inc_t                     rs_c,
+             inc_t                     cs_c,
+             dim_t                     off_m,
+             dim_t                     off_n,
+       const struct gemm_epi_params_s* params
+     )
+{
+	const gemm_i8_epi_params_t* p = ( const gemm_i8_epi_params_t* )params;
+
+	int32_t* c     = c0;
+	uint8_t* q     = p->q;
+	int32_t  q_min = p->q_signed ? INT8_MIN : 0;
+	int32_t  q_max = p->q_signed ? INT8_MAX : UINT8_MAX;
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const dim_t   jj     = off_n + j;
+		const int64_t comp_j = p->c0 -
+		                       ( p->sum_n != NULL ? p->coef_n * p->sum_n[ jj ] : 0 );
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			const dim_t   ii   = off_m + i;
+			const int64_t comp = comp_j -
+			                     ( p->sum_m != NULL ? p->coef_m * p->sum_m[ ii ] : 0 );
+
+			// Accumulate with wraparound, as the microkernels do.
+			int32_t* cij = c + i*rs_c + j*cs_c;
+			*cij = ( int32_t )( p->mul * ( uint32_t )*cij +
+			                    ( uint32_t )p->alpha * ( uint32_t )comp );
+
+			if ( q == NULL ) continue;
+
+			const float scale = p->q_scale[ ( p->q_scale_on_m ? ii : jj ) *
+			                                p->inc_q_scale ];
+
+			int64_t v = ( int64_t )lrintf( scale * ( float )*cij ) + p->q_zp;
+			v = bli_min( bli_max( v, q_min ), q_max );
+
+			q[ ii*p->rs_q + jj*p->cs_q ] = ( uint8_t )( v & 0xff );
+		}
+	}
+}
+
+void PASTEMAC(u8s8s32gemm,BLIS_TAPI_EX_SUF)
+     (
+             trans_t       transa,
+             trans_t       transb,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const int32_t*      alpha,
+       const uint8_t*      a, inc_t rs_a, inc_t cs_a,
+       const int8_t*       b, inc_t rs_b, inc_t cs_b,
+       const int32_t*      beta,
+             int32_t*      c, inc_t rs_c, inc_t cs_c,
+       const gemm_quant_t* quant,
+       const cntx_t*       cntx,
+       const rntm_t*       rntm
+     )
+{
+	bli_init_once();
+
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	const gemm_quant_t quant_def = BLIS_GEMM_QUANT_INITIALIZER;
+	if ( quant == NULL ) quant = &quant_def;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_cntx_get_ukr_dt( BLIS_FLOAT, BLIS_GEMM_U8S8S32_UKR, cntx ) == NULL )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	gemm_i8_epi_params_t epi;
+	epi.common.ker    = bli_u8s8s32gemm_epi_ker;
+	epi.mul           = 1;
+	epi.alpha         = *alpha;
+	epi.c0            = 0;
+	epi.sum_m         = NULL;
+	epi.coef_m        = 0;
+	epi.sum_n         = NULL;
+	epi.coef_n        = 0;
+	epi.q             = quant->q;
+	epi.rs_q          = quant->rs_q;
+	epi.cs_q          = quant->cs_q;
+	epi.q_signed      = quant->q_signed;
+	epi.q_scale       = quant->q_scale;
+	epi.inc_q_scale   = quant->inc_q_scale;
+	epi.q_scale_on_m  = FALSE;
+	epi.q_zp          = quant->q_zp;
+
+	// If there is no product to compute, scale C by beta and requantize it
+	// (if requested).
+	if ( k == 0 || *alpha == 0 )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			int32_t* cij = c + i*rs_c + j*cs_c;
+			*cij = *beta == 0 ? 0 : ( int32_t )( ( uint32_t )*beta * ( uint32_t )*cij );
+		}
+
+		if ( epi.q != NULL )
+			bli_u8s8s32gemm_epi_ker( m, n, c, rs_c, cs_c, 0, 0, &epi.common );
+
+		return;
+	}
+
+	// alpha and beta are passed through the framework as single-precision
+	// values, which represent integers exactly only up to 2^24 in magnitude.
+	// A larger alpha is split into a power of two, which is exact, and an odd
+	// factor, by which the epilogue multiplies C once the microkernels are
+	// done with it. Since odd numbers are invertible modulo 2^32, beta is
+	// divided by that factor up front. If the quotient is still too large, C
+	// is scaled by it here instead, and the microkernels use a beta of one.
+	const int64_t  flt_int_max = 1 << 24;
+	const uint32_t alpha_u     = ( uint32_t )*alpha;
+	int32_t        alpha_i     = *alpha;
+
+	if ( bli_abs( ( int64_t )*alpha ) > flt_int_max )
+	{
+		const uint32_t low = alpha_u & ( ~alpha_u + 1 );
+
+		alpha_i = ( int32_t )low;
+		epi.mul = alpha_u / low;
+	}
+
+	// Newton's iteration for the inverse of mul doubles the number of
+	// correct low-order bits with each step, starting from three.
+	uint32_t mul_inv = epi.mul;
+	for ( dim_t i = 0; i < 4; ++i ) mul_inv *= 2 - epi.mul * mul_inv;
+
+	int32_t beta_i = ( int32_t )( ( uint32_t )*beta * mul_inv );
+
+	if ( bli_abs( ( int64_t )beta_i ) > flt_int_max )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			int32_t* cij = c + i*rs_c + j*cs_c;
+			*cij = ( int32_t )( ( uint32_t )beta_i * ( uint32_t )*cij );
+		}
+
+		beta_i = 1;
+	}
+
+	const num_t dt    = BLIS_FLOAT;
+	const float alpha_r = alpha_i;
+	const float beta_r  = beta_i;
+
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER;
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER;
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t       co     = BLIS_OBJECT_INITIALIZER;
+
+	dim_t       m_a, n_a;
+	dim_t       m_b, n_b;
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	bli_obj_init_finish_1x1( dt, ( void* )&alpha_r, &alphao );
+	bli_obj_init_finish_1x1( dt, ( void* )&beta_r,  &betao  );
+
+	bli_obj_init_finish( dt, m_a, n_a, ( void* )a, rs_a, cs_a, &ao );
+	bli_obj_init_finish( dt, m_b, n_b, ( void* )b, rs_b, cs_b, &bo );
+	bli_obj_init_finish( dt, m,   n,            c, rs_c, cs_c, &co );
+
+	// A and B are stored in 8 bits, while C holds int32 values in place of
+	// single-precision ones.
+	bli_obj_set_elem_size( sizeof( uint8_t ), &ao );
+	bli_obj_set_elem_size( sizeof( int8_t ),  &bo );
+
+	bli_obj_set_onlytrans( transa, &ao );
+	bli_obj_set_onlytrans( transb, &bo );
+
+	gemm_cntl_t            cntl;
+	gemm_lp_packm_params_t params;
+	packm_i8_params_t      i8_params;
+
+	const bool swapped = bli_gemm_lp_cntl_init
+	(
+	  &alphao,
+	  &ao,
+	  &bo,
+	  &betao,
+	  &co,
+	  BLIS_PACKM_I8_KER,
+	  BLIS_GEMM_U8S8S32_UKR,
+	  TRUE,
+	  cntx,
+	  &params,
+	  &cntl
+	);
+
+	// If A and B were swapped, the operand packed in place of A is int8 and
+	// that packed in place of B is uint8. Flipping the sign bits converts
+	// them to uint8 B^T + 128 and int8 A^T - 128, respectively.
+	i8_params.xor_mask = swapped ? 0x80 : 0x00;
+	params.params      = &i8_params;
+
+	// Compute the coefficients of the row sums of A and column sums of B in
+	// the compensation. If A and B were swapped, the sign bit flips above
+	// contribute an additional 128*(ra(i) - cb(j)) - 128*128*k to the product
+	// computed by the microkernel, which must be removed as well.
+	const int64_t za    = quant->a_zp;
+	const int64_t zb    = quant->b_zp;
+	const int64_t shift = swapped ? 128 : 0;
+	const int64_t c_ra  = zb + shift;
+	const int64_t c_cb  = za - shift;
+
+	epi.c0 = ( int64_t )k * ( za * zb + shift * shift );
+
+	// The sums are kept in 64 bits, since k * 255 overflows an int32_t once
+	// k exceeds 2^23. Like the rest of the compensation, they are only
+	// reduced modulo 2^32 when they are applied to C.
+	int64_t* sums = NULL;
+	int64_t* ra   = NULL;
+	int64_t* cb   = NULL;
+	if ( c_ra != 0 || c_cb != 0 )
+	{
+		err_t r_val;
+		sums = bli_malloc_intl( ( m + n ) * sizeof( int64_t ), &r_val );
+
+		const inc_t rs_at = bli_does_trans( transa ) ? cs_a : rs_a;
+		const inc_t cs_at = bli_does_trans( transa ) ? rs_a : cs_a;
+		const inc_t rs_bt = bli_does_trans( transb ) ? cs_b : rs_b;
+		const inc_t cs_bt = bli_does_trans( transb ) ? rs_b : cs_b;
+
+		if ( c_ra != 0 )
+		{
+			ra = sums;
+			for ( dim_t i = 0; i < m; ++i )
+			{
+				int64_t s = 0;
+				for ( dim_t l = 0; l < k; ++l ) s += a[ i*rs_at + l*cs_at ];
+				ra[ i ] = s;
+			}
+		}
+
+		if ( c_cb != 0 )
+		{
+			cb = sums + m;
+			for ( dim_t j = 0; j < n; ++j )
+			{
+				int64_t s = 0;
+				for ( dim_t l = 0; l < k; ++l ) s += b[ l*rs_bt + j*cs_bt ];
+				cb[ j ] = s;
+			}
+		}
+	}
+
+	epi.sum_m  = swapped ? cb   : ra;
+	epi.coef_m = swapped ? c_cb : c_ra;
+	epi.sum_n  = swapped ? ra   : cb;
+	epi.coef_n = swapped ? c_ra : c_cb;
+
+	// Express Q in terms of the (possibly transposed) C.
+	if ( swapped )
+	{
+		epi.rs_q         = quant->cs_q;
+		epi.cs_q         = quant->rs_q;
+		epi.q_scale_on_m = TRUE;
+	}
+
+	if ( sums != NULL || epi.c0 != 0 || epi.q != NULL || epi.mul != 1 )
+		bli_gemm_cntl_set_epi( &epi.common, &cntl );
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  &ao,
+	  &bo,
+	  &co,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  rntm
+	);
+
+	bli_free_intl( sums );
+}
+
+void bli_u8s8s32gemm
+     (
+             trans_t       transa,
+             trans_t       transb,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const int32_t*      alpha,
+       const uint8_t*      a, inc_t rs_a, inc_t cs_a,
+       const int8_t*       b, inc_t rs_b, inc_t cs_b,
+       const int32_t*      beta,
+             int32_t*      c, inc_t rs_c, inc_t cs_c,
+       const gemm_quant_t* quant
+     )
+{
+	PASTEMAC(u8s8s32gemm,BLIS_TAPI_EX_SUF)
+	(
+	  transa, transb,
+	  m, n, k,
+	  alpha,
+	  a, rs_a, cs_a,
+	  b, rs_b, cs_b,
+	  beta,
+	  c, rs_c, cs_c,
+	  quant,
+	  NULL,
+	  NULL
+	);
+}
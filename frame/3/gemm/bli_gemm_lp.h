@@ -0,0 +1,290 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Reduced-precision gemm: C := beta * C + alpha * transa(A) * transb(B),
+// where A and B are stored as bfloat16 (sb) or IEEE half-precision float16
+// (sh) and alpha, beta and C are single precision. All products are
+// accumulated in single precision.
+//
+// Each operation is backed by a pair of context kernels. The packm kernel
+// (BLIS_PACKM_BF16_KER, BLIS_PACKM_F16_KER) packs micropanels of A and B,
+// and the gemm microkernel (BLIS_GEMM_BF16_UKR, BLIS_GEMM_F16_UKR), if one
+// is registered, consumes them. Only the float slot of each func_t is used.
+//
+// - If the gemm microkernel is not set (the default), the packm kernel
+//   converts the elements to single precision as they are packed, in the
+//   usual single-precision micropanel format, and the single-precision gemm
+//   microkernel is used. Every configuration supports the operations this
+//   way.
+//
+// - If the gemm microkernel is set, the packm kernel must leave the elements
+//   in their 16-bit format and interleave pairs of consecutive k indices:
+//   element (i,l) of a micropanel with leading dimension ldp is stored at
+//   p[ (l/2)*2*ldp + 2*i + (l%2) ], and an odd k is padded with a zero. The
+//   microkernel is called with the unpadded k. It must use the same register
+//   blocksizes (MR, NR) and storage preference as the single-precision
+//   microkernel, and KC is doubled since each packed element takes half the
+//   space.
+//
+
+//
+// 8-bit integer gemm:
+//
+//   C := beta * C + alpha * ( transa(A) - a_zp ) * ( transb(B) - b_zp )
+//
+// where A is uint8, B is int8, and alpha, beta, and C are int32. The zero
+// points a_zp and b_zp are scalars. The products are accumulated in int32
+// (with wraparound on overflow, as in the hardware instructions).
+//
+// The operation uses the native path described above with groups of four:
+// the BLIS_PACKM_I8_KER kernel packs element (i,l) of a micropanel at
+// p[ (l/4)*4*ldp + 4*i + (l%4) ], padding k to a multiple of four with zeros,
+// and the BLIS_GEMM_U8S8S32_UKR microkernel computes with the packed A as
+// uint8 and the packed B as int8 (i.e., the operand order of vpdpbusd). The
+// int32 C and scalars are carried through the framework as single-precision
+// objects; the microkernel reads alpha and beta as floats holding integral
+// values. Both kernels are always present in the reference context.
+//
+// If the framework transposes the operation (to suit the microkernel's
+// storage preference for C), A and B trade places, and the sign bit of every
+// element is flipped as it is packed so that the operand in the position of
+// A is still unsigned. This shifts each operand by 128, which is folded into
+// the zero point compensation.
+//
+// The compensation, i.e., the terms of the product that involve a_zp or b_zp,
+// is computed from the row sums of A and column sums of B and added to each
+// microtile of C along with its final update, by way of a gemm epilogue. In
+// the same pass, C may optionally be requantized into an 8-bit matrix Q:
+//
+//   Q(i,j) := saturate( round( q_scale(j) * C(i,j) ) + q_zp )
+//
+// where round() rounds to the nearest integer (ties to even), saturate()
+// clamps to the range of uint8 (or int8 if q_signed), and q_scale is either
+// a scalar (inc_q_scale == 0) or a vector with one element per column of C.
+// C receives its full int32 result in either case. If quant is NULL, both
+// zero points are zero and Q is not computed. Any int32 alpha and beta may be
+// given: those beyond the range of integers that single precision represents
+// exactly (2^24 in magnitude) are factored so that the epilogue applies them
+// exactly.
+//
+
+// Parameters of the BLIS_PACKM_I8_KER kernels. Each byte is XORed with
+// xor_mask as it is packed.
+typedef struct
+{
+	uint8_t xor_mask;
+} packm_i8_params_t;
+
+typedef struct
+{
+	// Zero points of A and B.
+	int32_t      a_zp;
+	int32_t      b_zp;
+
+	// Requantization of C into Q (disabled if q is NULL).
+	void*        q;
+	inc_t        rs_q;
+	inc_t        cs_q;
+	bool         q_signed;
+	const float* q_scale;
+	inc_t        inc_q_scale;
+	int32_t      q_zp;
+} gemm_quant_t;
+
+#define BLIS_GEMM_QUANT_INITIALIZER \
+        { \
+          .a_zp        = 0, \
+          .b_zp        = 0, \
+          .q           = NULL, \
+          .rs_q        = 0, \
+          .cs_q        = 0, \
+          .q_signed    = FALSE, \
+          .q_scale     = NULL, \
+          .inc_q_scale = 0, \
+          .q_zp        = 0, \
+        }
+
+//
+// Prototype object-based interfaces.
+//
+
+// The packm control tree nodes of the reduced-precision operations use a
+// wrapper that invokes the context packm kernel ukr with the given params.
+// The wrapper itself is stored here as well, since the control tree refers
+// to it by address.
+typedef struct
+{
+	packm_cxk_ker_ft ukr;
+	const void*      params;
+	func_t           wrapper;
+} gemm_lp_packm_params_t;
+
+// Initialize a control tree for a reduced-precision operation whose A and B
+// are packed by the packm kernel packm_ker_id and whose microkernel is
+// gemm_ukr_id (or, if that is not set in the context, the conventional
+// microkernel). The objects a, b, and c are modified if the operation is
+// transposed, which is indicated by the return value. If c_is_int is TRUE,
+// the elements of C are int32 values carried as single-precision ones, and
+// the k dimension is never split among threads (since the partial results
+// would be reduced with single-precision arithmetic). Both params and cntl
+// must remain valid for the duration of the operation; params->params may
+// be modified after initialization.
+bool bli_gemm_lp_cntl_init
+     (
+       const obj_t*                  alpha,
+             obj_t*                  a,
+             obj_t*                  b,
+       const obj_t*                  beta,
+             obj_t*                  c,
+             kerid_t                 packm_ker_id,
+             kerid_t                 gemm_ukr_id,
+             bool                    c_is_int,
+       const cntx_t*                 cntx,
+             gemm_lp_packm_params_t* params,
+             gemm_cntl_t*            cntl
+     );
+
+// Perform a reduced-precision operation with the given packm kernel and
+// (optional) gemm microkernel, using the same partitioning, multithreading,
+// and packed memory pools as bli_gemm(). A and B must be BLIS_FLOAT objects
+// whose element size has been set to that of the storage format (see
+// bli_obj_set_elem_size()); C, alpha, and beta are single precision, or some
+// other 32-bit type carried as such (see below). The latter must be indicated
+// with c_is_int if C holds int32 values (see bli_gemm_lp_cntl_init()).
+//
+// The kernel ids may be those of the built-in operations or ids obtained at
+// runtime with bli_gks_register_ukr(), which adds a (NULL) slot to the
+// context of every configuration. The caller then stores its kernels in the
+// float slot of the contexts of the configurations it supports, e.g.
+//
+//   bli_gks_register_ukr( &my_packm_id );
+//   bli_gks_register_ukr( &my_gemm_id );
+//
+//   cntx_t* cntx = ( cntx_t* )bli_gks_lookup_id( BLIS_ARCH_POWER10 );
+//   bli_cntx_set_ukr_dt( ( void_fp )my_packm, BLIS_FLOAT, my_packm_id, cntx );
+//   bli_cntx_set_ukr_dt( ( void_fp )my_gemm,  BLIS_FLOAT, my_gemm_id,  cntx );
+//
+// If the packm kernel is not set in the context, the operation fails with
+// BLIS_NOT_YET_IMPLEMENTED. A gemm microkernel that computes on some other
+// (e.g. integer) datatype must read alpha and beta as floats, and, since
+// zero-sized and alpha == 0 operations are handled by the framework in
+// single precision, the caller should treat those cases itself.
+
+BLIS_EXPORT_BLIS void bli_gemm_lp_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+             kerid_t packm_ker_id,
+             kerid_t gemm_ukr_id,
+             bool    c_is_int,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype_ab, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             float*    c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             float*    c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*   cntx, \
+       const rntm_t*   rntm  \
+     );
+
+GENTPROT( bfloat16, sb, gemm )
+GENTPROT( float16,  sh, gemm )
+
+BLIS_EXPORT_BLIS void bli_u8s8s32gemm
+     (
+             trans_t       transa,
+             trans_t       transb,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const int32_t*      alpha,
+       const uint8_t*      a, inc_t rs_a, inc_t cs_a,
+       const int8_t*       b, inc_t rs_b, inc_t cs_b,
+       const int32_t*      beta,
+             int32_t*      c, inc_t rs_c, inc_t cs_c,
+       const gemm_quant_t* quant
+     );
+
+BLIS_EXPORT_BLIS void PASTEMAC(u8s8s32gemm,BLIS_TAPI_EX_SUF)
+     (
+             trans_t       transa,
+             trans_t       transb,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const int32_t*      alpha,
+       const uint8_t*      a, inc_t rs_a, inc_t cs_a,
+       const int8_t*       b, inc_t rs_b, inc_t cs_b,
+       const int32_t*      beta,
+             int32_t*      c, inc_t rs_c, inc_t cs_c,
+       const gemm_quant_t* quant,
+       const cntx_t*       cntx,
+       const rntm_t*       rntm
+     );
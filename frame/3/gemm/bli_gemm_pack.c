@@ -0,0 +1,233 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+static packm_ker_ft GENARRAY2_MIXP(packm_struc_cxk,packm_struc_cxk);
+
+static void bli_gemm_pack_check
+     (
+             side_t side,
+       const obj_t* x
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_valid_side( side );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_general_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+}
+
+static siz_t bli_gemm_pack_init
+     (
+             side_t            side,
+       const obj_t*            x,
+             obj_t*            x_local,
+             obj_t*            xp,
+       const cntx_t*           cntx,
+             packm_def_cntl_t* cntl
+     )
+{
+	const num_t dt = bli_obj_dt( x );
+
+	// A is packed as an m x k matrix, as in bli_l3_packa(), and B is packed
+	// via its transpose, as in bli_l3_packb(), so that both are packed to
+	// (column-stored) row micropanels.
+	bli_obj_alias_to( x, x_local );
+
+	if ( side == BLIS_LEFT )
+	{
+		if ( bli_obj_has_trans( x ) )
+		{
+			bli_obj_induce_trans( x_local );
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, x_local );
+		}
+	}
+	else // if ( side == BLIS_RIGHT )
+	{
+		if ( bli_obj_has_trans( x ) )
+			bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, x_local );
+		else
+			bli_obj_induce_trans( x_local );
+	}
+
+	const bszid_t   bs_r     = ( side == BLIS_LEFT ? BLIS_MR  : BLIS_NR );
+	const bszid_t   bs_bcast = ( side == BLIS_LEFT ? BLIS_BBM : BLIS_BBN );
+	const packbuf_t buf_type = ( side == BLIS_LEFT ? BLIS_BUFFER_FOR_A_BLOCK
+	                                               : BLIS_BUFFER_FOR_B_PANEL );
+
+	// Request the same packing format that bli_gemm_cntl_init() uses for
+	// the native execution of a gemm whose operands all share the datatype
+	// of x. Note that the matrix is packed in its entirety, so each
+	// micropanel spans the full k dimension. The KC and NC (or MC)
+	// partitionings are applied when the packed object is consumed (see
+	// bli_acquire_mpart_packed()), so they need not be known here.
+	bli_packm_def_cntl_init_node
+	(
+	  NULL,
+	  dt,
+	  dt,
+	  dt,
+	  packm_struc_cxk[ dt ][ dt ],
+	  bli_cntx_get_blksz_def_dt( dt, bs_r, cntx ),
+	  bli_cntx_get_blksz_max_dt( dt, bs_r, cntx ),
+	  bli_cntx_get_blksz_max_dt( dt, bs_bcast, cntx ),
+	  1,
+	  1,
+	  bli_cntx_get_blksz_def_dt( dt, BLIS_KR, cntx ),
+	  FALSE,
+	  FALSE,
+	  FALSE,
+	  BLIS_PACKED_PANELS,
+	  buf_type,
+	  cntl
+	);
+
+	return bli_packm_init( dt, x_local, xp, ( cntl_t* )cntl );
+}
+
+static siz_t bli_gemm_pack_align_size
+     (
+       side_t side
+     )
+{
+	// Micropanels are expected to be aligned the same way as they would be
+	// within a block acquired from the pba.
+	return ( side == BLIS_LEFT ? BLIS_POOL_ADDR_ALIGN_SIZE_A
+	                           : BLIS_POOL_ADDR_ALIGN_SIZE_B );
+}
+
+siz_t bli_gemm_pack_size
+     (
+             side_t  side,
+       const obj_t*  x,
+       const cntx_t* cntx
+     )
+{
+	bli_init_once();
+
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_pack_check( side, x );
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	obj_t            x_local, xp;
+	packm_def_cntl_t cntl;
+
+	const siz_t size = bli_gemm_pack_init( side, x, &x_local, &xp, cntx, &cntl );
+
+	// Include enough space for bli_gemm_pack() to align the buffer.
+	return ( 0 < size ? size + bli_gemm_pack_align_size( side ) : 0 );
+}
+
+void bli_gemm_pack
+     (
+             side_t side,
+       const obj_t* x,
+             void*  p,
+             obj_t* xp
+     )
+{
+	PASTEMAC(gemm_pack,BLIS_OAPI_EX_SUF)( side, x, p, xp, NULL );
+}
+
+void PASTEMAC(gemm_pack,BLIS_OAPI_EX_SUF)
+     (
+             side_t  side,
+       const obj_t*  x,
+             void*   p,
+             obj_t*  xp,
+       const cntx_t* cntx
+     )
+{
+	bli_init_once();
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		bli_gemm_pack_check( side, x );
+		bli_check_error_code( bli_check_null_pointer( p ) );
+	}
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	obj_t            x_local, xp_local;
+	packm_def_cntl_t cntl;
+
+	const siz_t size = bli_gemm_pack_init( side, x, &x_local, &xp_local, cntx, &cntl );
+
+	// Present the caller's buffer to the packm variant as though it were a
+	// previously acquired pack buffer, which bli_packm_alloc() will then
+	// reuse since it is large enough.
+	thrcomm_t comm;
+	bli_thrcomm_init( BLIS_SINGLE, 1, &comm );
+
+	thrinfo_t* thread = bli_thrinfo_create_root( &comm, 0, NULL, bli_pba_query() );
+	mem_t*     mem    = bli_thrinfo_mem( thread );
+
+	bli_mem_set_buffer( ( void* )bli_align_ptr_to_size( p, bli_gemm_pack_align_size( side ) ), mem );
+	bli_mem_set_buf_type( bli_packm_def_cntl_pack_buf_type( ( cntl_t* )&cntl ), mem );
+	bli_mem_set_pool( NULL, mem );
+	bli_mem_set_size( size, mem );
+
+	if ( 0 < size )
+		bli_packm_blk_var1( &x_local, &xp_local, cntx, ( cntl_t* )&cntl, thread );
+
+	// Disown the caller's buffer before freeing the thrinfo_t so that it is
+	// not released to the pba.
+	bli_mem_clear( mem );
+	bli_thrinfo_free( thread );
+	bli_thrcomm_cleanup( &comm );
+
+	// Transpose a packed B back to its original orientation (k x n), as in
+	// bli_l3_packb().
+	if ( side == BLIS_RIGHT )
+		bli_obj_induce_trans( &xp_local );
+
+	// The packed object is its own root, since it no longer refers to x.
+	bli_obj_alias_to( &xp_local, xp );
+	bli_obj_set_as_root( xp );
+}
+
@@ -0,0 +1,71 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype object-based interfaces (basic and expert).
+//
+
+// These functions pack a matrix ahead of time into the micropanel format
+// that the gemm macrokernel consumes, so that the packed object may be passed
+// as the A (side == BLIS_LEFT) or B (side == BLIS_RIGHT) operand of any
+// number of subsequent calls to bli_gemm()/bli_gemm_ex() without being
+// packed again. The caller owns the buffer, which must be at least
+// bli_gemm_pack_size() bytes (but need not be aligned), and must keep it
+// alive for as long as the packed object is in use.
+
+BLIS_EXPORT_BLIS siz_t bli_gemm_pack_size
+     (
+             side_t  side,
+       const obj_t*  x,
+       const cntx_t* cntx
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_pack
+     (
+             side_t side,
+       const obj_t* x,
+             void*  p,
+             obj_t* xp
+     );
+
+BLIS_EXPORT_BLIS void PASTEMAC(gemm_pack,BLIS_OAPI_EX_SUF)
+     (
+             side_t  side,
+       const obj_t*  x,
+             void*   p,
+             obj_t*  xp,
+       const cntx_t* cntx
+     );
+
@@ -67,3 +67,47 @@ GENPROT( gemm_blk_var3 )
 
 GENPROT( gemm_ker_var2 )
 
+//
+// Prototype helper functions for parallelizing the pc loop in
+// bli_gemm_blk_var3().
+//
+
+void bli_gemm_blk_var3_range
+     (
+       dim_t  work_id,
+       dim_t  n_way,
+       dim_t  k,
+       dim_t  bf,
+       dim_t* start,
+       dim_t* end
+     );
+
+void bli_gemm_blk_var3_acquire_c
+     (
+             dim_t      n_way,
+       const obj_t*     c,
+             mem_t*     mem,
+             inc_t*     ps,
+             thrinfo_t* thread_par
+     );
+
+void bli_gemm_blk_var3_alias_c
+     (
+             dim_t  work_id,
+       const mem_t* mem,
+             inc_t  ps,
+       const obj_t* c,
+             obj_t* cw
+     );
+
+void bli_gemm_blk_var3_reduce
+     (
+             dim_t      n_way,
+             dim_t      k,
+             dim_t      bf,
+       const mem_t*     mem,
+             inc_t      ps,
+       const obj_t*     c,
+             thrinfo_t* thread_par
+     );
+
@@ -33,4 +33,5 @@
 */
 
 #include "bli_gemmt_var.h"
+#include "bli_gemmt_r2k.h"
 
@@ -42,7 +42,8 @@ typedef void (*xpbys_mxn_l_ft)
             dim_t  n,
       const void*  x, inc_t rs_x, inc_t cs_x,
       const void*  b,
-            void*  y, inc_t rs_y, inc_t cs_y
+            void*  y, inc_t rs_y, inc_t cs_y,
+            bool   realdiag
     );
 
 #undef  GENTFUNC
@@ -55,7 +56,8 @@ BLIS_INLINE void PASTEMAC(ch,op) \
             dim_t  n, \
       const void*  x, inc_t rs_x, inc_t cs_x, \
       const void*  b, \
-            void*  y, inc_t rs_y, inc_t cs_y \
+            void*  y, inc_t rs_y, inc_t cs_y, \
+            bool   realdiag \
     ) \
 { \
 	const ctype* restrict x_cast = x; \
@@ -73,6 +75,19 @@ BLIS_INLINE void PASTEMAC(ch,op) \
 	  b_cast, \
 	  y_cast, rs_y, cs_y \
 	); \
+\
+	/* If C is Hermitian, the imaginary parts of its diagonal elements are \
+	   zeroed as the microtile is written back. */ \
+	if ( realdiag ) \
+	{ \
+		for ( dim_t ii = 0; ii < m; ++ii ) \
+		{ \
+			const doff_t jj = diagoff + ( doff_t )ii; \
+\
+			if ( 0 <= jj && jj < n ) \
+				bli_tseti0s( ch, *( y_cast + ii*rs_y + jj*cs_y ) ); \
+		} \
+	} \
 }
 
 INSERT_GENTFUNC_BASIC(xpbys_mxn_l_fn);
@@ -141,6 +156,7 @@ void bli_gemmt_l_ker_var2
 	gemm_ukr_ft    gemm_ukr        = bli_gemm_var_cntl_ukr( cntl );
 	const void*    params          = bli_gemm_var_cntl_params( cntl );
 	xpbys_mxn_l_ft xpbys_mxn_l_ukr = xpbys_mxn_l[ dt_c ];
+	const bool     realdiag        = bli_obj_is_hermitian( c );
 
 	// Temporary C buffer for edge cases. Note that the strides of this
 	// temporary buffer are set so that they match the storage of the
@@ -237,8 +253,8 @@ void bli_gemmt_l_ker_var2
 	// Query the number of threads and thread ids for each loop.
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
-	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
-	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+	      dim_t ir_nt  = bli_thrinfo_n_way( caucus );
+	      dim_t ir_tid = bli_thrinfo_work_id( caucus );
 
 	dim_t jr_start, jr_end, jr_inc;
 	dim_t ir_start, ir_end, ir_inc;
@@ -251,9 +267,30 @@ void bli_gemmt_l_ker_var2
 	//bli_thread_range_slrr( jr_tid, jt_nt, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc );
 	bli_thread_range_slrr( ir_tid, ir_nt, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc );
 
+	// If dynamic scheduling was requested, every thread instead visits all
+	// columns of microtiles and computes each column that it claims in its
+	// entirety. Since columns are claimed as threads become free, the
+	// uneven amount of work per column near the diagonal balances itself.
+	const bool jrir_dyn  = bli_thrinfo_jrir_dyn( thread_par ) &&
+	                       bli_thrinfo_num_threads( thread_par ) > 1;
+	      dim_t dyn_start = 0;
+	      dim_t dyn_end   = 0;
+
+	if ( jrir_dyn )
+	{
+		jr_start = 0; jr_end = n_iter; jr_inc = 1;
+		ir_start = 0; ir_end = m_iter; ir_inc = 1;
+		ir_tid   = 0; ir_nt  = 1;
+	}
+
 	// Loop over the n dimension (NR columns at a time).
 	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 	{
+		// Skip the columns of microtiles claimed by other threads.
+		if ( jrir_dyn &&
+		     !bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end ) )
+			continue;
+
 		const char* b1 = b_cast + j * cstep_b;
 		      char* c1 = c_cast + j * cstep_c;
 
@@ -320,7 +357,8 @@ void bli_gemmt_l_ker_var2
 				  m_cur, n_cur,
 				  ct,  rs_ct, cs_ct,
 				  ( void* )beta_cast,
-				  c11, rs_c,  cs_c
+				  c11, rs_c,  cs_c,
+				  realdiag
 				);
 			}
 			else if ( bli_is_strictly_below_diag_n( diagoffc_ij, m_cur, n_cur ) )
@@ -360,5 +398,8 @@ void bli_gemmt_l_ker_var2
 			}
 		}
 	}
+
+	if ( jrir_dyn )
+		bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
 }
 
@@ -0,0 +1,359 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static void bli_gemmt_r2k_packm_var
+     (
+       const obj_t*     c,
+             obj_t*     p,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread
+     );
+
+void bli_gemmt_r2k_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  alpha2,
+       const obj_t*  a2,
+       const obj_t*  b2,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	const num_t dt = bli_obj_dt( c );
+
+	// The fused path packs the micropanels of both terms side by side, so
+	// it requires that all operands share C's storage and computation
+	// datatype and that the operation is executed natively. We also let
+	// bli_gemmt_ex() take care of trivial cases (including zero scalars),
+	// as well as of operands that were packed ahead of time.
+	bool fuse = bli_obj_dt( a )  == dt &&
+	            bli_obj_dt( b )  == dt &&
+	            bli_obj_dt( a2 ) == dt &&
+	            bli_obj_dt( b2 ) == dt &&
+	            bli_obj_comp_prec( c ) == bli_obj_prec( c ) &&
+	            !bli_obj_is_packed( a )  && !bli_obj_is_packed( b )  &&
+	            !bli_obj_is_packed( a2 ) && !bli_obj_is_packed( b2 ) &&
+	            !bli_zero_dim3( bli_obj_length( c ),
+	                            bli_obj_width( c ),
+	                            bli_obj_width_after_trans( a ) ) &&
+	            !bli_obj_equals( alpha,  &BLIS_ZERO ) &&
+	            !bli_obj_equals( alpha2, &BLIS_ZERO );
+
+	if ( fuse && bli_obj_is_complex( c ) )
+		fuse = bli_gemmtind_find_avail( dt ) == BLIS_NAT;
+
+	if ( !fuse )
+	{
+		// Invoke gemmt twice, using beta only the first time.
+		bli_gemmt_ex(  alpha,  a,  b,      beta, c, cntx, rntm );
+		bli_gemmt_ex( alpha2, a2, b2, &BLIS_ONE, c, cntx, rntm );
+
+		// The diagonal elements of a Hermitian rank-2k product computed this
+		// way sometimes accumulate meaningless non-zero imaginary components,
+		// so we explicitly set them to zero.
+		if ( bli_obj_is_hermitian( c ) )
+			bli_setid( &BLIS_ZERO, c );
+
+		return;
+	}
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Alias the operands in case we need to apply transformations.
+	obj_t a_local;
+	obj_t b_local;
+	obj_t a2_local;
+	obj_t b2_local;
+	obj_t c_local;
+	bli_obj_alias_submatrix( a, &a_local );
+	bli_obj_alias_submatrix( b, &b_local );
+	bli_obj_alias_submatrix( a2, &a2_local );
+	bli_obj_alias_submatrix( b2, &b2_local );
+	bli_obj_alias_submatrix( c, &c_local );
+
+	gemm_cntl_t cntl;
+	const bool swapped = bli_gemm_cntl_init
+	(
+	  BLIS_NAT,
+	  BLIS_GEMMT,
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  beta,
+	  &c_local,
+	  cntx,
+	  &cntl
+	);
+
+	// Give the operands of the second term the same treatment that
+	// bli_gemm_cntl_init() gave those of the first term: swap them if the
+	// operation was transposed, then attach alpha2 to the right-hand
+	// operand.
+	if ( swapped )
+	{
+		bli_obj_swap( &a2_local, &b2_local );
+
+		bli_obj_induce_trans( &a2_local );
+		bli_obj_induce_trans( &b2_local );
+	}
+
+	obj_t alpha2_cast;
+	bli_obj_scalar_init_detached_copy_of( dt,
+	                                      BLIS_NO_CONJUGATE,
+	                                      alpha2,
+	                                      &alpha2_cast );
+
+	bli_obj_scalar_cast_to( BLIS_COMPLEX | bli_obj_prec( c ), &a2_local );
+	bli_obj_scalar_cast_to( BLIS_COMPLEX | bli_obj_prec( c ), &b2_local );
+
+	if ( !bli_obj_equals( &alpha2_cast, &BLIS_ONE ) )
+		bli_obj_scalar_apply_scalar( &alpha2_cast, &b2_local );
+
+	// B is packed by way of B^T (see bli_l3_packb()), so the packm variant
+	// for B needs to locate its partitions within B2^T.
+	obj_t b2t_local;
+	bli_obj_alias_to( &b2_local, &b2t_local );
+	bli_obj_induce_trans( &b2t_local );
+
+	bli_gemm_cntl_set_packa_var( bli_gemmt_r2k_packm_var, &cntl );
+	bli_gemm_cntl_set_packb_var( bli_gemmt_r2k_packm_var, &cntl );
+	bli_packm_cntl_set_variant_params( &a2_local,  ( cntl_t* )&cntl.pack_a );
+	bli_packm_cntl_set_variant_params( &b2t_local, ( cntl_t* )&cntl.pack_b );
+
+	// Since each packed micropanel holds a KC block of both terms, halve KC
+	// so that the packed blocks of A and B keep their usual cache footprint.
+	blksz_t kc;
+	bli_blksz_copy( bli_cntx_get_blksz( BLIS_KC, cntx ), &kc );
+	bli_blksz_scale_def_max( 1, 2, dt, &kc );
+	bli_gemm_cntl_set_kc( &kc, &cntl );
+	bli_part_cntl_align_blksz( FALSE, ( cntl_t* )&cntl.part_pc );
+
+	// Invoke the internal back-end via the thread handler.
+	bli_l3_thread_decorator
+	(
+	  &a_local,
+	  &b_local,
+	  &c_local,
+	  cntx,
+	  ( cntl_t* )&cntl,
+	  rntm
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gemmt_r2k_packm_var
+     (
+       const obj_t*     c,
+             obj_t*     p,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread
+     )
+{
+	// Extract various fields from the control tree.
+	pack_t schema    = bli_packm_def_cntl_pack_schema( cntl );
+	num_t  dt_p      = bli_packm_def_cntl_target_dt( cntl );
+
+	// Locate the partition of the second term's operand that corresponds to
+	// the current partition of the first term's operand.
+	const obj_t* c2_root = bli_packm_cntl_variant_params( cntl );
+	obj_t c2;
+	bli_acquire_mpart
+	(
+	  bli_obj_row_off( c ),
+	  bli_obj_col_off( c ),
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  c2_root,
+	  &c2
+	);
+
+	// Initialize p for packing the concatenation [ c c2 ], which has twice
+	// as many columns as c.
+	const dim_t k = bli_obj_width( c );
+
+	obj_t cc;
+	bli_obj_alias_to( c, &cc );
+	bli_obj_set_width( 2 * k, &cc );
+
+	siz_t size_p = bli_packm_init( dt_p, &cc, p, cntl );
+	if ( size_p == 0 )
+		return;
+
+	void* buffer = bli_packm_alloc( size_p, cntl, thread );
+	bli_obj_set_buffer( buffer, p );
+
+	num_t   dt_c           = bli_obj_dt( c );
+	        dt_p           = bli_obj_dt( p );
+	dim_t   dt_c_size      = bli_dt_size( dt_c );
+	dim_t   dt_p_size      = bli_dt_size( dt_p );
+
+	struc_t strucc         = bli_obj_struc( c );
+	diag_t  diagc          = bli_obj_diag( c );
+	uplo_t  uploc          = bli_obj_uplo( c );
+	conj_t  conjc          = bli_obj_conj_status( c );
+	conj_t  conjc2         = bli_obj_conj_status( &c2 );
+
+	dim_t   iter_dim       = bli_obj_length( p );
+	dim_t   panel_len_max  = bli_obj_padded_width( p );
+
+	char*   c_cast         = bli_obj_buffer_at_off( c );
+	inc_t   incc           = bli_obj_row_stride( c );
+	inc_t   ldc            = bli_obj_col_stride( c );
+	char*   c2_cast        = bli_obj_buffer_at_off( &c2 );
+	inc_t   incc2          = bli_obj_row_stride( &c2 );
+	inc_t   ldc2           = bli_obj_col_stride( &c2 );
+	dim_t   panel_dim_off  = bli_obj_row_off( c );
+	dim_t   panel_len_off  = bli_obj_col_off( c );
+
+	char*   p_cast         = bli_obj_buffer( p );
+	inc_t   ldp            = bli_obj_col_stride( p );
+	dim_t   panel_dim_max  = bli_obj_panel_dim( p );
+	inc_t   ps_p           = bli_obj_panel_stride( p );
+	dim_t   bcast_p        = bli_packm_def_cntl_bmult_m_bcast( cntl );
+
+	// If both terms carry the same scalar, it is handled as usual (i.e.,
+	// typically left attached to p for the microkernel to apply).
+	// Otherwise, each scalar is applied to its term during packing.
+	obj_t   kappa_local, kappa2_local;
+	char*   kappa_cast;
+	char*   kappa2_cast;
+
+	bli_obj_scalar_detach( &c2, &kappa2_local );
+
+	if ( bli_obj_scalar_equals( p, &kappa2_local ) )
+	{
+		kappa_cast  = bli_packm_scalar( &kappa_local, p );
+		kappa2_cast = kappa_cast;
+	}
+	else
+	{
+		bli_obj_scalar_detach( p, &kappa_local );
+		bli_obj_scalar_reset( p );
+
+		kappa_cast  = bli_obj_buffer_for_1x1( dt_p, &kappa_local );
+		kappa2_cast = bli_obj_buffer_for_1x1( dt_p, &kappa2_local );
+	}
+
+	// Query the datatype-specific function pointer from the control tree.
+	packm_ker_ft packm_ker_cast = bli_packm_def_cntl_ukr( cntl );
+	const void*  params         = bli_packm_def_cntl_ukr_params( cntl );
+
+	// Compute the total number of iterations we'll need.
+	dim_t n_iter = iter_dim / panel_dim_max + ( iter_dim % panel_dim_max ? 1 : 0 );
+
+	// Query the number of threads (single-member thread teams) and the thread
+	// team ids from the current thread's packm thrinfo_t node.
+	const dim_t nt  = bli_thrinfo_num_threads( thread );
+	const dim_t tid = bli_thrinfo_thread_id( thread );
+
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_slrr( tid, nt, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	char* p_begin = p_cast;
+
+	// Iterate over every logical micropanel in the source matrices.
+	for ( dim_t ic = 0, it = 0; it < n_iter; ic += panel_dim_max, it += 1 )
+	{
+		dim_t  panel_dim_i     = bli_min( panel_dim_max, iter_dim - ic );
+		dim_t  panel_dim_off_i = panel_dim_off + ic;
+
+		char*  c_begin         = c_cast  + (ic  )*incc *dt_c_size;
+		char*  c2_begin        = c2_cast + (ic  )*incc2*dt_c_size;
+
+		if ( bli_is_my_iter( it, it_start, it_end, tid, nt ) )
+		{
+			// Pack the k columns of c into the leading part of the
+			// micropanel, without any zero-padding...
+			packm_ker_cast
+			(
+			  strucc,
+			  diagc,
+			  uploc,
+			  conjc,
+			  schema,
+			  FALSE,
+			  panel_dim_i,
+			  k,
+			  panel_dim_max,
+			  k,
+			  panel_dim_off_i,
+			  panel_len_off,
+			  bcast_p,
+			  kappa_cast,
+			  c_begin, incc, ldc,
+			  p_begin,       ldp,
+			  params,
+			  cntx
+			);
+
+			// ...followed by the k columns of c2, plus the zero-padding
+			// for the whole micropanel.
+			packm_ker_cast
+			(
+			  strucc,
+			  diagc,
+			  uploc,
+			  conjc2,
+			  schema,
+			  FALSE,
+			  panel_dim_i,
+			  k,
+			  panel_dim_max,
+			  panel_len_max - k,
+			  panel_dim_off_i,
+			  panel_len_off,
+			  bcast_p,
+			  kappa2_cast,
+			  c2_begin, incc2, ldc2,
+			  p_begin + k*ldp*dt_p_size, ldp,
+			  params,
+			  cntx
+			);
+		}
+
+		p_begin += ps_p*dt_p_size;
+	}
+}
+
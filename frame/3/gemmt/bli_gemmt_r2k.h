@@ -0,0 +1,72 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// -- Fused rank-2k gemmt -------------------------------------------------------
+//
+
+// bli_gemmt_r2k_ex() computes
+//
+//   C := beta * C + alpha * A * B + alpha2 * A2 * B2
+//
+// on the stored triangle of C, where A and A2 are m x k and B and B2 are
+// k x m, in a single traversal of C. This is the computation behind her2k
+// and syr2k with m x k operands X and Y: her2k passes A = X, B = Y^H,
+// A2 = Y, B2 = X^H, alpha2 = conj(alpha), and syr2k passes A = X, B = Y^T,
+// A2 = Y, B2 = X^T, alpha2 = alpha. Each micropanel of A is packed with the
+// k columns of A followed by the k columns of A2, and each micropanel of B
+// with the k rows of B followed by the k rows of B2, so that every
+// microkernel call performs a rank-2k update and each element of C is loaded
+// and stored once per KC block instead of twice. If C is Hermitian, the
+// imaginary parts of its diagonal elements are zeroed as they are written
+// back.
+//
+// The fused path is used for native execution when A, B, A2, B2, and C
+// share the same datatype; otherwise (or if the operation is trivial), the
+// two updates are performed by separate calls to bli_gemmt_ex().
+
+BLIS_EXPORT_BLIS void bli_gemmt_r2k_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  alpha2,
+       const obj_t*  a2,
+       const obj_t*  b2,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
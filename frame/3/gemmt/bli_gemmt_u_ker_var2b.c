@@ -42,7 +42,8 @@ typedef void (*xpbys_mxn_u_ft)
             dim_t  n,
       const void*  x, inc_t rs_x, inc_t cs_x,
       const void*  b,
-            void*  y, inc_t rs_y, inc_t cs_y
+            void*  y, inc_t rs_y, inc_t cs_y,
+            bool   realdiag
     );
 
 #undef  GENTFUNC
@@ -55,7 +56,8 @@ BLIS_INLINE void PASTEMAC(ch,op) \
             dim_t  n, \
       const void*  x, inc_t rs_x, inc_t cs_x, \
       const void*  b, \
-            void*  y, inc_t rs_y, inc_t cs_y \
+            void*  y, inc_t rs_y, inc_t cs_y, \
+            bool   realdiag \
     ) \
 { \
 	const ctype* restrict x_cast = x; \
@@ -73,6 +75,19 @@ BLIS_INLINE void PASTEMAC(ch,op) \
 	  b_cast, \
 	  y_cast, rs_y, cs_y \
 	); \
+\
+	/* If C is Hermitian, the imaginary parts of its diagonal elements are \
+	   zeroed as the microtile is written back. */ \
+	if ( realdiag ) \
+	{ \
+		for ( dim_t ii = 0; ii < m; ++ii ) \
+		{ \
+			const doff_t jj = diagoff + ( doff_t )ii; \
+\
+			if ( 0 <= jj && jj < n ) \
+				bli_tseti0s( ch, *( y_cast + ii*rs_y + jj*cs_y ) ); \
+		} \
+	} \
 }
 
 INSERT_GENTFUNC_BASIC(xpbys_mxn_u_fn);
@@ -91,6 +106,14 @@ void bli_gemmt_u_ker_var2b
              thrinfo_t* thread_par
      )
 {
+	// The tlb partitioning below is static. When dynamic scheduling of the
+	// jr/ir loops was requested, defer to bli_gemmt_u_ker_var2(), which implements it.
+	if ( bli_thrinfo_jrir_dyn( thread_par ) )
+	{
+		bli_gemmt_u_ker_var2( a, b, c, cntx, cntl, thread_par );
+		return;
+	}
+
 	const num_t  dt_comp   = bli_gemm_var_cntl_comp_dt( cntl );
 	const num_t  dt_a      = bli_obj_dt( a );
 	const num_t  dt_b      = bli_obj_dt( b );
@@ -141,6 +164,7 @@ void bli_gemmt_u_ker_var2b
 	gemm_ukr_ft    gemm_ukr        = bli_gemm_var_cntl_ukr( cntl );
 	const void*    params          = bli_gemm_var_cntl_params( cntl );
 	xpbys_mxn_u_ft xpbys_mxn_u_ukr = xpbys_mxn_u[ dt_c ];
+	const bool     realdiag        = bli_obj_is_hermitian( c );
 
 	// Temporary C buffer for edge cases. Note that the strides of this
 	// temporary buffer are set so that they match the storage of the
@@ -339,7 +363,8 @@ void bli_gemmt_u_ker_var2b
 				  m_cur, n_cur,
 				  ct,  rs_ct, cs_ct,
 				  ( void* )beta_cast,
-				  c11, rs_c,  cs_c
+				  c11, rs_c,  cs_c,
+				  realdiag
 				);
 
 				// Increment the microtile counter and check if the thread is done.
@@ -192,9 +192,28 @@ void bli_trmm_ll_ker_var2
 	bli_thread_range_slrr( jr_tid, jr_nt, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc );
 	//bli_thread_range_rr( ir_tid, ir_nt, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc );
 
+	// If dynamic scheduling was requested, every thread instead visits all
+	// columns of microtiles and computes the ones it claims. (All columns
+	// represent the same amount of work here, so this only helps when some
+	// threads run slower than others.)
+	const bool jrir_dyn  = bli_thrinfo_jrir_dyn( thread_par ) &&
+	                       bli_thrinfo_num_threads( thread_par ) > 1;
+	      dim_t dyn_start = 0;
+	      dim_t dyn_end   = 0;
+
+	if ( jrir_dyn )
+	{
+		jr_start = 0; jr_end = n_iter; jr_inc = 1;
+	}
+
 	// Loop over the n dimension (NR columns at a time).
 	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 	{
+		// Skip the columns of microtiles claimed by other threads.
+		if ( jrir_dyn &&
+		     !bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end ) )
+			continue;
+
 		const char* b1 = b_cast + j * cstep_b;
 		      char* c1 = c_cast + j * cstep_c;
 
@@ -315,6 +334,9 @@ void bli_trmm_ll_ker_var2
 			c11 += rstep_c;
 		}
 	}
+
+	if ( jrir_dyn )
+		bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
 }
 
 //PASTEMAC(ch,printm)( "trmm_ll_ker_var2: a1", MR, k_a1011, a1,   1, MR, "%4.1f", "" );
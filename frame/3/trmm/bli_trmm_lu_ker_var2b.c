@@ -45,6 +45,14 @@ void bli_trmm_lu_ker_var2b
              thrinfo_t* thread_par
      )
 {
+	// The tlb partitioning below is static. When dynamic scheduling of the
+	// jr/ir loops was requested, defer to bli_trmm_lu_ker_var2(), which implements it.
+	if ( bli_thrinfo_jrir_dyn( thread_par ) )
+	{
+		bli_trmm_lu_ker_var2( a, b, c, cntx, cntl, thread_par );
+		return;
+	}
+
 	const num_t  dt_comp   = bli_gemm_var_cntl_comp_dt( cntl );
 	const num_t  dt_a      = bli_obj_dt( a );
 	const num_t  dt_b      = bli_obj_dt( b );
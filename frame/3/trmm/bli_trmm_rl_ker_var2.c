@@ -187,8 +187,8 @@ void bli_trmm_rl_ker_var2
 	// Query the number of threads and thread ids for each loop.
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
-	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
-	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+	      dim_t ir_nt  = bli_thrinfo_n_way( caucus );
+	      dim_t ir_tid = bli_thrinfo_work_id( caucus );
 
 	dim_t jr_start, jr_end, jr_inc;
 	dim_t ir_start, ir_end, ir_inc;
@@ -225,9 +225,30 @@ void bli_trmm_rl_ker_var2
 	bli_thread_range_slrr( jr_tid, jr_nt, n_iter_rct, 1, FALSE, &jr_start, &jr_end, &jr_inc );
 	bli_thread_range_slrr( ir_tid, ir_nt, m_iter,     1, FALSE, &ir_start, &ir_end, &ir_inc );
 
+	// If dynamic scheduling was requested, every thread instead visits all
+	// columns of microtiles, in both regions, and computes the ones that it
+	// claims. Since columns are claimed as threads become free, the uneven
+	// amount of work per column in the triangular region balances itself.
+	const bool jrir_dyn  = bli_thrinfo_jrir_dyn( thread_par ) &&
+	                       bli_thrinfo_num_threads( thread_par ) > 1;
+	      dim_t dyn_start = 0;
+	      dim_t dyn_end   = 0;
+
+	if ( jrir_dyn )
+	{
+		jr_start = 0; jr_end = n_iter_rct; jr_inc = 1;
+		ir_start = 0; ir_end = m_iter; ir_inc = 1;
+		ir_tid   = 0; ir_nt  = 1;
+	}
+
 	// Loop over the n dimension (NR columns at a time).
 	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 	{
+		// Skip the columns of microtiles claimed by other threads.
+		if ( jrir_dyn &&
+		     !bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end ) )
+			continue;
+
 		const char* b1 = b_cast + j * cstep_b;
 		      char* c1 = c_cast + j * cstep_c;
 
@@ -279,7 +300,12 @@ void bli_trmm_rl_ker_var2
 	}
 
 	// If there is no triangular region, then we're done.
-	if ( n_iter_tri == 0 ) return;
+	if ( n_iter_tri == 0 )
+	{
+		if ( jrir_dyn )
+			bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
+		return;
+	}
 
 	// Use round-robin assignment of micropanels to threads in the 2nd and
 	// 1st loops for the remaining triangular region of B (if it exists).
@@ -324,12 +350,17 @@ void bli_trmm_rl_ker_var2
 			      ps_b_cur += ( bli_is_odd( ps_b_cur ) ? 1 : 0 );
 			      ps_b_cur *= dt_b_size;
 
-			if ( bli_trmm_my_iter_rr( j, thread ) ) {
+			const bool is_my_col
+			=
+			jrir_dyn ? bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end )
+			         : bli_trmm_my_iter_rr( j, thread );
+
+			if ( is_my_col ) {
 
 			// Loop over the m dimension (MR rows at a time).
 			for ( dim_t i = 0; i < m_iter; ++i )
 			{
-				if ( bli_trmm_my_iter_rr( i, caucus ) ) {
+				if ( jrir_dyn || bli_trmm_my_iter_rr( i, caucus ) ) {
 
 				const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left );
 
@@ -376,6 +407,9 @@ void bli_trmm_rl_ker_var2
 
 		c1 += cstep_c;
 	}
+
+	if ( jrir_dyn )
+		bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
 }
 
 //PASTEMAC(ch,fprintm)( stdout, "trmm_rl_ker_var2: a1", MR, k_b1121, a1, 1, MR, "%4.1f", "" );
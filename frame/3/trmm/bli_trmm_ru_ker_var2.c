@@ -188,8 +188,8 @@ void bli_trmm_ru_ker_var2
 	// Query the number of threads and thread ids for each loop.
 	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
 	const dim_t jr_tid = bli_thrinfo_work_id( thread );
-	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
-	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+	      dim_t ir_nt  = bli_thrinfo_n_way( caucus );
+	      dim_t ir_tid = bli_thrinfo_work_id( caucus );
 
 	dim_t jr_start, jr_end, jr_inc;
 	dim_t ir_start, ir_end, ir_inc;
@@ -225,6 +225,15 @@ void bli_trmm_ru_ker_var2
 	// of the jr and ir loops but skip all but the pointer increment for
 	// iterations that are not assigned to it.
 
+	// If dynamic scheduling was requested, every thread instead visits all
+	// columns of microtiles, in both regions, and computes the ones that it
+	// claims. Since columns are claimed as threads become free, the uneven
+	// amount of work per column in the triangular region balances itself.
+	const bool jrir_dyn  = bli_thrinfo_jrir_dyn( thread_par ) &&
+	                       bli_thrinfo_num_threads( thread_par ) > 1;
+	      dim_t dyn_start = 0;
+	      dim_t dyn_end   = 0;
+
 	const char* b1 = b_cast;
 	      char* c1 = c_cast;
 
@@ -258,12 +267,17 @@ void bli_trmm_ru_ker_var2
 			      ps_b_cur += ( bli_is_odd( ps_b_cur ) ? 1 : 0 );
 			      ps_b_cur *= dt_b_size;
 
-			if ( bli_trmm_my_iter_rr( j, thread ) ) {
+			const bool is_my_col
+			=
+			jrir_dyn ? bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end )
+			         : bli_trmm_my_iter_rr( j, thread );
+
+			if ( is_my_col ) {
 
 			// Loop over the m dimension (MR rows at a time).
 			for ( dim_t i = 0; i < m_iter; ++i )
 			{
-				if ( bli_trmm_my_iter_rr( i, caucus ) ) {
+				if ( jrir_dyn || bli_trmm_my_iter_rr( i, caucus ) ) {
 
 				const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left )
 				                      ? MR : m_left );
@@ -311,7 +325,12 @@ void bli_trmm_ru_ker_var2
 	}
 
 	// If there is no rectangular region, then we're done.
-	if ( n_iter_rct == 0 ) return;
+	if ( n_iter_rct == 0 )
+	{
+		if ( jrir_dyn )
+			bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
+		return;
+	}
 
 	// Determine the thread range and increment for the 2nd and 1st loops for
 	// the remaining rectangular region of B.
@@ -327,6 +346,13 @@ void bli_trmm_ru_ker_var2
 	      jr_end   += n_iter_tri;
 	dim_t jb0       = n_iter_tri;
 
+	if ( jrir_dyn )
+	{
+		jr_start = n_iter_tri; jr_end = n_iter; jr_inc = 1;
+		ir_start = 0; ir_end = m_iter; ir_inc = 1;
+		ir_tid   = 0; ir_nt  = 1;
+	}
+
 	// Save the resulting value of b1 from the previous loop since it represents
 	// the starting point for the rectangular region.
 	b_cast = b1;
@@ -334,6 +360,11 @@ void bli_trmm_ru_ker_var2
 	// Loop over the n dimension (NR columns at a time).
 	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
 	{
+		// Skip the columns of microtiles claimed by other threads.
+		if ( jrir_dyn &&
+		     !bli_is_my_iter_dyn( thread_par, n_iter, j, &dyn_start, &dyn_end ) )
+			continue;
+
 		// NOTE: We must index through b_cast differently since it contains
 		// the starting address of the rectangular region (which is already
 		// n_iter_tri logical iterations through B).
@@ -390,6 +421,9 @@ void bli_trmm_ru_ker_var2
 			}
 		}
 	}
+
+	if ( jrir_dyn )
+		bli_thread_range_dyn_finish( thread_par, n_iter, &dyn_start, &dyn_end );
 }
 
 //PASTEMAC(ch,fprintm)( stdout, "trmm_ru_ker_var2: a1", MR, k_b0111, a1, 1, MR, "%4.1f", "" );
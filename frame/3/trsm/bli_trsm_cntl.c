@@ -303,9 +303,13 @@ void bli_trsm_l_cntl_init
 	  nr_scale,
 	  &cntl->trsm_ker
 	);
+	// The 1st loop cannot be parallelized in the trsm branch due to the
+	// inter-iteration dependencies (see bli_trsm_ll_ker_var2()), so the ways
+	// of the ir loop are given to the jr loop instead. Otherwise, the threads
+	// of an ir group would all update the same microtiles of B in place.
 	bli_cntl_attach_sub_node
 	(
-	  BLIS_THREAD_MC | BLIS_THREAD_KC | BLIS_THREAD_NR,
+	  BLIS_THREAD_MC | BLIS_THREAD_KC | BLIS_THREAD_MR | BLIS_THREAD_NR,
 	  ( cntl_t* )&cntl->ir_loop_trsm,
 	  ( cntl_t* )&cntl->trsm_ker
 	);
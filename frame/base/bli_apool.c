@@ -133,6 +133,7 @@ void bli_apool_init
 	bli_pool_set_num_blocks( num_blocks, pool );
 	bli_pool_set_block_size( block_size, pool );
 	bli_pool_set_align_size( align_size, pool );
+	bli_pool_set_node( -1, pool );
 	bli_pool_set_malloc_fp( NULL, pool );
 	bli_pool_set_free_fp( NULL, pool );
 }
@@ -438,6 +439,7 @@ pool_t* bli_apool_array_elem
 		  block_size,
 		  align_size,
 		  offset_size,
+		  -1,
 		  malloc_fp,
 		  free_fp,
 		  pool
@@ -54,6 +54,11 @@
   // is normally defined in bli_config_macro_defs.h.)
   #define BLIS_EXPORT_BLIS
 
+  // The memory broker data structures in bli_type_defs.h are sized by the
+  // maximum number of NUMA nodes; a single node suffices here. (This macro
+  // is normally defined in bli_config_macro_defs.h.)
+  #define BLIS_NUMA_MAX_NODES 1
+
   #include "bli_system.h"
   #include "bli_type_defs.h"
   #include "bli_arch.h"
@@ -229,6 +234,12 @@ arch_t bli_arch_query_id_impl( void )
 		#endif
 
 		// AMD microarchitectures.
+		#ifdef BLIS_FAMILY_ZEN5
+		id = BLIS_ARCH_ZEN5;
+		#endif
+		#ifdef BLIS_FAMILY_ZEN4
+		id = BLIS_ARCH_ZEN4;
+		#endif
 		#ifdef BLIS_FAMILY_ZEN3
 		id = BLIS_ARCH_ZEN3;
 		#endif
@@ -390,7 +401,10 @@ static const char* config_name[ BLIS_NUM_ARCHS ] =
     "sifive_rvv",
     "sifive_x280",
 
-    "generic"
+    "generic",
+
+    "zen4",
+    "zen5"
 };
 
 const char* bli_arch_string( arch_t id )
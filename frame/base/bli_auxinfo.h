@@ -91,6 +91,10 @@ BLIS_INLINE const void* bli_auxinfo_params( const auxinfo_t* ai )
 {
 	return ai->params;
 }
+BLIS_INLINE const void* bli_auxinfo_epi( const auxinfo_t* ai )
+{
+	return ai->epi;
+}
 
 
 // auxinfo_t field modification
@@ -153,6 +157,10 @@ BLIS_INLINE void bli_auxinfo_set_params( const void* params, auxinfo_t* ai )
 {
 	ai->params = params;
 }
+BLIS_INLINE void bli_auxinfo_set_epi( const void* epi, auxinfo_t* ai )
+{
+	ai->epi = epi;
+}
 
 #endif
 
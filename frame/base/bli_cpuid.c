@@ -67,6 +67,11 @@
   // is normally defined in bli_config_macro_defs.h.)
   #define BLIS_EXPORT_BLIS
 
+  // The memory broker data structures in bli_type_defs.h are sized by the
+  // maximum number of NUMA nodes; a single node suffices here. (This macro
+  // is normally defined in bli_config_macro_defs.h.)
+  #define BLIS_NUMA_MAX_NODES 1
+
   #include "bli_system.h"
   #include "bli_type_defs.h"
   #include "bli_arch.h"
@@ -132,6 +137,14 @@ arch_t bli_cpuid_query_id( void )
 
 		// Check for each AMD configuration that is enabled, check for that
 		// microarchitecture. We check from most recent to most dated.
+#ifdef BLIS_CONFIG_ZEN5
+		if ( bli_cpuid_is_zen5( family, model, features ) )
+			return BLIS_ARCH_ZEN5;
+#endif
+#ifdef BLIS_CONFIG_ZEN4
+		if ( bli_cpuid_is_zen4( family, model, features ) )
+			return BLIS_ARCH_ZEN4;
+#endif
 #ifdef BLIS_CONFIG_ZEN3
 		if ( bli_cpuid_is_zen3( family, model, features ) )
 			return BLIS_ARCH_ZEN3;
@@ -283,6 +296,72 @@ bool bli_cpuid_is_penryn
 
 // -----------------------------------------------------------------------------
 
+bool bli_cpuid_is_zen5
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_AVX      |
+	                          FEATURE_FMA3     |
+	                          FEATURE_AVX2     |
+	                          FEATURE_AVX512F  |
+	                          FEATURE_AVX512DQ |
+	                          FEATURE_AVX512BW |
+	                          FEATURE_AVX512VL ;
+
+	if ( !bli_cpuid_has_features( features, expected ) ) return FALSE;
+
+	// All Zen5 cores have a family of 0x1a.
+	if ( family != 0x1a ) return FALSE;
+
+	// NOTE: We accept any model because the family 26 (0x1a) is unique to
+	// Zen5, so the model is not checked.
+	( void )model;
+
+	return TRUE;
+}
+
+bool bli_cpuid_is_zen4
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_AVX      |
+	                          FEATURE_FMA3     |
+	                          FEATURE_AVX2     |
+	                          FEATURE_AVX512F  |
+	                          FEATURE_AVX512DQ |
+	                          FEATURE_AVX512BW |
+	                          FEATURE_AVX512VL ;
+
+	if ( !bli_cpuid_has_features( features, expected ) ) return FALSE;
+
+	// Zen4 cores share the family of 0x19 with Zen3.
+	if ( family != 0x19 ) return FALSE;
+
+	// Finally, check for specific models:
+	// - 0x10 ~ 0x1f (Genoa, Genoa-X)
+	// - 0x60 ~ 0x7f (Raphael, Phoenix)
+	// - 0xa0 ~ 0xaf (Bergamo, Siena)
+	// NOTE: Zen3 does not implement AVX-512, so the feature check above
+	// already rules it out; the model ranges are checked for good measure.
+	const bool is_arch
+	=
+	( 0x10 <= model && model <= 0x1f ) ||
+	( 0x60 <= model && model <= 0x7f ) ||
+	( 0xa0 <= model && model <= 0xaf );
+
+	if ( !is_arch ) return FALSE;
+
+	return TRUE;
+}
+
 bool bli_cpuid_is_zen3
      (
        uint32_t family,
@@ -641,6 +720,10 @@ enum
 	FEATURE_MASK_AVX512CD = (1u<<28), // cpuid[eax=7,ecx=0]   :ebx[28]
 	FEATURE_MASK_AVX512BW = (1u<<30), // cpuid[eax=7,ecx=0]   :ebx[30]
 	FEATURE_MASK_AVX512VL = (1u<<31), // cpuid[eax=7,ecx=0]   :ebx[31]
+	FEATURE_MASK_F16C     = (1u<<29), // cpuid[eax=1]         :ecx[29]
+	FEATURE_MASK_AVX512BF16 = (1u<<5),// cpuid[eax=7,ecx=1]   :eax[5]
+	FEATURE_MASK_AVX512VNNI = (1u<<11),//cpuid[eax=7,ecx=0]   :ecx[11]
+	FEATURE_MASK_AVXVNNI  = (1u<< 4), // cpuid[eax=7,ecx=1]   :eax[4]
 	FEATURE_MASK_XGETBV   = (1u<<26)|
                             (1u<<27), // cpuid[eax=1]         :ecx[27:26]
 	XGETBV_MASK_XMM       = 0x02u,    // xcr0[1]
@@ -707,6 +790,18 @@ uint32_t bli_cpuid_query
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512CD ) ) *features |= FEATURE_AVX512CD;
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512BW ) ) *features |= FEATURE_AVX512BW;
 		if ( bli_cpuid_has_features( ebx, FEATURE_MASK_AVX512VL ) ) *features |= FEATURE_AVX512VL;
+
+		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_AVX512VNNI ) ) *features |= FEATURE_AVX512VNNI;
+
+		// Sub-leaf 1 (reported as the maximum sub-leaf in eax of sub-leaf 0)
+		// holds the reduced-precision arithmetic features.
+		if ( eax >= 1 )
+		{
+			__cpuid_count( 7, 1, eax, ebx, ecx, edx );
+
+			if ( bli_cpuid_has_features( eax, FEATURE_MASK_AVX512BF16 ) ) *features |= FEATURE_AVX512BF16;
+			if ( bli_cpuid_has_features( eax, FEATURE_MASK_AVXVNNI    ) ) *features |= FEATURE_AVXVNNI;
+		}
 	}
 
 	// Check extended processor info / features bits for AMD-specific features.
@@ -790,6 +885,7 @@ uint32_t bli_cpuid_query
 		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_SSE42 ) ) *features |= FEATURE_SSE42;
 		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_AVX   ) ) *features |= FEATURE_AVX;
 		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_FMA3  ) ) *features |= FEATURE_FMA3;
+		if ( bli_cpuid_has_features( ecx, FEATURE_MASK_F16C  ) ) *features |= FEATURE_F16C;
 
 		// Check whether the hardware supports xsave/xrestor/xsetbv/xgetbv AND
 		// support for these is enabled by the OS. If so, then we proceed with
@@ -834,7 +930,9 @@ uint32_t bli_cpuid_query
 				                FEATURE_AVX512ER |
 				                FEATURE_AVX512CD |
 				                FEATURE_AVX512BW |
-				                FEATURE_AVX512VL );
+				                FEATURE_AVX512VL |
+				                FEATURE_AVX512BF16 |
+				                FEATURE_AVX512VNNI );
 			}
 
 			// The OS can manage the state of 256-bit ymm (AVX) registers
@@ -846,7 +944,9 @@ uint32_t bli_cpuid_query
 				*features &= ~( FEATURE_AVX  |
 				                FEATURE_AVX2 |
 				                FEATURE_FMA3 |
-				                FEATURE_FMA4 );
+				                FEATURE_FMA4 |
+				                FEATURE_F16C |
+				                FEATURE_AVXVNNI );
 			}
 
 			// The OS can manage the state of 128-bit xmm (SSE) registers
@@ -1388,3 +1488,182 @@ char* find_string_in( char* target, char* buffer, size_t buf_len, char* filepath
 
 #endif
 
+
+// -----------------------------------------------------------------------------
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+
+static bool bli_cpuid_query_cache_x86( dim_t level, bli_cache_info_t* info )
+{
+	uint32_t eax, ebx, ecx, edx;
+
+	uint32_t cpuid_max     = __get_cpuid_max( 0,           0 );
+	uint32_t cpuid_max_ext = __get_cpuid_max( 0x80000000u, 0 );
+
+	// The fourth '0' serves as the NULL-terminator for the vendor string.
+	uint32_t vendor_string[4] = { 0, 0, 0, 0 };
+
+	__cpuid( 0, eax, vendor_string[0],
+	                 vendor_string[2],
+	                 vendor_string[1] );
+
+	// Intel enumerates its caches via the deterministic cache parameters
+	// leaf (4). AMD provides the same information, in the same format, via
+	// leaf 0x8000001D if topology extensions are supported.
+	uint32_t leaf = 0;
+
+	if ( strcmp( ( char* )vendor_string, "GenuineIntel" ) == 0 )
+	{
+		if ( cpuid_max >= 4 ) leaf = 4;
+	}
+	else if ( strcmp( ( char* )vendor_string, "AuthenticAMD" ) == 0 )
+	{
+		if ( cpuid_max_ext >= 0x8000001Du )
+		{
+			__cpuid( 0x80000001u, eax, ebx, ecx, edx );
+			if ( ecx & ( 1u << 22 ) ) leaf = 0x8000001Du;
+		}
+	}
+
+	if ( leaf == 0 ) return FALSE;
+
+	for ( uint32_t i = 0; i < 32; ++i )
+	{
+		__cpuid_count( leaf, i, eax, ebx, ecx, edx );
+
+		const uint32_t type = eax & 0x1f;          // eax[4:0]
+		const uint32_t lvl  = ( eax >> 5 ) & 0x7;  // eax[7:5]
+
+		// A type of zero indicates that there are no more caches. Skip
+		// instruction caches (type 2).
+		if ( type == 0 ) break;
+		if ( type == 2 || lvl != level ) continue;
+
+		const dim_t line_size  = (   ebx         & 0xfff ) + 1; // ebx[11:0]
+		const dim_t partitions = ( ( ebx >> 12 ) & 0x3ff ) + 1; // ebx[21:12]
+		const dim_t assoc      = ( ( ebx >> 22 ) & 0x3ff ) + 1; // ebx[31:22]
+		const dim_t num_sets   =     ecx                   + 1;
+
+		info->line_size   = line_size;
+		info->assoc       = assoc;
+		info->num_sets    = num_sets * partitions;
+		info->size        = line_size * assoc * num_sets * partitions;
+		// eax[25:14] holds the maximum number of logical processor ids that
+		// may share the cache. It is sized to the id space (and thus often
+		// rounded up to a power of two), so it can exceed the number of
+		// logical processors that actually exist. Clamp it to the number of
+		// logical processors in the package, as given by the topology leaf
+		// (0xB). bli_cpuid_query_cache() replaces it with the real count
+		// where sysfs is available.
+		dim_t num_sharing = ( ( eax >> 14 ) & 0xfff ) + 1;
+
+		if ( cpuid_max >= 0xB )
+		{
+			uint32_t eax_t, ebx_t, ecx_t, edx_t;
+
+			__cpuid_count( 0xB, 1, eax_t, ebx_t, ecx_t, edx_t );
+
+			const dim_t num_logical = ebx_t & 0xffff;  // ebx[15:0]
+
+			if ( 0 < num_logical && num_logical < num_sharing ) num_sharing = num_logical;
+		}
+
+		info->num_sharing = num_sharing;
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+#endif
+
+#if defined(__linux__) && !defined(BLIS_CONFIGURETIME_CPUID)
+
+static bool bli_cpuid_read_sysfs( const char* dir, const char* file, char* buf, int len )
+{
+	char path[ 128 ];
+	snprintf( path, sizeof( path ), "%s/%s", dir, file );
+
+	FILE* stream = fopen( path, "r" );
+	if ( stream == NULL ) return FALSE;
+
+	char* r_val = fgets( buf, len, stream );
+	fclose( stream );
+
+	return r_val != NULL;
+}
+
+static bool bli_cpuid_query_cache_sysfs( dim_t level, bli_cache_info_t* info )
+{
+	for ( int i = 0; i < 16; ++i )
+	{
+		char dir[ 64 ];
+		char buf[ 256 ];
+
+		snprintf( dir, sizeof( dir ),
+		          "/sys/devices/system/cpu/cpu0/cache/index%d", i );
+
+		if ( !bli_cpuid_read_sysfs( dir, "level", buf, sizeof( buf ) ) ) break;
+		if ( atoi( buf ) != level ) continue;
+
+		if ( !bli_cpuid_read_sysfs( dir, "type", buf, sizeof( buf ) ) ) continue;
+		if ( strncmp( buf, "Instruction", 11 ) == 0 ) continue;
+
+		// The size is reported as, e.g., "48K" or "2048K".
+		if ( !bli_cpuid_read_sysfs( dir, "size", buf, sizeof( buf ) ) ) continue;
+		char* suffix;
+		siz_t size = strtoul( buf, &suffix, 10 );
+		if      ( *suffix == 'K' ) size *= 1024;
+		else if ( *suffix == 'M' ) size *= 1024 * 1024;
+
+		if ( !bli_cpuid_read_sysfs( dir, "ways_of_associativity", buf, sizeof( buf ) ) ) continue;
+		const dim_t assoc = atoi( buf );
+
+		if ( !bli_cpuid_read_sysfs( dir, "coherency_line_size", buf, sizeof( buf ) ) ) continue;
+		const dim_t line_size = atoi( buf );
+
+		if ( size == 0 || assoc <= 0 || line_size <= 0 ) continue;
+
+		char path[ 128 ];
+		snprintf( path, sizeof( path ), "%s/shared_cpu_list", dir );
+		const dim_t num_sharing = bli_max( bli_cpuset_count_list( path ), 1 );
+
+		info->size        = size;
+		info->assoc       = assoc;
+		info->line_size   = line_size;
+		info->num_sets    = size / ( assoc * line_size );
+		info->num_sharing = num_sharing;
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+#endif
+
+bool bli_cpuid_query_cache( dim_t level, bli_cache_info_t* info )
+{
+	bool found = FALSE;
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+	found = bli_cpuid_query_cache_x86( level, info );
+#endif
+#if defined(__linux__) && !defined(BLIS_CONFIGURETIME_CPUID)
+	// The number of cpus that actually share the cache is only known to the
+	// kernel, so prefer the count from sysfs even when cpuid describes the
+	// rest of the cache.
+	bli_cache_info_t info_sysfs;
+
+	if ( bli_cpuid_query_cache_sysfs( level, &info_sysfs ) )
+	{
+		if ( found ) info->num_sharing = info_sysfs.num_sharing;
+		else         *info             = info_sysfs;
+
+		found = TRUE;
+	}
+#endif
+
+	return found;
+}
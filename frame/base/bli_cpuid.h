@@ -61,6 +61,8 @@ bool bli_cpuid_is_sandybridge( uint32_t family, uint32_t model, uint32_t feature
 bool bli_cpuid_is_penryn( uint32_t family, uint32_t model, uint32_t features );
 
 // AMD
+bool bli_cpuid_is_zen5( uint32_t family, uint32_t model, uint32_t features );
+bool bli_cpuid_is_zen4( uint32_t family, uint32_t model, uint32_t features );
 bool bli_cpuid_is_zen3( uint32_t family, uint32_t model, uint32_t features );
 bool bli_cpuid_is_zen2( uint32_t family, uint32_t model, uint32_t features );
 bool bli_cpuid_is_zen( uint32_t family, uint32_t model, uint32_t features );
@@ -80,6 +82,19 @@ bool bli_cpuid_is_cortexa9( uint32_t model, uint32_t part, uint32_t features );
 
 uint32_t bli_cpuid_query( uint32_t* family, uint32_t* model, uint32_t* features );
 
+// Cache parameters of the data (or unified) cache at a given level, as seen
+// by the calling cpu.
+typedef struct bli_cache_info_s
+{
+	siz_t size;        // total capacity in bytes
+	dim_t assoc;       // ways of associativity
+	dim_t line_size;   // line size in bytes
+	dim_t num_sets;    // number of sets
+	dim_t num_sharing; // number of logical cpus sharing the cache
+} bli_cache_info_t;
+
+bool bli_cpuid_query_cache( dim_t level, bli_cache_info_t* info );
+
 // -----------------------------------------------------------------------------
 
 //
@@ -158,7 +173,11 @@ enum
 	FEATURE_AVX512ER = 0x0800,
 	FEATURE_AVX512CD = 0x1000,
 	FEATURE_AVX512BW = 0x2000,
-	FEATURE_AVX512VL = 0x4000
+	FEATURE_AVX512VL = 0x4000,
+	FEATURE_F16C     = 0x8000,
+	FEATURE_AVX512BF16 = 0x10000,
+	FEATURE_AVX512VNNI = 0x20000,
+	FEATURE_AVXVNNI    = 0x40000
 };
 
 #elif defined(__aarch64__) || defined(__arm__) || defined(_M_ARM) || defined(_ARCH_PPC)
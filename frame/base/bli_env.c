@@ -54,6 +54,11 @@
   // is normally defined in bli_config_macro_defs.h.)
   #define BLIS_EXPORT_BLIS
 
+  // The memory broker data structures in bli_type_defs.h are sized by the
+  // maximum number of NUMA nodes; a single node suffices here. (This macro
+  // is normally defined in bli_config_macro_defs.h.)
+  #define BLIS_NUMA_MAX_NODES 1
+
   #include "bli_system.h"
   #include "bli_type_defs.h"
   //#include "bli_arch.h"
@@ -51,6 +51,7 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 	[-BLIS_INVALID_CONJ]                         = "Invalid conj_t parameter value.",
 	[-BLIS_INVALID_DIAG]                         = "Invalid diag_t parameter value.",
 	[-BLIS_EXPECTED_NONUNIT_DIAG]                = "Expected object with non-unit diagonal.",
+	[-BLIS_INVALID_EPI_ACT]                      = "Invalid epilogue activation function.",
 
 	[-BLIS_INVALID_DATATYPE]                     = "Invalid datatype value.",
 	[-BLIS_EXPECTED_FLOATING_POINT_DATATYPE]     = "Expected floating-point datatype value.",
@@ -93,6 +94,7 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK] = "Pack schema not yet supported/implemented for use with unpacking.",
 	[-BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART]   = "Pack schema not yet supported/implemented for use with partitioning.",
+	[-BLIS_INCOMPATIBLE_PACKED_OBJECT]           = "Packed object is incompatible with the current operation or context.",
 
 	[-BLIS_EXPECTED_NONNULL_OBJECT_BUFFER]       = "Encountered object with non-zero dimensions containing null buffer.",
 
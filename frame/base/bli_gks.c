@@ -53,6 +53,8 @@ static cntx_init_ft cntx_ref_init[ BLIS_NUM_ARCHS ];
 // queries.
 static cntx_t* cached_cntx = NULL;
 
+static void bli_gks_tune_cache_blkszs( cntx_t* cntx );
+
 // -----------------------------------------------------------------------------
 
 int bli_gks_init( void )
@@ -77,6 +79,18 @@ int bli_gks_init( void )
 
 	INSERT_GENTCONF
 
+	// Replace the static cache blocksizes of the context that will be used
+	// on this hardware with values derived from the cache topology reported
+	// by the cpu (unless the user asked us not to). This must wait until
+	// every context is registered, since the architecture may be selected
+	// via BLIS_ARCH_TYPE, which is only accepted for registered contexts.
+	if ( bli_env_get_var( "BLIS_AUTO_CACHE_BLKSZ", BLIS_AUTO_CACHE_BLKSZ_DEF ) != 0 )
+	{
+		cntx_t* gks_id = gks[ bli_arch_query_id() ];
+
+		if ( gks_id != NULL ) bli_gks_tune_cache_blkszs( gks_id );
+	}
+
 #ifdef BLIS_ENABLE_GKS_CACHING
 	// Deep-query and cache the native and induced method contexts so they are
 	// ready to go when needed (by BLIS or the application). Notice that we use
@@ -171,6 +185,139 @@ const cntx_t* bli_gks_lookup_id
 
 // -----------------------------------------------------------------------------
 
+static dim_t bli_gks_round_blksz( dim_t bs, dim_t bs_def, dim_t bs_hi, dim_t mult )
+{
+	// Keep the derived blocksize between a quarter of the value chosen by the
+	// kernel developer and bs_hi, so that an unusual (or misreported) cache
+	// topology cannot push us too far from a known-good configuration.
+	bs = bli_max( bs, bs_def / 4 );
+	bs = bli_min( bs, bs_hi );
+
+	// Round down to the nearest multiple of mult.
+	return bli_max( bs / mult, 1 ) * mult;
+}
+
+static dim_t bli_gks_scale_blksz_max( dim_t bs, dim_t bs_def, dim_t bs_max, dim_t mult )
+{
+	// Preserve the ratio between the maximum and default blocksizes that was
+	// set by the context initialization function.
+	if ( bs_max <= bs_def ) return bs;
+
+	dim_t max = ( bs * bs_max ) / bs_def;
+
+	return ( ( max + mult - 1 ) / mult ) * mult;
+}
+
+static void bli_gks_tune_cache_blkszs( cntx_t* cntx )
+{
+	// Derive KC, MC, and NC from the cache topology, following the analytical
+	// model of Low et al. ("Analytical Modeling Is Enough for High-Performance
+	// BLIS", ACM TOMS 43(2), 2016):
+	//   - KC is chosen so that a micropanel of B (KC x NR) remains in the L1
+	//     cache alongside the micropanel of A (MR x KC) being streamed from
+	//     the L2 cache, with one way left over for the elements of C.
+	//   - MC is chosen so that the block of A (MC x KC) fills the ways of the
+	//     L2 cache that are not needed for a micropanel of B (and, again, one
+	//     way for C).
+	//   - NC is chosen likewise so that the panel of B (KC x NC) fills the
+	//     ways of the L3 cache not occupied by the block of A.
+	// MC and NC are never raised above the static values chosen by the
+	// kernel developer. The model only lowers them on parts whose caches are
+	// too small (or too widely shared) for those values.
+	bli_cache_info_t l1, l2, l3;
+
+	if ( !bli_cpuid_query_cache( 1, &l1 ) ) return;
+	if ( !bli_cpuid_query_cache( 2, &l2 ) ) return;
+
+	const bool has_l3 = bli_cpuid_query_cache( 3, &l3 );
+
+	if ( l1.assoc < 2 || l2.assoc < 2 ) return;
+
+	// The size of one way of each cache, in bytes.
+	const dim_t way1 = l1.num_sets * l1.line_size;
+	const dim_t way2 = l2.num_sets * l2.line_size;
+	const dim_t way3 = has_l3 ? l3.num_sets * l3.line_size : 0;
+
+	// When the L2 cache is shared between hardware threads of the same core
+	// (SMT), each of them packs its own block of A into it.
+	const dim_t l2_share = bli_max( l2.num_sharing, 1 );
+
+	// Likewise, every core sharing the L3 cache keeps its block of A there
+	// while the panel of B is shared among all of them.
+	const dim_t l3_share = has_l3 ? bli_max( l3.num_sharing / l2_share, 1 ) : 1;
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		const dim_t dt_size = bli_dt_size( dt );
+
+		const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+
+		const dim_t mc_def = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+		const dim_t nc_def = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+		const dim_t kc_def = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+		const dim_t mc_max = bli_cntx_get_blksz_max_dt( dt, BLIS_MC, cntx );
+		const dim_t nc_max = bli_cntx_get_blksz_max_dt( dt, BLIS_NC, cntx );
+		const dim_t kc_max = bli_cntx_get_blksz_max_dt( dt, BLIS_KC, cntx );
+
+		if ( mr <= 0 || nr <= 0 || mc_def <= 0 || nc_def <= 0 || kc_def <= 0 )
+			continue;
+
+		const dim_t kc_mult = bli_cntx_get_bmult_dt( dt, BLIS_KC, cntx );
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+		const dim_t mc_mult = bli_lcm( bli_cntx_get_bmult_dt( dt, BLIS_MC, cntx ), nr );
+		const dim_t nc_mult = bli_lcm( bli_cntx_get_bmult_dt( dt, BLIS_NC, cntx ), mr );
+#else
+		const dim_t mc_mult = bli_cntx_get_bmult_dt( dt, BLIS_MC, cntx );
+		const dim_t nc_mult = bli_cntx_get_bmult_dt( dt, BLIS_NC, cntx );
+#endif
+
+		// L1: the ways given to the micropanel of A, in proportion to the
+		// relative sizes of the micropanels of A and B.
+		const dim_t w1_a = ( ( l1.assoc - 1 ) * mr ) / ( mr + nr );
+		if ( w1_a < 1 ) continue;
+
+		dim_t kc = ( w1_a * way1 ) / ( mr * dt_size );
+		kc = bli_gks_round_blksz( kc, kc_def, kc_def * 4, kc_mult );
+
+		// L2: the ways left for the block(s) of A.
+		const dim_t w2_b = ( nr * kc * dt_size + way2 - 1 ) / way2;
+		const dim_t w2_a = ( l2.assoc - 1 - w2_b ) / l2_share;
+		if ( w2_a < 1 ) continue;
+
+		dim_t mc = ( w2_a * way2 ) / ( kc * dt_size );
+		mc = bli_gks_round_blksz( mc, mc_def, mc_def, mc_mult );
+
+		// L3: the ways left for the panel of B. Without an L3 cache (or if
+		// the model leaves no room for B), keep the static value.
+		dim_t nc = nc_def;
+		if ( has_l3 && l3.assoc >= 2 )
+		{
+			const dim_t w3_a = ( l3_share * mc * kc * dt_size + way3 - 1 ) / way3;
+			const dim_t w3_b = l3.assoc - 1 - w3_a;
+
+			if ( w3_b >= 1 )
+			{
+				nc = ( w3_b * way3 ) / ( kc * dt_size );
+				nc = bli_gks_round_blksz( nc, nc_def, nc_def, nc_mult );
+			}
+		}
+
+		bli_cntx_set_blksz_def_dt( dt, BLIS_KC, kc, cntx );
+		bli_cntx_set_blksz_def_dt( dt, BLIS_MC, mc, cntx );
+		bli_cntx_set_blksz_def_dt( dt, BLIS_NC, nc, cntx );
+
+		bli_cntx_set_blksz_max_dt( dt, BLIS_KC,
+		  bli_gks_scale_blksz_max( kc, kc_def, kc_max, kc_mult ), cntx );
+		bli_cntx_set_blksz_max_dt( dt, BLIS_MC,
+		  bli_gks_scale_blksz_max( mc, mc_def, mc_max, mc_mult ), cntx );
+		bli_cntx_set_blksz_max_dt( dt, BLIS_NC,
+		  bli_gks_scale_blksz_max( nc, nc_def, nc_max, nc_mult ), cntx );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_gks_register_cntx
      (
        arch_t  id,
@@ -0,0 +1,184 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef __linux__
+  // Needed for MAP_ANONYMOUS, MAP_HUGETLB, and MADV_HUGEPAGE.
+  #define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+#ifdef BLIS_OS_LINUX
+  #include <sys/mman.h>
+#endif
+
+static hugepage_t hugepage_mode = BLIS_HUGEPAGE_NONE;
+
+// Counters for the amount of pool memory mapped for huge pages. These are
+// updated by threads allocating from different (per-node) pools
+// concurrently, and thus are updated atomically.
+static siz_t hugepage_requested = 0;
+static siz_t hugepage_fallback = 0;
+
+// -----------------------------------------------------------------------------
+
+void bli_hugepage_init( void )
+{
+#ifdef BLIS_ENABLE_HUGEPAGES
+	const gint_t mode_def = BLIS_HUGEPAGE_THP;
+#else
+	const gint_t mode_def = BLIS_HUGEPAGE_NONE;
+#endif
+
+	gint_t mode = bli_env_get_var( "BLIS_HUGEPAGES", mode_def );
+
+	if ( mode < BLIS_HUGEPAGE_NONE || BLIS_HUGEPAGE_HUGETLB < mode )
+		mode = mode_def;
+
+#ifndef BLIS_OS_LINUX
+	mode = BLIS_HUGEPAGE_NONE;
+#endif
+
+	hugepage_mode      = ( hugepage_t )mode;
+	hugepage_requested = 0;
+	hugepage_fallback  = 0;
+}
+
+void bli_hugepage_finalize( void )
+{
+	hugepage_mode = BLIS_HUGEPAGE_NONE;
+}
+
+hugepage_t bli_hugepage_mode( void )
+{
+	return hugepage_mode;
+}
+
+siz_t bli_hugepage_requested_size( void )
+{
+	return __atomic_load_n( &hugepage_requested, __ATOMIC_RELAXED );
+}
+
+siz_t bli_hugepage_fallback_size( void )
+{
+	return __atomic_load_n( &hugepage_fallback, __ATOMIC_RELAXED );
+}
+
+// -----------------------------------------------------------------------------
+
+#ifdef BLIS_OS_LINUX
+
+static void* bli_hugepage_map_thp( siz_t size )
+{
+	const siz_t hp = BLIS_HUGE_PAGE_SIZE;
+
+	// Anonymous mappings are only guaranteed to be aligned to the base page
+	// size, so we over-allocate by one huge page and trim the unaligned
+	// head and tail.
+	char* p = mmap( NULL, size + hp, PROT_READ | PROT_WRITE,
+	                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+	if ( p == MAP_FAILED ) return NULL;
+
+	char* p_align = ( char* )( ( ( uintptr_t )p + hp - 1 ) & ~( uintptr_t )( hp - 1 ) );
+	const siz_t head = p_align - p;
+	const siz_t tail = hp - head;
+
+	if ( 0 < head ) munmap( p, head );
+	if ( 0 < tail ) munmap( p_align + size, tail );
+
+#ifdef MADV_HUGEPAGE
+	// This is only advice: if THP is disabled system-wide the region is
+	// still usable and is simply backed by base pages.
+	madvise( p_align, size, MADV_HUGEPAGE );
+#endif
+
+	return p_align;
+}
+
+static void* bli_hugepage_map_hugetlb( siz_t size )
+{
+#ifdef MAP_HUGETLB
+	void* p = mmap( NULL, size, PROT_READ | PROT_WRITE,
+	                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+	return ( p == MAP_FAILED ? NULL : p );
+#else
+	return NULL;
+#endif
+}
+
+#endif
+
+void* bli_hugepage_alloc( siz_t size, siz_t* map_size )
+{
+	*map_size = 0;
+
+	if ( hugepage_mode == BLIS_HUGEPAGE_NONE ||
+	     size < BLIS_HUGE_PAGE_MIN_SIZE ) return NULL;
+
+	void* p = NULL;
+
+#ifdef BLIS_OS_LINUX
+	// Round the size up to a whole number of huge pages.
+	const siz_t hp     = BLIS_HUGE_PAGE_SIZE;
+	const siz_t size_r = ( size + hp - 1 ) / hp * hp;
+
+	if ( hugepage_mode == BLIS_HUGEPAGE_HUGETLB )
+		p = bli_hugepage_map_hugetlb( size_r );
+
+	if ( p == NULL )
+		p = bli_hugepage_map_thp( size_r );
+
+	if ( p != NULL )
+	{
+		*map_size = size_r;
+		__atomic_fetch_add( &hugepage_requested, size_r, __ATOMIC_RELAXED );
+		return p;
+	}
+#endif
+
+	__atomic_fetch_add( &hugepage_fallback, size, __ATOMIC_RELAXED );
+
+	return p;
+}
+
+void bli_hugepage_free( void* p, siz_t map_size )
+{
+#ifdef BLIS_OS_LINUX
+	munmap( p, map_size );
+	__atomic_fetch_sub( &hugepage_requested, map_size, __ATOMIC_RELAXED );
+#endif
+}
+
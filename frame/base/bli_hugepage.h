@@ -0,0 +1,83 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_HUGEPAGE_H
+#define BLIS_HUGEPAGE_H
+
+// Huge page backing for memory pool blocks. The mode is chosen when the
+// memory system is initialized: it defaults to BLIS_HUGEPAGE_THP if BLIS was
+// configured with --enable-hugepages (and BLIS_HUGEPAGE_NONE otherwise) and
+// may be overridden at runtime via the BLIS_HUGEPAGES environment variable
+// (0, 1, or 2, corresponding to the values below).
+typedef enum
+{
+	// Allocate pool blocks via BLIS_MALLOC_POOL.
+	BLIS_HUGEPAGE_NONE    = 0,
+
+	// Map pool blocks anonymously, aligned to BLIS_HUGE_PAGE_SIZE, and
+	// request transparent huge pages via madvise(MADV_HUGEPAGE).
+	BLIS_HUGEPAGE_THP     = 1,
+
+	// Map pool blocks from the explicit hugetlbfs reserve (MAP_HUGETLB),
+	// falling back to BLIS_HUGEPAGE_THP if no huge pages are available.
+	BLIS_HUGEPAGE_HUGETLB = 2,
+
+} hugepage_t;
+
+void bli_hugepage_init( void );
+void bli_hugepage_finalize( void );
+
+BLIS_EXPORT_BLIS hugepage_t bli_hugepage_mode( void );
+
+// Return the number of bytes of pool memory currently mapped with a request
+// for huge pages, and the total number of bytes (since initialization) for
+// which huge page backing was attempted but for which the mapping failed,
+// such that the memory had to be allocated via BLIS_MALLOC_POOL instead.
+// Under BLIS_HUGEPAGE_THP the request is only advice, so the kernel may
+// still back some or all of the requested bytes with base pages (see
+// AnonHugePages in /proc/self/smaps for what it actually did).
+BLIS_EXPORT_BLIS siz_t bli_hugepage_requested_size( void );
+BLIS_EXPORT_BLIS siz_t bli_hugepage_fallback_size( void );
+
+// Map a region of at least size bytes, aligned to BLIS_HUGE_PAGE_SIZE. On
+// success, the length of the mapping is returned via map_size. If huge pages
+// are disabled, if size is below BLIS_HUGE_PAGE_MIN_SIZE, or if the mapping
+// fails, NULL is returned and the caller should fall back to its usual
+// allocator.
+void* bli_hugepage_alloc( siz_t size, siz_t* map_size );
+void  bli_hugepage_free( void* p, siz_t map_size );
+
+#endif
+
@@ -48,6 +48,9 @@ int bli_memsys_init( void )
 	// to avoid the internal call to bli_init_once().
 	const cntx_t* cntx_p = bli_gks_query_cntx_noinit();
 
+	// Determine whether (and how) pool blocks should be backed by huge pages.
+	bli_hugepage_init();
+
 	// Initialize the packing block allocator and its data structures.
 	bli_pba_init( cntx_p );
 
@@ -59,12 +62,18 @@ int bli_memsys_init( void )
 
 int bli_memsys_finalize( void )
 {
+	// Free the thrinfo_t trees kept for reuse by level-3 operations. These
+	// hold array_t's checked out from the sba and must go first.
+	bli_l3_thrinfo_cache_finalize();
+
 	// Finalize the small block allocator and its data structures.
 	bli_sba_finalize();
 
 	// Finalize the packing block allocator and its data structures.
 	bli_pba_finalize();
 
+	bli_hugepage_finalize();
+
 	return 0;
 }
 
@@ -38,6 +38,89 @@
 // -- Matrix partitioning ------------------------------------------------------
 
 
+static void bli_acquire_mpart_packed
+     (
+             mdim_t    mdim,
+             dir_t     direct,
+             subpart_t req_part,
+             dim_t     i,
+             dim_t     b,
+       const obj_t*    obj,
+             obj_t*    sub_obj
+     )
+{
+	// Partition an object that was packed to micropanels (e.g. an operand
+	// that was packed ahead of time via bli_gemm_pack()). The row and column
+	// strides of such an object describe the storage within each micropanel,
+	// so partitioning along the dimension that each micropanel spans only
+	// requires the usual adjustment of the offsets. Partitioning across
+	// micropanels instead advances the buffer by whole micropanels, and thus
+	// requires that the partition begin on a micropanel boundary. Only
+	// forward partitioning of the middle subpartition is supported.
+	if ( direct != BLIS_FWD || req_part != BLIS_SUBPART1 ||
+	     bli_obj_has_trans( obj ) )
+		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
+
+	const dim_t m  = bli_obj_length( obj );
+	const dim_t n  = bli_obj_width( obj );
+	const inc_t rs = bli_obj_row_stride( obj );
+	const inc_t cs = bli_obj_col_stride( obj );
+	const dim_t pd = bli_obj_panel_dim( obj );
+
+	// Micropanels are stacked vertically (as with a packed A) if elements are
+	// contiguous down columns within each micropanel, and horizontally (as
+	// with a packed B, after its transposition is induced) otherwise.
+	const bool  vert_panels = rs < cs ||
+	                          ( rs == cs && bli_obj_panel_length( obj ) == pd );
+	const mdim_t pdim       = vert_panels ? BLIS_M : BLIS_N;
+
+	const dim_t len = ( mdim == BLIS_M ? m : n );
+
+	// Foolproofing: do not let b exceed what's left of the dimension.
+	if ( i > len     ) i = len;
+	if ( b > len - i ) b = len - i;
+
+	bli_obj_init_subpart_from( obj, sub_obj );
+
+	if ( mdim == BLIS_M ) bli_obj_set_dims( b, n, sub_obj );
+	else                  bli_obj_set_dims( m, b, sub_obj );
+
+	if ( mdim == pdim )
+	{
+		if ( 0 < b && i % pd != 0 )
+			bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
+
+		char* p = bli_obj_buffer( obj );
+
+		p += ( i / pd ) * bli_obj_panel_stride( obj ) * bli_obj_elem_size( obj );
+
+		bli_obj_set_buffer( p, sub_obj );
+
+		if ( mdim == BLIS_M )
+			bli_obj_set_padded_dims( bli_align_dim_to_mult( b, pd, true ),
+			                         bli_obj_padded_width( obj ), sub_obj );
+		else
+			bli_obj_set_padded_dims( bli_obj_padded_length( obj ),
+			                         bli_align_dim_to_mult( b, pd, true ), sub_obj );
+	}
+	else
+	{
+		if ( mdim == BLIS_M )
+		{
+			bli_obj_inc_offs( i, 0, sub_obj );
+			bli_obj_set_padded_dims( b, bli_obj_padded_width( obj ), sub_obj );
+			bli_obj_set_panel_length( b, sub_obj );
+		}
+		else
+		{
+			bli_obj_inc_offs( 0, i, sub_obj );
+			bli_obj_set_padded_dims( bli_obj_padded_length( obj ), b, sub_obj );
+			bli_obj_set_panel_width( b, sub_obj );
+		}
+	}
+}
+
+
 void bli_acquire_mpart
      (
              dim_t  i,
@@ -131,7 +214,10 @@ void bli_acquire_mpart_mdim
 	// partitioned through normally.) Note that the function called below
 	// assumes forward partitioning.
 	if ( bli_obj_is_panel_packed( obj ) )
-		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
+	{
+		bli_acquire_mpart_packed( BLIS_M, direct, req_part, i, b, obj, sub_obj );
+		return;
+	}
 
 
 	// Check parameters.
@@ -351,7 +437,10 @@ void bli_acquire_mpart_ndim
 	// partitioned through normally.) Note that the function called below
 	// assumes forward partitioning.
 	if ( bli_obj_is_panel_packed( obj ) )
-		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART );
+	{
+		bli_acquire_mpart_packed( BLIS_N, direct, req_part, j, b, obj, sub_obj );
+		return;
+	}
 
 
 	// Check parameters.
@@ -36,8 +36,9 @@
 
 #include "blis.h"
 
-// Statically initialize the mutex within the packing block allocator object.
-static pba_t global_pba = { .mutex = BLIS_PTHREAD_MUTEX_INITIALIZER };
+// The global packing block allocator object. Its mutexes are initialized in
+// bli_pba_init() since their number depends on the NUMA topology.
+static pba_t global_pba;
 
 // -----------------------------------------------------------------------------
 
@@ -63,13 +64,21 @@ void bli_pba_init
 	bli_pba_set_malloc_fp( malloc_fp, pba );
 	bli_pba_set_free_fp( free_fp, pba );
 
-	// The mutex field of pba is initialized statically above. This
-	// keeps bli_pba_init() simpler and removes the possibility of
-	// something going wrong during mutex initialization.
+	// Maintain one set of pools, each protected by its own mutex, for each
+	// NUMA node so that packed blocks are allocated from (and reused on)
+	// the node of the threads that consume them.
+	const dim_t num_nodes = bli_numa_num_nodes();
+
+	bli_pba_set_num_nodes( num_nodes, pba );
+
+	for ( dim_t node = 0; node < num_nodes; ++node )
+	{
+		bli_pba_init_mutex( node, pba );
 
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_pba_init_pools( cntx, pba );
+		bli_pba_init_pools( cntx, node, pba );
 #endif
+	}
 }
 
 void bli_pba_finalize
@@ -79,13 +88,16 @@ void bli_pba_finalize
 {
 	pba_t* pba = bli_pba_query();
 
+	for ( dim_t node = 0; node < bli_pba_num_nodes( pba ); ++node )
+	{
 #ifdef BLIS_ENABLE_PBA_POOLS
-	bli_pba_finalize_pools( pba );
+		bli_pba_finalize_pools( node, pba );
 #endif
 
-	// The mutex field of pba is initialized statically above, and
-	// therefore never destroyed.
+		bli_pba_finalize_mutex( node, pba );
+	}
 
+	bli_pba_set_num_nodes( 0, pba );
 	bli_pba_set_malloc_fp( NULL, pba );
 	bli_pba_set_free_fp( NULL, pba );
 }
@@ -139,15 +151,18 @@ void bli_pba_acquire_m
 		// and then recycled.
 
 		// Map the requested packed buffer type to a zero-based index, which
-		// we then use to select the corresponding memory pool.
+		// we then use to select the corresponding memory pool from the set
+		// of pools belonging to the NUMA node on which the calling thread
+		// is running.
+		dim_t   node = bli_pba_curr_node( pba );
 		dim_t   pi   = bli_packbuf_index( buf_type );
-		pool_t* pool = bli_pba_pool( pi, pba );
+		pool_t* pool = bli_pba_pool( node, pi, pba );
 
 		// Extract the address of the pblk_t struct within the mem_t.
 		pblk_t* pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the pba object.
-		bli_pba_lock( pba );
+		// Acquire the mutex associated with the node's pools.
+		bli_pba_lock( node, pba );
 
 		// BEGIN CRITICAL SECTION
 		{
@@ -165,8 +180,8 @@ void bli_pba_acquire_m
 		}
 		// END CRITICAL SECTION
 
-		// Release the mutex associated with the pba object.
-		bli_pba_unlock( pba );
+		// Release the mutex associated with the node's pools.
+		bli_pba_unlock( node, pba );
 
 		// Query the block_size from the pblk_t. This will be at least
 		// req_size, perhaps larger.
@@ -215,14 +230,16 @@ void bli_pba_release
 	else
 	{
 		// Extract the address of the pool from which the memory was
-		// allocated.
+		// allocated, and the NUMA node to which that pool belongs. (This
+		// need not be the node on which the calling thread is running.)
 		pool_t* pool = bli_mem_pool( mem );
+		dim_t   node = bli_pool_node( pool );
 
 		// Extract the address of the pblk_t struct within the mem_t struct.
 		pblk_t* pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the pba object.
-		bli_pba_lock( pba );
+		// Acquire the mutex associated with the node's pools.
+		bli_pba_lock( node, pba );
 
 		// BEGIN CRITICAL SECTION
 		{
@@ -233,8 +250,8 @@ void bli_pba_release
 		}
 		// END CRITICAL SECTION
 
-		// Release the mutex associated with the pba object.
-		bli_pba_unlock( pba );
+		// Release the mutex associated with the node's pools.
+		bli_pba_unlock( node, pba );
 	}
 
 	// Clear the mem_t object so that it appears unallocated. This clears:
@@ -283,18 +300,21 @@ siz_t bli_pba_pool_size
 	}
 	else
 	{
-		dim_t   pool_index;
-		pool_t* pool;
-
-		// Acquire the pointer to the pool corresponding to the buf_type
-		// provided.
-		pool_index = bli_packbuf_index( buf_type );
-		pool       = bli_pba_pool( pool_index, ( pba_t* )pba );
-
-		// Compute the pool "size" as the product of the block size
-		// and the number of blocks in the pool.
-		r_val = bli_pool_block_size( pool ) *
-		        bli_pool_num_blocks( pool );
+		dim_t pool_index = bli_packbuf_index( buf_type );
+
+		r_val = 0;
+
+		for ( dim_t node = 0; node < bli_pba_num_nodes( pba ); ++node )
+		{
+			// Acquire the pointer to the node's pool corresponding to the
+			// buf_type provided.
+			pool_t* pool = bli_pba_pool( node, pool_index, ( pba_t* )pba );
+
+			// Compute the pool "size" as the product of the block size
+			// and the number of blocks in the pool, summed over all nodes.
+			r_val += bli_pool_block_size( pool ) *
+			         bli_pool_num_blocks( pool );
+		}
 	}
 
 	return r_val;
@@ -305,6 +325,7 @@ siz_t bli_pba_pool_size
 void bli_pba_init_pools
      (
        const cntx_t* cntx,
+             dim_t   node,
              pba_t*  pba
      )
 {
@@ -314,9 +335,9 @@ void bli_pba_init_pools
 	const dim_t index_c      = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
 	// Alias the pool addresses to convenient identifiers.
-	pool_t*     pool_a       = bli_pba_pool( index_a, pba );
-	pool_t*     pool_b       = bli_pba_pool( index_b, pba );
-	pool_t*     pool_c       = bli_pba_pool( index_c, pba );
+	pool_t*     pool_a       = bli_pba_pool( node, index_a, pba );
+	pool_t*     pool_b       = bli_pba_pool( node, index_b, pba );
+	pool_t*     pool_c       = bli_pba_pool( node, index_c, pba );
 
 	// Start with empty pools.
 	const dim_t num_blocks_a = 0;
@@ -353,17 +374,19 @@ void bli_pba_init_pools
 	                                  &block_size_c,
 	                                  cntx );
 
-	// Initialize the memory pools for A, B, and C.
+	// Initialize the memory pools for A, B, and C. Blocks allocated by the
+	// pools are placed on the given NUMA node.
 	bli_pool_init( num_blocks_a, block_ptrs_len_a, block_size_a, align_size_a,
-	               offset_size_a, malloc_fp, free_fp, pool_a );
+	               offset_size_a, node, malloc_fp, free_fp, pool_a );
 	bli_pool_init( num_blocks_b, block_ptrs_len_b, block_size_b, align_size_b,
-	               offset_size_b, malloc_fp, free_fp, pool_b );
+	               offset_size_b, node, malloc_fp, free_fp, pool_b );
 	bli_pool_init( num_blocks_c, block_ptrs_len_c, block_size_c, align_size_c,
-	               offset_size_c, malloc_fp, free_fp, pool_c );
+	               offset_size_c, node, malloc_fp, free_fp, pool_c );
 }
 
 void bli_pba_finalize_pools
      (
+       dim_t  node,
        pba_t* pba
      )
 {
@@ -373,9 +396,9 @@ void bli_pba_finalize_pools
 	dim_t   index_c = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
 	// Alias the pool addresses to convenient identifiers.
-	pool_t* pool_a  = bli_pba_pool( index_a, pba );
-	pool_t* pool_b  = bli_pba_pool( index_b, pba );
-	pool_t* pool_c  = bli_pba_pool( index_c, pba );
+	pool_t* pool_a  = bli_pba_pool( node, index_a, pba );
+	pool_t* pool_b  = bli_pba_pool( node, index_b, pba );
+	pool_t* pool_c  = bli_pba_pool( node, index_c, pba );
 
 	// Finalize the memory pools for A, B, and C.
 	bli_pool_finalize( pool_a, FALSE );
@@ -42,8 +42,9 @@
 /*
 typedef struct pba_s
 {
-	pool_t              pools[3];
-	bli_pthread_mutex_t mutex;
+	pool_t              pools[ BLIS_NUMA_MAX_NODES ][3];
+	bli_pthread_mutex_t mutex[ BLIS_NUMA_MAX_NODES ];
+	dim_t               num_nodes;
 
 	// These fields are used for general-purpose allocation.
 	siz_t               align_size;
@@ -56,21 +57,32 @@ typedef struct pba_s
 
 // pba init
 
-//BLIS_INLINE void bli_pba_init_mutex( pba_t* pba )
-//{
-//	bli_pthread_mutex_init( &(pba->mutex), NULL );
-//}
+BLIS_INLINE void bli_pba_init_mutex( dim_t node, pba_t* pba )
+{
+	bli_pthread_mutex_init( &(pba->mutex[ node ]), NULL );
+}
 
-//BLIS_INLINE void bli_pba_finalize_mutex( pba_t* pba )
-//{
-//	bli_pthread_mutex_destroy( &(pba->mutex) );
-//}
+BLIS_INLINE void bli_pba_finalize_mutex( dim_t node, pba_t* pba )
+{
+	bli_pthread_mutex_destroy( &(pba->mutex[ node ]) );
+}
 
 // pba query
 
-BLIS_INLINE pool_t* bli_pba_pool( dim_t pool_index, pba_t* pba )
+BLIS_INLINE pool_t* bli_pba_pool( dim_t node, dim_t pool_index, pba_t* pba )
+{
+	return &(pba->pools[ node ][ pool_index ]);
+}
+
+BLIS_INLINE dim_t bli_pba_num_nodes( const pba_t* pba )
 {
-	return &(pba->pools[ pool_index ]);
+	return pba->num_nodes;
+}
+
+// Return the node whose pools should serve requests from the calling thread.
+BLIS_INLINE dim_t bli_pba_curr_node( const pba_t* pba )
+{
+	return bli_min( bli_numa_curr_node(), bli_pba_num_nodes( pba ) - 1 );
 }
 
 BLIS_INLINE siz_t bli_pba_align_size( const pba_t* pba )
@@ -90,6 +102,11 @@ BLIS_INLINE free_ft bli_pba_free_fp( const pba_t* pba )
 
 // pba modification
 
+BLIS_INLINE void bli_pba_set_num_nodes( dim_t num_nodes, pba_t* pba )
+{
+	pba->num_nodes = num_nodes;
+}
+
 BLIS_INLINE void bli_pba_set_align_size( siz_t align_size, pba_t* pba )
 {
 	pba->align_size = align_size;
@@ -107,14 +124,14 @@ BLIS_INLINE void bli_pba_set_free_fp( free_ft free_fp, pba_t* pba )
 
 // pba action
 
-BLIS_INLINE void bli_pba_lock( pba_t* pba )
+BLIS_INLINE void bli_pba_lock( dim_t node, pba_t* pba )
 {
-	bli_pthread_mutex_lock( &(pba->mutex) );
+	bli_pthread_mutex_lock( &(pba->mutex[ node ]) );
 }
 
-BLIS_INLINE void bli_pba_unlock( pba_t* pba )
+BLIS_INLINE void bli_pba_unlock( dim_t node, pba_t* pba )
 {
-	bli_pthread_mutex_unlock( &(pba->mutex) );
+	bli_pthread_mutex_unlock( &(pba->mutex[ node ]) );
 }
 
 // -----------------------------------------------------------------------------
@@ -155,10 +172,12 @@ siz_t bli_pba_pool_size
 void bli_pba_init_pools
      (
        const cntx_t* cntx,
+             dim_t   node,
              pba_t*  pba
      );
 void bli_pba_finalize_pools
      (
+       dim_t  node,
        pba_t* pba
      );
 
@@ -44,6 +44,7 @@ void bli_pool_init
        siz_t     block_size,
        siz_t     align_size,
        siz_t     offset_size,
+       dim_t     node,
        malloc_ft malloc_fp,
        free_ft   free_fp,
        pool_t*   pool
@@ -85,6 +86,7 @@ void bli_pool_init
 		  block_size,
 		  align_size,
 		  offset_size,
+		  node,
 		  malloc_fp,
 		  &(block_ptrs[i])
 		);
@@ -109,6 +111,7 @@ void bli_pool_init
 	bli_pool_set_block_size( block_size, pool );
 	bli_pool_set_align_size( align_size, pool );
 	bli_pool_set_offset_size( offset_size, pool );
+	bli_pool_set_node( node, pool );
 	bli_pool_set_malloc_fp( malloc_fp, pool );
 	bli_pool_set_free_fp( free_fp, pool );
 }
@@ -203,10 +206,11 @@ void bli_pool_reinit
        pool_t* pool
      )
 {
-	// Preserve the pointers to malloc() and free() provided when the pool
-	// was first initialized.
-	malloc_ft malloc_fp = bli_pool_malloc_fp( pool );
-	free_ft   free_fp   = bli_pool_free_fp( pool );
+	// Preserve the NUMA node and the pointers to malloc() and free()
+	// provided when the pool was first initialized.
+	const dim_t node      = bli_pool_node( pool );
+	malloc_ft   malloc_fp = bli_pool_malloc_fp( pool );
+	free_ft     free_fp   = bli_pool_free_fp( pool );
 
 	// Finalize the pool as it is currently configured. If some blocks
 	// are still checked out to threads, those blocks are not freed
@@ -225,6 +229,7 @@ void bli_pool_reinit
 	  block_size_new,
 	  align_size_new,
 	  offset_size_new,
+	  node,
 	  malloc_fp,
 	  free_fp,
 	  pool
@@ -441,8 +446,9 @@ void bli_pool_grow
 	const siz_t align_size  = bli_pool_align_size( pool );
 	const siz_t offset_size = bli_pool_offset_size( pool );
 
-	// Query the malloc() function pointer for the pool.
-	malloc_ft malloc_fp = bli_pool_malloc_fp( pool );
+	// Query the NUMA node and the malloc() function pointer for the pool.
+	const dim_t node      = bli_pool_node( pool );
+	malloc_ft   malloc_fp = bli_pool_malloc_fp( pool );
 
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_pool_grow(): growing pool from (%d -> %d).\n",
@@ -458,6 +464,7 @@ void bli_pool_grow
 		  block_size,
 		  align_size,
 		  offset_size,
+		  node,
 		  malloc_fp,
 		  &(block_ptrs[i])
 		);
@@ -524,6 +531,7 @@ void bli_pool_alloc_block
        siz_t     block_size,
        siz_t     align_size,
        siz_t     offset_size,
+       dim_t     node,
        malloc_ft malloc_fp,
        pblk_t*   block
      )
@@ -536,14 +544,30 @@ void bli_pool_alloc_block
 	fflush( stdout );
 	#endif
 
-	// Allocate the block via the bli_fmalloc_align() wrapper, which performs
-	// alignment logic and opaquely saves the original pointer so that it can
-	// be recovered when it's time to free the block. Note that we have to
-	// add offset_size to the number of bytes requested since we will skip
+	// If huge page backing is enabled (and the block is large enough to
+	// benefit from it), try to map the block directly. The mapping is
+	// aligned to BLIS_HUGE_PAGE_SIZE, which satisfies any smaller alignment.
+	siz_t map_size = 0;
+	void* buf      = NULL;
+
+	if ( BLIS_HUGE_PAGE_SIZE % align_size == 0 )
+		buf = bli_hugepage_alloc( block_size + offset_size, &map_size );
+
+	// Otherwise, allocate the block via the bli_fmalloc_align() wrapper, which
+	// performs alignment logic and opaquely saves the original pointer so that
+	// it can be recovered when it's time to free the block. Note that we have
+	// to add offset_size to the number of bytes requested since we will skip
 	// that many bytes at the beginning of the allocated memory.
-	void* buf
-	=
-	bli_fmalloc_align( malloc_fp, block_size + offset_size, align_size, &r_val );
+	if ( buf == NULL )
+		buf = bli_fmalloc_align( malloc_fp, block_size + offset_size, align_size, &r_val );
+
+	// If the pool belongs to a NUMA node and the block was mapped above, ask
+	// the kernel to place its pages on that node when they are first touched.
+	// Blocks from malloc() may share pages with unrelated heap memory, so they
+	// are left to the default (first-touch) policy; the threads that pack them
+	// are bound to the node anyway.
+	if ( map_size != 0 )
+		bli_numa_bind_mem( buf, map_size, node );
 
 #if 0
 	// NOTE: This code is disabled because it is not needed, since
@@ -574,6 +598,7 @@ void bli_pool_alloc_block
 	// Save the results in the pblk_t structure.
 	bli_pblk_set_buf( buf, block );
 	bli_pblk_set_block_size( block_size, block );
+	bli_pblk_set_map_size( map_size, block );
 }
 
 void bli_pool_free_block
@@ -597,6 +622,13 @@ void bli_pool_free_block
 	// by bli_pool_alloc_block().
 	buf = ( void* )( ( char* )buf - offset_size );
 
+	// If the block is backed by a huge page mapping, unmap it.
+	if ( bli_pblk_map_size( block ) != 0 )
+	{
+		bli_hugepage_free( buf, bli_pblk_map_size( block ) );
+		return;
+	}
+
 	// Free the block via the bli_ffree_align() wrapper, which recovers the
 	// original pointer that was returned by the pool's malloc() function when
 	// the block was allocated.
@@ -624,6 +656,7 @@ void bli_pool_print
 	printf( "  block_size:      %d\n", ( int )block_size );
 	printf( "  align_size:      %d\n", ( int )align_size );
 	printf( "  offset_size:     %d\n", ( int )offset_size );
+	printf( "  node:            %d\n", ( int )bli_pool_node( pool ) );
 	printf( "  pblks   sys    align\n" );
 
 	for ( dim_t i = 0; i < num_blocks; ++i )
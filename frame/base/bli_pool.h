@@ -82,6 +82,11 @@ BLIS_INLINE siz_t bli_pblk_block_size( const pblk_t* pblk )
 
 // Pool block modification
 
+BLIS_INLINE siz_t bli_pblk_map_size( const pblk_t* pblk )
+{
+	return pblk->map_size;
+}
+
 BLIS_INLINE void bli_pblk_set_buf( void* buf, pblk_t* pblk )
 {
 	pblk->buf = buf;
@@ -92,6 +97,11 @@ BLIS_INLINE void bli_pblk_set_block_size( siz_t block_size, pblk_t* pblk )
 	pblk->block_size = block_size;
 }
 
+BLIS_INLINE void bli_pblk_set_map_size( siz_t map_size, pblk_t* pblk )
+{
+	pblk->map_size = map_size;
+}
+
 //
 // -- pool block initialization ------------------------------------------------
 //
@@ -104,12 +114,14 @@ BLIS_INLINE void bli_pblk_set_block_size( siz_t block_size, pblk_t* pblk )
         { \
           /* .buf        = */ NULL, \
           /* .block_size = */ 0, \
+          /* .map_size   = */ 0, \
         }  \
 
 BLIS_INLINE void bli_pblk_clear( pblk_t* pblk )
 {
 	bli_pblk_set_buf( NULL, pblk );
 	bli_pblk_set_block_size( 0, pblk );
+	bli_pblk_set_map_size( 0, pblk );
 }
 
 
@@ -145,6 +157,11 @@ BLIS_INLINE siz_t bli_pool_offset_size( const pool_t* pool )
 	return pool->offset_size;
 }
 
+BLIS_INLINE dim_t bli_pool_node( const pool_t* pool )
+{
+	return pool->node;
+}
+
 BLIS_INLINE malloc_ft bli_pool_malloc_fp( const pool_t* pool )
 {
 	return pool->malloc_fp;
@@ -198,6 +215,11 @@ BLIS_INLINE void bli_pool_set_offset_size( siz_t offset_size, pool_t* pool ) \
 	pool->offset_size = offset_size;
 }
 
+BLIS_INLINE void bli_pool_set_node( dim_t node, pool_t* pool ) \
+{
+	pool->node = node;
+}
+
 BLIS_INLINE void bli_pool_set_malloc_fp( malloc_ft malloc_fp, pool_t* pool ) \
 {
 	pool->malloc_fp = malloc_fp;
@@ -222,6 +244,7 @@ void bli_pool_init
        siz_t     block_size,
        siz_t     align_size,
        siz_t     offset_size,
+       dim_t     node,
        malloc_ft malloc_fp,
        free_ft   free_fp,
        pool_t*   pool
@@ -269,6 +292,7 @@ void bli_pool_alloc_block
        siz_t     block_size,
        siz_t     align_size,
        siz_t     offset_size,
+       dim_t     node,
        malloc_ft malloc_fp,
        pblk_t*   block
      );
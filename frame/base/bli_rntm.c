@@ -162,10 +162,46 @@ void bli_rntm_init_from_env
 
 	// ------------------------------------------------------------------------
 
+	taff_t aff = BLIS_AFFINITY_NONE;
+
+	// Try to read BLIS_AFFINITY. Besides the named policies, we accept an
+	// explicit cpu list (e.g. "0-7,16-23"), which is interpreted the same
+	// way as BLIS_AFFINITY=list with BLIS_AFFINITY_LIST set to that list
+	// (see bli_affinity_init()).
+	char* aff_env = bli_env_get_str( "BLIS_AFFINITY" );
+
+	if ( aff_env != NULL )
+	{
+		if      ( !strncmp( aff_env, "compact", 7 ) ) aff = BLIS_AFFINITY_COMPACT;
+		else if ( !strncmp( aff_env, "close",   5 ) ) aff = BLIS_AFFINITY_COMPACT;
+		else if ( !strncmp( aff_env, "scatter", 7 ) ) aff = BLIS_AFFINITY_SCATTER;
+		else if ( !strncmp( aff_env, "spread",  6 ) ) aff = BLIS_AFFINITY_SCATTER;
+		else if ( !strncmp( aff_env, "list",    4 ) ) aff = BLIS_AFFINITY_LIST;
+		else if ( isdigit( ( unsigned char )aff_env[0] ) ) aff = BLIS_AFFINITY_LIST;
+		else                                          aff = BLIS_AFFINITY_NONE;
+	}
+
+	// ------------------------------------------------------------------------
+
+	// Try to read BLIS_JRIR_DYNAMIC. Any nonzero value enables dynamic
+	// scheduling of the microtiles in the jr/ir loops of the macrokernels.
+	const bool jrir_dyn = ( bli_env_get_var( "BLIS_JRIR_DYNAMIC", 0 ) != 0 );
+
+	// ------------------------------------------------------------------------
+
+	// Try to read BLIS_BARRIER_SPIN, the number of times a thread waiting at
+	// a barrier polls it before going to sleep.
+	const dim_t barrier_spin = bli_env_get_var( "BLIS_BARRIER_SPIN", -1 );
+
+	// ------------------------------------------------------------------------
+
 	// Save the results back in the runtime object.
 	bli_rntm_set_thread_impl_only( ti, rntm );
 	bli_rntm_set_num_threads_only( nt, rntm );
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
+	bli_rntm_set_affinity( aff, rntm );
+	bli_rntm_set_jrir_dyn( jrir_dyn, rntm );
+	bli_rntm_set_barrier_spin( barrier_spin, rntm );
 
 	// ------------------------------------------------------------------------
 
@@ -289,7 +325,7 @@ void bli_rntm_set_ways
 
 	// Record the number of ways of parallelism per loop.
 	bli_rntm_set_jc_ways_only( jc, rntm );
-	bli_rntm_set_pc_ways_only(  1, rntm ); // Disable pc_nt values.
+	bli_rntm_set_pc_ways_only( pc, rntm );
 	bli_rntm_set_ic_ways_only( ic, rntm );
 	bli_rntm_set_jr_ways_only( jr, rntm );
 	bli_rntm_set_ir_ways_only( ir, rntm );
@@ -363,7 +399,7 @@ void bli_rntm_sanitize
 		// parallelism were set to meaningful values.
 		if ( nt > 1 ) { nt_set   = TRUE; }
 		if ( jc > 1 ) { ways_set = TRUE; }
-		if ( pc > 1 ) { ways_set = TRUE; pc = 1; } // Disable pc_nt values.
+		if ( pc > 1 ) { ways_set = TRUE; }
 		if ( ic > 1 ) { ways_set = TRUE; }
 		if ( jr > 1 ) { ways_set = TRUE; }
 		if ( ir > 1 ) { ways_set = TRUE; }
@@ -421,11 +457,47 @@ void bli_rntm_sanitize
 #endif
 }
 
-void bli_rntm_factorize
+// Partition nt threads between the ic and jc loops. If there is more than one
+// NUMA node and the threads can be divided evenly among them, the jc loop is
+// given a multiple of the number of nodes (nn) so that each jc thread group
+// (and therefore each packed panel of B) resides within a single node. When
+// the threads are bound to cpus, the same is done for the last-level cache
+// domains that the team occupies, provided that they nest within the nodes.
+static void bli_rntm_partition_mn
+     (
+       taff_t aff,
+       dim_t  nt,
+       dim_t  m,
+       dim_t  n,
+       dim_t* ic,
+       dim_t* jc,
+       dim_t* nn
+     )
+{
+	*nn = bli_numa_is_enabled() ? bli_numa_num_nodes() : 1;
+
+	const dim_t nd = bli_affinity_num_domains( aff, nt );
+
+	if ( *nn < nd && nd % *nn == 0 ) *nn = nd;
+
+	if ( 1 < *nn && nt % *nn == 0 && *nn <= n )
+	{
+		bli_thread_partition_2x2( nt / *nn, m, n / *nn, ic, jc );
+		*jc *= *nn;
+	}
+	else
+	{
+		*nn = 1;
+		bli_thread_partition_2x2( nt, m, n, ic, jc );
+	}
+}
+
+static void bli_rntm_factorize_int
      (
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       bool    pc_par,
        rntm_t* rntm
      )
 {
@@ -458,8 +530,25 @@ void bli_rntm_factorize
 			//         (int)m, (int)n, (int)BLIS_THREAD_RATIO_M,
 			//                         (int)BLIS_THREAD_RATIO_N );
 
-			bli_thread_partition_2x2( nt, m*BLIS_THREAD_RATIO_M,
-			                              n*BLIS_THREAD_RATIO_N, &ic, &jc );
+			// If the operation can parallelize the pc loop and the k dimension
+			// dominates the m and n dimensions, first set aside some of the
+			// threads for the pc loop. The partial products computed by each
+			// pc thread group are reduced into C at the end (see
+			// bli_gemm_blk_var3()).
+			dim_t nt_mn = nt;
+			pc = 1;
+
+			if ( pc_par && BLIS_THREAD_RATIO_K * bli_max( m, n ) < k )
+			{
+				bli_thread_partition_2x2( nt, k,
+				                              BLIS_THREAD_RATIO_K * bli_max( m, n ),
+				                              &pc, &nt_mn );
+			}
+
+			dim_t nn;
+			bli_rntm_partition_mn( bli_rntm_affinity( rntm ),
+			                       nt_mn, m*BLIS_THREAD_RATIO_M,
+			                       n*BLIS_THREAD_RATIO_N, &ic, &jc, &nn );
 
 			//printf( "jc ic = %d %d\n", (int)jc, (int)ic );
 
@@ -468,9 +557,11 @@ void bli_rntm_factorize
 				if ( ic % ir == 0 ) { ic /= ir; break; }
 			}
 
+			// Keep the jc ways a multiple of the number of NUMA nodes (or cache
+			// domains).
 			for ( jr = BLIS_THREAD_MAX_JR ; jr > 1 ; jr-- )
 			{
-				if ( jc % jr == 0 ) { jc /= jr; break; }
+				if ( jc % ( jr * nn ) == 0 ) { jc /= jr; break; }
 			}
 		}
 
@@ -488,6 +579,28 @@ void bli_rntm_factorize
 #endif
 }
 
+void bli_rntm_factorize
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     )
+{
+	bli_rntm_factorize_int( m, n, k, FALSE, rntm );
+}
+
+void bli_rntm_factorize_pc
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     )
+{
+	bli_rntm_factorize_int( m, n, k, TRUE, rntm );
+}
+
 void bli_rntm_factorize_sup
      (
        dim_t   m,
@@ -521,8 +634,9 @@ void bli_rntm_factorize_sup
 			if ( bli_is_prime( nt ) && BLIS_NT_MAX_PRIME < nt ) nt -= 1;
 			#endif
 
-			bli_thread_partition_2x2( nt, m,
-										  n, &ic, &jc );
+			dim_t nn;
+			bli_rntm_partition_mn( bli_rntm_affinity( rntm ),
+			                       nt, m, n, &ic, &jc, &nn );
 			ir = 1; jr = 1;
 		}
 
@@ -558,6 +672,9 @@ void bli_rntm_print
 	dim_t   ir = bli_rntm_ir_ways( rntm );
 
 	printf( "thread impl: %d\n", ti );
+	printf( "affinity:    %d\n", ( int )bli_rntm_affinity( rntm ) );
+	printf( "jr/ir dyn:   %d\n", ( int )bli_rntm_jrir_dyn( rntm ) );
+	printf( "barrier spin: %ld\n", ( long )bli_rntm_barrier_spin( rntm ) );
 	printf( "rntm contents    nt  jc  pc  ic  jr  ir\n" );
 	printf( "autofac? %1d | %4d%4d%4d%4d%4d%4d\n", (int)af,
 	                                               (int)nt, (int)jc, (int)pc,
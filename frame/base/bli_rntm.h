@@ -52,6 +52,9 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	taff_t    affinity;
+	bool      jrir_dyn;
+	dim_t     barrier_spin;
 } rntm_t;
 */
 
@@ -129,6 +132,21 @@ BLIS_INLINE bool bli_rntm_l3_sup( const rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE taff_t bli_rntm_affinity( const rntm_t* rntm )
+{
+	return rntm->affinity;
+}
+
+BLIS_INLINE bool bli_rntm_jrir_dyn( const rntm_t* rntm )
+{
+	return rntm->jrir_dyn;
+}
+
+BLIS_INLINE dim_t bli_rntm_barrier_spin( const rntm_t* rntm )
+{
+	return rntm->barrier_spin;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -159,7 +177,7 @@ BLIS_INLINE void bli_rntm_set_jc_ways_only( dim_t ways, rntm_t* rntm )
 }
 BLIS_INLINE void bli_rntm_set_pc_ways_only( dim_t ways, rntm_t* rntm )
 {
-	bli_rntm_set_ways_for_only( BLIS_KC, 1, rntm );
+	bli_rntm_set_ways_for_only( BLIS_KC, ways, rntm );
 }
 BLIS_INLINE void bli_rntm_set_ic_ways_only( dim_t ways, rntm_t* rntm )
 {
@@ -182,7 +200,7 @@ BLIS_INLINE void bli_rntm_set_ways_only( dim_t jc, dim_t pc, dim_t ic, dim_t jr,
 {
 	// Record the number of ways of parallelism per loop.
 	bli_rntm_set_jc_ways_only( jc, rntm );
-	bli_rntm_set_pc_ways_only(  1, rntm );
+	bli_rntm_set_pc_ways_only( pc, rntm );
 	bli_rntm_set_ic_ways_only( ic, rntm );
 	bli_rntm_set_jr_ways_only( jr, rntm );
 	bli_rntm_set_ir_ways_only( ir, rntm );
@@ -233,6 +251,25 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_affinity( taff_t affinity, rntm_t* rntm )
+{
+	// Set the policy used to bind threads to cpus.
+	rntm->affinity = affinity;
+}
+
+BLIS_INLINE void bli_rntm_set_jrir_dyn( bool jrir_dyn, rntm_t* rntm )
+{
+	// Set whether microtiles are claimed dynamically in the jr/ir loops.
+	rntm->jrir_dyn = jrir_dyn;
+}
+
+BLIS_INLINE void bli_rntm_set_barrier_spin( dim_t barrier_spin, rntm_t* rntm )
+{
+	// Set the number of times a thread polls a barrier before going to
+	// sleep. A negative value selects the default (BLIS_BARRIER_SPIN_COUNT).
+	rntm->barrier_spin = barrier_spin;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -258,6 +295,18 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_affinity( rntm_t* rntm )
+{
+	bli_rntm_set_affinity( BLIS_AFFINITY_NONE, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_jrir_dyn( rntm_t* rntm )
+{
+	bli_rntm_set_jrir_dyn( FALSE, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_barrier_spin( rntm_t* rntm )
+{
+	bli_rntm_set_barrier_spin( -1, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -278,6 +327,9 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           /* .pack_a      = */ FALSE, \
           /* .pack_b      = */ FALSE, \
           /* .l3_sup      = */ TRUE, \
+          /* .affinity    = */ BLIS_AFFINITY_NONE, \
+          /* .jrir_dyn    = */ FALSE, \
+          /* .barrier_spin = */ -1, \
         }  \
 
 #if 0
@@ -292,6 +344,9 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_affinity( rntm );
+	bli_rntm_clear_jrir_dyn( rntm );
+	bli_rntm_clear_barrier_spin( rntm );
 }
 #endif
 
@@ -359,6 +414,17 @@ BLIS_EXPORT_BLIS void bli_rntm_factorize
        rntm_t* rntm
      );
 
+// Like bli_rntm_factorize(), but for control trees that parallelize the pc
+// loop (currently only those of gemm; see bli_gemm_cntl_init()). When k
+// dominates m and n, some of the threads are first set aside for that loop.
+BLIS_EXPORT_BLIS void bli_rntm_factorize_pc
+     (
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       rntm_t* rntm
+     );
+
 void bli_rntm_factorize_sup
      (
        dim_t   m,
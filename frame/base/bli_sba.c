@@ -139,9 +139,11 @@ void bli_sba_release
 		const siz_t block_size = bli_pool_block_size( sba_pool );
 
 		// Embed the block's memory address into a pblk_t, along with the
-		// block_size queried from the sba pool.
+		// block_size queried from the sba pool. Small blocks are never
+		// backed by huge page mappings.
 		bli_pblk_set_buf( block, &pblk );
 		bli_pblk_set_block_size( block_size, &pblk );
+		bli_pblk_set_map_size( 0, &pblk );
 
 		// Check the pblk_t back into the pool_t. (It's okay that the pblk_t is
 		// a local variable since its contents are copied into the pool's internal
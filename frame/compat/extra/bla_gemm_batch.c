@@ -39,103 +39,92 @@
 // Define BLAS-to-BLIS interfaces.
 //
 
-#ifdef BLIS_BLAS3_CALLS_TAPI
+typedef struct
+{
+	      dim_t      group_count;
+	const dim_t*     group_offs;
+	const f77_char*  transa_array;
+	const f77_char*  transb_array;
+	const f77_int*   m_array;
+	const f77_int*   n_array;
+	const f77_int*   k_array;
+	const void*      alpha_array;
+	const void**     a_array; const f77_int* lda_array;
+	const void**     b_array; const f77_int* ldb_array;
+	const void*      beta_array;
+	      void**     c_array; const f77_int* ldc_array;
+} bla_gemm_batch_params_t;
 
 #undef  GENTFUNC
 #define GENTFUNC( ftype, ch, blasname, blisname ) \
 \
-void PASTEF77(ch,blasname) \
+static void PASTECH(bla_,ch,blasname,_get) \
      ( \
-       const f77_char* transa_array, \
-       const f77_char* transb_array, \
-       const f77_int*  m_array, \
-       const f77_int*  n_array, \
-       const f77_int*  k_array, \
-       const ftype*    alpha_array, \
-       const ftype**   a_array, const f77_int* lda_array, \
-       const ftype**   b_array, const f77_int* ldb_array, \
-       const ftype*    beta_array, \
-             ftype**   c_array, const f77_int* ldc_array, \
-       const f77_int*  group_count, \
-       const f77_int*  group_size \
+             dim_t  i, \
+       const void*  params_void, \
+             obj_t* alpha, \
+             obj_t* a, \
+             obj_t* b, \
+             obj_t* beta, \
+             obj_t* c  \
      ) \
 { \
 	trans_t blis_transa; \
 	trans_t blis_transb; \
 	dim_t   m0, n0, k0; \
 \
-	/* Initialize BLIS. */ \
-	bli_init_auto(); \
+	const num_t dt = PASTEMAC(ch,type); \
 \
-	/* Perform BLAS parameter checking. */ \
-	for ( f77_int gi = 0; gi < *group_count; gi++ ) \
-	{ \
-		PASTEBLACHK(blisname) \
-		( \
-		  MKSTR(ch), \
-		  MKSTR(blisname), \
-		  transa_array+gi, \
-		  transb_array+gi, \
-		  m_array+gi, \
-		  n_array+gi, \
-		  k_array+gi, \
-		  lda_array+gi, \
-		  ldb_array+gi, \
-		  ldc_array+gi \
-		); \
-	} \
+	const bla_gemm_batch_params_t* params = params_void; \
 \
-	f77_int idx = 0; \
+	/* Find the group to which the current problem belongs. */ \
+	const dim_t g = bli_gemm_batch_find_group( i, params->group_count, \
+	                                              params->group_offs ); \
 \
-	for ( f77_int i = 0; i < *group_count; i++ ) \
-	{ \
-		/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
-		bli_param_map_netlib_to_blis_trans( transa_array[i], &blis_transa ); \
-		bli_param_map_netlib_to_blis_trans( transb_array[i], &blis_transb ); \
-\
-		/* Typecast BLAS integers to BLIS integers. */ \
-		bli_convert_blas_dim1( m_array[i], m0 ); \
-		bli_convert_blas_dim1( n_array[i], n0 ); \
-		bli_convert_blas_dim1( k_array[i], k0 ); \
-\
-		/* Set the row and column strides of the matrix operands. */ \
-		const inc_t rs_a = 1; \
-		const inc_t cs_a = lda_array[i]; \
-		const inc_t rs_b = 1; \
-		const inc_t cs_b = ldb_array[i]; \
-		const inc_t rs_c = 1; \
-		const inc_t cs_c = ldc_array[i]; \
-\
-		for ( f77_int j = 0; j < group_size[i]; j++ ) \
-		{ \
-			/* Call BLIS interface. */ \
-			PASTEMAC(ch,blisname,BLIS_TAPI_EX_SUF) \
-			( \
-			  blis_transa, \
-			  blis_transb, \
-			  m0, \
-			  n0, \
-			  k0, \
-			  (ftype*)(alpha_array + i), \
-			  (ftype*)*(a_array + idx), rs_a, cs_a, \
-			  (ftype*)*(b_array + idx), rs_b, cs_b, \
-			  (ftype*)(beta_array + i), \
-			  (ftype*)*(c_array + idx), rs_c, cs_c, \
-			  NULL, \
-			  NULL  \
-			); \
-\
-			idx++; \
-		} \
-	} \
+	/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
+	bli_param_map_netlib_to_blis_trans( params->transa_array[ g ], &blis_transa ); \
+	bli_param_map_netlib_to_blis_trans( params->transb_array[ g ], &blis_transb ); \
 \
-	bli_finalize_auto(); \
-}
-
-#else
-
-#undef  GENTFUNC
-#define GENTFUNC( ftype, ch, blasname, blisname ) \
+	/* Typecast BLAS integers to BLIS integers. */ \
+	bli_convert_blas_dim1( params->m_array[ g ], m0 ); \
+	bli_convert_blas_dim1( params->n_array[ g ], n0 ); \
+	bli_convert_blas_dim1( params->k_array[ g ], k0 ); \
+\
+	/* Set the row and column strides of the matrix operands. */ \
+	const inc_t rs_a = 1; \
+	const inc_t cs_a = params->lda_array[ g ]; \
+	const inc_t rs_b = 1; \
+	const inc_t cs_b = params->ldb_array[ g ]; \
+	const inc_t rs_c = 1; \
+	const inc_t cs_c = params->ldc_array[ g ]; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m0_a, n0_a; \
+	dim_t       m0_b, n0_b; \
+\
+	bli_set_dims_with_trans( blis_transa, m0, k0, &m0_a, &n0_a ); \
+	bli_set_dims_with_trans( blis_transb, k0, n0, &m0_b, &n0_b ); \
+\
+	bli_obj_init_finish_1x1( dt, (ftype*)params->alpha_array + g, &alphao ); \
+	bli_obj_init_finish_1x1( dt, (ftype*)params->beta_array  + g, &betao  ); \
+\
+	bli_obj_init_finish( dt, m0_a, n0_a, (ftype*)params->a_array[ i ], rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m0_b, n0_b, (ftype*)params->b_array[ i ], rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m0,   n0,   (ftype*)params->c_array[ i ], rs_c, cs_c, &co ); \
+	bli_obj_set_conjtrans( blis_transa, &ao ); \
+	bli_obj_set_conjtrans( blis_transb, &bo ); \
+\
+	*alpha = alphao; \
+	*a     = ao; \
+	*b     = bo; \
+	*beta  = betao; \
+	*c     = co; \
+} \
 \
 void PASTEF77(ch,blasname) \
      ( \
@@ -149,13 +138,10 @@ void PASTEF77(ch,blasname) \
        const ftype**   b_array, const f77_int* ldb_array, \
        const ftype*    beta_array, \
              ftype**   c_array, const f77_int* ldc_array, \
-       const f77_int* group_count, \
-       const f77_int* group_size ) \
+       const f77_int*  group_count, \
+       const f77_int*  group_size \
+     ) \
 { \
-	trans_t blis_transa; \
-	trans_t blis_transb; \
-	dim_t   m0, n0, k0; \
-\
 	/* Initialize BLIS. */ \
 	bli_init_auto(); \
 \
@@ -166,85 +152,68 @@ void PASTEF77(ch,blasname) \
 		( \
 		  MKSTR(ch), \
 		  MKSTR(blisname), \
-		  transa_array+gi, \
-		  transb_array+gi, \
-		  m_array+gi, \
-		  n_array+gi, \
-		  k_array+gi, \
-		  lda_array+gi, \
-		  ldb_array+gi, \
-		  ldc_array+gi \
+		  &transa_array[ gi ], \
+		  &transb_array[ gi ], \
+		  &m_array[ gi ], \
+		  &n_array[ gi ], \
+		  &k_array[ gi ], \
+		  &lda_array[ gi ], \
+		  &ldb_array[ gi ], \
+		  &ldc_array[ gi ]  \
 		); \
 	} \
 \
-	const num_t dt     = PASTEMAC(ch,type); \
-\
-	f77_int idx = 0, i, j; \
-\
-	for ( i = 0; i < *group_count; i++ ) \
+	if ( *group_count < 1 ) \
 	{ \
-		/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
-		bli_param_map_netlib_to_blis_trans( transa_array[i], &blis_transa ); \
-		bli_param_map_netlib_to_blis_trans( transb_array[i], &blis_transb ); \
-\
-		/* Typecast BLAS integers to BLIS integers. */ \
-		bli_convert_blas_dim1( m_array[i], m0 ); \
-		bli_convert_blas_dim1( n_array[i], n0 ); \
-		bli_convert_blas_dim1( k_array[i], k0 ); \
-\
-		/* Set the row and column strides of the matrix operands. */ \
-		const inc_t rs_a = 1; \
-		const inc_t cs_a = lda_array[i]; \
-		const inc_t rs_b = 1; \
-		const inc_t cs_b = ldb_array[i]; \
-		const inc_t rs_c = 1; \
-		const inc_t cs_c = ldc_array[i]; \
-\
-		obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
-		obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
-\
-		dim_t       m0_a, n0_a; \
-		dim_t       m0_b, n0_b; \
-\
-		bli_set_dims_with_trans( blis_transa, m0, k0, &m0_a, &n0_a ); \
-		bli_set_dims_with_trans( blis_transb, k0, n0, &m0_b, &n0_b ); \
-\
-		bli_obj_init_finish_1x1( dt, (ftype*)(alpha_array + i), &alphao ); \
-		bli_obj_init_finish_1x1( dt, (ftype*)(beta_array  + i),  &betao ); \
-\
-		for( j = 0; j < group_size[i]; j++ ) \
-		{ \
-			obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
-			obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
-			obj_t       co     = BLIS_OBJECT_INITIALIZER; \
-\
-			bli_obj_init_finish( dt, m0_a, n0_a, (ftype*)*(a_array + idx), rs_a, cs_a, &ao ); \
-			bli_obj_init_finish( dt, m0_b, n0_b, (ftype*)*(b_array + idx), rs_b, cs_b, &bo ); \
-			bli_obj_init_finish( dt, m0,   n0,   (ftype*)*(c_array + idx), rs_c, cs_c, &co ); \
-			bli_obj_set_conjtrans( blis_transa, &ao ); \
-			bli_obj_set_conjtrans( blis_transb, &bo ); \
-\
-			PASTEMAC(blisname,BLIS_OAPI_EX_SUF) \
-			( \
-			  &alphao, \
-			  &ao, \
-			  &bo, \
-			  &betao, \
-			  &co, \
-			  NULL, \
-			  NULL  \
-			); \
-\
-			idx++; \
-		} \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+		return; \
 	} \
 \
-	/* Finalize BLIS. */  \
+	/* Compute the index of the first problem of each group so that the
+	   group to which any given problem belongs can be found quickly. */ \
+	err_t  r_val; \
+	dim_t* group_offs = bli_malloc_intl( ( *group_count + 1 ) * sizeof( dim_t ), \
+	                                     &r_val ); \
+\
+	group_offs[ 0 ] = 0; \
+	for ( f77_int gi = 0; gi < *group_count; gi++ ) \
+		group_offs[ gi + 1 ] = group_offs[ gi ] + group_size[ gi ]; \
+\
+	bla_gemm_batch_params_t params; \
+	params.group_count  = *group_count; \
+	params.group_offs   = group_offs; \
+	params.transa_array = transa_array; \
+	params.transb_array = transb_array; \
+	params.m_array      = m_array; \
+	params.n_array      = n_array; \
+	params.k_array      = k_array; \
+	params.alpha_array  = alpha_array; \
+	params.a_array      = (const void**)a_array; \
+	params.lda_array    = lda_array; \
+	params.b_array      = (const void**)b_array; \
+	params.ldb_array    = ldb_array; \
+	params.beta_array   = beta_array; \
+	params.c_array      = (void**)c_array; \
+	params.ldc_array    = ldc_array; \
+\
+	/* Execute all problems of all groups via the batched gemm engine, which
+	   distributes the problems across threads. */ \
+	bli_gemm_batch_int \
+	( \
+	  group_offs[ *group_count ], \
+	  PASTECH(bla_,ch,blasname,_get), \
+	  &params, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	bli_free_intl( group_offs ); \
+\
+	/* Finalize BLIS. */ \
 	bli_finalize_auto(); \
 }
 
-#endif
-
 #ifdef BLIS_ENABLE_BLAS
 INSERT_GENTFUNC_BLAS( gemm_batch, gemm )
 #endif
@@ -526,5 +526,117 @@ BLIS_INLINE double bli_randnp2s( void )
 
 
 
-#endif
+// -- Conversion between float and the reduced-precision storage types --------
+
+// NOTE: Unlike the typecasts above, these functions operate on the bfloat16
+// and float16 storage types defined in bli_type_defs.h. Narrowing
+// conversions round to nearest (ties to even) and preserve NaN and Inf.
+
+BLIS_INLINE uint32_t bli_float_as_bits( float s )
+{
+	uint32_t u;
+	memcpy( &u, &s, sizeof( u ) );
+	return u;
+}
+
+BLIS_INLINE float bli_bits_as_float( uint32_t u )
+{
+	float s;
+	memcpy( &s, &u, sizeof( s ) );
+	return s;
+}
+
+BLIS_INLINE float bli_bf16_to_float( bfloat16 b )
+{
+	return bli_bits_as_float( ( uint32_t )b.v << 16 );
+}
+
+BLIS_INLINE bfloat16 bli_float_to_bf16( float s )
+{
+	uint32_t u = bli_float_as_bits( s );
+	bfloat16 b;
+
+	// Quiet NaNs rather than letting the rounding below turn them into Inf.
+	if ( ( u & 0x7fffffffu ) > 0x7f800000u )
+	{
+		b.v = ( uint16_t )( ( u >> 16 ) | 0x0040u );
+		return b;
+	}
+
+	// Round to nearest even on the 16 discarded bits.
+	u += 0x7fffu + ( ( u >> 16 ) & 1u );
+	b.v = ( uint16_t )( u >> 16 );
+
+	return b;
+}
+
+BLIS_INLINE float bli_f16_to_float( float16 h )
+{
+	const uint32_t sign = ( uint32_t )( h.v & 0x8000u ) << 16;
+	const uint32_t e    = ( h.v >> 10 ) & 0x1fu;
+	uint32_t       m    = h.v & 0x3ffu;
+
+	if ( e == 0x1fu )
+	{
+		// Inf or NaN.
+		return bli_bits_as_float( sign | 0x7f800000u | ( m << 13 ) );
+	}
+	else if ( e == 0 )
+	{
+		// Zero or subnormal; the latter is exactly m * 2^-24.
+		const float r = ( float )m * 5.9604644775390625e-08F;
+		return bli_bits_as_float( sign | bli_float_as_bits( r ) );
+	}
+
+	return bli_bits_as_float( sign | ( ( e + 112u ) << 23 ) | ( m << 13 ) );
+}
+
+BLIS_INLINE float16 bli_float_to_f16( float s )
+{
+	const uint32_t u    = bli_float_as_bits( s );
+	const uint32_t au   = u & 0x7fffffffu;
+	const uint16_t sign = ( uint16_t )( ( u >> 16 ) & 0x8000u );
+	uint32_t       r;
+	float16        h;
+
+	if ( au >= 0x7f800000u )
+	{
+		// Inf or NaN (quieted).
+		r = ( au > 0x7f800000u ? 0x7e00u : 0x7c00u );
+	}
+	else if ( au >= 0x477ff000u )
+	{
+		// Rounds to a magnitude beyond the largest finite float16.
+		r = 0x7c00u;
+	}
+	else if ( au < 0x38800000u )
+	{
+		// Result is a float16 subnormal (or zero).
+		if ( au < 0x33000000u ) r = 0;
+		else
+		{
+			const uint32_t m     = ( au & 0x7fffffu ) | 0x800000u;
+			const uint32_t shift = 126u - ( au >> 23 );
+			const uint32_t rem   = m & ( ( 1u << shift ) - 1u );
+			const uint32_t half  = 1u << ( shift - 1u );
+
+			r = m >> shift;
+			if ( rem > half || ( rem == half && ( r & 1u ) ) ) r += 1;
+		}
+	}
+	else
+	{
+		const uint32_t v   = au - 0x38000000u;
+		const uint32_t rem = v & 0x1fffu;
+
+		r = v >> 13;
+		if ( rem > 0x1000u || ( rem == 0x1000u && ( r & 1u ) ) ) r += 1;
+	}
+
+	h.v = ( uint16_t )( sign | r );
+
+	return h;
+}
+
 
+#endif
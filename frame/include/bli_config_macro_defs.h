@@ -105,6 +105,62 @@
   // Default behavior is disabled.
 #endif
 
+// Enable the persistent thread pool used by the POSIX threads implementation.
+// When disabled, threads are created and joined on every parallel region.
+#ifdef BLIS_ENABLE_PTHREADS
+  #ifdef BLIS_DISABLE_PTHREAD_POOL
+    #undef BLIS_ENABLE_PTHREAD_POOL
+  #else
+    // Default behavior is enabled.
+    #undef  BLIS_ENABLE_PTHREAD_POOL // In case user explicitly enabled.
+    #define BLIS_ENABLE_PTHREAD_POOL
+  #endif
+#endif
+
+// Set the number of iterations that an idle thread pool worker (or the chief
+// thread waiting on the workers) spins before going to sleep.
+#ifndef BLIS_THREAD_POOL_SPIN_COUNT
+  #define BLIS_THREAD_POOL_SPIN_COUNT 100000
+#endif
+
+// Set the maximum number of NUMA nodes for which the packing block allocator
+// maintains separate pools. Any additional nodes are folded onto the first
+// BLIS_NUMA_MAX_NODES nodes.
+#ifndef BLIS_NUMA_MAX_NODES
+  #define BLIS_NUMA_MAX_NODES 8
+#endif
+
+// Set the number of chunks per thread into which a dynamically scheduled
+// jr/ir loop is divided. Larger values balance the load more finely at the
+// cost of more atomic updates of the shared counter.
+#ifndef BLIS_THREAD_DYN_GRAIN
+  #define BLIS_THREAD_DYN_GRAIN 8
+#endif
+
+// Set the largest number of arrivals on any one node of the tree barrier
+// (see BLIS_BARRIER_TREE). Must be at least 2.
+#ifndef BLIS_BARRIER_MAX_FANIN
+  #define BLIS_BARRIER_MAX_FANIN 8
+#endif
+
+// Set the default number of times a thread waiting at a barrier polls it
+// before going to sleep (on Linux) until the barrier is released. Each poll
+// is followed by a spin-wait hint (pause on x86, which takes on the order of
+// 100 cycles on recent cores), so the default amounts to well under a
+// millisecond of polling. This may be overridden at runtime via
+// BLIS_BARRIER_SPIN or the rntm_t.
+#ifndef BLIS_BARRIER_SPIN_COUNT
+  #define BLIS_BARRIER_SPIN_COUNT 10000
+#endif
+
+// Set the number of sets of thrinfo_t trees that are kept after a level-3
+// operation completes so that a later operation with the same
+// parallelization can reuse them (see bli_l3_thrinfo_cache_checkout()).
+// Setting this to 0 disables the cache.
+#ifndef BLIS_THRINFO_CACHE_SIZE
+  #define BLIS_THRINFO_CACHE_SIZE 4
+#endif
+
 // Enable multithreading via OpenMP.
 #ifdef BLIS_ENABLE_OPENMP
   // No additional definitions needed.
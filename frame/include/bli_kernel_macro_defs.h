@@ -52,6 +52,14 @@
 #define BLIS_THREAD_RATIO_N     1
 #endif
 
+// The BLIS_THREAD_RATIO_K macro determines how much larger the k dimension
+// must be than the larger of the m and n dimensions before threads are
+// assigned to the pc loop during automatic factorization. See bli_rntm.c to
+// see how this macro is used.
+#ifndef BLIS_THREAD_RATIO_K
+#define BLIS_THREAD_RATIO_K     4
+#endif
+
 // These BLIS_THREAD_MAX_?R macros place a ceiling on the maximum amount of
 // parallelism allowed when performing automatic factorization. See bli_rntm.c
 // to see how these macros are used.
@@ -63,6 +71,14 @@
 #define BLIS_THREAD_MAX_JR      4
 #endif
 
+// The BLIS_GEMM_BATCH_COOP_MNK macro sets the size (measured as m*n*k) at
+// or above which a problem within a batched gemm is executed by all threads
+// cooperatively rather than by a single thread. See bli_gemm_batch.c to see
+// how this macro is used.
+#ifndef BLIS_GEMM_BATCH_COOP_MNK
+#define BLIS_GEMM_BATCH_COOP_MNK  ( 256 * 256 * 256 )
+#endif
+
 #if 0
 // -- Skinny/small possibly-unpacked (sup code path) values --
 
@@ -160,6 +176,25 @@
 #define BLIS_PAGE_SIZE                   4096
 #endif
 
+// Size of a (transparent or explicit) huge page. When huge page backing is
+// enabled (see bli_hugepage.c), pool blocks of at least
+// BLIS_HUGE_PAGE_MIN_SIZE bytes are allocated in multiples of this size and
+// aligned to it.
+#ifndef BLIS_HUGE_PAGE_SIZE
+#define BLIS_HUGE_PAGE_SIZE              ( 2 * 1024 * 1024 )
+#endif
+
+#ifndef BLIS_HUGE_PAGE_MIN_SIZE
+#define BLIS_HUGE_PAGE_MIN_SIZE          ( BLIS_HUGE_PAGE_SIZE / 2 )
+#endif
+
+// Whether the cache blocksizes (MC, KC, and NC) of the native context are
+// derived at runtime from the cache topology reported by the cpu. This may be
+// overridden at runtime via the BLIS_AUTO_CACHE_BLKSZ environment variable.
+#ifndef BLIS_AUTO_CACHE_BLKSZ_DEF
+#define BLIS_AUTO_CACHE_BLKSZ_DEF        1
+#endif
+
 // The maximum number of named SIMD vector registers available for use.
 // When configuring with umbrella configuration families, this should be
 // set to the maximum number of registers across all sub-configurations in
@@ -78,6 +78,7 @@
                                   defined(__ICC)     || \
                                   defined(__IBMC__) )
   #define BLIS_THREAD_LOCAL __thread
+  #define BLIS_HAS_THREAD_LOCAL
 #else
   #define BLIS_THREAD_LOCAL
 #endif
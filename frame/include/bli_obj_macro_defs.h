@@ -173,6 +173,13 @@ BLIS_INLINE prec_t bli_obj_scalar_prec( const obj_t* obj )
 	       ( ( obj->info2 & BLIS_SCALAR_PREC_BIT ) >> BLIS_SCALAR_DT_SHIFT );
 }
 
+// NOTE: This function queries info2.
+BLIS_INLINE bool bli_obj_has_pending_updates( const obj_t* obj )
+{
+	return ( bool )
+	       ( ( obj->info2 & BLIS_PENDING_UPDATES_BIT ) != 0 );
+}
+
 BLIS_INLINE trans_t bli_obj_conjtrans_status( const obj_t* obj )
 {
 	return ( trans_t )
@@ -429,6 +436,14 @@ BLIS_INLINE void bli_obj_set_scalar_prec( prec_t dt, obj_t* obj )
 	               ( dt << BLIS_SCALAR_DT_SHIFT ) );
 }
 
+// NOTE: This function queries and modifies info2.
+BLIS_INLINE void bli_obj_set_pending_updates( bool pending, obj_t* obj )
+{
+	obj->info2 = ( objbits_t )
+	             ( ( obj->info2 & ~BLIS_PENDING_UPDATES_BIT ) |
+	               ( ( pending ? 1 : 0 ) << BLIS_PENDING_UPDATES_SHIFT ) );
+}
+
 BLIS_INLINE void bli_obj_set_pack_schema( pack_t schema, obj_t* obj )
 {
 	obj->info = ( objbits_t )
@@ -1144,6 +1159,7 @@ BLIS_INLINE void bli_obj_set_defaults( obj_t* obj )
 {
 	obj->info = 0x0;
 	obj->info = obj->info | BLIS_BITVAL_DENSE | BLIS_BITVAL_GENERAL;
+	obj->info2 = 0x0;
 }
 
 // Acquire buffer at object's submatrix offset (offset-aware buffer query).
@@ -208,6 +208,37 @@ typedef uint32_t objbits_t;  // object information bit field
 
 #endif // BLIS_ENABLE_C99_COMPLEX
 
+// -- Reduced-precision storage types --
+
+// Note: these types are only used to store the input operands of the
+// reduced-precision gemm operations (see bli_gemm_lp.h). They are not
+// members of num_t; computation on them always takes place in (at least)
+// single precision.
+
+// Brain floating-point (bfloat16): the upper 16 bits of an IEEE float.
+typedef union
+{
+	uint16_t v;
+	struct
+	{
+		uint16_t m:7;
+		uint16_t e:8;
+		uint16_t s:1;
+	} bits;
+} bfloat16;
+
+// IEEE 754 half-precision floating-point (binary16).
+typedef union
+{
+	uint16_t v;
+	struct
+	{
+		uint16_t m:10;
+		uint16_t e:5;
+		uint16_t s:1;
+	} bits;
+} float16;
+
 // -- Atom type --
 
 // Note: atom types are used to hold "bufferless" scalar object values. Note
@@ -274,6 +305,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_PACK_REV_IF_LOWER_NUM_BITS    1
 #define BLIS_PACK_BUFFER_NUM_BITS          2
 #define BLIS_STRUC_NUM_BITS                2
+#define BLIS_PENDING_UPDATES_NUM_BITS      1
 
 
 //
@@ -304,8 +336,9 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_SCALAR_DT_SHIFT             ( BLIS_COMP_PREC_SHIFT + BLIS_PRECISION_NUM_BITS )
 #define   BLIS_SCALAR_DOMAIN_SHIFT       (   BLIS_SCALAR_DT_SHIFT )
 #define   BLIS_SCALAR_PREC_SHIFT         (   BLIS_SCALAR_DOMAIN_SHIFT + BLIS_DOMAIN_NUM_BITS )
+#define BLIS_PENDING_UPDATES_SHIFT       ( BLIS_SCALAR_DT_SHIFT + BLIS_DATATYPE_NUM_BITS )
 // This is the total number of bits, which should always be <= 32
-#define BLIS_INFO_NUM_BITS               ( BLIS_SCALAR_DT_SHIFT + BLIS_DATATYPE_NUM_BITS )
+#define BLIS_INFO_NUM_BITS               ( BLIS_PENDING_UPDATES_SHIFT + BLIS_PENDING_UPDATES_NUM_BITS )
 
 //
 // -- BLIS info bit field masks ------------------------------------------------
@@ -335,6 +368,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_SCALAR_DT_BITS                ( ( ( 1 << BLIS_DATATYPE_NUM_BITS          ) - 1 ) << BLIS_SCALAR_DT_SHIFT )
 #define   BLIS_SCALAR_DOMAIN_BIT           ( ( ( 1 << BLIS_DOMAIN_NUM_BITS            ) - 1 ) << BLIS_SCALAR_DOMAIN_SHIFT )
 #define   BLIS_SCALAR_PREC_BIT             ( ( ( 1 << BLIS_PRECISION_NUM_BITS         ) - 1 ) << BLIS_SCALAR_PREC_SHIFT )
+#define BLIS_PENDING_UPDATES_BIT           ( ( ( 1 << BLIS_PENDING_UPDATES_NUM_BITS   ) - 1 ) << BLIS_PENDING_UPDATES_SHIFT )
 
 
 //
@@ -611,6 +645,40 @@ typedef enum timpl_e
 } timpl_t;
 
 
+// -- Thread affinity policy type --
+
+typedef enum taff_e
+{
+	// Leave thread placement to the operating system (or to the threading
+	// runtime, e.g. via OMP_PROC_BIND).
+	BLIS_AFFINITY_NONE = 0,
+
+	// Bind the threads to as few last-level cache domains as possible.
+	BLIS_AFFINITY_COMPACT,
+
+	// Spread the threads evenly across all last-level cache domains.
+	BLIS_AFFINITY_SCATTER,
+
+	// Bind thread i to the i-th cpu of a user-supplied list.
+	BLIS_AFFINITY_LIST,
+
+} taff_t;
+
+
+// -- Thread barrier type --
+
+typedef enum tbar_e
+{
+	// All threads of a communicator arrive on a single shared counter.
+	BLIS_BARRIER_CENTRAL = 0,
+
+	// Threads arrive on a combining tree whose fan-in at each level follows
+	// the cache/package topology (see bli_thrcomm_tree_init()).
+	BLIS_BARRIER_TREE,
+
+} tbar_t;
+
+
 // -- Kernel ID types --
 
 // Encode the number of independent type parameters in the high
@@ -684,6 +752,16 @@ typedef enum ukr_e
 	BLIS_GEMMSUP_CCC_UKR,
 	BLIS_GEMMSUP_XXX_UKR,
 
+	// reduced-precision (bfloat16, float16) pack and gemm kernels
+	BLIS_PACKM_BF16_KER,
+	BLIS_PACKM_F16_KER,
+	BLIS_GEMM_BF16_UKR,
+	BLIS_GEMM_F16_UKR,
+
+	// 8-bit integer (uint8 x int8 -> int32) pack and gemm kernels
+	BLIS_PACKM_I8_KER,
+	BLIS_GEMM_U8S8S32_UKR,
+
 	// BLIS_NUM_UKRS must after all 1-type kernels and before 2-type kernels!
 	BLIS_NUM_UKRS_, BLIS_NUM_UKRS = bli_ker_idx( BLIS_NUM_UKRS_ ),
 
@@ -1013,9 +1091,14 @@ typedef enum arch_e
 	// Generic architecture/configuration
 	BLIS_ARCH_GENERIC,
 
+	// AMD (appended after the original list so that the values above keep
+	// their numbering)
+	BLIS_ARCH_ZEN4,
+	BLIS_ARCH_ZEN5,
+
 	// The total number of defined architectures. This must be last in the
 	// list of enums since its definition assumes that the previous enum
-	// value (BLIS_ARCH_GENERIC) is given index num_archs-1.
+	// value is given index num_archs-1.
 	BLIS_NUM_ARCHS
 
 } arch_t;
@@ -1036,6 +1119,10 @@ typedef struct pblk_s
 	void*     buf;
 	siz_t     block_size;
 
+	// The length of the huge page mapping backing the block, or zero if the
+	// block was allocated via the pool's malloc() function.
+	siz_t     map_size;
+
 } pblk_t;
 
 
@@ -1053,6 +1140,9 @@ typedef struct pool_s
 	siz_t     align_size;
 	siz_t     offset_size;
 
+	// The NUMA node on which blocks are placed, or -1 for no preference.
+	dim_t     node;
+
 	malloc_ft malloc_fp;
 	free_ft   free_fp;
 
@@ -1087,8 +1177,10 @@ typedef struct apool_s
 
 typedef struct pba_s
 {
-	pool_t              pools[3];
-	bli_pthread_mutex_t mutex;
+	// One set of pools (and one mutex) per NUMA node.
+	pool_t              pools[ BLIS_NUMA_MAX_NODES ][3];
+	bli_pthread_mutex_t mutex[ BLIS_NUMA_MAX_NODES ];
+	dim_t               num_nodes;
 
 	// These fields are used for general-purpose allocation.
 	siz_t               align_size;
@@ -1208,6 +1300,10 @@ typedef struct auxinfo_s
 	void_fp ukr;
 	const void* params;
 
+	// The epilogue to apply to the micro-tile of C once it has been
+	// updated, or NULL if there is none (see bli_gemm_epi.h).
+	const void* epi;
+
 } auxinfo_t;
 
 
@@ -1265,7 +1361,7 @@ typedef struct obj_s
 // Pre-initializors. Things that must be set afterwards:
 // - root object pointer
 // - info bitfields: dt, target_dt, exec_dt, comp_dt
-// - info2 bitfields: scalar_dt
+// - info2 bitfields: scalar_dt, pending_updates
 // - elem_size
 // - dims, strides
 // - buffer
@@ -1485,6 +1581,9 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	taff_t    affinity; // policy for binding threads to cpus.
+	bool      jrir_dyn; // enable/disable dynamic scheduling of jr/ir loops.
+	dim_t     barrier_spin; // polls before a barrier waiter sleeps (-1: default).
 } rntm_t;
 
 
@@ -1520,6 +1619,7 @@ typedef enum err_e
 	BLIS_INVALID_DIAG                          = ( -24),
 	BLIS_INVALID_MACHVAL                       = ( -25),
 	BLIS_EXPECTED_NONUNIT_DIAG                 = ( -26),
+	BLIS_INVALID_EPI_ACT                       = ( -27),
 
 	// Datatype-specific errors
 	BLIS_INVALID_DATATYPE                      = ( -30),
@@ -1570,6 +1670,7 @@ typedef enum err_e
 	// Packing-specific errors
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK  = (-100),
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_PART    = (-101),
+	BLIS_INCOMPATIBLE_PACKED_OBJECT            = (-102),
 
 	// Buffer-specific errors
 	BLIS_EXPECTED_NONNULL_OBJECT_BUFFER        = (-110),
@@ -908,6 +908,7 @@
 #define VXORPS(_0, _1, _2) INSTR_(vxorps, _0, _1, _2)
 #define VXORPD(_0, _1, _2) INSTR_(vxorpd, _0, _1, _2)
 #define VPXORD(_0, _1, _2) INSTR_(vpxord, _0, _1, _2)
+#define VDPBF16PS(_0, _1, _2) INSTR_(vdpbf16ps, _0, _1, _2)
 
 #define VUCOMISS(_0, _1) INSTR_(vucomiss, _0, _1)
 #define VUCOMISD(_0, _1) INSTR_(vucomisd, _0, _1)
@@ -1042,6 +1043,7 @@
 #define vxorps(_0, _1, _2) VXORPS(_0, _1, _2)
 #define vxorpd(_0, _1, _2) VXORPD(_0, _1, _2)
 #define vpxord(_0, _1, _2) VPXORD(_0, _1, _2)
+#define vdpbf16ps(_0, _1, _2) VDPBF16PS(_0, _1, _2)
 
 #define vucomiss(_0, _1) VUCOMISS(_0, _1)
 #define vucomisd(_0, _1) VUCOMISD(_0, _1)
@@ -106,6 +106,7 @@ extern "C" {
 #include "bli_thread_range.h"
 #include "bli_thread_range_slab_rr.h"
 #include "bli_thread_range_tlb.h"
+#include "bli_thread_range_dyn.h"
 
 #include "bli_pthread.h"
 
@@ -133,6 +134,7 @@ extern "C" {
 #include "bli_ind.h"
 #include "bli_pba.h"
 #include "bli_pool.h"
+#include "bli_hugepage.h"
 #include "bli_array.h"
 #include "bli_apool.h"
 #include "bli_sba.h"
@@ -0,0 +1,296 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef __linux__
+  // Needed for the cpu_set_t interface.
+  #define _GNU_SOURCE
+  #include <sched.h>
+#endif
+
+#include "blis.h"
+
+#ifdef BLIS_OS_LINUX
+
+// The topology, as detected by bli_affinity_init(). The cpus on which the
+// process may run are stored in aff_order grouped by last-level cache
+// domain; domain d occupies aff_order[ aff_dom_off[d] : aff_dom_off[d+1] ].
+// Within a domain, the first hardware thread of every core comes first,
+// followed by the second hardware thread of every core, and so on, so that
+// SMT siblings are only used once every core of the domain is occupied.
+static dim_t     aff_num_cpus  = 0;
+static dim_t     aff_num_doms  = 0;
+static dim_t     aff_min_cores = 1;
+static dim_t     aff_pkg_doms  = 0;
+static int       aff_order[ CPU_SETSIZE ];
+static dim_t     aff_dom_off[ CPU_SETSIZE + 1 ];
+
+// The cpu list used by BLIS_AFFINITY_LIST.
+static dim_t     aff_list_len  = 0;
+static int       aff_list[ CPU_SETSIZE ];
+
+// Read a sysfs file in the "cpulist" format into a cpu_set_t. Return FALSE
+// if the file could not be read.
+static bool bli_affinity_read_set( int cpu, const char* file, cpu_set_t* set )
+{
+	char path[ 128 ];
+
+	snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%d/%s",
+	          cpu, file );
+
+	return bli_cpuset_read_list( path, set );
+}
+
+// Read a sysfs file holding a single non-negative integer. Return -1 if the
+// file could not be read.
+static int bli_affinity_read_int( int cpu, const char* file )
+{
+	char path[ 128 ];
+	int  val = -1;
+
+	snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%d/%s",
+	          cpu, file );
+
+	FILE* fp = fopen( path, "r" );
+	if ( fp == NULL ) return -1;
+
+	if ( fscanf( fp, "%d", &val ) != 1 ) val = -1;
+
+	fclose( fp );
+
+	return val;
+}
+
+void bli_affinity_init( void )
+{
+	aff_num_cpus  = 0;
+	aff_num_doms  = 0;
+	aff_min_cores = 1;
+	aff_pkg_doms  = 0;
+	aff_list_len  = 0;
+
+	// Read the cpu list for BLIS_AFFINITY_LIST, which may also be given
+	// directly as the value of BLIS_AFFINITY.
+	char* list_env = bli_env_get_str( "BLIS_AFFINITY_LIST" );
+	char* aff_env  = bli_env_get_str( "BLIS_AFFINITY" );
+
+	if ( list_env == NULL && aff_env != NULL &&
+	     isdigit( ( unsigned char )aff_env[0] ) ) list_env = aff_env;
+
+	aff_list_len = bli_cpuset_parse_list( list_env, aff_list, CPU_SETSIZE );
+
+	cpu_set_t allowed;
+	if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &allowed ) != 0 )
+		return;
+
+	// For every allowed cpu, determine its rank among the hardware threads
+	// of its core and the (dense) index of its last-level cache domain.
+	int dom_of[ CPU_SETSIZE ];
+	int smt_of[ CPU_SETSIZE ];
+
+	for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu ) dom_of[ cpu ] = smt_of[ cpu ] = -1;
+
+	int max_smt = 0;
+
+	for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+	{
+		if ( !CPU_ISSET( cpu, &allowed ) ) continue;
+
+		cpu_set_t set;
+
+		if ( smt_of[ cpu ] < 0 )
+		{
+			if ( !bli_affinity_read_set( cpu, "topology/thread_siblings_list", &set ) )
+				CPU_ZERO( &set );
+
+			CPU_AND( &set, &set, &allowed );
+			CPU_SET( cpu, &set );
+
+			int rank = 0;
+			for ( int c = 0; c < CPU_SETSIZE; ++c )
+				if ( CPU_ISSET( c, &set ) && smt_of[ c ] < 0 ) smt_of[ c ] = rank++;
+
+			max_smt = bli_max( max_smt, rank - 1 );
+		}
+
+		if ( dom_of[ cpu ] < 0 )
+		{
+			// Prefer the cpus sharing the L3 cache. Fall back to the cpus of
+			// the same package if the cache topology is not exposed.
+			if ( !bli_affinity_read_set( cpu, "cache/index3/shared_cpu_list", &set ) &&
+			     !bli_affinity_read_set( cpu, "topology/package_cpus_list", &set ) &&
+			     !bli_affinity_read_set( cpu, "topology/core_siblings_list", &set ) )
+				set = allowed;
+
+			CPU_AND( &set, &set, &allowed );
+			CPU_SET( cpu, &set );
+
+			for ( int c = 0; c < CPU_SETSIZE; ++c )
+				if ( CPU_ISSET( c, &set ) && dom_of[ c ] < 0 ) dom_of[ c ] = aff_num_doms;
+
+			++aff_num_doms;
+		}
+	}
+
+	// Lay out the cpus domain by domain, using up the first hardware thread
+	// of every core before moving on to the SMT siblings.
+	for ( dim_t d = 0; d < aff_num_doms; ++d )
+	{
+		aff_dom_off[ d ] = aff_num_cpus;
+
+		for ( int rank = 0; rank <= max_smt; ++rank )
+		{
+			for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+				if ( dom_of[ cpu ] == d && smt_of[ cpu ] == rank )
+					aff_order[ aff_num_cpus++ ] = cpu;
+
+			if ( rank == 0 )
+			{
+				const dim_t n_cores = aff_num_cpus - aff_dom_off[ d ];
+				aff_min_cores = ( d == 0 ? n_cores : bli_min( aff_min_cores, n_cores ) );
+			}
+		}
+	}
+
+	aff_dom_off[ aff_num_doms ] = aff_num_cpus;
+	aff_min_cores = bli_max( 1, aff_min_cores );
+
+	// Count the domains of each package, as given by the package of the
+	// first cpu of the domain, and keep the smallest nonzero count.
+	dim_t pkg_doms[ CPU_SETSIZE ] = { 0 };
+
+	for ( dim_t d = 0; d < aff_num_doms; ++d )
+	{
+		const int pkg = bli_affinity_read_int( aff_order[ aff_dom_off[ d ] ],
+		                                       "topology/physical_package_id" );
+
+		// Without package information, the packages are left undetected.
+		if ( pkg < 0 || CPU_SETSIZE <= pkg ) return;
+
+		++pkg_doms[ pkg ];
+	}
+
+	for ( int pkg = 0; pkg < CPU_SETSIZE; ++pkg )
+		if ( 0 < pkg_doms[ pkg ] )
+			aff_pkg_doms = ( aff_pkg_doms == 0 ? pkg_doms[ pkg ]
+			                                   : bli_min( aff_pkg_doms, pkg_doms[ pkg ] ) );
+}
+
+void bli_affinity_finalize( void )
+{
+	aff_num_cpus = 0;
+	aff_num_doms = 0;
+	aff_pkg_doms = 0;
+	aff_list_len = 0;
+}
+
+dim_t bli_affinity_domain_cores( void )
+{
+	return ( 0 < aff_num_doms ? aff_min_cores : 0 );
+}
+
+dim_t bli_affinity_package_domains( void )
+{
+	return aff_pkg_doms;
+}
+
+dim_t bli_affinity_num_domains( taff_t aff, dim_t nt )
+{
+	if ( aff_num_doms < 2 || nt < 2 ) return 1;
+
+	if ( aff == BLIS_AFFINITY_COMPACT )
+		return bli_min( aff_num_doms, ( nt + aff_min_cores - 1 ) / aff_min_cores );
+	if ( aff == BLIS_AFFINITY_SCATTER )
+		return bli_min( aff_num_doms, nt );
+
+	return 1;
+}
+
+dim_t bli_affinity_thread_cpu( taff_t aff, dim_t tid, dim_t nt )
+{
+	if ( nt < 2 || tid < 0 ) return -1;
+
+	if ( aff == BLIS_AFFINITY_LIST )
+	{
+		if ( aff_list_len == 0 ) return -1;
+
+		return aff_list[ tid % aff_list_len ];
+	}
+
+	if ( aff != BLIS_AFFINITY_COMPACT && aff != BLIS_AFFINITY_SCATTER )
+		return -1;
+
+	if ( aff_num_cpus == 0 ) return -1;
+
+	// Divide the thread ids into nd contiguous blocks of (nearly) equal size,
+	// one per domain, and let the threads of each block fill their domain in
+	// order.
+	const dim_t nd    = bli_affinity_num_domains( aff, nt );
+	const dim_t d     = ( tid * nd ) / nt;
+	const dim_t first = ( d * nt + nd - 1 ) / nd;
+	const dim_t off   = aff_dom_off[ d ];
+	const dim_t len   = aff_dom_off[ d + 1 ] - off;
+
+	return aff_order[ off + ( tid - first ) % len ];
+}
+
+bool bli_affinity_bind_thread( taff_t aff, dim_t tid, dim_t nt )
+{
+	const dim_t cpu = bli_affinity_thread_cpu( aff, tid, nt );
+
+	// Threads that are not bound here are left to bli_numa_bind_thread(),
+	// which also releases a binding kept from a previous operation.
+	if ( cpu < 0 ) return FALSE;
+
+	cpu_set_t set;
+	CPU_ZERO( &set );
+	CPU_SET( cpu, &set );
+
+	return bli_cpuset_bind_thread( &set, FALSE );
+}
+
+#else
+
+void  bli_affinity_init( void ) { }
+void  bli_affinity_finalize( void ) { }
+
+dim_t bli_affinity_domain_cores( void ) { return 0; }
+dim_t bli_affinity_package_domains( void ) { return 0; }
+
+dim_t bli_affinity_num_domains( taff_t aff, dim_t nt ) { return 1; }
+dim_t bli_affinity_thread_cpu( taff_t aff, dim_t tid, dim_t nt ) { return -1; }
+
+bool  bli_affinity_bind_thread( taff_t aff, dim_t tid, dim_t nt ) { return FALSE; }
+
+#endif
+
@@ -0,0 +1,72 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_AFFINITY_H
+#define BLIS_AFFINITY_H
+
+// Thread-to-cpu binding. When the rntm_t of a level-3 operation requests an
+// affinity policy (see taff_t), each thread of the team binds itself to a
+// single cpu before it starts computing. Thread ids are mapped to cpus such
+// that contiguous ranges of ids, which are what the jc loop (and, within it,
+// the ic loop) hands to each thread group, land within one last-level cache
+// domain. The cpu topology is read from /sys/devices/system/cpu at
+// initialization time; on non-Linux systems all of the functions below are
+// no-ops.
+
+void  bli_affinity_init( void );
+void  bli_affinity_finalize( void );
+
+// Return the number of cores in the smallest last-level cache domain and the
+// number of such domains in the smallest package, or 0 if that part of the
+// topology is unknown.
+BLIS_EXPORT_BLIS dim_t bli_affinity_domain_cores( void );
+BLIS_EXPORT_BLIS dim_t bli_affinity_package_domains( void );
+
+// Return the number of last-level cache domains over which a team of nt
+// threads is spread under the given policy. This is 1 unless the policy is
+// BLIS_AFFINITY_COMPACT or BLIS_AFFINITY_SCATTER.
+BLIS_EXPORT_BLIS dim_t bli_affinity_num_domains( taff_t aff, dim_t nt );
+
+// Return the cpu to which thread tid of an nt-thread team is bound under the
+// given policy, or -1 if the thread is not bound.
+BLIS_EXPORT_BLIS dim_t bli_affinity_thread_cpu( taff_t aff, dim_t tid, dim_t nt );
+
+// Bind the calling thread according to the given policy. Returns TRUE if the
+// thread is now bound to a single cpu. The binding is undone by
+// bli_cpuset_unbind_thread().
+bool  bli_affinity_bind_thread( taff_t aff, dim_t tid, dim_t nt );
+
+#endif
+
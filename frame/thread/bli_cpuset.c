@@ -0,0 +1,212 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef __linux__
+  // Needed for the cpu_set_t interface.
+  #define _GNU_SOURCE
+  #include <sched.h>
+#endif
+
+#include "blis.h"
+
+#ifdef BLIS_OS_LINUX
+
+#ifdef BLIS_HAS_THREAD_LOCAL
+// The affinity mask of the calling thread prior to its first binding by
+// either the NUMA or the affinity policy, and the cpus to which it is
+// currently bound, if any. Without thread-local storage these would be
+// shared by all threads, so binding is disabled altogether in that case.
+static BLIS_THREAD_LOCAL cpu_set_t cpuset_saved;
+static BLIS_THREAD_LOCAL cpu_set_t cpuset_bound;
+static BLIS_THREAD_LOCAL bool      cpuset_is_bound = FALSE;
+static BLIS_THREAD_LOCAL bool      cpuset_is_kept  = FALSE;
+#endif
+
+dim_t bli_cpuset_parse_list( const char* str, int* list, dim_t max )
+{
+	dim_t n = 0;
+
+	while ( str != NULL && *str != '\0' && n < max )
+	{
+		char* end;
+		long  lo = strtol( str, &end, 10 );
+		long  hi = lo;
+
+		if ( end == str ) break;
+
+		if ( *end == '-' )
+		{
+			str = end + 1;
+			hi  = strtol( str, &end, 10 );
+			if ( end == str ) break;
+		}
+
+		for ( long i = lo; i <= hi && n < max; ++i )
+			if ( 0 <= i && i < CPU_SETSIZE ) list[ n++ ] = ( int )i;
+
+		str = ( *end == ',' ? end + 1 : NULL );
+	}
+
+	return n;
+}
+
+bool bli_cpuset_read_list( const char* path, cpu_set_t* set )
+{
+	CPU_ZERO( set );
+
+	FILE* fp = fopen( path, "r" );
+	if ( fp == NULL ) return FALSE;
+
+	// Read the list piece by piece rather than into a fixed-size buffer,
+	// since lists of scattered cpus can be arbitrarily long.
+	long lo, hi;
+	int  c = ',';
+	while ( c == ',' && fscanf( fp, "%ld", &lo ) == 1 )
+	{
+		hi = lo;
+		c  = fgetc( fp );
+		if ( c == '-' )
+		{
+			if ( fscanf( fp, "%ld", &hi ) != 1 ) break;
+			c = fgetc( fp );
+		}
+
+		for ( long i = bli_max( lo, 0 ); i <= hi && i < CPU_SETSIZE; ++i )
+			CPU_SET( i, set );
+	}
+
+	fclose( fp );
+
+	return 0 < CPU_COUNT( set );
+}
+
+dim_t bli_cpuset_count_list( const char* path )
+{
+	cpu_set_t set;
+
+	if ( !bli_cpuset_read_list( path, &set ) ) return 0;
+
+	return CPU_COUNT( &set );
+}
+
+#ifdef BLIS_HAS_THREAD_LOCAL
+
+bool bli_cpuset_bind_thread( const cpu_set_t* set, bool confine )
+{
+	if ( !cpuset_is_bound &&
+	     sched_getaffinity( 0, sizeof( cpu_set_t ), &cpuset_saved ) != 0 )
+		return FALSE;
+
+	cpu_set_t cpus = *set;
+
+	if ( confine )
+	{
+		CPU_AND( &cpus, &cpus, &cpuset_saved );
+
+		// If the application has pinned the thread somewhere else entirely,
+		// or if the thread is already confined to the cpus of set, leave it
+		// alone.
+		if ( CPU_COUNT( &cpus ) == 0 )
+		{
+			bli_cpuset_restore_thread();
+			return FALSE;
+		}
+
+		if ( CPU_EQUAL( &cpus, &cpuset_saved ) )
+		{
+			bli_cpuset_restore_thread();
+			return TRUE;
+		}
+	}
+
+	// A thread that kept the same binding from a previous operation needs
+	// no further system calls.
+	if ( cpuset_is_bound && CPU_EQUAL( &cpus, &cpuset_bound ) ) return TRUE;
+
+	// Binding may fail if, for example, a cpu in the user's list is offline
+	// or outside of the process's cpuset. This is not an error; the thread
+	// simply runs wherever it was allowed to run before.
+	if ( sched_setaffinity( 0, sizeof( cpu_set_t ), &cpus ) != 0 )
+	{
+		bli_cpuset_restore_thread();
+		return FALSE;
+	}
+
+	cpuset_bound    = cpus;
+	cpuset_is_bound = TRUE;
+
+	return TRUE;
+}
+
+void bli_cpuset_restore_thread( void )
+{
+	if ( !cpuset_is_bound ) return;
+
+	sched_setaffinity( 0, sizeof( cpu_set_t ), &cpuset_saved );
+
+	cpuset_is_bound = FALSE;
+}
+
+void bli_cpuset_unbind_thread( void )
+{
+	if ( cpuset_is_kept ) return;
+
+	bli_cpuset_restore_thread();
+}
+
+void bli_cpuset_keep_binding( void )
+{
+	cpuset_is_kept = TRUE;
+}
+
+#else
+
+bool bli_cpuset_bind_thread( const cpu_set_t* set, bool confine ) { return FALSE; }
+void bli_cpuset_restore_thread( void ) { }
+void bli_cpuset_unbind_thread( void ) { }
+void bli_cpuset_keep_binding( void ) { }
+
+#endif
+
+#else
+
+dim_t bli_cpuset_parse_list( const char* str, int* list, dim_t max ) { return 0; }
+dim_t bli_cpuset_count_list( const char* path ) { return 0; }
+
+void  bli_cpuset_restore_thread( void ) { }
+void  bli_cpuset_unbind_thread( void ) { }
+void  bli_cpuset_keep_binding( void ) { }
+
+#endif
+
@@ -0,0 +1,83 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CPUSET_H
+#define BLIS_CPUSET_H
+
+// Linux cpu set helpers shared by the NUMA (bli_numa.c) and affinity
+// (bli_affinity.c) policies and by the cache query in bli_cpuid.c. On
+// non-Linux systems, nothing is read and threads are never bound.
+
+// Parse a string in the kernel's "cpulist" format (e.g. "0-3,8-11") into
+// an array of cpu ids, preserving the order in which they appear. Return
+// the number of cpu ids that were stored.
+dim_t bli_cpuset_parse_list( const char* str, int* list, dim_t max );
+
+// Return the number of cpus in a file in the "cpulist" format, or 0 if the
+// file could not be read.
+dim_t bli_cpuset_count_list( const char* path );
+
+// Restore the affinity mask that the calling thread had before it was first
+// bound, unless the thread was marked by bli_cpuset_keep_binding().
+void  bli_cpuset_unbind_thread( void );
+void  bli_cpuset_restore_thread( void );
+
+// Mark the calling thread as owned by BLIS, in which case its binding is
+// kept in between operations instead of being undone by
+// bli_cpuset_unbind_thread().
+void  bli_cpuset_keep_binding( void );
+
+// The functions below take a cpu_set_t and are only declared for files that
+// define _GNU_SOURCE and #include <sched.h> ahead of blis.h.
+#ifdef CPU_SETSIZE
+
+// Read a file in the "cpulist" format into a cpu_set_t. Return FALSE if the
+// file could not be read or lists no cpus.
+bool  bli_cpuset_read_list( const char* path, cpu_set_t* set );
+
+// Bind the calling thread to the cpus in set. If confine is TRUE, the
+// thread is only restricted to those cpus of set that were in its original
+// affinity mask, and it is left alone if that leaves no cpus or all of them.
+// Return TRUE if the thread now runs only on cpus of set.
+//
+// The original mask is saved on the first binding and restored by
+// bli_cpuset_unbind_thread(). Since it is kept in thread-local storage,
+// this function does nothing (and returns FALSE) when BLIS is configured
+// with --disable-tls.
+bool  bli_cpuset_bind_thread( const cpu_set_t* set, bool confine );
+
+#endif
+
+#endif
+
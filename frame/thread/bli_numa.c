@@ -0,0 +1,210 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef __linux__
+  // Needed for the cpu_set_t interface, sched_getcpu(), and syscall().
+  #define _GNU_SOURCE
+  #include <sched.h>
+#endif
+
+#include "blis.h"
+
+#ifdef BLIS_OS_LINUX
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+// The mbind() memory policy that prefers (but does not require) allocation
+// on the given node. This value is fixed by the kernel ABI; we define it here
+// so that we do not depend on the libnuma headers.
+#define BLIS_MPOL_PREFERRED 1
+
+// The topology, as detected by bli_numa_init(). Node indices used throughout
+// BLIS are "logical": they are dense, start at zero, and only count nodes
+// that have at least one cpu on which the process is allowed to run.
+static bool          numa_enabled = FALSE;
+static dim_t         numa_num_nodes = 1;
+static cpu_set_t     numa_node_cpus[ BLIS_NUMA_MAX_NODES ];
+static unsigned long numa_node_mask[ BLIS_NUMA_MAX_NODES ];
+static dim_t         numa_cpu_node[ CPU_SETSIZE ];
+
+void bli_numa_init( void )
+{
+	numa_enabled   = FALSE;
+	numa_num_nodes = 1;
+
+	for ( dim_t i = 0; i < CPU_SETSIZE; ++i ) numa_cpu_node[ i ] = 0;
+
+	if ( bli_env_get_var( "BLIS_NUMA", 1 ) == 0 ) return;
+
+	cpu_set_t online;
+	if ( !bli_cpuset_read_list( "/sys/devices/system/node/online", &online ) )
+		return;
+
+	// Only consider the cpus on which the process may run.
+	cpu_set_t allowed;
+	if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &allowed ) != 0 )
+		return;
+
+	dim_t n_nodes = 0;
+
+	for ( int os_node = 0; os_node < CPU_SETSIZE; ++os_node )
+	{
+		if ( !CPU_ISSET( os_node, &online ) ) continue;
+
+		char path[ 64 ];
+		snprintf( path, sizeof( path ),
+		          "/sys/devices/system/node/node%d/cpulist", os_node );
+
+		cpu_set_t cpus;
+		if ( !bli_cpuset_read_list( path, &cpus ) ) continue;
+
+		CPU_AND( &cpus, &cpus, &allowed );
+		if ( CPU_COUNT( &cpus ) == 0 ) continue;
+
+		// If there are more nodes than BLIS_NUMA_MAX_NODES, fold the extra
+		// nodes onto the existing ones.
+		const dim_t node = n_nodes % BLIS_NUMA_MAX_NODES;
+
+		if ( n_nodes < BLIS_NUMA_MAX_NODES )
+		{
+			CPU_ZERO( &numa_node_cpus[ node ] );
+			numa_node_mask[ node ] = 0;
+		}
+
+		CPU_OR( &numa_node_cpus[ node ], &numa_node_cpus[ node ], &cpus );
+
+		if ( os_node < ( int )( 8 * sizeof( unsigned long ) ) )
+			numa_node_mask[ node ] |= 1UL << os_node;
+
+		for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+			if ( CPU_ISSET( cpu, &cpus ) ) numa_cpu_node[ cpu ] = node;
+
+		++n_nodes;
+	}
+
+	numa_num_nodes = bli_max( 1, bli_min( n_nodes, BLIS_NUMA_MAX_NODES ) );
+	numa_enabled   = ( 1 < numa_num_nodes );
+}
+
+void bli_numa_finalize( void )
+{
+	numa_enabled   = FALSE;
+	numa_num_nodes = 1;
+}
+
+bool bli_numa_is_enabled( void )
+{
+	return numa_enabled;
+}
+
+dim_t bli_numa_num_nodes( void )
+{
+	return numa_num_nodes;
+}
+
+dim_t bli_numa_curr_node( void )
+{
+	if ( !numa_enabled ) return 0;
+
+	const int cpu = sched_getcpu();
+
+	if ( cpu < 0 || CPU_SETSIZE <= cpu ) return 0;
+
+	return numa_cpu_node[ cpu ];
+}
+
+dim_t bli_numa_thread_node( dim_t tid, dim_t nt )
+{
+	if ( !numa_enabled || nt < 1 ) return 0;
+
+	return ( tid * numa_num_nodes ) / nt;
+}
+
+void bli_numa_bind_thread( dim_t tid, dim_t nt )
+{
+	// A thread whose binding was kept from a previous operation is released
+	// if the current operation does not call for one.
+	if ( !numa_enabled || nt < 2 )
+	{
+		bli_cpuset_restore_thread();
+		return;
+	}
+
+	// Restrict the thread to the cpus of its node, but only within the
+	// affinity mask it had before it was first bound. If the thread is
+	// already confined to the node, or if the application has pinned it
+	// somewhere else entirely, leave it alone.
+	const dim_t node = bli_numa_thread_node( tid, nt );
+
+	bli_cpuset_bind_thread( &numa_node_cpus[ node ], TRUE );
+}
+
+void bli_numa_bind_mem( void* buf, siz_t size, dim_t node )
+{
+#ifdef SYS_mbind
+	if ( !numa_enabled || buf == NULL || size == 0 ) return;
+	if ( node < 0 || numa_num_nodes <= node ) return;
+
+	unsigned long mask = numa_node_mask[ node ];
+	if ( mask == 0 ) return;
+
+	// mbind() requires a page-aligned starting address. We never round buf
+	// down to one, since the extra pages could belong to someone else.
+	if ( ( uintptr_t )buf % ( uintptr_t )BLIS_PAGE_SIZE != 0 ) return;
+
+	// Failure is not an error; the pages will simply be placed by the
+	// default (first-touch) policy.
+	syscall( SYS_mbind, buf, ( unsigned long )size,
+	         BLIS_MPOL_PREFERRED, &mask, 8 * sizeof( mask ), 0 );
+#endif
+}
+
+#else
+
+void  bli_numa_init( void ) { }
+void  bli_numa_finalize( void ) { }
+
+bool  bli_numa_is_enabled( void ) { return FALSE; }
+dim_t bli_numa_num_nodes( void ) { return 1; }
+dim_t bli_numa_curr_node( void ) { return 0; }
+dim_t bli_numa_thread_node( dim_t tid, dim_t nt ) { return 0; }
+
+void  bli_numa_bind_thread( dim_t tid, dim_t nt ) { }
+
+void  bli_numa_bind_mem( void* buf, siz_t size, dim_t node ) { }
+
+#endif
+
@@ -0,0 +1,74 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_NUMA_H
+#define BLIS_NUMA_H
+
+// NUMA topology detection and locality policy. On systems with more than one
+// NUMA node, the packing block allocator keeps a separate set of pools per
+// node, threads executing a level-3 operation are bound to the cpus of the
+// node that owns their thread id, and pool blocks are placed on the node of
+// the thread that allocates them. NUMA support may be disabled at runtime by
+// setting BLIS_NUMA=0. On non-Linux systems (or systems with a single node)
+// there is exactly one node and all of the functions below are no-ops.
+
+void  bli_numa_init( void );
+void  bli_numa_finalize( void );
+
+BLIS_EXPORT_BLIS bool  bli_numa_is_enabled( void );
+BLIS_EXPORT_BLIS dim_t bli_numa_num_nodes( void );
+
+// Return the index (in [0, bli_numa_num_nodes())) of the node on which the
+// calling thread is currently running.
+BLIS_EXPORT_BLIS dim_t bli_numa_curr_node( void );
+
+// Return the node to which thread tid of an nt-thread team is assigned.
+// Thread ids are assigned to nodes in contiguous blocks so that thread
+// groups formed by the jc loop never straddle a node boundary.
+BLIS_EXPORT_BLIS dim_t bli_numa_thread_node( dim_t tid, dim_t nt );
+
+// Bind the calling thread to the cpus of its node, or release a binding kept
+// from a previous operation if NUMA placement does not apply. The binding is
+// undone by bli_cpuset_unbind_thread().
+void  bli_numa_bind_thread( dim_t tid, dim_t nt );
+
+// Prefer the given node for the pages of [buf, buf+size). The range must be
+// a mapping that the caller owns outright (e.g. one obtained directly from
+// mmap()); binding part of a malloc()'d range would split the heap's memory
+// mapping and change the policy of unrelated allocations in the same pages.
+void  bli_numa_bind_mem( void* buf, siz_t size, dim_t node );
+
+#endif
+
@@ -33,8 +33,39 @@
 
 */
 
+#ifdef __linux__
+  // Needed for the syscall() interface.
+  #define _GNU_SOURCE
+#endif
+
 #include "blis.h"
 
+#ifdef BLIS_OS_LINUX
+  #include <limits.h>
+  #include <unistd.h>
+  #include <sys/syscall.h>
+  #include <linux/futex.h>
+#endif
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+#define __ATOMIC_RELEASE
+#define __ATOMIC_ACQ_REL
+#define __ATOMIC_SEQ_CST
+
+#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
+#define __atomic_store_n(   ptr, value, constraint ) ( void )__sync_lock_test_and_set( ptr, value )
+#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
+#define __atomic_sub_fetch( ptr, value, constraint ) __sync_sub_and_fetch( ptr, value )
+#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
+#define __atomic_fetch_sub( ptr, value, constraint ) __sync_fetch_and_sub( ptr, value )
+#define __atomic_fetch_xor( ptr, value, constraint ) __sync_fetch_and_xor( ptr, value )
+
+#endif
+
 // -- Method-agnostic functions ------------------------------------------------
 
 thrcomm_t* bli_thrcomm_create( timpl_t ti, pool_t* sba_pool, dim_t n_threads )
@@ -63,6 +94,215 @@ void bli_thrcomm_free( pool_t* sba_pool, thrcomm_t* comm )
 	bli_sba_release( sba_pool, comm );
 }
 
+void bli_thrcomm_set_spin( dim_t spin, thrcomm_t* comm )
+{
+	if ( spin < 0 ) spin = BLIS_BARRIER_SPIN_COUNT;
+
+	// The store is atomic because other threads of the comm may already be
+	// waiting at a barrier (and thus reading the same value).
+	__atomic_store_n( &comm->barrier_spin, spin, __ATOMIC_RELAXED );
+}
+
+// -- Barrier waiting ----------------------------------------------------------
+
+// Wait until *word no longer holds the value old. The word is first polled
+// up to spin times (indefinitely if spin is negative), which is all that is
+// needed when the threads arrive at the barrier at about the same time. A
+// thread still waiting after that sleeps on the word with a futex, having
+// first registered itself in *sleepers so that the releasing thread knows it
+// must issue a wake-up. Elsewhere, the thread keeps polling.
+static void bli_thrcomm_wait
+     (
+       int32_t* word,
+       int32_t  old,
+       int32_t* sleepers,
+       dim_t    spin
+     )
+{
+	for ( dim_t i = 0; spin < 0 || i < spin; ++i )
+	{
+		if ( __atomic_load_n( word, __ATOMIC_ACQUIRE ) != old ) return;
+		bli_thrcomm_relax();
+	}
+
+	#ifdef BLIS_OS_LINUX
+	__atomic_fetch_add( sleepers, 1, __ATOMIC_SEQ_CST );
+
+	// FUTEX_WAIT returns immediately if the word has already changed, and
+	// may also return spuriously, hence the loop.
+	while ( __atomic_load_n( word, __ATOMIC_ACQUIRE ) == old )
+		syscall( SYS_futex, word, FUTEX_WAIT_PRIVATE, old, NULL, NULL, 0 );
+
+	__atomic_fetch_sub( sleepers, 1, __ATOMIC_RELAXED );
+	#else
+	while ( __atomic_load_n( word, __ATOMIC_ACQUIRE ) == old )
+		bli_thrcomm_relax();
+	#endif
+}
+
+// Flip *word between 0 and 1, releasing the threads waiting on it. Both the
+// flip and the subsequent read of *sleepers are sequentially consistent so
+// that a thread cannot register as a sleeper without either being seen here
+// or seeing the new value of the word before it sleeps.
+static void bli_thrcomm_release
+     (
+       int32_t* word,
+       int32_t* sleepers
+     )
+{
+	__atomic_fetch_xor( word, 1, __ATOMIC_SEQ_CST );
+
+	#ifdef BLIS_OS_LINUX
+	if ( __atomic_load_n( sleepers, __ATOMIC_SEQ_CST ) != 0 )
+		syscall( SYS_futex, word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0 );
+	#endif
+}
+
+// Arrive at node barack of a tree barrier and wait for the tree to be
+// released. The last thread to arrive at a node carries the arrival of the
+// whole subtree up to the parent node. Once the root has been reached, the
+// signals are flipped on the way back down, releasing each subtree.
+static void bli_thrcomm_tree_barrier_wait( barrier_t* barack, dim_t spin )
+{
+	int32_t my_signal = __atomic_load_n( &barack->signal, __ATOMIC_RELAXED );
+
+	dim_t my_count =
+	__atomic_sub_fetch( &barack->count, 1, __ATOMIC_ACQ_REL );
+
+	if ( my_count == 0 )
+	{
+		if ( barack->dad != NULL )
+		{
+			bli_thrcomm_tree_barrier_wait( barack->dad, spin );
+		}
+		barack->count = barack->arity;
+		bli_thrcomm_release( &barack->signal, &barack->sleepers );
+	}
+	else
+	{
+		bli_thrcomm_wait( &barack->signal, my_signal, &barack->sleepers, spin );
+	}
+}
+
+// -- Tree barrier construction ------------------------------------------------
+
+// The kind of barrier given to the comms created from now on. This is read
+// from BLIS_BARRIER by bli_thread_init() and may be changed at any time with
+// bli_thread_set_barrier(); comms that already exist keep their barrier.
+static tbar_t thrcomm_barrier_kind = BLIS_BARRIER_CENTRAL;
+
+tbar_t bli_thrcomm_barrier_kind( void )
+{
+	return thrcomm_barrier_kind;
+}
+
+void bli_thrcomm_set_barrier_kind( tbar_t kind )
+{
+	thrcomm_barrier_kind = kind;
+}
+
+// Return the number of children of a tree barrier node on which n threads
+// arrive, or 0 if the n threads should arrive on the node directly. The
+// threads are divided between packages first, then between last-level
+// cache domains, and only then into groups no larger than the maximum
+// fan-in. Since thread ids are split into contiguous, nearly equal ranges
+// (the same way bli_affinity_thread_cpu() places them), threads that share
+// a cache also share the leaves and lower levels of the tree when the team
+// is bound with BLIS_AFFINITY_COMPACT.
+static dim_t bli_thrcomm_tree_num_kids( dim_t n )
+{
+	const dim_t max_fanin = BLIS_BARRIER_MAX_FANIN;
+	const dim_t dom_cores = bli_affinity_domain_cores();
+	const dim_t pkg_cores = dom_cores * bli_affinity_package_domains();
+
+	// A topology in which every domain holds a single core says nothing
+	// useful about which threads should be grouped together.
+	const bool  use_topo  = ( 1 < dom_cores );
+
+	dim_t n_kids;
+
+	if      ( use_topo && 0 < pkg_cores && pkg_cores < n )
+		n_kids = ( n + pkg_cores - 1 ) / pkg_cores;
+	else if ( use_topo && dom_cores < n )
+		n_kids = ( n + dom_cores - 1 ) / dom_cores;
+	else if ( max_fanin < n )
+		n_kids = ( n + max_fanin - 1 ) / max_fanin;
+	else
+		return 0;
+
+	return bli_min( n_kids, max_fanin );
+}
+
+// Build the subtree on which n threads arrive, taking its nodes from *next,
+// and record the leaf of each thread in leaves[0:n-1].
+static barrier_t* bli_thrcomm_tree_build
+     (
+       dim_t       n,
+       barrier_t** leaves,
+       barrier_t** next
+     )
+{
+	barrier_t*  me     = ( *next )++;
+	const dim_t n_kids = bli_thrcomm_tree_num_kids( n );
+
+	me->dad      = NULL;
+	me->signal   = 0;
+	me->sleepers = 0;
+
+	if ( n_kids == 0 )
+	{
+		for ( dim_t i = 0; i < n; i++ ) leaves[ i ] = me;
+
+		me->arity = n;
+	}
+	else
+	{
+		for ( dim_t k = 0; k < n_kids; k++ )
+		{
+			const dim_t first = ( k       * n + n_kids - 1 ) / n_kids;
+			const dim_t last  = ( ( k + 1 ) * n + n_kids - 1 ) / n_kids;
+
+			barrier_t* kid = bli_thrcomm_tree_build( last - first, leaves + first, next );
+			kid->dad = me;
+		}
+
+		me->arity = n_kids;
+	}
+
+	me->count = me->arity;
+
+	return me;
+}
+
+static void bli_thrcomm_tree_init( thrcomm_t* comm )
+{
+	const dim_t nt = comm->n_threads;
+
+	comm->barrier_leaves = NULL;
+
+	if ( nt < 2 || thrcomm_barrier_kind != BLIS_BARRIER_TREE ) return;
+
+	// Every interior node has at least two children, so a tree with at most
+	// nt leaves never has more than 2*nt - 1 nodes. The array of leaf
+	// pointers and the nodes are allocated together. (The size depends on
+	// nt, so unlike the comm itself, it cannot come from the sba, whose
+	// blocks all have the same size.)
+	err_t       r_val;
+	barrier_t** leaves = bli_malloc_intl( nt * sizeof( barrier_t* ) +
+	                                      ( 2 * nt - 1 ) * sizeof( barrier_t ),
+	                                      &r_val );
+
+	// If the tree could not be allocated, leave comm->barrier_leaves NULL so
+	// that bli_thrcomm_barrier() uses the threading-specific barrier instead.
+	if ( bli_is_failure( r_val ) || leaves == NULL ) return;
+
+	barrier_t*  next   = ( barrier_t* )( leaves + nt );
+
+	bli_thrcomm_tree_build( nt, leaves, &next );
+
+	comm->barrier_leaves = leaves;
+}
+
 // -- Method-specific functions ------------------------------------------------
 
 // Initialize a function pointer array for each family of threading-specific
@@ -149,6 +389,16 @@ void bli_thrcomm_init( timpl_t ti, dim_t nt, thrcomm_t* comm )
 	// Call the threading-specific init function.
 	fp( nt, comm );
 
+	// Reset the counters used by dynamically scheduled loops.
+	comm->dyn_next = 0;
+	comm->dyn_done = 0;
+
+	comm->barrier_sleepers = 0;
+	comm->barrier_spin     = BLIS_BARRIER_SPIN_COUNT;
+
+	// Build the tree barrier, if one was requested.
+	bli_thrcomm_tree_init( comm );
+
 	// NOTE: The init function that just returned intrinsically knows its
 	// timpl_t value, thus is able to set that value without us explicitly
 	// passing it in.
@@ -170,10 +420,26 @@ void bli_thrcomm_cleanup( thrcomm_t* comm )
 
 	// Call the threading-specific cleanup function.
 	fp( comm );
+
+	// Free the tree barrier, if the comm has one.
+	if ( comm->barrier_leaves != NULL )
+	{
+		bli_free_intl( comm->barrier_leaves );
+		comm->barrier_leaves = NULL;
+	}
 }
 
 void bli_thrcomm_barrier( dim_t tid, thrcomm_t* comm )
 {
+	// The tree barrier only relies on atomic operations, so it is used in
+	// place of the threading-specific barrier whenever the comm has one.
+	if ( comm->barrier_leaves != NULL )
+	{
+		bli_thrcomm_tree_barrier_wait( comm->barrier_leaves[ tid ],
+		                               __atomic_load_n( &comm->barrier_spin, __ATOMIC_RELAXED ) );
+		return;
+	}
+
 	const timpl_t            ti = bli_thrcomm_thread_impl( comm );
 	const thrcomm_barrier_ft fp = barrier_fpa[ ti ];
 
@@ -205,22 +471,13 @@ void* bli_thrcomm_bcast
 	return object;
 }
 
-#ifndef BLIS_TREE_BARRIER
-
-// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
-#ifndef __ATOMIC_RELAXED
-
-#define __ATOMIC_RELAXED
-#define __ATOMIC_ACQUIRE
-#define __ATOMIC_RELEASE
-#define __ATOMIC_ACQ_REL
-
-#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
-#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
-#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
-#define __atomic_fetch_xor( ptr, value, constraint ) __sync_fetch_and_xor( ptr, value )
+void bli_thrcomm_tree_barrier( barrier_t* barack )
+{
+	// Used by the trees built at compile time, which have no spin budget.
+	bli_thrcomm_tree_barrier_wait( barack, -1 );
+}
 
-#endif
+#ifndef BLIS_TREE_BARRIER
 
 void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 {
@@ -236,7 +493,7 @@ void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 	// fact, if everything else is working, a binary variable is sufficient,
 	// which is what we do here (i.e., 0 is incremented to 1, which is then
 	// decremented back to 0, and so forth).
-	gint_t orig_sense = __atomic_load_n( &comm->barrier_sense, __ATOMIC_RELAXED );
+	int32_t orig_sense = __atomic_load_n( &comm->barrier_sense, __ATOMIC_RELAXED );
 
 	// Register ourselves (the current thread) as having arrived by
 	// incrementing the barrier_threads_arrived variable. We must perform
@@ -251,18 +508,20 @@ void bli_thrcomm_barrier_atomic( dim_t t_id, thrcomm_t* comm )
 		// Reset the variable tracking the number of threads that have arrived
 		// to zero (which returns the barrier to the "empty" state. Then
 		// atomically toggle the barrier sense variable. This will signal to
-		// the other threads (which are spinning in the branch elow) that it
-		// is now safe to exit the barrier.
+		// the other threads (which are waiting in the branch elow) that it
+		// is now safe to exit the barrier, waking any that went to sleep.
 		comm->barrier_threads_arrived = 0;
-		__atomic_fetch_xor( &comm->barrier_sense, 1, __ATOMIC_RELEASE );
+		bli_thrcomm_release( &comm->barrier_sense, &comm->barrier_sleepers );
 	}
 	else
 	{
 		// If the current thread is NOT the last thread to have arrived, then
-		// it spins on the sense variable until that sense variable changes at
-		// which time these threads will exit the barrier.
-		while ( __atomic_load_n( &comm->barrier_sense, __ATOMIC_ACQUIRE ) == orig_sense )
-			; // Empty loop body.
+		// it waits on the sense variable until that sense variable changes at
+		// which time these threads will exit the barrier. The thread spins
+		// for a while before going to sleep.
+		bli_thrcomm_wait( &comm->barrier_sense, orig_sense,
+		                  &comm->barrier_sleepers,
+		                  __atomic_load_n( &comm->barrier_spin, __ATOMIC_RELAXED ) );
 	}
 }
 
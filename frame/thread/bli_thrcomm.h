@@ -36,12 +36,11 @@
 #ifndef BLIS_THRCOMM_H
 #define BLIS_THRCOMM_H
 
-// Define barrier_t, which is specific to the tree barrier in the OpenMP
-// implementation. This needs to be done first since it is (potentially)
-// used within the definition of thrcomm_t below.
+// Define barrier_t, a node of a combining tree barrier. Such trees are built
+// at runtime when BLIS_BARRIER_TREE is selected, and at compile time by the
+// OpenMP implementation when BLIS_TREE_BARRIER is defined. This needs to be
+// done first since it is used within the definition of thrcomm_t below.
 
-#ifdef BLIS_ENABLE_OPENMP
-#ifdef BLIS_TREE_BARRIER
 struct barrier_s
 {
 	int               arity;
@@ -57,15 +56,16 @@ struct barrier_s
 	// the fields above and fields below.
 	char   padding2[ BLIS_CACHE_LINE_SIZE ];
 
-	gint_t            signal;
+	// The signal is 32 bits wide so that waiters can sleep on it with a
+	// futex. The number of such sleeping waiters is kept alongside it.
+	int32_t           signal;
+	int32_t           sleepers;
 
 	// We insert a cache line of padding here to eliminate false sharing between
 	// this struct and the next one.
 	char   padding3[ BLIS_CACHE_LINE_SIZE ];
 };
 typedef struct barrier_s barrier_t;
-#endif
-#endif
 
 // Define hpx_barrier_t, which is specific to the barrier used in HPX
 // implementation. This needs to be done first since it is (potentially)
@@ -89,6 +89,15 @@ typedef struct thrcomm_s
 	dim_t       n_threads;
 	timpl_t     ti;
 
+	// The leaf of the tree barrier on which each thread arrives, indexed by
+	// thread id, or NULL if the comm uses the central barrier. The nodes of
+	// the tree are stored in the same allocation, right after this array.
+	barrier_t** barrier_leaves;
+
+	// The number of times a waiting thread polls the barrier before it goes
+	// to sleep.
+	dim_t       barrier_spin;
+
 	// We insert a cache line of padding here to eliminate false sharing between
 	// the fields above and fields below.
 	char   padding1[ BLIS_CACHE_LINE_SIZE ];
@@ -98,9 +107,13 @@ typedef struct thrcomm_s
 	// don't allow the use of bool for the variables being operated upon.
 	// (Specifically, this was observed of __atomic_fetch_xor(), but it likely
 	// applies to all other related built-ins.) Thus, we get around this by
-	// redefining barrier_sense as a gint_t.
+	// redefining barrier_sense as an integer. It is 32 bits wide because
+	// waiters that exhaust their spin budget sleep on it with a futex.
 	//volatile gint_t  barrier_sense;
-	gint_t barrier_sense;
+	int32_t barrier_sense;
+
+	// The number of threads sleeping on barrier_sense.
+	int32_t barrier_sleepers;
 
 	// We insert a cache line of padding here to eliminate false sharing between
 	// the fields above and fields below.
@@ -109,9 +122,19 @@ typedef struct thrcomm_s
 	dim_t  barrier_threads_arrived;
 
 	// We insert a cache line of padding here to eliminate false sharing between
-	// the fields above and whatever data structures follow.
+	// the fields above and fields below.
 	char   padding3[ BLIS_CACHE_LINE_SIZE ];
 
+	// The next unclaimed index, and the number of threads that have found
+	// nothing left to claim, when a loop is scheduled dynamically (see
+	// bli_thread_range_dyn()).
+	dim_t  dyn_next;
+	dim_t  dyn_done;
+
+	// We insert a cache line of padding here to eliminate false sharing between
+	// the fields above and whatever data structures follow.
+	char   padding4[ BLIS_CACHE_LINE_SIZE ];
+
 	// -- Fields specific to OpenMP --
 
 	#ifdef BLIS_ENABLE_OPENMP
@@ -170,6 +193,23 @@ BLIS_INLINE timpl_t bli_thrcomm_thread_impl( thrcomm_t* comm )
 	return comm->ti;
 }
 
+BLIS_INLINE dim_t bli_thrcomm_spin( thrcomm_t* comm )
+{
+	return comm->barrier_spin;
+}
+
+// Tell the processor that the calling thread is polling a memory location,
+// so that it can yield the core's resources to an SMT sibling and avoid a
+// pipeline flush when the polled value changes.
+BLIS_INLINE void bli_thrcomm_relax( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__( "yield" ::: "memory" );
+#endif
+}
+
 
 // Threading method-agnostic function prototypes.
 BLIS_EXPORT_BLIS thrcomm_t* bli_thrcomm_create( timpl_t ti, pool_t* sba_pool, dim_t n_threads );
@@ -187,6 +227,15 @@ BLIS_EXPORT_BLIS void  bli_thrcomm_barrier( dim_t thread_id, thrcomm_t* comm );
 // Other function prototypes.
 BLIS_EXPORT_BLIS void* bli_thrcomm_bcast( dim_t inside_id, void* to_send, thrcomm_t* comm );
 void                   bli_thrcomm_barrier_atomic( dim_t thread_id, thrcomm_t* comm );
+void                   bli_thrcomm_tree_barrier( barrier_t* barack );
+
+// Set the spin budget of a comm. Every thread of the comm may call this
+// before its first barrier, as long as they all pass the same value.
+void                   bli_thrcomm_set_spin( dim_t spin, thrcomm_t* comm );
+
+// Query and set the kind of barrier used by the comms created from now on.
+tbar_t                 bli_thrcomm_barrier_kind( void );
+void                   bli_thrcomm_set_barrier_kind( tbar_t kind );
 
 #endif
 
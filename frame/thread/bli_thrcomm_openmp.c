@@ -119,6 +119,7 @@ barrier_t* bli_thrcomm_tree_barrier_create( int num_threads, int arity, barrier_
 
 	me->dad = NULL;
 	me->signal = 0;
+	me->sleepers = 0;
 
 	// Base Case
 	if ( num_threads <= arity )
@@ -167,45 +168,6 @@ void bli_thrcomm_tree_barrier_free( barrier_t* barrier )
 	return;
 }
 
-// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
-#ifndef __ATOMIC_RELAXED
-
-#define __ATOMIC_RELAXED
-#define __ATOMIC_ACQUIRE
-#define __ATOMIC_RELEASE
-#define __ATOMIC_ACQ_REL
-
-//#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
-//#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
-
-#define __atomic_load_n(    ptr,        constraint ) __sync_fetch_and_add( ptr, 0     )
-#define __atomic_sub_fetch( ptr, value, constraint ) __sync_sub_and_fetch( ptr, value )
-#define __atomic_fetch_xor( ptr, value, constraint ) __sync_fetch_and_xor( ptr, value )
-
-#endif
-
-void bli_thrcomm_tree_barrier( barrier_t* barack )
-{
-	gint_t my_signal = __atomic_load_n( &barack->signal, __ATOMIC_RELAXED );
-
-	dim_t my_count =
-	__atomic_sub_fetch( &barack->count, 1, __ATOMIC_ACQ_REL );
-
-	if ( my_count == 0 )
-	{
-		if ( barack->dad != NULL )
-		{
-			bli_thrcomm_tree_barrier( barack->dad );
-		}
-		barack->count = barack->arity;
-		__atomic_fetch_xor( &barack->signal, 1, __ATOMIC_RELEASE );
-	}
-	else
-	{
-		while ( __atomic_load_n( &barack->signal, __ATOMIC_ACQUIRE ) == my_signal ) {}
-	}
-}
-
 #endif
 
 #endif
@@ -49,7 +49,6 @@ void bli_thrcomm_barrier_openmp( dim_t tid, thrcomm_t* comm );
 #ifdef BLIS_TREE_BARRIER
 barrier_t* bli_thrcomm_tree_barrier_create( int num_threads, int arity, barrier_t** leaves, int leaf_index );
 void       bli_thrcomm_tree_barrier_free( barrier_t* barrier );
-void       bli_thrcomm_tree_barrier( barrier_t* barack );
 #endif
 
 #endif
@@ -80,6 +80,23 @@ int bli_thread_init( void )
 
 	bli_thrcomm_init( BLIS_SINGLE, 1, &BLIS_SINGLE_COMM );
 
+	// Detect the NUMA topology. This must happen before the packing block
+	// allocator is initialized, since it creates one set of pools per node.
+	bli_numa_init();
+
+	// Detect the cpu topology used to bind threads when an affinity policy
+	// is requested.
+	bli_affinity_init();
+
+	// Select the barrier used by thread communicators. The tree barrier is
+	// shaped by the topology detected above.
+	char* bar_env = bli_env_get_str( "BLIS_BARRIER" );
+
+	if ( bar_env != NULL && !strncmp( bar_env, "tree", 4 ) )
+		bli_thrcomm_set_barrier_kind( BLIS_BARRIER_TREE );
+	else
+		bli_thrcomm_set_barrier_kind( BLIS_BARRIER_CENTRAL );
+
 	return 0;
 }
 
@@ -87,6 +104,14 @@ int bli_thread_finalize( void )
 {
 	bli_thrcomm_cleanup( &BLIS_SINGLE_COMM );
 
+	#ifdef BLIS_ENABLE_PTHREAD_POOL
+	// Shut down the persistent pool of POSIX worker threads, if it exists.
+	bli_thread_pool_finalize_pthreads();
+	#endif
+
+	bli_numa_finalize();
+	bli_affinity_finalize();
+
 	return 0;
 }
 
@@ -714,6 +739,37 @@ const char* bli_thread_get_thread_impl_str( timpl_t ti )
 	return bli_timpl_string[ti];
 }
 
+taff_t bli_thread_get_affinity( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_affinity( bli_global_rntm() );
+}
+
+bool bli_thread_get_jrir_dyn( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_jrir_dyn( bli_global_rntm() );
+}
+
+dim_t bli_thread_get_barrier_spin( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_barrier_spin( bli_global_rntm() );
+}
+
+tbar_t bli_thread_get_barrier( void )
+{
+	bli_init_once();
+
+	return bli_thrcomm_barrier_kind();
+}
+
 // ----------------------------------------------------------------------------
 
 void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
@@ -729,7 +785,7 @@ void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
 	bli_pthread_mutex_lock( bli_global_rntm_mutex() );
 	#endif
 
-	bli_rntm_set_ways_only( jc, 1, ic, jr, ir, bli_global_rntm() );
+	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, bli_global_rntm() );
 
 	// Ensure that the rntm_t is in a consistent state.
 	bli_rntm_sanitize( bli_global_rntm() );
@@ -794,6 +850,71 @@ void bli_thread_set_thread_impl( timpl_t ti )
 	#endif
 }
 
+void bli_thread_set_affinity( taff_t aff )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// If TLS is disabled, we need to use a mutex to protect the global rntm_t
+	// since it will be shared with all application threads.
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_lock( bli_global_rntm_mutex() );
+	#endif
+
+	bli_rntm_set_affinity( aff, bli_global_rntm() );
+
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_unlock( bli_global_rntm_mutex() );
+	#endif
+}
+
+void bli_thread_set_jrir_dyn( bool jrir_dyn )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// If TLS is disabled, we need to use a mutex to protect the global rntm_t
+	// since it will be shared with all application threads.
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_lock( bli_global_rntm_mutex() );
+	#endif
+
+	bli_rntm_set_jrir_dyn( jrir_dyn, bli_global_rntm() );
+
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_unlock( bli_global_rntm_mutex() );
+	#endif
+}
+
+void bli_thread_set_barrier_spin( dim_t spin )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// If TLS is disabled, we need to use a mutex to protect the global rntm_t
+	// since it will be shared with all application threads.
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_lock( bli_global_rntm_mutex() );
+	#endif
+
+	bli_rntm_set_barrier_spin( spin, bli_global_rntm() );
+
+	#ifdef BLIS_DISABLE_TLS
+	bli_pthread_mutex_unlock( bli_global_rntm_mutex() );
+	#endif
+}
+
+void bli_thread_set_barrier( tbar_t kind )
+{
+	bli_init_once();
+
+	// Unlike the settings above, the barrier is not part of the rntm_t: it is
+	// chosen whenever a thread communicator is created, which happens in
+	// places where no rntm_t is available. Communicators that already exist
+	// keep the barrier they were created with.
+	bli_thrcomm_set_barrier_kind( kind );
+}
+
 void bli_thread_reset( void )
 {
 	// We must ensure that global_rntm_at_init has been initialized.
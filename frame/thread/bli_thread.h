@@ -52,6 +52,15 @@ typedef void (*thread_func_t)( thrcomm_t* gl_comm, dim_t tid, const void* params
 #include "bli_thread_hpx.h"
 #include "bli_thread_single.h"
 
+// Include cpu list parsing and thread binding prototypes.
+#include "bli_cpuset.h"
+
+// Include NUMA topology and locality prototypes.
+#include "bli_numa.h"
+
+// Include thread-to-cpu binding prototypes.
+#include "bli_affinity.h"
+
 // Initialization-related prototypes.
 int bli_thread_init( void );
 int bli_thread_finalize( void );
@@ -122,10 +131,18 @@ BLIS_EXPORT_BLIS dim_t   bli_thread_get_ir_nt( void );
 BLIS_EXPORT_BLIS dim_t   bli_thread_get_num_threads( void );
 BLIS_EXPORT_BLIS timpl_t bli_thread_get_thread_impl( void );
 BLIS_EXPORT_BLIS const char* bli_thread_get_thread_impl_str( timpl_t ti );
+BLIS_EXPORT_BLIS taff_t  bli_thread_get_affinity( void );
+BLIS_EXPORT_BLIS bool    bli_thread_get_jrir_dyn( void );
+BLIS_EXPORT_BLIS tbar_t  bli_thread_get_barrier( void );
+BLIS_EXPORT_BLIS dim_t   bli_thread_get_barrier_spin( void );
 
 BLIS_EXPORT_BLIS void    bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir );
 BLIS_EXPORT_BLIS void    bli_thread_set_num_threads( dim_t value );
 BLIS_EXPORT_BLIS void    bli_thread_set_thread_impl( timpl_t ti );
+BLIS_EXPORT_BLIS void    bli_thread_set_affinity( taff_t aff );
+BLIS_EXPORT_BLIS void    bli_thread_set_jrir_dyn( bool jrir_dyn );
+BLIS_EXPORT_BLIS void    bli_thread_set_barrier( tbar_t kind );
+BLIS_EXPORT_BLIS void    bli_thread_set_barrier_spin( dim_t spin );
 BLIS_EXPORT_BLIS void    bli_thread_reset( void );
 
 
@@ -62,7 +62,7 @@ static void* bli_posix_thread_entry( void* data_void )
 	return NULL;
 }
 
-void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void* params )
+static void bli_thread_launch_pthreads_spawn( dim_t n_threads, thread_func_t func, const void* params )
 {
 	err_t r_val;
 
@@ -124,5 +124,346 @@ void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void
 	bli_free_intl( datas );
 }
 
+#ifdef BLIS_ENABLE_PTHREAD_POOL
+
+// -- Persistent thread pool ---------------------------------------------------
+
+// The thread pool consists of a set of worker threads that are created lazily
+// the first time they are needed and then parked (first spinning, then
+// sleeping on a condition variable) in between calls to
+// bli_thread_launch_pthreads(). A worker with index i always executes as
+// thread id i+1 of the team, with the calling (chief) thread acting as thread
+// id 0. Each worker waits on its own slot, so that a job for a team of n
+// threads only wakes (and waits for) the first n-1 workers. Only one
+// application thread may dispatch into the pool at a time; any other thread
+// that calls bli_thread_launch_pthreads() while the pool is busy falls back
+// to spawning (and joining) its own threads.
+
+// The per-worker part of the pool. Slots are allocated individually so that
+// they do not move when the pool grows, and each occupies its own cache line.
+typedef struct thread_pool_slot_s
+{
+	// The job counter of the worker. This is incremented (while holding the
+	// pool's mutex) each time a job is posted for the worker, or when the
+	// pool is being shut down.
+	gint_t              epoch;
+
+	// The condition variable on which the worker sleeps, used together with
+	// the pool's mutex.
+	bli_pthread_cond_t  wake_cond;
+
+	bli_pthread_t       thread;
+
+	// We insert a cache line of padding here to eliminate false sharing
+	// between adjacent slots.
+	char   padding[ BLIS_CACHE_LINE_SIZE ];
+
+} thread_pool_slot_t;
+
+typedef struct thread_pool_s
+{
+	// This mutex is held by the application thread that currently owns the
+	// pool for the duration of its call to bli_thread_launch_pthreads().
+	bli_pthread_mutex_t owner_mutex;
+
+	// This mutex and the condition variables below (and in the slots) are
+	// used to park sleeping workers and to notify the chief thread of job
+	// completion.
+	bli_pthread_mutex_t mutex;
+	bli_pthread_cond_t  done_cond;
+
+	// The worker threads that have been created so far.
+	dim_t                n_workers;
+	thread_pool_slot_t** slots;
+
+	// The job currently being executed by the pool.
+	dim_t               n_threads;
+	thrcomm_t*          gl_comm;
+	thread_func_t       func;
+	const void*         params;
+	gint_t              shutdown;
+
+	// We insert a cache line of padding here to eliminate false sharing between
+	// the fields above and fields below.
+	char   padding1[ BLIS_CACHE_LINE_SIZE ];
+
+	// The number of workers that have yet to finish the current job.
+	dim_t               n_pending;
+
+} thread_pool_t;
+
+static thread_pool_t thread_pool =
+{
+	.owner_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER,
+	.mutex       = BLIS_PTHREAD_MUTEX_INITIALIZER,
+	.done_cond   = BLIS_PTHREAD_COND_INITIALIZER,
+	.n_workers   = 0,
+	.slots       = NULL,
+};
+
+// A data structure to pass a worker's index and slot to the worker's entry
+// point.
+typedef struct thread_pool_worker_data
+{
+	dim_t               index;
+	thread_pool_slot_t* slot;
+} thread_pool_worker_data_t;
+
+// Entry point for the pool's worker threads.
+static void* bli_thread_pool_worker_entry( void* data_void )
+{
+	thread_pool_worker_data_t* data  = data_void;
+	const dim_t                index = data->index;
+	thread_pool_slot_t*        slot  = data->slot;
+	      gint_t               epoch = 0;
+
+	bli_free_intl( data );
+
+	// Workers persist across operations, so there is no need to undo their
+	// cpu or NUMA node binding (if any) at the end of each one.
+	bli_cpuset_keep_binding();
+
+	thread_pool_t* pool = &thread_pool;
+
+	while ( TRUE )
+	{
+		// Spin for a while in anticipation of a new job, which is the
+		// common case when the application issues level-3 operations in
+		// quick succession.
+		for ( dim_t i = 0; i < BLIS_THREAD_POOL_SPIN_COUNT; ++i )
+		{
+			if ( __atomic_load_n( &slot->epoch, __ATOMIC_ACQUIRE ) != epoch )
+				break;
+			bli_thrcomm_relax();
+		}
+
+		// If no job was posted while we were spinning, go to sleep. Since the
+		// job counter is only ever modified while the mutex is held, wakeups
+		// cannot be lost.
+		if ( __atomic_load_n( &slot->epoch, __ATOMIC_ACQUIRE ) == epoch )
+		{
+			bli_pthread_mutex_lock( &pool->mutex );
+			while ( __atomic_load_n( &slot->epoch, __ATOMIC_ACQUIRE ) == epoch )
+				bli_pthread_cond_wait( &slot->wake_cond, &pool->mutex );
+			bli_pthread_mutex_unlock( &pool->mutex );
+		}
+
+		epoch = __atomic_load_n( &slot->epoch, __ATOMIC_ACQUIRE );
+
+		if ( __atomic_load_n( &pool->shutdown, __ATOMIC_ACQUIRE ) ) break;
+
+		// Jobs are only posted to the workers that are part of the team.
+		pool->func( pool->gl_comm, index + 1, pool->params );
+
+		// Report completion. The last worker to do so wakes the chief
+		// thread in case it went to sleep while waiting.
+		if ( __atomic_sub_fetch( &pool->n_pending, 1, __ATOMIC_ACQ_REL ) == 0 )
+		{
+			bli_pthread_mutex_lock( &pool->mutex );
+			bli_pthread_cond_broadcast( &pool->done_cond );
+			bli_pthread_mutex_unlock( &pool->mutex );
+		}
+	}
+
+	return NULL;
+}
+
+// Grow the pool so that it contains at least n_workers worker threads. This
+// function must only be called by the owner of the pool while no job is in
+// flight. Returns the number of workers in the pool upon return.
+static dim_t bli_thread_pool_grow( thread_pool_t* pool, dim_t n_workers )
+{
+	err_t r_val;
+
+	if ( n_workers <= pool->n_workers ) return pool->n_workers;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_pool_grow(): " );
+	#endif
+	thread_pool_slot_t** slots
+	    = bli_malloc_intl( sizeof( thread_pool_slot_t* ) * n_workers, &r_val );
+
+	for ( dim_t i = 0; i < pool->n_workers; ++i )
+		slots[i] = pool->slots[i];
+
+	dim_t i;
+	for ( i = pool->n_workers; i < n_workers; ++i )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thread_pool_grow(): " );
+		#endif
+		thread_pool_slot_t* slot
+		    = bli_malloc_intl( sizeof( thread_pool_slot_t ), &r_val );
+
+		slot->epoch = 0;
+		bli_pthread_cond_init( &slot->wake_cond, NULL );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thread_pool_grow(): " );
+		#endif
+		thread_pool_worker_data_t* data
+		    = bli_malloc_intl( sizeof( thread_pool_worker_data_t ), &r_val );
+
+		data->index = i;
+		data->slot  = slot;
+
+		if ( bli_pthread_create( &slot->thread, NULL,
+		                         &bli_thread_pool_worker_entry, data ) != 0 )
+		{
+			// If a thread could not be created, keep whatever workers were
+			// successfully created so far.
+			bli_free_intl( data );
+			bli_pthread_cond_destroy( &slot->wake_cond );
+			bli_free_intl( slot );
+			break;
+		}
+
+		slots[i] = slot;
+	}
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_pool_grow(): " );
+	#endif
+	bli_free_intl( pool->slots );
+
+	pool->slots     = slots;
+	pool->n_workers = i;
+
+	return pool->n_workers;
+}
+
+// Post the next job (or the shutdown request) to the first n_workers workers
+// and wake them up. The caller must hold the pool's mutex.
+static void bli_thread_pool_post( thread_pool_t* pool, dim_t n_workers )
+{
+	for ( dim_t i = 0; i < n_workers; ++i )
+	{
+		thread_pool_slot_t* slot = pool->slots[i];
+
+		__atomic_add_fetch( &slot->epoch, 1, __ATOMIC_RELEASE );
+		bli_pthread_cond_broadcast( &slot->wake_cond );
+	}
+}
+
+// Execute func with n_threads threads using the pool. Returns FALSE (without
+// executing anything) if the pool could not be used.
+static bool bli_thread_pool_launch( dim_t n_threads, thread_func_t func, const void* params )
+{
+	thread_pool_t* pool = &thread_pool;
+
+	// If some other application thread currently owns the pool, give up and
+	// let the caller spawn its own threads.
+	if ( bli_pthread_mutex_trylock( &pool->owner_mutex ) != 0 ) return FALSE;
+
+	// Lazily create the worker threads. We size the pool to accommodate the
+	// larger of the current request and the global number of threads (e.g.
+	// BLIS_NUM_THREADS) so that a subsequent request with the default number
+	// of threads does not need to grow the pool again.
+	dim_t n_workers = bli_max( n_threads, bli_thread_get_num_threads() ) - 1;
+
+	if ( bli_thread_pool_grow( pool, n_workers ) < n_threads - 1 )
+	{
+		bli_pthread_mutex_unlock( &pool->owner_mutex );
+		return FALSE;
+	}
+
+	// Allocate a global communicator for the root thrinfo_t structures.
+	const timpl_t ti           = BLIS_POSIX;
+	pool_t*       gl_comm_pool = NULL;
+	thrcomm_t*    gl_comm      = bli_thrcomm_create( ti, gl_comm_pool, n_threads );
+
+	// Post the job to the workers of the team and wake them up. The other
+	// workers are left undisturbed.
+	bli_pthread_mutex_lock( &pool->mutex );
+	pool->n_threads = n_threads;
+	pool->gl_comm   = gl_comm;
+	pool->func      = func;
+	pool->params    = params;
+	__atomic_store_n( &pool->n_pending, n_threads - 1, __ATOMIC_RELAXED );
+	bli_thread_pool_post( pool, n_threads - 1 );
+	bli_pthread_mutex_unlock( &pool->mutex );
+
+	// The chief thread executes its share of the work as thread id 0.
+	func( gl_comm, 0, params );
+
+	// Wait for the workers to finish, first spinning, then sleeping.
+	for ( dim_t i = 0; i < BLIS_THREAD_POOL_SPIN_COUNT; ++i )
+	{
+		if ( __atomic_load_n( &pool->n_pending, __ATOMIC_ACQUIRE ) == 0 )
+			break;
+		bli_thrcomm_relax();
+	}
+
+	if ( __atomic_load_n( &pool->n_pending, __ATOMIC_ACQUIRE ) != 0 )
+	{
+		bli_pthread_mutex_lock( &pool->mutex );
+		while ( __atomic_load_n( &pool->n_pending, __ATOMIC_ACQUIRE ) != 0 )
+			bli_pthread_cond_wait( &pool->done_cond, &pool->mutex );
+		bli_pthread_mutex_unlock( &pool->mutex );
+	}
+
+	// Free the global communicator, because the root thrinfo_t node
+	// never frees its communicator.
+	bli_thrcomm_free( gl_comm_pool, gl_comm );
+
+	bli_pthread_mutex_unlock( &pool->owner_mutex );
+
+	return TRUE;
+}
+
+void bli_thread_pool_finalize_pthreads( void )
+{
+	thread_pool_t* pool = &thread_pool;
+
+	bli_pthread_mutex_lock( &pool->owner_mutex );
+
+	if ( pool->n_workers > 0 )
+	{
+		// Ask the workers to exit and wait for them to do so.
+		bli_pthread_mutex_lock( &pool->mutex );
+		__atomic_store_n( &pool->shutdown, 1, __ATOMIC_RELAXED );
+		bli_thread_pool_post( pool, pool->n_workers );
+		bli_pthread_mutex_unlock( &pool->mutex );
+
+		for ( dim_t i = 0; i < pool->n_workers; ++i )
+		{
+			thread_pool_slot_t* slot = pool->slots[i];
+
+			bli_pthread_join( slot->thread, NULL );
+			bli_pthread_cond_destroy( &slot->wake_cond );
+
+			#ifdef BLIS_ENABLE_MEM_TRACING
+			printf( "bli_thread_pool_finalize_pthreads(): " );
+			#endif
+			bli_free_intl( slot );
+		}
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_thread_pool_finalize_pthreads(): " );
+		#endif
+		bli_free_intl( pool->slots );
+	}
+
+	// Return the pool to its initial state so that it may be used again
+	// after BLIS is re-initialized.
+	pool->slots     = NULL;
+	pool->n_workers = 0;
+	pool->shutdown  = 0;
+
+	bli_pthread_mutex_unlock( &pool->owner_mutex );
+}
+
+#endif
+
+void bli_thread_launch_pthreads( dim_t n_threads, thread_func_t func, const void* params )
+{
+	#ifdef BLIS_ENABLE_PTHREAD_POOL
+	// Dispatch into the persistent thread pool, if possible.
+	if ( bli_thread_pool_launch( n_threads, func, params ) ) return;
+	#endif
+
+	bli_thread_launch_pthreads_spawn( n_threads, func, params );
+}
+
 #endif
 
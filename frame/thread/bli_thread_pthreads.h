@@ -45,6 +45,10 @@ void bli_thread_launch_pthreads
        const void*         params
      );
 
+#ifdef BLIS_ENABLE_PTHREAD_POOL
+void bli_thread_pool_finalize_pthreads( void );
+#endif
+
 #endif
 
 #endif
@@ -0,0 +1,153 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQ_REL
+
+#define __atomic_add_fetch( ptr, value, constraint ) __sync_add_and_fetch( ptr, value )
+#define __atomic_fetch_add( ptr, value, constraint ) __sync_fetch_and_add( ptr, value )
+#define __atomic_store_n(   ptr, value, constraint ) __sync_lock_test_and_set( ptr, value )
+
+#endif
+
+//
+// Claim the next range [start,end) of the index space [0,n) on behalf of the
+// calling thread, using the counter in the communicator of 'thread' that is
+// shared by every thread in the team. The function returns FALSE (and sets
+// start and end past n) once the index space is exhausted. Each thread in
+// the team must keep calling it until that happens, and must then call
+// bli_thread_range_dyn_finish().
+//
+// The last thread to observe the exhausted index space resets the counters
+// before it reaches the barrier in bli_thread_range_dyn_finish(), so the
+// counters are ready for the next dynamically scheduled loop once the team
+// leaves that barrier. This holds regardless of what separates consecutive
+// loops (e.g. packing may be skipped for a prepacked operand) and of which
+// team used the communicator last.
+//
+bool bli_thread_range_dyn
+     (
+       const thrinfo_t* thread,
+       const dim_t      n,
+             dim_t*     start,
+             dim_t*     end
+     )
+{
+	thrcomm_t*  comm = bli_thrinfo_comm( thread );
+	const dim_t nt   = bli_thrinfo_num_threads( thread );
+
+	// Hand out chunks that are small enough that each thread claims several
+	// of them (which lets fast threads pick up the slack of slow ones) but
+	// large enough that claiming does not dominate the work of a chunk.
+	const dim_t chunk = bli_max( 1, n / ( BLIS_THREAD_DYN_GRAIN * nt ) );
+
+	const dim_t i = __atomic_fetch_add( &comm->dyn_next, chunk, __ATOMIC_RELAXED );
+
+	if ( i < n )
+	{
+		*start = i;
+		*end   = bli_min( i + chunk, n );
+
+		return TRUE;
+	}
+
+	// There was nothing left to claim. If we are the last thread to discover
+	// this, reset the counters.
+	const dim_t n_done = __atomic_add_fetch( &comm->dyn_done, 1, __ATOMIC_ACQ_REL );
+
+	if ( n_done == nt )
+	{
+		__atomic_store_n( &comm->dyn_next, 0, __ATOMIC_RELAXED );
+		__atomic_store_n( &comm->dyn_done, 0, __ATOMIC_RELAXED );
+	}
+
+	*start = *end = n + 1;
+
+	return FALSE;
+}
+
+//
+// Some loops must be traversed in order by every thread of the team, either
+// because the address of iteration i is only known after visiting iterations
+// 0 through i-1 or because it is simpler to keep the static loop structure.
+// For those loops, bli_is_my_iter_dyn() returns whether iteration i belongs
+// to the calling thread, claiming a new range whenever i moves past the end
+// of the range in [start,end). The caller must initialize start and end to
+// zero and call bli_thread_range_dyn_finish() once it has left the loop.
+//
+bool bli_is_my_iter_dyn
+     (
+       const thrinfo_t* thread,
+       const dim_t      n,
+       const dim_t      i,
+             dim_t*     start,
+             dim_t*     end
+     )
+{
+	// Since the shared counter never decreases, a newly claimed range never
+	// begins before i. Once the index space is exhausted, the range is moved
+	// past n so that nothing more is claimed.
+	if ( *end <= i )
+		bli_thread_range_dyn( thread, n, start, end );
+
+	return *start <= i && i < *end;
+}
+
+//
+// End a dynamically scheduled loop. If the calling thread has not yet seen
+// the exhausted index space (e.g. because bli_is_my_iter_dyn() claimed a
+// range that extended to n, or the loop had no iterations), it does so now,
+// since every thread must in order for the counters to be reset. The team
+// then waits at a barrier, after which the counters are back at zero.
+//
+void bli_thread_range_dyn_finish
+     (
+       const thrinfo_t* thread,
+       const dim_t      n,
+             dim_t*     start,
+             dim_t*     end
+     )
+{
+	// All indices have been claimed by now, so this call always fails.
+	if ( *end <= n )
+		bli_thread_range_dyn( thread, n, start, end );
+
+	bli_thrinfo_barrier( thread );
+}
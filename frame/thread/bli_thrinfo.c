@@ -95,6 +95,7 @@ thrinfo_t* bli_thrinfo_create
 	bli_thrinfo_set_n_way( n_way, thread );
 	bli_thrinfo_set_work_id( work_id, thread );
 	bli_thrinfo_set_free_comm( free_comm, thread );
+	bli_thrinfo_set_jrir_dyn( FALSE, thread );
 	bli_thrinfo_set_sba_pool( sba_pool, thread );
 	bli_thrinfo_set_pba( pba, thread );
 	bli_mem_clear( bli_thrinfo_mem( thread ) );
@@ -153,6 +154,61 @@ void bli_thrinfo_free
 	bli_sba_release( sba_pool, thread );
 }
 
+void bli_thrinfo_reset
+     (
+       thrinfo_t* thread
+     )
+{
+	if ( thread == NULL ) return;
+
+	mem_t* cntl_mem_p = bli_thrinfo_mem( thread );
+
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+		bli_thrinfo_reset( bli_thrinfo_sub_node( i, thread ) );
+
+	// Reset the counters of dynamically scheduled loops in the communicators
+	// owned by this node. (Communicators shared with the parent node are
+	// reset along with the parent, or belong to the caller if this is the
+	// root.)
+	if ( bli_thrinfo_needs_free_comm( thread ) &&
+	     bli_thrinfo_am_chief( thread ) )
+	{
+		thrcomm_t* comm = bli_thrinfo_comm( thread );
+
+		comm->dyn_next = 0;
+		comm->dyn_done = 0;
+	}
+
+	// Return any packing buffer to the pba, as in bli_thrinfo_free(). Every
+	// thread's node holds a copy of the chief's mem_t, so all of them are
+	// cleared.
+	if ( bli_mem_is_alloc( cntl_mem_p ) && bli_thrinfo_am_chief( thread ) )
+		bli_pba_release( bli_thrinfo_pba( thread ), cntl_mem_p );
+
+	bli_mem_clear( cntl_mem_p );
+}
+
+void bli_thrinfo_set_root_comm
+     (
+       thrcomm_t* comm,
+       thrinfo_t* thread
+     )
+{
+	thrcomm_t* old_comm = bli_thrinfo_comm( thread );
+
+	bli_thrinfo_set_comm( comm, thread );
+
+	// Sub-nodes created by a one-way split share the communicator of their
+	// parent, and so must follow it.
+	for ( dim_t i = 0; i < BLIS_MAX_SUB_NODES; i++ )
+	{
+		thrinfo_t* thread_sub = bli_thrinfo_sub_node( i, thread );
+
+		if ( thread_sub != NULL && bli_thrinfo_comm( thread_sub ) == old_comm )
+			bli_thrinfo_set_root_comm( comm, thread_sub );
+	}
+}
+
 // -----------------------------------------------------------------------------
 
 thrinfo_t* bli_thrinfo_split
@@ -219,8 +275,13 @@ thrinfo_t* bli_thrinfo_split
 		// Chiefs in the child communicator allocate the communicator
 		// object and store it in the array element corresponding to the
 		// parent's work id.
+		// The new communicator inherits the barrier spin budget of the
+		// parent's.
 		if ( child_thread_id == 0 )
+		{
 			new_comms[ child_work_id ] = bli_thrcomm_create( ti, sba_pool, child_num_threads );
+			bli_thrcomm_set_spin( bli_thrcomm_spin( parent_comm ), new_comms[ child_work_id ] );
+		}
 
 		bli_thrinfo_barrier( thread_par );
 
@@ -241,6 +302,9 @@ thrinfo_t* bli_thrinfo_split
 	  pba
 	);
 
+	// Inherit the scheduling of the jr/ir loops from the parent.
+	bli_thrinfo_set_jrir_dyn( bli_thrinfo_jrir_dyn( thread_par ), thread_chl );
+
 	bli_thrinfo_barrier( thread_par );
 
 	// The parent's chief thread frees the temporary array of thrcomm_t
@@ -60,6 +60,10 @@ struct thrinfo_s
 	// to false.
 	bool               free_comm;
 
+	// When true, the threads in the communicator claim the microtiles of
+	// the jr/ir loops dynamically rather than being assigned static ranges.
+	bool               jrir_dyn;
+
 	// The small block pool.
 	pool_t*            sba_pool;
 
@@ -110,6 +114,11 @@ BLIS_INLINE bool bli_thrinfo_needs_free_comm( const thrinfo_t* t )
 	return t->free_comm;
 }
 
+BLIS_INLINE bool bli_thrinfo_jrir_dyn( const thrinfo_t* t )
+{
+	return t->jrir_dyn;
+}
+
 BLIS_INLINE pool_t* bli_thrinfo_sba_pool( const thrinfo_t* t )
 {
 	return t->sba_pool;
@@ -164,6 +173,11 @@ BLIS_INLINE void bli_thrinfo_set_free_comm( bool free_comm, thrinfo_t* t )
 	t->free_comm = free_comm;
 }
 
+BLIS_INLINE void bli_thrinfo_set_jrir_dyn( bool jrir_dyn, thrinfo_t* t )
+{
+	t->jrir_dyn = jrir_dyn;
+}
+
 BLIS_INLINE void bli_thrinfo_set_sba_pool( pool_t* sba_pool, thrinfo_t* t )
 {
 	t->sba_pool = sba_pool;
@@ -222,6 +236,22 @@ BLIS_EXPORT_BLIS void bli_thrinfo_free
        thrinfo_t* thread
      );
 
+// Release the packing buffers held by a tree and reset the state of the
+// communicators it owns, so that the tree can be used again. This must only
+// be called once every thread is done with the tree.
+void bli_thrinfo_reset
+     (
+       thrinfo_t* thread
+     );
+
+// Make comm the communicator of a root node, along with any sub-nodes that
+// shared the root's previous communicator.
+void bli_thrinfo_set_root_comm
+     (
+       thrcomm_t* comm,
+       thrinfo_t* thread
+     );
+
 // -----------------------------------------------------------------------------
 
 thrinfo_t* bli_thrinfo_split
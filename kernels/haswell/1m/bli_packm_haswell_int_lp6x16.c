@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2019 - 2020, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Packing kernels for the reduced-precision gemm operations (bli_sbgemm(),
+   bli_shgemm()) on AVX2 hardware, where no native reduced-precision
+   microkernel is available.
+
+   bfloat16 and float16 elements are converted to single precision as they
+   are packed (the latter with the F16C vcvtph2ps instruction), producing
+   the same micropanels as bli_spackm_haswell_asm_6x16(), which are then
+   consumed by the sgemm microkernel. The kernels place no restriction on
+   the panel dimension, so they serve both the 6xk micropanels of A and the
+   kx16 micropanels of B.
+
+   Column-stored sources (inca == 1) are converted 8 rows at a time. Other
+   sources, and broadcast packing, fall back to scalar code.
+*/
+
+// Widen 8 bfloat16 or float16 values to single precision.
+#define CVT8_SB( x ) _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( x ), 16 ) )
+#define CVT8_SH( x ) _mm256_cvtph_ps( x )
+
+// Masks for storing the first i (0 <= i <= 8) elements of a vector.
+static const int32_t mask_n[ 16 ] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                       0,  0,  0,  0,  0,  0,  0,  0 };
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, cvt8, tofloat ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   cdim_bcast, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a0, inc_t inca, inc_t lda, \
+             void*   p0,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     ) \
+{ \
+	const ctype* restrict a       = a0; \
+	      float* restrict p       = p0; \
+	const float           kappa_r = *( const float* )kappa; \
+\
+	if ( cdim_bcast == 1 && inca == 1 ) \
+	{ \
+		const __m256  kv    = _mm256_set1_ps( kappa_r ); \
+		const dim_t   cdim8 = cdim - cdim % 8; \
+		const dim_t   cleft = cdim % 8; \
+		const __m256i ml    = _mm256_loadu_si256( ( __m256i* )( mask_n + 8 - cleft ) ); \
+\
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			const ctype* restrict ak = a + k*lda; \
+			      float* restrict pk = p + k*ldp; \
+\
+			for ( dim_t i = 0; i < cdim8; i += 8 ) \
+			{ \
+				const __m256 v = cvt8( _mm_loadu_si128( ( __m128i* )( ak + i ) ) ); \
+				_mm256_storeu_ps( pk + i, _mm256_mul_ps( kv, v ) ); \
+			} \
+\
+			if ( cleft ) \
+			{ \
+				/* Stage the remaining elements so that the load does not
+				   read beyond the end of the column. */ \
+				uint16_t buf[ 8 ] = { 0 }; \
+				memcpy( buf, ak + cdim8, cleft * sizeof( ctype ) ); \
+\
+				const __m256 v = cvt8( _mm_loadu_si128( ( __m128i* )buf ) ); \
+				_mm256_maskstore_ps( pk + cdim8, ml, _mm256_mul_ps( kv, v ) ); \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		for ( dim_t i = 0; i < cdim; ++i ) \
+		{ \
+			const float alpha = kappa_r * tofloat( a[ i*inca + k*lda ] ); \
+\
+			for ( dim_t d = 0; d < cdim_bcast; ++d ) \
+				p[ i*cdim_bcast + d + k*ldp ] = alpha; \
+		} \
+	} \
+\
+	bli_sset0s_edge \
+	( \
+	  cdim*cdim_bcast, cdim_max*cdim_bcast, \
+	  n, n_max, \
+	  p, ldp \
+	); \
+}
+
+GENTFUNC( bfloat16, sb, packm_haswell_int_6x16, CVT8_SB, bli_bf16_to_float )
+GENTFUNC( float16,  sh, packm_haswell_int_6x16, CVT8_SH, bli_f16_to_float )
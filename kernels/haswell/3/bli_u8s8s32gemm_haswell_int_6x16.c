@@ -0,0 +1,247 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2019 - 2020, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Microkernels for the 8-bit integer gemm operation (bli_u8s8s32gemm()) on
+   AVX2 hardware, with the same 6x16 register blocking as the haswell sgemm
+   microkernel.
+
+   Each 32-bit word of the packed micropanels holds a group of four
+   consecutive k indices (see bli_gemm_lp.h), so that one k iteration
+   multiplies a broadcast word of A (uint8) by two ymm registers of B (int8)
+   for each of the 6 rows, accumulating into 12 ymm registers of int32.
+
+   The _avxvnni kernel does so with a single VEX-encoded vpdpbusd
+   instruction (AVX-VNNI), emitted via inline assembly so that no additional
+   compiler flags are needed. The instruction is encoded by hand (see
+   VPDPBUSD_VEX below), as binutils only assembles "{vex} vpdpbusd" as of
+   version 2.36. The other kernel requires only AVX2 and uses
+   vpmaddubsw followed by vpmaddwd. Since vpmaddubsw saturates the sum of
+   each pair of products to 16 bits, A is split into its low seven bits and
+   its sign bit, for which the pairwise sums are always exact; both halves
+   are then widened and accumulated separately. The result is therefore
+   identical to that of the _avxvnni kernel. Since the emulation needs more
+   registers than are available alongside all of the accumulators, its k
+   loop is run separately for each half (8 columns) of the microtile.
+
+   Row-stored microtiles of C (including edge cases) are updated directly
+   with masked loads and stores; other storage goes through a temporary
+   microtile.
+*/
+
+#define MR     6
+#define NR     16
+#define PACKMR 6
+#define PACKNR 16
+
+// Expand a macro once for each row of the microtile.
+#define FOR_EACH_ROW( f ) \
+	f( 0 ) f( 1 ) f( 2 ) f( 3 ) f( 4 ) f( 5 )
+
+#define DECL_ROW( i ) \
+	__m256i c##i##_0 = _mm256_setzero_si256(); \
+	__m256i c##i##_1 = _mm256_setzero_si256();
+
+// Masks for loading or storing the first i (0 <= i <= 8) elements of a
+// vector.
+static const int32_t mask_n[ 16 ] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                       0,  0,  0,  0,  0,  0,  0,  0 };
+
+// -- AVX-VNNI --
+
+// vpdpbusd %2, %1, %0 (VEX.256.66.0F38.W0 50 /r). The register numbers of
+// the operands, which the "x" constraint limits to ymm0-ymm15, are
+// recovered by matching their names, and the instruction is then emitted
+// byte by byte.
+#define VPDPBUSD_VEX \
+	".irp r, 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15\n\t" \
+	".ifc %0, %%ymm\\r\n\t.set .Lvnni_dst, \\r\n\t.endif\n\t" \
+	".ifc %1, %%ymm\\r\n\t.set .Lvnni_src1, \\r\n\t.endif\n\t" \
+	".ifc %2, %%ymm\\r\n\t.set .Lvnni_src2, \\r\n\t.endif\n\t" \
+	".endr\n\t" \
+	".byte 0xc4, " \
+	"0xe2 ^ ( ( .Lvnni_dst & 8 ) << 4 ) ^ ( ( .Lvnni_src2 & 8 ) << 2 ), " \
+	"( ( 15 - .Lvnni_src1 ) << 3 ) | 0x05, " \
+	"0x50, " \
+	"0xc0 | ( ( .Lvnni_dst & 7 ) << 3 ) | ( .Lvnni_src2 & 7 )"
+
+#define AVXVNNI_UPDATE_ROW( i ) \
+	{ \
+		const __m256i av = _mm256_set1_epi32( a[ i ] ); \
+		__asm__( VPDPBUSD_VEX : "+x"( c##i##_0 ) : "x"( av ), "x"( bv0 ) ); \
+		__asm__( VPDPBUSD_VEX : "+x"( c##i##_1 ) : "x"( av ), "x"( bv1 ) ); \
+	}
+
+#define AVXVNNI_ACCUMULATE \
+	for ( dim_t l = 0; l < k4; ++l ) \
+	{ \
+		const __m256i bv0 = _mm256_loadu_si256( ( const __m256i* )( b     ) ); \
+		const __m256i bv1 = _mm256_loadu_si256( ( const __m256i* )( b + 8 ) ); \
+\
+		FOR_EACH_ROW( AVXVNNI_UPDATE_ROW ) \
+\
+		a += PACKMR; \
+		b += PACKNR; \
+	}
+
+// -- AVX2 --
+
+#define AVX2_UPDATE_ROW( i, h ) \
+	{ \
+		const __m256i av   = _mm256_set1_epi32( a[ l*PACKMR + i ] ); \
+		const __m256i a_lo = _mm256_and_si256( av, lo7 ); \
+		const __m256i a_hi = _mm256_andnot_si256( lo7, av ); \
+		c##i##_##h = _mm256_add_epi32( c##i##_##h, _mm256_madd_epi16( _mm256_maddubs_epi16( a_lo, bv ), ones ) ); \
+		c##i##_##h = _mm256_add_epi32( c##i##_##h, _mm256_madd_epi16( _mm256_maddubs_epi16( a_hi, bv ), ones ) ); \
+	}
+
+#define AVX2_UPDATE_ROW_0( i ) AVX2_UPDATE_ROW( i, 0 )
+#define AVX2_UPDATE_ROW_1( i ) AVX2_UPDATE_ROW( i, 1 )
+
+#define AVX2_LOOP( h ) \
+	for ( dim_t l = 0; l < k4; ++l ) \
+	{ \
+		const __m256i bv = _mm256_loadu_si256( ( const __m256i* )( b + l*PACKNR + 8*h ) ); \
+\
+		FOR_EACH_ROW( AVX2_UPDATE_ROW_##h ) \
+	}
+
+#define AVX2_ACCUMULATE \
+	{ \
+		const __m256i lo7  = _mm256_set1_epi8( 0x7f ); \
+		const __m256i ones = _mm256_set1_epi16( 1 ); \
+\
+		AVX2_LOOP( 0 ) \
+		AVX2_LOOP( 1 ) \
+	}
+
+// -- Write-back --
+
+#define SCALE_ROW( i ) \
+	c##i##_0 = _mm256_mullo_epi32( alphav, c##i##_0 ); \
+	c##i##_1 = _mm256_mullo_epi32( alphav, c##i##_1 );
+
+#define STORE_ROW( i ) \
+	if ( i < m ) \
+	{ \
+		_mm256_maskstore_epi32( c + i*rs_c,     m0, c##i##_0 ); \
+		_mm256_maskstore_epi32( c + i*rs_c + 8, m1, c##i##_1 ); \
+	}
+
+#define UPDATE_ROW( i ) \
+	if ( i < m ) \
+	{ \
+		const __m256i ci_0 = _mm256_maskload_epi32( c + i*rs_c,     m0 ); \
+		const __m256i ci_1 = _mm256_maskload_epi32( c + i*rs_c + 8, m1 ); \
+		c##i##_0 = _mm256_add_epi32( c##i##_0, _mm256_mullo_epi32( betav, ci_0 ) ); \
+		c##i##_1 = _mm256_add_epi32( c##i##_1, _mm256_mullo_epi32( betav, ci_1 ) ); \
+	} \
+	STORE_ROW( i )
+
+#define STORE_CT( i ) \
+	_mm256_store_si256( ( __m256i* )( ct + i*NR     ), c##i##_0 ); \
+	_mm256_store_si256( ( __m256i* )( ct + i*NR + 8 ), c##i##_1 );
+
+#undef  GENKER
+#define GENKER( name, accumulate ) \
+\
+void name \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const int32_t* restrict a     = a0; \
+	const int32_t* restrict b     = b0; \
+	      int32_t* restrict c     = c0; \
+	const int32_t           alpha = ( int32_t )*( const float* )alpha0; \
+	const int32_t           beta  = ( int32_t )*( const float* )beta0; \
+	const dim_t             k4    = ( k + 3 ) / 4; \
+\
+	( void )data; ( void )cntx; \
+\
+	FOR_EACH_ROW( DECL_ROW ) \
+\
+	accumulate \
+\
+	if ( alpha != 1 ) \
+	{ \
+		const __m256i alphav = _mm256_set1_epi32( alpha ); \
+\
+		FOR_EACH_ROW( SCALE_ROW ) \
+	} \
+\
+	if ( cs_c == 1 ) \
+	{ \
+		const __m256i betav = _mm256_set1_epi32( beta ); \
+		const __m256i m0    = _mm256_loadu_si256( ( const __m256i* ) \
+		                      ( mask_n + 8 - bli_min( n,     8 ) ) ); \
+		const __m256i m1    = _mm256_loadu_si256( ( const __m256i* ) \
+		                      ( mask_n + 8 - bli_max( n - 8, 0 ) ) ); \
+\
+		if ( beta == 0 ) { FOR_EACH_ROW( STORE_ROW ) } \
+		else             { FOR_EACH_ROW( UPDATE_ROW ) } \
+	} \
+	else \
+	{ \
+		int32_t ct[ MR*NR ] __attribute__((aligned(32))); \
+\
+		FOR_EACH_ROW( STORE_CT ) \
+\
+		for ( dim_t i = 0; i < m; ++i ) \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			int32_t* restrict cij = c + i*rs_c + j*cs_c; \
+\
+			if ( beta == 0 ) *cij = ct[ i*NR + j ]; \
+			else             *cij = ( int32_t )( ( uint32_t )ct[ i*NR + j ] + \
+			                                     ( uint32_t )beta * ( uint32_t )*cij ); \
+		} \
+	} \
+}
+
+GENKER( bli_u8s8s32gemm_haswell_int_6x16,         AVX2_ACCUMULATE    )
+GENKER( bli_u8s8s32gemm_haswell_int_6x16_avxvnni, AVXVNNI_ACCUMULATE )
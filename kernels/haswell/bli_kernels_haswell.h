@@ -41,6 +41,10 @@ PACKM_KER_PROT( double,   d, packm_haswell_asm_6x8 )
 PACKM_KER_PROT( scomplex, c, packm_haswell_asm_3x8 )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_3x4 )
 
+// packm (intrinsics, bfloat16/float16 -> float)
+PACKM_KER_PROT( float,   sb, packm_haswell_int_6x16 )
+PACKM_KER_PROT( float,   sh, packm_haswell_int_6x16 )
+
 
 // -- level-3 ------------------------------------------------------------------
 
@@ -50,6 +54,9 @@ GEMM_UKR_PROT( double,   d, gemm_haswell_asm_6x8 )
 GEMM_UKR_PROT( scomplex, c, gemm_haswell_asm_3x8 )
 GEMM_UKR_PROT( dcomplex, z, gemm_haswell_asm_3x4 )
 
+GEMM_UKR_PROT( int32_t, u8s8s32, gemm_haswell_int_6x16 )
+GEMM_UKR_PROT( int32_t, u8s8s32, gemm_haswell_int_6x16_avxvnni )
+
 // gemm (asm d8x6)
 GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
 GEMM_UKR_PROT( double,   d, gemm_haswell_asm_8x6 )
@@ -0,0 +1,146 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+/*
+   Packing kernels for the 16-bit MMA microkernels (bli_sbgemm_power10_mma_8x16,
+   bli_shgemm_power10_mma_8x16, bli_i16gemm_power10_mma_8x16). The elements
+   are copied without conversion, interleaving pairs of k indices as consumed
+   by the rank-2 xv*ger2 instructions (see bli_gemm_lp.h): element (i,l) of
+   the micropanel is stored at p[ (l/2)*2*ldp + 2*i + (l%2) ], and an odd k
+   is padded with a zero. Since the format does not depend on what the 16
+   bits represent, all three kernels are the same code.
+
+   Each pair occupies one 32-bit word, so pair l of row i is found at word
+   i + l*ldp, and the edges are zeroed as in a single-precision micropanel.
+   Kappa is not applied; it is always one since alpha is applied by the
+   microkernel.
+*/
+
+#undef  GENTFUNC
+#define GENTFUNC( ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   cdim_bcast, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a0, inc_t inca, inc_t lda, \
+             void*   p0,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     ) \
+{ \
+	const uint16_t* restrict a  = a0; \
+	      uint16_t* restrict p  = p0; \
+	const dim_t              n2 = ( n + 1 ) / 2; \
+\
+	if ( cdim_bcast == 1 && inca == 1 ) \
+	{ \
+		/* Column-stored source: merge two contiguous columns. */ \
+		for ( dim_t l = 0; l < n2; ++l ) \
+		{ \
+			const uint16_t* restrict ak0 = a + ( 2*l     )*lda; \
+			const uint16_t* restrict ak1 = a + ( 2*l + 1 )*lda; \
+			      uint16_t* restrict pl  = p + 2*l*ldp; \
+\
+			if ( 2*l + 1 < n ) \
+			{ \
+				for ( dim_t i = 0; i < cdim; ++i ) \
+				{ \
+					pl[ 2*i + 0 ] = ak0[ i ]; \
+					pl[ 2*i + 1 ] = ak1[ i ]; \
+				} \
+			} \
+			else \
+			{ \
+				for ( dim_t i = 0; i < cdim; ++i ) \
+				{ \
+					pl[ 2*i + 0 ] = ak0[ i ]; \
+					pl[ 2*i + 1 ] = 0; \
+				} \
+			} \
+		} \
+	} \
+	else if ( cdim_bcast == 1 && lda == 1 ) \
+	{ \
+		/* Row-stored source: each pair is already contiguous. */ \
+		for ( dim_t i = 0; i < cdim; ++i ) \
+		{ \
+			const uint16_t* restrict ai = a + i*inca; \
+			      uint16_t* restrict pi = p + 2*i; \
+\
+			for ( dim_t l = 0; l < n2; ++l ) \
+			{ \
+				pi[ 2*l*ldp + 0 ] = ai[ 2*l ]; \
+				pi[ 2*l*ldp + 1 ] = 2*l + 1 < n ? ai[ 2*l + 1 ] : 0; \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t l = 0; l < n2; ++l ) \
+		for ( dim_t i = 0; i < cdim; ++i ) \
+		{ \
+			const uint16_t lo = a[ i*inca + ( 2*l )*lda ]; \
+			const uint16_t hi = 2*l + 1 < n ? a[ i*inca + ( 2*l + 1 )*lda ] : 0; \
+\
+			for ( dim_t d = 0; d < cdim_bcast; ++d ) \
+			{ \
+				p[ 2*( i*cdim_bcast + d ) + 0 + 2*l*ldp ] = lo; \
+				p[ 2*( i*cdim_bcast + d ) + 1 + 2*l*ldp ] = hi; \
+			} \
+		} \
+	} \
+\
+	/* Zero the edges, treating each pair as a single 32-bit word. The
+	   padded length n_max is always a whole number of pairs. */ \
+	bli_sset0s_edge \
+	( \
+	  cdim*cdim_bcast, cdim_max*cdim_bcast, \
+	  n2, n_max / 2, \
+	  ( float* )p, ldp \
+	); \
+}
+
+GENTFUNC( sb,  packm_power10_int_8x16 )
+GENTFUNC( sh,  packm_power10_int_8x16 )
+GENTFUNC( i16, packm_power10_int_8x16 )
@@ -32,8 +32,6 @@
 
 */
 
-#ifdef BLIS_SANDBOX_POWER10
-
 #include "vector_int_macros.h"
 
 #define I16_ACCUMULATE \
@@ -74,19 +72,31 @@ void bli_i16gemm_power10_mma_8x16
         const cntx_t*    cntx
     )
 {
+    // The micropanels hold pairs of k indices (see bli_gemm_lp.h), one pair
+    // per rank-2 update; an odd k has been padded with a zero.
+    const dim_t k2 = ( k + 1 ) / 2;
 
-    uint64_t k_iter = (k-1) / 4;
-    uint64_t k_left = (k-1) % 4;
+    // Typecast local copies of integers in case dim_t and inc_t are a
+    // different size than is expected by load instructions.
+    uint64_t k_iter = k2 / 4;
+    uint64_t k_left = k2 % 4;
 
     uint64_t rs_c   = rs_c0;
-    //uint64_t cs_c   = cs_c0;
+    uint64_t cs_c   = cs_c0;
+
+    // The int32 microtile is carried by the framework as single precision,
+    // including alpha and beta, which hold integral values. Edge cases and
+    // column storage are computed in a temporary microtile, which is then
+    // accumulated into C in integer arithmetic below (the float
+    // GEMM_UKR_FLUSH_CT() would not do).
+    GEMM_UKR_SETUP_CT( s, 8, 16, true );
 
     const short* restrict A0 = a;
     const short* restrict B0 = b;
           int*   restrict C0 = c;
 
-    int alpha_ = *((int32_t*)alpha),
-        beta_  = *((int32_t*)beta);
+    int alpha_ = *((float*)alpha),
+        beta_  = *((float*)beta);
 
     iv4sf_t result[4];
     iv4sf_t *rowC;
@@ -95,21 +105,20 @@ void bli_i16gemm_power10_mma_8x16
     __vector_quad acc0, acc1, acc2, acc3,
                   acc4, acc5, acc6, acc7;
 
+    // initialize the accumulators to zeros
+    __builtin_mma_xxsetaccz(&acc0);
+    __builtin_mma_xxsetaccz(&acc1);
+    __builtin_mma_xxsetaccz(&acc2);
+    __builtin_mma_xxsetaccz(&acc3);
+    __builtin_mma_xxsetaccz(&acc4);
+    __builtin_mma_xxsetaccz(&acc5);
+    __builtin_mma_xxsetaccz(&acc6);
+    __builtin_mma_xxsetaccz(&acc7);
+
     vec_t *ca = (vec_t*) A0;
     vec_t *rb = (vec_t*) B0;
 
-    __builtin_mma_xvi16ger2 (&acc0, ca[0], rb[0]);
-    __builtin_mma_xvi16ger2 (&acc1, ca[0], rb[1]);
-    __builtin_mma_xvi16ger2 (&acc2, ca[0], rb[2]);
-    __builtin_mma_xvi16ger2 (&acc3, ca[0], rb[3]);
-    __builtin_mma_xvi16ger2 (&acc4, ca[1], rb[0]);
-    __builtin_mma_xvi16ger2 (&acc5, ca[1], rb[1]);
-    __builtin_mma_xvi16ger2 (&acc6, ca[1], rb[2]);
-    __builtin_mma_xvi16ger2 (&acc7, ca[1], rb[3]);
-
-    I16_INCREMENT
-
-    // k loop
+    // k loop (unrolled by 4)
     for (int k = 0; k<k_iter; k++)
     {
         I16_AB_PRODUCT
@@ -118,14 +127,14 @@ void bli_i16gemm_power10_mma_8x16
         I16_AB_PRODUCT
     }
 
-    // k loop
+    // edge loop
     for (int k = 0; k<k_left; k++)
     {
         I16_AB_PRODUCT
     }
 
     // handle beta cases
-    if (beta_ != 0.0)
+    if (beta_ != 0)
     {
         SAVE_ACC(iv4sf_t, &acc0, rs_c,  0     );
         SAVE_ACC(iv4sf_t, &acc1, rs_c,  4     );
@@ -147,5 +156,19 @@ void bli_i16gemm_power10_mma_8x16
         SAVE_ACC_bz(iv4sf_t, &acc6, rs_c,  8+4*rs_c);
         SAVE_ACC_bz(iv4sf_t, &acc7, rs_c, 12+4*rs_c);
     }
+
+    if ( _use_ct )
+    {
+        const int32_t* restrict ct     = ( const int32_t* )_ct;
+              int32_t* restrict c_orig = ( int32_t* )_c;
+        const int32_t           beta_c = *_beta;
+
+        for ( dim_t i = 0; i < m; ++i )
+        for ( dim_t j = 0; j < n; ++j )
+        {
+            int32_t* restrict cij = c_orig + i*_rs_c + j*_cs_c;
+
+            *cij = ct[ i*_rs_ct + j*_cs_ct ] + ( beta_c != 0 ? beta_c * *cij : 0 );
+        }
+    }
 }
-#endif // BLIS_SANDBOX_POWER10
@@ -32,8 +32,6 @@
 
 */
 
-#ifdef BLIS_SANDBOX_POWER10
-
 #include "vector_int_macros.h"
 
 #define B_ACCUMULATE \
@@ -75,12 +73,19 @@ void bli_sbgemm_power10_mma_8x16
         const cntx_t*    cntx
     )
 {
+    // The micropanels hold pairs of k indices (see bli_gemm_lp.h), one pair
+    // per rank-2 update; an odd k has been padded with a zero.
+    const dim_t k2 = ( k + 1 ) / 2;
 
-    uint64_t k_iter = (k-1)/4;
-    uint64_t k_left = (k-1)%4;
+    // Typecast local copies of integers in case dim_t and inc_t are a
+    // different size than is expected by load instructions.
+    uint64_t k_iter = k2 / 4;
+    uint64_t k_left = k2 % 4;
 
     uint64_t rs_c   = rs_c0;
-    //uint64_t cs_c   = cs_c0;
+    uint64_t cs_c   = cs_c0;
+
+    GEMM_UKR_SETUP_CT( s, 8, 16, true );
 
     const bfloat16* restrict A0 = a;
     const bfloat16* restrict B0 = b;
@@ -96,21 +101,20 @@ void bli_sbgemm_power10_mma_8x16
     __vector_quad acc0, acc1, acc2, acc3,
                   acc4, acc5, acc6, acc7;
 
+    // initialize the accumulators to zeros
+    __builtin_mma_xxsetaccz(&acc0);
+    __builtin_mma_xxsetaccz(&acc1);
+    __builtin_mma_xxsetaccz(&acc2);
+    __builtin_mma_xxsetaccz(&acc3);
+    __builtin_mma_xxsetaccz(&acc4);
+    __builtin_mma_xxsetaccz(&acc5);
+    __builtin_mma_xxsetaccz(&acc6);
+    __builtin_mma_xxsetaccz(&acc7);
+
     vec_t *ca = (vec_t *) A0;
     vec_t *rb = (vec_t *) B0;
 
-    __builtin_mma_xvbf16ger2 (&acc0, ca[0], rb[0]);
-    __builtin_mma_xvbf16ger2 (&acc1, ca[0], rb[1]);
-    __builtin_mma_xvbf16ger2 (&acc2, ca[0], rb[2]);
-    __builtin_mma_xvbf16ger2 (&acc3, ca[0], rb[3]);
-    __builtin_mma_xvbf16ger2 (&acc4, ca[1], rb[0]);
-    __builtin_mma_xvbf16ger2 (&acc5, ca[1], rb[1]);
-    __builtin_mma_xvbf16ger2 (&acc6, ca[1], rb[2]);
-    __builtin_mma_xvbf16ger2 (&acc7, ca[1], rb[3]);
-
-    B_INCREMENT
-
-    // k loop
+    // k loop (unrolled by 4)
     for (int k = 0; k<k_iter; k++)
     {
         B_AB_PRODUCT
@@ -119,6 +123,7 @@ void bli_sbgemm_power10_mma_8x16
         B_AB_PRODUCT
     }
 
+    // edge loop
     for (int k = 0; k<k_left; k++)
     {
         B_AB_PRODUCT
@@ -148,5 +153,5 @@ void bli_sbgemm_power10_mma_8x16
         SAVE_ACC_bz(fv4sf_t, &acc7, rs_c, 12+4*rs_c);
     }
 
+    GEMM_UKR_FLUSH_CT( s );
 }
-#endif // BLIS_SANDBOX_POWER10
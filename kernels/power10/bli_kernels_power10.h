@@ -32,7 +32,16 @@
 
 */
 
+// packm (16-bit pairs; see bli_gemm_lp.h)
+PACKM_KER_PROT( float,   sb,  packm_power10_int_8x16 )
+PACKM_KER_PROT( float,   sh,  packm_power10_int_8x16 )
+PACKM_KER_PROT( int32_t, i16, packm_power10_int_8x16 )
+
 // gemm
 GEMM_UKR_PROT( double,   d, gemm_power10_mma_8x8  )
 GEMM_UKR_PROT( float,    s, gemm_power10_mma_8x16 )
 
+GEMM_UKR_PROT( float,    sb,  gemm_power10_mma_8x16 )
+GEMM_UKR_PROT( float,    sh,  gemm_power10_mma_8x16 )
+GEMM_UKR_PROT( int32_t,  i16, gemm_power10_mma_8x16 )
+
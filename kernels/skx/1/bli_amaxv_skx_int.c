@@ -0,0 +1,203 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 amaxv kernels. Each lane of two independent (max, index) vector
+   pairs tracks the largest absolute value seen in that lane along with the
+   index at which it was first seen; the final partial vector is handled
+   with masked loads. The lanes are merged at the end, preferring the
+   smallest index among equal values, which reproduces the result of the
+   sequential search in the reference kernel. As there, a NaN replaces any
+   non-NaN maximum but is never replaced itself, so the index of the first
+   NaN is returned if one is present.
+
+   For complex vectors, |xr| + |xi| is formed in both lanes of each
+   (real,imag) pair, and only the even lanes take part in the search.
+   Non-unit strides, and vectors too long for the lane indices, are
+   handled with a scalar loop.
+*/
+
+// Update a (max, index) vector pair with the absolute values in av.
+#define AMAXV_SKX_UPDATE( px, ix, mtype, k, av, maxv, idxv, iv ) \
+{ \
+	const mtype gt  = _mm512_cmp_##px##_mask( av, maxv, _CMP_GT_OQ ); \
+	const mtype nan = _mm512_cmp_##px##_mask( av, av, _CMP_UNORD_Q ) & \
+	           ( mtype )~_mm512_cmp_##px##_mask( maxv, maxv, _CMP_UNORD_Q ); \
+	const mtype upd = ( gt | nan ) & ( k ); \
+\
+	maxv = _mm512_mask_mov_##px( maxv, upd, av ); \
+	idxv = _mm512_mask_mov_##ix( idxv, upd, iv ); \
+}
+
+// Compute the absolute values of one vector of real elements.
+#define AMAXV_SKX_ABS( px, dim, swp, xv ) \
+	( dim == 1 ? _mm512_abs_##px( xv ) \
+	           : _mm512_add_##px( _mm512_abs_##px( xv ), \
+	                              _mm512_permute_##px( _mm512_abs_##px( xv ), swp ) ) )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, swp, lanes, itype, ix, imax ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+             dim_t*  index, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype_r* restrict x = x0; \
+\
+	/* If the vector length is zero, return early. This directly emulates
+	   the behavior of netlib BLAS's i?amax() routines. */ \
+	if ( bli_zero_dim1( n ) ) \
+	{ \
+		*index = 0; \
+		return; \
+	} \
+\
+	if ( incx != 1 || n > imax ) \
+	{ \
+		const ctype* restrict chi = x0; \
+		ctype_r abs_chi1_max = -1.0; \
+		dim_t   i_max_l      = 0; \
+\
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			ctype_r chi1_r, chi1_i; \
+			bli_tgets( ch,chr, chi[ i*incx ], chi1_r, chi1_i ); \
+\
+			const ctype_r abs_chi1 = bli_fabs( chi1_r ) + bli_fabs( chi1_i ); \
+\
+			if ( abs_chi1_max < abs_chi1 || ( PASTEMAC(chr,isnan)( abs_chi1 ) && !PASTEMAC(chr,isnan)( abs_chi1_max ) ) ) \
+			{ \
+				abs_chi1_max = abs_chi1; \
+				i_max_l      = i; \
+			} \
+		} \
+\
+		*index = i_max_l; \
+		return; \
+	} \
+\
+	/* The vectorized loops below index x by real elements. The lane
+	   indices are in units of ctype. */ \
+	const dim_t n_r = dim*n; \
+\
+	itype iv0[ nv ]; \
+	for ( dim_t j = 0; j < nv; ++j ) iv0[ j ] = j / dim; \
+\
+	const __m512i step  = _mm512_set1_##ix( nv / dim ); \
+	const __m512i step2 = _mm512_set1_##ix( 2*nv / dim ); \
+	__m512i       i0v   = _mm512_loadu_si512( iv0 ); \
+	__m512i       i1v   = _mm512_add_##ix( i0v, step ); \
+	__m512i       idx0  = _mm512_setzero_si512(); \
+	__m512i       idx1  = _mm512_setzero_si512(); \
+\
+	/* Initialize the maximum absolute value search candidates with -1,
+	   which is less than all values we will compute. */ \
+	vtype max0 = _mm512_set1_##px( -1.0 ); \
+	vtype max1 = _mm512_set1_##px( -1.0 ); \
+\
+	dim_t i = 0; \
+\
+	for ( ; i + 2*nv <= n_r; i += 2*nv ) \
+	{ \
+		const vtype x0v = _mm512_loadu_##px( x + i + 0*nv ); \
+		const vtype x1v = _mm512_loadu_##px( x + i + 1*nv ); \
+		const vtype a0v = AMAXV_SKX_ABS( px, dim, swp, x0v ); \
+		const vtype a1v = AMAXV_SKX_ABS( px, dim, swp, x1v ); \
+\
+		AMAXV_SKX_UPDATE( px, ix, mtype, lanes, a0v, max0, idx0, i0v ); \
+		AMAXV_SKX_UPDATE( px, ix, mtype, lanes, a1v, max1, idx1, i1v ); \
+\
+		i0v = _mm512_add_##ix( i0v, step2 ); \
+		i1v = _mm512_add_##ix( i1v, step2 ); \
+	} \
+\
+	if ( i + nv <= n_r ) \
+	{ \
+		const vtype xv = _mm512_loadu_##px( x + i ); \
+		const vtype av = AMAXV_SKX_ABS( px, dim, swp, xv ); \
+\
+		AMAXV_SKX_UPDATE( px, ix, mtype, lanes, av, max0, idx0, i0v ); \
+\
+		i0v  = _mm512_add_##ix( i0v, step ); \
+		i   += nv; \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x + i ); \
+		const vtype av = AMAXV_SKX_ABS( px, dim, swp, xv ); \
+\
+		AMAXV_SKX_UPDATE( px, ix, mtype, ( lanes ) & k, av, max1, idx1, i0v ); \
+	} \
+\
+	/* Merge the lanes. Lanes that were never updated still hold -1 and
+	   cannot be chosen. */ \
+	ctype_r max_l[ 2*nv ]; \
+	itype   idx_l[ 2*nv ]; \
+\
+	_mm512_storeu_##px( max_l + 0*nv, max0 ); \
+	_mm512_storeu_##px( max_l + 1*nv, max1 ); \
+	_mm512_storeu_si512( idx_l + 0*nv, idx0 ); \
+	_mm512_storeu_si512( idx_l + 1*nv, idx1 ); \
+\
+	dim_t j_max = 0; \
+\
+	for ( dim_t j = 1; j < 2*nv; ++j ) \
+	{ \
+		const ctype_r a_j = max_l[ j ]; \
+		const ctype_r a_m = max_l[ j_max ]; \
+		const bool    gt  = a_m < a_j || \
+		                    ( PASTEMAC(chr,isnan)( a_j ) && !PASTEMAC(chr,isnan)( a_m ) ); \
+		const bool    lt  = a_j < a_m || \
+		                    ( PASTEMAC(chr,isnan)( a_m ) && !PASTEMAC(chr,isnan)( a_j ) ); \
+\
+		if ( gt || ( !lt && idx_l[ j ] < idx_l[ j_max ] ) ) j_max = j; \
+	} \
+\
+	*index = idx_l[ j_max ]; \
+}
+
+GENTFUNCR( float,    float,  s, s, amaxv, _skx, _int, __m512,  __mmask16, ps, 16, 1, 0,    0xFFFF, int32_t, epi32, INT32_MAX )
+GENTFUNCR( double,   double, d, d, amaxv, _skx, _int, __m512d, __mmask8,  pd, 8,  1, 0,    0xFF,   int64_t, epi64, INT64_MAX )
+GENTFUNCR( scomplex, float,  c, s, amaxv, _skx, _int, __m512,  __mmask16, ps, 16, 2, 0xB1, 0x5555, int32_t, epi32, INT32_MAX )
+GENTFUNCR( dcomplex, double, z, d, amaxv, _skx, _int, __m512d, __mmask8,  pd, 8,  2, 0x55, 0x55,   int64_t, epi64, INT64_MAX )
+
@@ -0,0 +1,169 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 axpyv kernels. The vectorized path requires unit stride. A
+   leading partial vector is peeled off so that (for naturally aligned y)
+   the accesses to y in the main loops do not cross cache lines, and the
+   leading and trailing partial vectors are handled with masked loads and
+   stores rather than scalar loops. Non-unit strides are handled one
+   element at a time.
+
+   Complex vectors are processed as interleaved (real,imag) pairs, with
+   alpha * conjx(x) formed as
+
+     va * x + vb * x_s
+
+   where x_s has the real and imaginary parts of each element swapped and
+   va, vb hold +/- the real and imaginary parts of alpha in alternating
+   lanes.
+*/
+
+// Update one vector of real elements of y.
+#define AXPYV_SKX_VEC( px, dim, swp, xv, yv ) \
+	( dim == 1 ? _mm512_fmadd_##px( va, xv, yv ) \
+	           : _mm512_fmadd_##px( vb, _mm512_permute_##px( xv, swp ), \
+	                                _mm512_fmadd_##px( va, xv, yv ) ) )
+
+// Update a partial vector of y, as selected by the mask k.
+#define AXPYV_SKX_MASKED( vtype, px, dim, swp, k, x, y ) \
+{ \
+	const vtype xv = _mm512_maskz_loadu_##px( k, x ); \
+	const vtype yv = _mm512_maskz_loadu_##px( k, y ); \
+\
+	_mm512_mask_storeu_##px( y, k, AXPYV_SKX_VEC( px, dim, swp, xv, yv ) ); \
+}
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, swp, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjx, \
+             dim_t   n, \
+       const void*   alpha0, \
+       const void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const ctype*   restrict alpha = alpha0; \
+	const ctype_r* restrict x     = x0; \
+	      ctype_r* restrict y     = y0; \
+\
+	/* If alpha is zero, return. */ \
+	if ( bli_teq0s( ch, *alpha ) ) return; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		const ctype* restrict chi = x0; \
+		      ctype* restrict psi = y0; \
+\
+		if ( bli_is_conj( conjx ) ) \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_taxpyjs( ch,ch,ch,ch, *alpha, chi[ i*incx ], psi[ i*incy ] ); \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_taxpys( ch,ch,ch,ch, *alpha, chi[ i*incx ], psi[ i*incy ] ); \
+		} \
+		return; \
+	} \
+\
+	/* For the complex domain, va and vb are (ar, ar) and (-ai, ai) without
+	   conjugation of x, and (ar, -ar) and (ai, ai) with conjugation. */ \
+	const vtype arv = _mm512_set1_##px( PASTEMAC(ch,real)( *alpha ) ); \
+	const vtype aiv = _mm512_set1_##px( PASTEMAC(ch,imag)( *alpha ) ); \
+	const vtype va  = bli_is_conj( conjx ) \
+	                ? _mm512_mask_sub_##px( arv, odd, _mm512_setzero_##px(), arv ) : arv; \
+	const vtype vb  = bli_is_conj( conjx ) \
+	                ? aiv : _mm512_mask_sub_##px( aiv, ( mtype )~odd, _mm512_setzero_##px(), aiv ); \
+\
+	/* The vectorized loops below index x and y by real elements. */ \
+	const dim_t n_r   = dim*n; \
+	const dim_t n_pre = bli_min( n_r, dim*( ( -( uintptr_t )y & 63 ) / sizeof( ctype ) ) ); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << n_pre ) - 1 ); \
+		AXPYV_SKX_MASKED( vtype, px, dim, swp, k, x, y ); \
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 4*nv <= n_r; i += 4*nv ) \
+	{ \
+		const vtype x0v = _mm512_loadu_##px( x + i + 0*nv ); \
+		const vtype x1v = _mm512_loadu_##px( x + i + 1*nv ); \
+		const vtype x2v = _mm512_loadu_##px( x + i + 2*nv ); \
+		const vtype x3v = _mm512_loadu_##px( x + i + 3*nv ); \
+		const vtype y0v = _mm512_loadu_##px( y + i + 0*nv ); \
+		const vtype y1v = _mm512_loadu_##px( y + i + 1*nv ); \
+		const vtype y2v = _mm512_loadu_##px( y + i + 2*nv ); \
+		const vtype y3v = _mm512_loadu_##px( y + i + 3*nv ); \
+\
+		_mm512_storeu_##px( y + i + 0*nv, AXPYV_SKX_VEC( px, dim, swp, x0v, y0v ) ); \
+		_mm512_storeu_##px( y + i + 1*nv, AXPYV_SKX_VEC( px, dim, swp, x1v, y1v ) ); \
+		_mm512_storeu_##px( y + i + 2*nv, AXPYV_SKX_VEC( px, dim, swp, x2v, y2v ) ); \
+		_mm512_storeu_##px( y + i + 3*nv, AXPYV_SKX_VEC( px, dim, swp, x3v, y3v ) ); \
+	} \
+\
+	for ( ; i + nv <= n_r; i += nv ) \
+	{ \
+		const vtype xv = _mm512_loadu_##px( x + i ); \
+		const vtype yv = _mm512_loadu_##px( y + i ); \
+\
+		_mm512_storeu_##px( y + i, AXPYV_SKX_VEC( px, dim, swp, xv, yv ) ); \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		AXPYV_SKX_MASKED( vtype, px, dim, swp, k, x + i, y + i ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, axpyv, _skx, _int, __m512,  __mmask16, ps, 16, 1, 0,    0 )
+GENTFUNCR( double,   double, d, d, axpyv, _skx, _int, __m512d, __mmask8,  pd, 8,  1, 0,    0 )
+GENTFUNCR( scomplex, float,  c, s, axpyv, _skx, _int, __m512,  __mmask16, ps, 16, 2, 0xB1, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, axpyv, _skx, _int, __m512d, __mmask8,  pd, 8,  2, 0x55, 0xAA )
+
@@ -0,0 +1,133 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 copyv kernels. The vectorized path requires unit stride. A
+   leading partial vector is peeled off so that the stores to y in the main
+   loops are aligned, and the leading and trailing partial vectors are
+   handled with masked loads and stores (see bli_axpyv_skx_int.c). Complex
+   vectors are copied as interleaved (real,imag) pairs, with conjugation
+   applied by flipping the sign bit of the odd lanes. Other strides are
+   handled with a scalar loop.
+*/
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjx, \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const ctype_r* restrict x = x0; \
+	      ctype_r* restrict y = y0; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		const ctype* restrict chi = x0; \
+		      ctype* restrict psi = y0; \
+\
+		if ( bli_is_conj( conjx ) ) \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_tcopyjs( ch,ch, chi[ i*incx ], psi[ i*incy ] ); \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_tcopys( ch,ch, chi[ i*incx ], psi[ i*incy ] ); \
+		} \
+		return; \
+	} \
+\
+	/* The vectorized loops below index x and y by real elements. For the
+	   real domain, conjugation is a no-op and sgn is zero. */ \
+	const dim_t n_r = dim*n; \
+	const dim_t n_pre = bli_min( n_r, dim*( ( -( uintptr_t )y & 63 ) / sizeof( ctype ) ) ); \
+	const vtype sgn = bli_is_conj( conjx ) \
+	                ? _mm512_maskz_mov_##px( odd, _mm512_set1_##px( -0.0 ) ) \
+	                : _mm512_setzero_##px(); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << n_pre ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x ); \
+		_mm512_mask_storeu_##px( y, k, _mm512_xor_##px( xv, sgn ) ); \
+\
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 4*nv <= n_r; i += 4*nv ) \
+	{ \
+		const vtype x0v = _mm512_loadu_##px( x + i + 0*nv ); \
+		const vtype x1v = _mm512_loadu_##px( x + i + 1*nv ); \
+		const vtype x2v = _mm512_loadu_##px( x + i + 2*nv ); \
+		const vtype x3v = _mm512_loadu_##px( x + i + 3*nv ); \
+\
+		_mm512_storeu_##px( y + i + 0*nv, _mm512_xor_##px( x0v, sgn ) ); \
+		_mm512_storeu_##px( y + i + 1*nv, _mm512_xor_##px( x1v, sgn ) ); \
+		_mm512_storeu_##px( y + i + 2*nv, _mm512_xor_##px( x2v, sgn ) ); \
+		_mm512_storeu_##px( y + i + 3*nv, _mm512_xor_##px( x3v, sgn ) ); \
+	} \
+\
+	for ( ; i + nv <= n_r; i += nv ) \
+	{ \
+		const vtype xv = _mm512_loadu_##px( x + i ); \
+		_mm512_storeu_##px( y + i, _mm512_xor_##px( xv, sgn ) ); \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x + i ); \
+		_mm512_mask_storeu_##px( y + i, k, _mm512_xor_##px( xv, sgn ) ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, copyv, _skx, _int, __m512,  __mmask16, ps, 16, 1, 0 )
+GENTFUNCR( double,   double, d, d, copyv, _skx, _int, __m512d, __mmask8,  pd, 8,  1, 0 )
+GENTFUNCR( scomplex, float,  c, s, copyv, _skx, _int, __m512,  __mmask16, ps, 16, 2, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, copyv, _skx, _int, __m512d, __mmask8,  pd, 8,  2, 0xAA )
+
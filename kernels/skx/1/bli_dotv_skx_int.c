@@ -0,0 +1,271 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 dotv kernels. The vectorized path requires unit stride. A
+   leading partial vector is peeled off so that the loads of x in the main
+   loops are aligned, and the leading and trailing partial vectors are
+   handled with masked loads (see bli_axpyv_skx_int.c). Four independent
+   accumulators hide the latency of the FMA chain.
+
+   Complex vectors are processed as interleaved (real,imag) pairs. Two sets
+   of accumulators collect the lane-wise products x * y and x * y_s, where
+   y_s has the real and imaginary parts of each element swapped; the real
+   and imaginary parts of the dot product are then sums and differences of
+   the even and odd lanes of these accumulators. As in the reference
+   kernel, conjugation of y is handled by toggling the conjugation of x and
+   conjugating the result. Other strides are handled with a scalar loop.
+*/
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf, vtype, mtype, px, nv ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjx, \
+             conj_t  conjy, \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+       const void*   y0, inc_t incy, \
+             void*   rho0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* restrict x   = x0; \
+	const ctype* restrict y   = y0; \
+	      ctype* restrict rho = rho0; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		ctype dotxy; \
+		bli_tset0s( ch, dotxy ); \
+\
+		for ( dim_t i = 0; i < n; ++i ) \
+			bli_tdots( ch,ch,ch,ch, x[ i*incx ], y[ i*incy ], dotxy ); \
+\
+		bli_tcopys( ch,ch, dotxy, *rho ); \
+		return; \
+	} \
+\
+	vtype rho0v = _mm512_setzero_##px(); \
+	vtype rho1v = _mm512_setzero_##px(); \
+	vtype rho2v = _mm512_setzero_##px(); \
+	vtype rho3v = _mm512_setzero_##px(); \
+\
+	const dim_t n_pre = bli_min( n, ( -( uintptr_t )x & 63 ) / sizeof( ctype ) ); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << n_pre ) - 1 ); \
+\
+		rho2v = _mm512_fmadd_##px( _mm512_maskz_loadu_##px( k, x ), \
+		                           _mm512_maskz_loadu_##px( k, y ), rho2v ); \
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 4*nv <= n; i += 4*nv ) \
+	{ \
+		rho0v = _mm512_fmadd_##px( _mm512_loadu_##px( x + i + 0*nv ), \
+		                           _mm512_loadu_##px( y + i + 0*nv ), rho0v ); \
+		rho1v = _mm512_fmadd_##px( _mm512_loadu_##px( x + i + 1*nv ), \
+		                           _mm512_loadu_##px( y + i + 1*nv ), rho1v ); \
+		rho2v = _mm512_fmadd_##px( _mm512_loadu_##px( x + i + 2*nv ), \
+		                           _mm512_loadu_##px( y + i + 2*nv ), rho2v ); \
+		rho3v = _mm512_fmadd_##px( _mm512_loadu_##px( x + i + 3*nv ), \
+		                           _mm512_loadu_##px( y + i + 3*nv ), rho3v ); \
+	} \
+\
+	for ( ; i + nv <= n; i += nv ) \
+	{ \
+		rho0v = _mm512_fmadd_##px( _mm512_loadu_##px( x + i ), \
+		                           _mm512_loadu_##px( y + i ), rho0v ); \
+	} \
+\
+	if ( i < n ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << ( n - i ) ) - 1 ); \
+\
+		rho1v = _mm512_fmadd_##px( _mm512_maskz_loadu_##px( k, x + i ), \
+		                           _mm512_maskz_loadu_##px( k, y + i ), rho1v ); \
+	} \
+\
+	rho0v = _mm512_add_##px( rho0v, rho1v ); \
+	rho2v = _mm512_add_##px( rho2v, rho3v ); \
+	rho0v = _mm512_add_##px( rho0v, rho2v ); \
+\
+	*rho = _mm512_reduce_add_##px( rho0v ); \
+}
+
+GENTFUNC( float,  s, dotv, _skx, _int, __m512,  __mmask16, ps, 16 )
+GENTFUNC( double, d, dotv, _skx, _int, __m512d, __mmask8,  pd, 8 )
+
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, swp, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjx, \
+             conj_t  conjy, \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+       const void*   y0, inc_t incy, \
+             void*   rho0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype_r* restrict x   = x0; \
+	const ctype_r* restrict y   = y0; \
+	      ctype*   restrict rho = rho0; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		const ctype* restrict chi = x0; \
+		const ctype* restrict psi = y0; \
+\
+		conj_t conjx_use = conjx; \
+		if ( bli_is_conj( conjy ) ) bli_toggle_conj( &conjx_use ); \
+\
+		ctype dotxy; \
+		bli_tset0s( ch, dotxy ); \
+\
+		if ( bli_is_conj( conjx_use ) ) \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_tdotjs( ch,ch,ch,ch, chi[ i*incx ], psi[ i*incy ], dotxy ); \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < n; ++i ) \
+				bli_tdots( ch,ch,ch,ch, chi[ i*incx ], psi[ i*incy ], dotxy ); \
+		} \
+\
+		if ( bli_is_conj( conjy ) ) bli_tconjs( ch, dotxy ); \
+\
+		bli_tcopys( ch,ch, dotxy, *rho ); \
+		return; \
+	} \
+\
+	/* If y must be conjugated, we do so indirectly by first toggling the
+	   effective conjugation of x and then conjugating the resulting dot
+	   product. */ \
+	conj_t conjx_use = conjx; \
+	if ( bli_is_conj( conjy ) ) \
+		bli_toggle_conj( &conjx_use ); \
+\
+	/* The vectorized loops below index x and y by real elements. */ \
+	const dim_t n_r = 2*n; \
+\
+	vtype rr0v = _mm512_setzero_##px(); \
+	vtype rr1v = _mm512_setzero_##px(); \
+	vtype ri0v = _mm512_setzero_##px(); \
+	vtype ri1v = _mm512_setzero_##px(); \
+\
+	const dim_t n_pre = bli_min( n_r, 2*( ( -( uintptr_t )x & 63 ) / sizeof( ctype ) ) ); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << n_pre ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x ); \
+		const vtype yv = _mm512_maskz_loadu_##px( k, y ); \
+\
+		rr1v = _mm512_fmadd_##px( xv, yv, rr1v ); \
+		ri1v = _mm512_fmadd_##px( xv, _mm512_permute_##px( yv, swp ), ri1v ); \
+\
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 2*nv <= n_r; i += 2*nv ) \
+	{ \
+		const vtype x0v = _mm512_loadu_##px( x + i + 0*nv ); \
+		const vtype x1v = _mm512_loadu_##px( x + i + 1*nv ); \
+		const vtype y0v = _mm512_loadu_##px( y + i + 0*nv ); \
+		const vtype y1v = _mm512_loadu_##px( y + i + 1*nv ); \
+\
+		rr0v = _mm512_fmadd_##px( x0v, y0v, rr0v ); \
+		rr1v = _mm512_fmadd_##px( x1v, y1v, rr1v ); \
+		ri0v = _mm512_fmadd_##px( x0v, _mm512_permute_##px( y0v, swp ), ri0v ); \
+		ri1v = _mm512_fmadd_##px( x1v, _mm512_permute_##px( y1v, swp ), ri1v ); \
+	} \
+\
+	if ( i + nv <= n_r ) \
+	{ \
+		const vtype xv = _mm512_loadu_##px( x + i ); \
+		const vtype yv = _mm512_loadu_##px( y + i ); \
+\
+		rr0v = _mm512_fmadd_##px( xv, yv, rr0v ); \
+		ri0v = _mm512_fmadd_##px( xv, _mm512_permute_##px( yv, swp ), ri0v ); \
+\
+		i += nv; \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x + i ); \
+		const vtype yv = _mm512_maskz_loadu_##px( k, y + i ); \
+\
+		rr1v = _mm512_fmadd_##px( xv, yv, rr1v ); \
+		ri1v = _mm512_fmadd_##px( xv, _mm512_permute_##px( yv, swp ), ri1v ); \
+	} \
+\
+	/* The even and odd lanes of rr hold xr*yr and xi*yi, and those of ri
+	   hold xr*yi and xi*yr, respectively. */ \
+	vtype rrv = _mm512_add_##px( rr0v, rr1v ); \
+	vtype riv = _mm512_add_##px( ri0v, ri1v ); \
+\
+	if ( bli_is_noconj( conjx_use ) ) \
+		rrv = _mm512_mask_sub_##px( rrv, odd, _mm512_setzero_##px(), rrv ); \
+	else \
+		riv = _mm512_mask_sub_##px( riv, odd, _mm512_setzero_##px(), riv ); \
+\
+	ctype_r rho_r = _mm512_reduce_add_##px( rrv ); \
+	ctype_r rho_i = _mm512_reduce_add_##px( riv ); \
+\
+	if ( bli_is_conj( conjy ) ) \
+		rho_i = -rho_i; \
+\
+	bli_tsets( ch,ch, rho_r, rho_i, *rho ); \
+}
+
+GENTFUNCCO( scomplex, float,  c, s, dotv, _skx, _int, __m512,  __mmask16, ps, 16, 0xB1, 0xAAAA )
+GENTFUNCCO( dcomplex, double, z, d, dotv, _skx, _int, __m512d, __mmask8,  pd, 8,  0x55, 0xAA )
+
@@ -0,0 +1,93 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 dotxv kernels, implemented in terms of the corresponding dotv
+   kernels in bli_dotv_skx_int.c.
+*/
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjx, \
+             conj_t  conjy, \
+             dim_t   n, \
+       const void*   alpha0, \
+       const void*   x0, inc_t incx, \
+       const void*   y0, inc_t incy, \
+       const void*   beta0, \
+             void*   rho0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* alpha = alpha0; \
+	const ctype* beta  = beta0; \
+	      ctype* rho   = rho0; \
+\
+	ctype dotxy; \
+\
+	/* If beta is zero, clear rho. Otherwise, scale by beta. */ \
+	if ( bli_teq0s( ch, *beta ) ) \
+	{ \
+		bli_tset0s( ch, *rho ); \
+	} \
+	else \
+	{ \
+		bli_tscals( ch,ch,ch, *beta, *rho ); \
+	} \
+\
+	/* If the vectors are empty or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( n ) || bli_teq0s( ch, *alpha ) ) return; \
+\
+	PASTEMAC(ch,dotv,arch,suf) \
+	( \
+	  conjx, \
+	  conjy, \
+	  n, \
+	  x0, incx, \
+	  y0, incy, \
+	  &dotxy, \
+	  cntx  \
+	); \
+\
+	bli_taxpys( ch,ch,ch,ch, *alpha, dotxy, *rho ); \
+}
+
+INSERT_GENTFUNC_BASIC( dotxv, _skx, _int )
+
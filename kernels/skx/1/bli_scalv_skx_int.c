@@ -0,0 +1,157 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 scalv kernels. The vectorized path requires unit stride. A
+   leading partial vector is peeled off so that the accesses in the main
+   loops are aligned, and the leading and trailing partial vectors are
+   handled with masked loads and stores. Complex vectors are processed as
+   interleaved (real,imag) pairs, with alpha * x formed as va * x + vb * x_s,
+   where x_s has the real and imaginary parts of each element swapped. See
+   bli_axpyv_skx_int.c for both. Other strides are handled with a scalar
+   loop.
+*/
+
+// Scale one vector of real elements.
+#define SCALV_SKX_VEC( px, dim, swp, xv ) \
+	( dim == 1 ? _mm512_mul_##px( va, xv ) \
+	           : _mm512_fmadd_##px( vb, _mm512_permute_##px( xv, swp ), \
+	                                _mm512_mul_##px( va, xv ) ) )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, swp, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjalpha, \
+             dim_t   n, \
+       const void*   alpha0, \
+             void*   x0, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const ctype*   restrict alpha = alpha0; \
+	      ctype_r* restrict x     = x0; \
+\
+	/* If alpha is one, return. */ \
+	if ( bli_teq1s( ch, *alpha ) ) return; \
+\
+	/* If alpha is zero, use setv. */ \
+	if ( bli_teq0s( ch, *alpha ) ) \
+	{ \
+		const ctype* zero = PASTEMAC(ch,0); \
+\
+		/* Query the context for the kernel function pointer. */ \
+		const num_t dt     = PASTEMAC(ch,type); \
+		setv_ker_ft setv_p = bli_cntx_get_ukr_dt( dt, BLIS_SETV_KER, cntx ); \
+\
+		setv_p \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  n, \
+		  zero, \
+		  x0, incx, \
+		  cntx  \
+		); \
+		return; \
+	} \
+\
+	ctype alpha_conj; \
+	bli_tcopycjs( ch,ch, conjalpha, *alpha, alpha_conj ); \
+\
+	if ( incx != 1 ) \
+	{ \
+		ctype* restrict chi = x0; \
+\
+		for ( dim_t i = 0; i < n; ++i ) \
+			bli_tscals( ch,ch,ch, alpha_conj, chi[ i*incx ] ); \
+		return; \
+	} \
+\
+	/* The vectorized loops below index x by real elements. For the complex
+	   domain, va = (ar, ar) and vb = (-ai, ai). */ \
+	const dim_t n_r = dim*n; \
+	const dim_t n_pre = bli_min( n_r, dim*( ( -( uintptr_t )x & 63 ) / sizeof( ctype ) ) ); \
+	const vtype va  = _mm512_set1_##px( PASTEMAC(ch,real)( alpha_conj ) ); \
+	const vtype aiv = _mm512_set1_##px( PASTEMAC(ch,imag)( alpha_conj ) ); \
+	const vtype vb  = _mm512_mask_sub_##px( aiv, ( mtype )~odd, _mm512_setzero_##px(), aiv ); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << n_pre ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x ); \
+		_mm512_mask_storeu_##px( x, k, SCALV_SKX_VEC( px, dim, swp, xv ) ); \
+\
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 4*nv <= n_r; i += 4*nv ) \
+	{ \
+		const vtype x0v = _mm512_loadu_##px( x + i + 0*nv ); \
+		const vtype x1v = _mm512_loadu_##px( x + i + 1*nv ); \
+		const vtype x2v = _mm512_loadu_##px( x + i + 2*nv ); \
+		const vtype x3v = _mm512_loadu_##px( x + i + 3*nv ); \
+\
+		_mm512_storeu_##px( x + i + 0*nv, SCALV_SKX_VEC( px, dim, swp, x0v ) ); \
+		_mm512_storeu_##px( x + i + 1*nv, SCALV_SKX_VEC( px, dim, swp, x1v ) ); \
+		_mm512_storeu_##px( x + i + 2*nv, SCALV_SKX_VEC( px, dim, swp, x2v ) ); \
+		_mm512_storeu_##px( x + i + 3*nv, SCALV_SKX_VEC( px, dim, swp, x3v ) ); \
+	} \
+\
+	for ( ; i + nv <= n_r; i += nv ) \
+	{ \
+		const vtype xv = _mm512_loadu_##px( x + i ); \
+		_mm512_storeu_##px( x + i, SCALV_SKX_VEC( px, dim, swp, xv ) ); \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k  = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		const vtype xv = _mm512_maskz_loadu_##px( k, x + i ); \
+		_mm512_mask_storeu_##px( x + i, k, SCALV_SKX_VEC( px, dim, swp, xv ) ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, scalv, _skx, _int, __m512,  __mmask16, ps, 16, 1, 0,    0 )
+GENTFUNCR( double,   double, d, d, scalv, _skx, _int, __m512d, __mmask8,  pd, 8,  1, 0,    0 )
+GENTFUNCR( scomplex, float,  c, s, scalv, _skx, _int, __m512,  __mmask16, ps, 16, 2, 0xB1, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, scalv, _skx, _int, __m512d, __mmask8,  pd, 8,  2, 0x55, 0xAA )
+
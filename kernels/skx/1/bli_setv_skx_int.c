@@ -0,0 +1,120 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 setv kernels. The vectorized path requires unit stride. A
+   leading partial vector is peeled off so that the stores in the main
+   loops are aligned, and the leading and trailing partial vectors are
+   handled with masked stores (see bli_axpyv_skx_int.c). For complex
+   vectors, the real and imaginary parts of alpha are broadcast to
+   alternating lanes. Other strides are handled with a scalar loop.
+*/
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjalpha, \
+             dim_t   n, \
+       const void*   alpha0, \
+             void*   x0, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const ctype*   restrict alpha = alpha0; \
+	      ctype_r* restrict x     = x0; \
+\
+	ctype alpha_conj; \
+	bli_tcopycjs( ch,ch, conjalpha, *alpha, alpha_conj ); \
+\
+	if ( incx != 1 ) \
+	{ \
+		ctype* restrict chi = x0; \
+\
+		for ( dim_t i = 0; i < n; ++i ) \
+			bli_tcopys( ch,ch, alpha_conj, chi[ i*incx ] ); \
+		return; \
+	} \
+\
+	/* The vectorized loops below index x by real elements. */ \
+	const dim_t n_r = dim*n; \
+	const dim_t n_pre = bli_min( n_r, dim*( ( -( uintptr_t )x & 63 ) / sizeof( ctype ) ) ); \
+	const vtype av  = _mm512_mask_blend_##px \
+	( \
+	  odd, \
+	  _mm512_set1_##px( PASTEMAC(ch,real)( alpha_conj ) ), \
+	  _mm512_set1_##px( PASTEMAC(ch,imag)( alpha_conj ) ) \
+	); \
+\
+	dim_t i = 0; \
+\
+	if ( n_pre > 0 ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << n_pre ) - 1 ); \
+		_mm512_mask_storeu_##px( x, k, av ); \
+\
+		i = n_pre; \
+	} \
+\
+	for ( ; i + 4*nv <= n_r; i += 4*nv ) \
+	{ \
+		_mm512_storeu_##px( x + i + 0*nv, av ); \
+		_mm512_storeu_##px( x + i + 1*nv, av ); \
+		_mm512_storeu_##px( x + i + 2*nv, av ); \
+		_mm512_storeu_##px( x + i + 3*nv, av ); \
+	} \
+\
+	for ( ; i + nv <= n_r; i += nv ) \
+	{ \
+		_mm512_storeu_##px( x + i, av ); \
+	} \
+\
+	if ( i < n_r ) \
+	{ \
+		const mtype k = ( mtype )( ( 1u << ( n_r - i ) ) - 1 ); \
+		_mm512_mask_storeu_##px( x + i, k, av ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, setv, _skx, _int, __m512,  __mmask16, ps, 16, 1, 0 )
+GENTFUNCR( double,   double, d, d, setv, _skx, _int, __m512d, __mmask8,  pd, 8,  1, 0 )
+GENTFUNCR( scomplex, float,  c, s, setv, _skx, _int, __m512,  __mmask16, ps, 16, 2, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, setv, _skx, _int, __m512d, __mmask8,  pd, 8,  2, 0xAA )
+
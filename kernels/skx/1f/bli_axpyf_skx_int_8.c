@@ -0,0 +1,180 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 axpyf kernels with a fusing factor of 8. Each vector of y is
+   loaded once, updated with all eight columns of A, and stored. The column
+   updates are split across two accumulators to shorten the FMA chain. A
+   leading partial vector is peeled off so that the accesses to y are
+   aligned, and the leading and trailing partial vectors are handled with
+   masked loads and stores (see bli_axpyv_skx_int.c).
+
+   Complex vectors are processed as interleaved (real,imag) pairs, with
+   chi_j * conja(a_j) formed as va_j * a_j + vb_j * a_j_s, where a_j_s has
+   the real and imaginary parts of each element swapped.
+
+   If b_n is not equal to the fusing factor, or if any of the vectors is
+   not stored contiguously, the operation is performed as a loop over
+   axpyv.
+*/
+
+// Broadcast alpha * conjx(chi_j) to va_j and vb_j, which are formed as for
+// axpyv in the complex domain.
+#define AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, j ) \
+\
+	ctype alpha_chi##j; \
+	bli_tcopycjs( ch,ch, conjx, x[j], alpha_chi##j ); \
+	bli_tscals( ch,ch,ch, *alpha, alpha_chi##j ); \
+\
+	const vtype ar##j = _mm512_set1_##px( PASTEMAC(ch,real)( alpha_chi##j ) ); \
+	const vtype ai##j = _mm512_set1_##px( PASTEMAC(ch,imag)( alpha_chi##j ) ); \
+	const vtype va##j = bli_is_conj( conja ) \
+	    ? _mm512_mask_sub_##px( ar##j, odd, _mm512_setzero_##px(), ar##j ) : ar##j; \
+	const vtype vb##j = bli_is_conj( conja ) \
+	    ? ai##j : _mm512_mask_sub_##px( ai##j, ( mtype )~odd, _mm512_setzero_##px(), ai##j );
+
+// Accumulate chi_j * conja(a_j) into y0v, and into y1v for the complex
+// domain.
+#define AXPYF_SKX_COL( vtype, px, dim, swp, j, y0v, y1v ) \
+{ \
+	const vtype av = _mm512_maskz_loadu_##px( k, ap + i + j*lda_r ); \
+\
+	y0v = _mm512_fmadd_##px( va##j, av, y0v ); \
+	if ( dim == 2 ) \
+	y1v = _mm512_fmadd_##px( vb##j, _mm512_permute_##px( av, swp ), y1v ); \
+}
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, swp, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conja, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   b_n, \
+       const void*   alpha0, \
+       const void*   a0, inc_t inca, inc_t lda, \
+       const void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const dim_t fuse_fac = 8; \
+\
+	const ctype* restrict alpha = alpha0; \
+	const ctype* restrict a     = a0; \
+	const ctype* restrict x     = x0; \
+	      ctype* restrict y     = y0; \
+\
+	/* If either dimension is zero, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim2( m, b_n ) || bli_teq0s( ch, *alpha ) ) return; \
+\
+	/* If b_n is not equal to the fusing factor, or if the vectors are not
+	   contiguous, then perform the entire operation as a loop over
+	   axpyv. */ \
+	if ( b_n != fuse_fac || inca != 1 || incx != 1 || incy != 1 ) \
+	{ \
+		const num_t  dt     = PASTEMAC(ch,type); \
+		axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+		for ( dim_t j = 0; j < b_n; ++j ) \
+		{ \
+			const ctype* restrict a1   = a + (0  )*inca + (j  )*lda; \
+			const ctype* restrict chi1 = x + (j  )*incx; \
+			ctype alpha_chi1; \
+\
+			bli_tcopycjs( ch,ch, conjx, *chi1, alpha_chi1 ); \
+			bli_tscals( ch,ch,ch, *alpha, alpha_chi1 ); \
+\
+			kfp_av \
+			( \
+			  conja, \
+			  m, \
+			  &alpha_chi1, \
+			  a1, inca, \
+			  y, incy, \
+			  cntx  \
+			); \
+		} \
+		return; \
+	} \
+\
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 0 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 1 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 2 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 3 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 4 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 5 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 6 ) \
+	AXPYF_SKX_CHI( ctype, vtype, mtype, ch, px, odd, 7 ) \
+\
+	/* The vectorized loop below indexes a and y by real elements. */ \
+	const ctype_r* restrict ap    = ( const ctype_r* )a; \
+	      ctype_r* restrict yp    = ( ctype_r* )y; \
+	const dim_t             m_r   = dim*m; \
+	const inc_t             lda_r = dim*lda; \
+	const dim_t             m_pre = bli_min( m_r, dim*( ( -( uintptr_t )y & 63 ) / sizeof( ctype ) ) ); \
+\
+	for ( dim_t i = 0, m_i; i < m_r; i += m_i ) \
+	{ \
+		m_i = ( i == 0 && m_pre > 0 ) ? m_pre : bli_min( nv, m_r - i ); \
+\
+		const mtype k = m_i == nv ? ( mtype )-1 : ( mtype )( ( 1u << m_i ) - 1 ); \
+\
+		vtype y0v = _mm512_maskz_loadu_##px( k, yp + i ); \
+		vtype y1v = _mm512_setzero_##px(); \
+\
+		/* For the real domain, alternate between the two accumulators. */ \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 0, y0v, y1v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 1, y1v, y0v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 2, y0v, y1v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 3, y1v, y0v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 4, y0v, y1v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 5, y1v, y0v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 6, y0v, y1v ); \
+		AXPYF_SKX_COL( vtype, px, dim, swp, 7, y1v, y0v ); \
+\
+		_mm512_mask_storeu_##px( yp + i, k, _mm512_add_##px( y0v, y1v ) ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, axpyf, _skx, _int_8, __m512,  __mmask16, ps, 16, 1, 0,    0 )
+GENTFUNCR( double,   double, d, d, axpyf, _skx, _int_8, __m512d, __mmask8,  pd, 8,  1, 0,    0 )
+GENTFUNCR( scomplex, float,  c, s, axpyf, _skx, _int_8, __m512,  __mmask16, ps, 16, 2, 0xB1, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, axpyf, _skx, _int_8, __m512d, __mmask8,  pd, 8,  2, 0x55, 0xAA )
+
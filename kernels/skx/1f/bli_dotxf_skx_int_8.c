@@ -0,0 +1,228 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   AVX-512 dotxf kernels with a fusing factor of 8. Each vector of x is
+   loaded once and multiplied into one accumulator per column of A. A
+   leading partial vector is peeled off so that the loads of x are aligned,
+   and the leading and trailing partial vectors are handled with masked
+   loads (see bli_axpyv_skx_int.c).
+
+   Complex vectors are processed as interleaved (real,imag) pairs. Two
+   accumulators per column collect the lane-wise products a_j * x and
+   a_j * x_s, where x_s has the real and imaginary parts of each element
+   swapped, and the real and imaginary parts of each dot product are sums
+   and differences of their even and odd lanes (see bli_dotv_skx_int.c).
+   As in the reference kernel, conjugation of A is handled by toggling the
+   conjugation of x and conjugating the results.
+
+   If b_n is not equal to the fusing factor, or if any of the vectors is
+   not stored contiguously, the operation is performed as a loop over
+   dotxv.
+*/
+
+// Accumulate a_j * x into rr_j, and a_j * x_s into ri_j for the complex
+// domain.
+#define DOTXF_SKX_COL( vtype, px, dim, j ) \
+{ \
+	const vtype av = _mm512_maskz_loadu_##px( k, ap + i + j*lda_r ); \
+\
+	rr##j = _mm512_fmadd_##px( av, xv, rr##j ); \
+	if ( dim == 2 ) \
+	ri##j = _mm512_fmadd_##px( av, xsv, ri##j ); \
+}
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf, vtype, mtype, px, nv, dim, swp, odd ) \
+\
+void PASTEMAC(ch,opname,arch,suf) \
+     ( \
+             conj_t  conjat, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   b_n, \
+       const void*   alpha0, \
+       const void*   a0, inc_t inca, inc_t lda, \
+       const void*   x0, inc_t incx, \
+       const void*   beta0, \
+             void*   y0, inc_t incy, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const dim_t fuse_fac = 8; \
+	const num_t dt       = PASTEMAC(ch,type); \
+\
+	const ctype* restrict alpha = alpha0; \
+	const ctype* restrict a     = a0; \
+	const ctype* restrict x     = x0; \
+	const ctype* restrict beta  = beta0; \
+	      ctype* restrict y     = y0; \
+\
+	/* If the b_n dimension is zero, y is empty and there is no
+	   computation. */ \
+	if ( bli_zero_dim1( b_n ) ) return; \
+\
+	/* If the m dimension is zero, or if alpha is zero, the computation
+	   simplifies to updating y. */ \
+	if ( bli_zero_dim1( m ) || bli_teq0s( ch, *alpha ) ) \
+	{ \
+		scalv_ker_ft kfp_sv = bli_cntx_get_ukr_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+		kfp_sv \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  b_n, \
+		  beta, \
+		  y, incy, \
+		  cntx  \
+		); \
+		return; \
+	} \
+\
+	/* If b_n is not equal to the fusing factor, or if the vectors are not
+	   contiguous, then perform the entire operation as a loop over
+	   dotxv. */ \
+	if ( b_n != fuse_fac || inca != 1 || incx != 1 ) \
+	{ \
+		dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+		for ( dim_t j = 0; j < b_n; ++j ) \
+		{ \
+			const ctype* restrict a1   = a + (0  )*inca + (j  )*lda; \
+			      ctype* restrict psi1 = y + (j  )*incy; \
+\
+			kfp_dv \
+			( \
+			  conjat, \
+			  conjx, \
+			  m, \
+			  alpha, \
+			  a1, inca, \
+			  x, incx, \
+			  beta, \
+			  psi1, \
+			  cntx  \
+			); \
+		} \
+		return; \
+	} \
+\
+	/* If a must be conjugated, we do so indirectly by first toggling the
+	   effective conjugation of x and then conjugating the resulting dot
+	   products. */ \
+	conj_t conjx_use = conjx; \
+	if ( bli_is_conj( conjat ) ) \
+		bli_toggle_conj( &conjx_use ); \
+\
+	/* The vectorized loop below indexes a and x by real elements. */ \
+	const ctype_r* restrict ap    = ( const ctype_r* )a; \
+	const ctype_r* restrict xp    = ( const ctype_r* )x; \
+	const dim_t             m_r   = dim*m; \
+	const inc_t             lda_r = dim*lda; \
+	const dim_t             m_pre = bli_min( m_r, dim*( ( -( uintptr_t )x & 63 ) / sizeof( ctype ) ) ); \
+\
+	vtype rr0 = _mm512_setzero_##px(), ri0 = _mm512_setzero_##px(); \
+	vtype rr1 = _mm512_setzero_##px(), ri1 = _mm512_setzero_##px(); \
+	vtype rr2 = _mm512_setzero_##px(), ri2 = _mm512_setzero_##px(); \
+	vtype rr3 = _mm512_setzero_##px(), ri3 = _mm512_setzero_##px(); \
+	vtype rr4 = _mm512_setzero_##px(), ri4 = _mm512_setzero_##px(); \
+	vtype rr5 = _mm512_setzero_##px(), ri5 = _mm512_setzero_##px(); \
+	vtype rr6 = _mm512_setzero_##px(), ri6 = _mm512_setzero_##px(); \
+	vtype rr7 = _mm512_setzero_##px(), ri7 = _mm512_setzero_##px(); \
+\
+	for ( dim_t i = 0, m_i; i < m_r; i += m_i ) \
+	{ \
+		m_i = ( i == 0 && m_pre > 0 ) ? m_pre : bli_min( nv, m_r - i ); \
+\
+		const mtype k = m_i == nv ? ( mtype )-1 : ( mtype )( ( 1u << m_i ) - 1 ); \
+\
+		const vtype xv  = _mm512_maskz_loadu_##px( k, xp + i ); \
+		const vtype xsv = _mm512_permute_##px( xv, swp ); \
+\
+		DOTXF_SKX_COL( vtype, px, dim, 0 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 1 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 2 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 3 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 4 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 5 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 6 ); \
+		DOTXF_SKX_COL( vtype, px, dim, 7 ); \
+	} \
+\
+	vtype rr[ 8 ] = { rr0, rr1, rr2, rr3, rr4, rr5, rr6, rr7 }; \
+	vtype ri[ 8 ] = { ri0, ri1, ri2, ri3, ri4, ri5, ri6, ri7 }; \
+\
+	for ( dim_t j = 0; j < fuse_fac; ++j ) \
+	{ \
+		ctype rho; \
+\
+		/* For the complex domain, the even and odd lanes of rr hold ar*xr
+		   and ai*xi, and those of ri hold ar*xi and ai*xr, respectively. */ \
+		if ( dim == 2 && bli_is_noconj( conjx_use ) ) \
+			rr[j] = _mm512_mask_sub_##px( rr[j], odd, _mm512_setzero_##px(), rr[j] ); \
+		else if ( dim == 2 ) \
+			ri[j] = _mm512_mask_sub_##px( ri[j], ( mtype )~odd, _mm512_setzero_##px(), ri[j] ); \
+\
+		ctype_r rho_r = _mm512_reduce_add_##px( rr[j] ); \
+		ctype_r rho_i = dim == 2 ? _mm512_reduce_add_##px( ri[j] ) : 0; \
+\
+		if ( bli_is_conj( conjat ) ) \
+			rho_i = -rho_i; \
+\
+		bli_tsets( ch,ch, rho_r, rho_i, rho ); \
+\
+		/* If beta is zero, overwrite y. Otherwise, scale by beta. */ \
+		ctype* restrict psi1 = y + j*incy; \
+\
+		if ( bli_teq0s( ch, *beta ) ) \
+		{ \
+			bli_tset0s( ch, *psi1 ); \
+		} \
+		else \
+		{ \
+			bli_tscals( ch,ch,ch, *beta, *psi1 ); \
+		} \
+\
+		bli_taxpys( ch,ch,ch,ch, *alpha, rho, *psi1 ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, dotxf, _skx, _int_8, __m512,  __mmask16, ps, 16, 1, 0,    0 )
+GENTFUNCR( double,   double, d, d, dotxf, _skx, _int_8, __m512d, __mmask8,  pd, 8,  1, 0,    0 )
+GENTFUNCR( scomplex, float,  c, s, dotxf, _skx, _int_8, __m512,  __mmask16, ps, 16, 2, 0xB1, 0xAAAA )
+GENTFUNCR( dcomplex, double, z, d, dotxf, _skx, _int_8, __m512d, __mmask8,  pd, 8,  2, 0x55, 0xAA )
+
@@ -0,0 +1,319 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Packing kernels for double precision on AVX-512 hardware, for use with
+   the 16x14 skx gemm and gemmtrsm microkernels.
+
+   Micropanels of up to 16 rows are packed from column-stored sources
+   (inca == 1) with a pair of masked zmm loads and stores per column. For
+   row-stored sources (lda == 1), 8x8 tiles are loaded one row at a time,
+   transposed in registers and stored as eight columns of the micropanel.
+   Sources with general stride, and broadcast packing, fall back to the
+   generic scalar code.
+*/
+
+#define MR 16
+#define NR 14
+
+// Transpose the 8x8 tile held in r0-r7 (one row per register). The columns
+// of the tile are left in t0-t7.
+#define TRANSPOSE_8X8 \
+\
+	t0 = _mm512_unpacklo_pd( r0, r1 ); \
+	t1 = _mm512_unpackhi_pd( r0, r1 ); \
+	t2 = _mm512_unpacklo_pd( r2, r3 ); \
+	t3 = _mm512_unpackhi_pd( r2, r3 ); \
+	t4 = _mm512_unpacklo_pd( r4, r5 ); \
+	t5 = _mm512_unpackhi_pd( r4, r5 ); \
+	t6 = _mm512_unpacklo_pd( r6, r7 ); \
+	t7 = _mm512_unpackhi_pd( r6, r7 ); \
+\
+	r0 = _mm512_shuffle_f64x2( t0, t2, 0x44 ); \
+	r1 = _mm512_shuffle_f64x2( t1, t3, 0x44 ); \
+	r2 = _mm512_shuffle_f64x2( t0, t2, 0xee ); \
+	r3 = _mm512_shuffle_f64x2( t1, t3, 0xee ); \
+	r4 = _mm512_shuffle_f64x2( t4, t6, 0x44 ); \
+	r5 = _mm512_shuffle_f64x2( t5, t7, 0x44 ); \
+	r6 = _mm512_shuffle_f64x2( t4, t6, 0xee ); \
+	r7 = _mm512_shuffle_f64x2( t5, t7, 0xee ); \
+\
+	t0 = _mm512_shuffle_f64x2( r0, r4, 0x88 ); \
+	t1 = _mm512_shuffle_f64x2( r1, r5, 0x88 ); \
+	t2 = _mm512_shuffle_f64x2( r0, r4, 0xdd ); \
+	t3 = _mm512_shuffle_f64x2( r1, r5, 0xdd ); \
+	t4 = _mm512_shuffle_f64x2( r2, r6, 0x88 ); \
+	t5 = _mm512_shuffle_f64x2( r3, r7, 0x88 ); \
+	t6 = _mm512_shuffle_f64x2( r2, r6, 0xdd ); \
+	t7 = _mm512_shuffle_f64x2( r3, r7, 0xdd );
+
+#define LOAD_ROW( i ) \
+	r##i = _mm512_loadu_pd( ar##i + k );
+
+#define LOAD_ROW_MASK( i ) \
+	r##i = _mm512_maskz_loadu_pd( mk, ar##i + k );
+
+#define STORE_COL( j ) \
+	if ( j < nk ) \
+		_mm512_mask_storeu_pd( pi + ( k + j )*ldp, mi, _mm512_mul_pd( kv, t##j ) );
+
+#define FOR_EACH_8( f ) \
+	f( 0 ) f( 1 ) f( 2 ) f( 3 ) f( 4 ) f( 5 ) f( 6 ) f( 7 )
+
+void bli_dpackm_skx_int_16x14
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const double* restrict a  = a0;
+	      double* restrict p  = p0;
+	const __m512d          kv = _mm512_set1_pd( *( const double* )kappa );
+
+	if ( cdim_bcast == 1 && cdim <= MR && inca == 1 )
+	{
+		// Full micropanels are copied with unmasked loads and stores;
+		// masked accesses that straddle cache lines are comparatively slow.
+		if ( cdim == MR )
+		{
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const double* restrict ak = a + k*lda;
+				      double* restrict pk = p + k*ldp;
+
+				_mm512_storeu_pd( pk + 0, _mm512_mul_pd( kv, _mm512_loadu_pd( ak + 0 ) ) );
+				_mm512_storeu_pd( pk + 8, _mm512_mul_pd( kv, _mm512_loadu_pd( ak + 8 ) ) );
+			}
+		}
+		else if ( cdim == NR )
+		{
+			const __m256d kv4 = _mm512_castpd512_pd256( kv );
+			const __m128d kv2 = _mm512_castpd512_pd128( kv );
+
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const double* restrict ak = a + k*lda;
+				      double* restrict pk = p + k*ldp;
+
+				_mm512_storeu_pd( pk +  0, _mm512_mul_pd( kv,  _mm512_loadu_pd( ak +  0 ) ) );
+				_mm256_storeu_pd( pk +  8, _mm256_mul_pd( kv4, _mm256_loadu_pd( ak +  8 ) ) );
+				_mm_storeu_pd   ( pk + 12, _mm_mul_pd   ( kv2, _mm_loadu_pd   ( ak + 12 ) ) );
+			}
+		}
+		else
+		{
+			const __mmask8 m0 = ( 1u << bli_min( cdim,     8 ) ) - 1;
+			const __mmask8 m1 = ( 1u << bli_max( cdim - 8, 0 ) ) - 1;
+
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const double* restrict ak = a + k*lda;
+				      double* restrict pk = p + k*ldp;
+
+				_mm512_mask_storeu_pd( pk + 0, m0, _mm512_mul_pd( kv, _mm512_maskz_loadu_pd( m0, ak + 0 ) ) );
+				_mm512_mask_storeu_pd( pk + 8, m1, _mm512_mul_pd( kv, _mm512_maskz_loadu_pd( m1, ak + 8 ) ) );
+			}
+		}
+	}
+	else if ( cdim_bcast == 1 && cdim <= MR && lda == 1 )
+	{
+		__m512d r0, r1, r2, r3, r4, r5, r6, r7;
+		__m512d t0, t1, t2, t3, t4, t5, t6, t7;
+
+		for ( dim_t k = 0; k < n; k += 8 )
+		{
+			const dim_t    nk = bli_min( n - k, 8 );
+			const __mmask8 mk = ( 1u << nk ) - 1;
+
+			for ( dim_t i = 0; i < cdim; i += 8 )
+			{
+				const dim_t            m_i = bli_min( cdim - i, 8 );
+				const __mmask8         mi  = ( 1u << m_i ) - 1;
+				      double* restrict pi  = p + i;
+
+				// Rows beyond the edge of the micropanel alias the last row
+				// and are discarded by the masked stores.
+				const double* restrict ar0 = a + ( i + bli_min( 0, m_i - 1 ) )*inca;
+				const double* restrict ar1 = a + ( i + bli_min( 1, m_i - 1 ) )*inca;
+				const double* restrict ar2 = a + ( i + bli_min( 2, m_i - 1 ) )*inca;
+				const double* restrict ar3 = a + ( i + bli_min( 3, m_i - 1 ) )*inca;
+				const double* restrict ar4 = a + ( i + bli_min( 4, m_i - 1 ) )*inca;
+				const double* restrict ar5 = a + ( i + bli_min( 5, m_i - 1 ) )*inca;
+				const double* restrict ar6 = a + ( i + bli_min( 6, m_i - 1 ) )*inca;
+				const double* restrict ar7 = a + ( i + bli_min( 7, m_i - 1 ) )*inca;
+
+				if ( nk == 8 ) { FOR_EACH_8( LOAD_ROW ) }
+				else           { FOR_EACH_8( LOAD_ROW_MASK ) }
+
+				TRANSPOSE_8X8
+				FOR_EACH_8( STORE_COL )
+			}
+		}
+	}
+	else
+	{
+		bli_dscal2bbs_mxn
+		(
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a,       inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_dset0s_edge
+	(
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p, ldp
+	);
+}
+
+void bli_dpackm_diag_skx_int_16x14
+     (
+             struc_t struca,
+             diag_t  diaga,
+             uplo_t  uploa,
+             conj_t  conja,
+             pack_t  schema,
+             bool    invdiag,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const double* restrict a       = a0;
+	      double* restrict p       = p0;
+	const double           kappa_r = *( const double* )kappa;
+	const bool             refl    = bli_is_herm_or_symm( struca );
+	const bool             lower   = bli_is_lower( uploa );
+
+	if ( cdim_bcast == 1 && cdim_max <= MR )
+	{
+		double pt[ MR * MR ];
+
+		// Pack the whole diagonal block as though it were dense (this also
+		// zeroes the edges of p). For symmetric and Hermitian matrices, also
+		// pack its transpose, from which the unstored triangle is taken.
+		bli_dpackm_skx_int_16x14
+		(
+		  conja, schema, cdim, cdim_max, 1, cdim, n_max,
+		  kappa, a, inca, lda, p, ldp, params, cntx
+		);
+
+		if ( refl )
+			bli_dpackm_skx_int_16x14
+			(
+			  conja, schema, cdim, cdim, 1, cdim, cdim,
+			  kappa, a, lda, inca, pt, MR, params, cntx
+			);
+
+		const uint64_t mall = ( 1ull << cdim ) - 1;
+
+		for ( dim_t k = 0; k < cdim; ++k )
+		{
+			      double* restrict pk    = p  + k*ldp;
+			const double* restrict ptk   = pt + k*MR;
+			const uint64_t         below = mall & ~( ( 2ull << k ) - 1 );
+			const uint64_t         above = ( 1ull << k ) - 1;
+			const uint64_t         other = lower ? above : below;
+
+			for ( dim_t h = 0; h < cdim; h += 8 )
+			{
+				const __mmask8 mh = mall  >> h;
+				const __mmask8 mo = other >> h;
+				      __m512d  v  = _mm512_maskz_loadu_pd( mh, pk + h );
+
+				if ( refl ) v = _mm512_mask_loadu_pd( v, mo, ptk + h );
+				else        v = _mm512_mask_mov_pd( v, mo, _mm512_setzero_pd() );
+
+				_mm512_mask_storeu_pd( pk + h, mh, v );
+			}
+
+			double alpha11 = bli_is_unit_diag( diaga ) ? kappa_r : pk[ k ];
+			if ( invdiag ) alpha11 = 1.0 / alpha11;
+			pk[ k ] = alpha11;
+		}
+	}
+	else
+	{
+		bli_tset0s_mxn( d, cdim_max*cdim_bcast, n_max, p, 1, ldp );
+
+		for ( dim_t k = 0; k < cdim; ++k )
+		for ( dim_t i = 0; i < cdim; ++i )
+		{
+			double alpha;
+
+			if ( i == k )
+			{
+				alpha = bli_is_unit_diag( diaga ) ? kappa_r
+				                                  : kappa_r * a[ k*inca + k*lda ];
+				if ( invdiag ) alpha = 1.0 / alpha;
+			}
+			else if ( ( i > k ) == lower ) alpha = kappa_r * a[ i*inca + k*lda ];
+			else if ( refl )               alpha = kappa_r * a[ k*inca + i*lda ];
+			else                           continue;
+
+			for ( dim_t d = 0; d < cdim_bcast; ++d )
+				p[ i*cdim_bcast + d + k*ldp ] = alpha;
+		}
+	}
+
+	// If this is an edge case in both directions, extend the diagonal
+	// with ones.
+	for ( dim_t k = cdim; k < bli_min( cdim_max, n_max ); ++k )
+	for ( dim_t d = 0; d < cdim_bcast; ++d )
+		p[ k*cdim_bcast + d + k*ldp ] = 1.0;
+}
@@ -0,0 +1,340 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Packing kernels for the reduced-precision gemm operations (bli_sbgemm(),
+   bli_shgemm()) on AVX-512 hardware, for use with the 32x12 skx microkernels.
+
+   The sb and sh kernels convert bfloat16 and float16 elements to single
+   precision as they are packed, producing the same micropanels as
+   bli_spackm_skx_int_32x12(), which are then consumed by the sgemm
+   microkernel.
+
+   The sb "dpbf16" kernel instead keeps the elements in bfloat16 and
+   interleaves pairs of k indices (see bli_gemm_lp.h), the format consumed
+   by bli_sbgemm_skx_asm_32x12_l2(). Each pair occupies one 32-bit word, so
+   a micropanel of pairs can be packed just like a single-precision
+   micropanel of words. This kernel does not apply kappa, which is always
+   one since alpha is applied by the microkernel.
+
+   Column-stored sources (inca == 1) are converted 16 rows at a time with
+   masked loads and stores. For row-stored sources (lda == 1), 8x8 tiles of
+   32-bit values are transposed in registers. Sources with general stride,
+   and broadcast packing, fall back to scalar code.
+*/
+
+#define MR 32
+
+// Transpose the 8x8 tile held in r0-r7 (one row per register). The columns
+// of the tile are left in t0-t7.
+#define TRANSPOSE_8X8 \
+\
+	t0 = _mm256_unpacklo_ps( r0, r1 ); \
+	t1 = _mm256_unpackhi_ps( r0, r1 ); \
+	t2 = _mm256_unpacklo_ps( r2, r3 ); \
+	t3 = _mm256_unpackhi_ps( r2, r3 ); \
+	t4 = _mm256_unpacklo_ps( r4, r5 ); \
+	t5 = _mm256_unpackhi_ps( r4, r5 ); \
+	t6 = _mm256_unpacklo_ps( r6, r7 ); \
+	t7 = _mm256_unpackhi_ps( r6, r7 ); \
+\
+	r0 = _mm256_shuffle_ps( t0, t2, 0x44 ); \
+	r1 = _mm256_shuffle_ps( t0, t2, 0xee ); \
+	r2 = _mm256_shuffle_ps( t1, t3, 0x44 ); \
+	r3 = _mm256_shuffle_ps( t1, t3, 0xee ); \
+	r4 = _mm256_shuffle_ps( t4, t6, 0x44 ); \
+	r5 = _mm256_shuffle_ps( t4, t6, 0xee ); \
+	r6 = _mm256_shuffle_ps( t5, t7, 0x44 ); \
+	r7 = _mm256_shuffle_ps( t5, t7, 0xee ); \
+\
+	t0 = _mm256_permute2f128_ps( r0, r4, 0x20 ); \
+	t1 = _mm256_permute2f128_ps( r1, r5, 0x20 ); \
+	t2 = _mm256_permute2f128_ps( r2, r6, 0x20 ); \
+	t3 = _mm256_permute2f128_ps( r3, r7, 0x20 ); \
+	t4 = _mm256_permute2f128_ps( r0, r4, 0x31 ); \
+	t5 = _mm256_permute2f128_ps( r1, r5, 0x31 ); \
+	t6 = _mm256_permute2f128_ps( r2, r6, 0x31 ); \
+	t7 = _mm256_permute2f128_ps( r3, r7, 0x31 );
+
+#define FOR_EACH_8( f ) \
+	f( 0 ) f( 1 ) f( 2 ) f( 3 ) f( 4 ) f( 5 ) f( 6 ) f( 7 )
+
+// Widen 16 (8) bfloat16 or float16 values to single precision.
+#define CVT16_SB( x ) _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_cvtepu16_epi32( x ), 16 ) )
+#define CVT8_SB( x )  _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( x ), 16 ) )
+#define CVT16_SH( x ) _mm512_cvtph_ps( x )
+#define CVT8_SH( x )  _mm256_cvtph_ps( x )
+
+#define STORE_COL_CVT( j ) \
+	if ( j < nk ) \
+		_mm256_mask_storeu_ps( pi + ( k + j )*ldp, mi, _mm256_mul_ps( kv8, t##j ) );
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, cvt16, cvt8, tofloat ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   cdim_bcast, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a0, inc_t inca, inc_t lda, \
+             void*   p0,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx \
+     ) \
+{ \
+	const ctype* restrict a       = a0; \
+	      float* restrict p       = p0; \
+	const float           kappa_r = *( const float* )kappa; \
+	const __m512          kv      = _mm512_set1_ps( kappa_r ); \
+\
+	if ( cdim_bcast == 1 && cdim <= MR && inca == 1 ) \
+	{ \
+		const __mmask16 m0 = ( 1u << bli_min( cdim,      16 ) ) - 1; \
+		const __mmask16 m1 = ( 1u << bli_max( cdim - 16, 0  ) ) - 1; \
+\
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			const ctype* restrict ak = a + k*lda; \
+			      float* restrict pk = p + k*ldp; \
+\
+			const __m512 v0 = cvt16( _mm256_maskz_loadu_epi16( m0, ak +  0 ) ); \
+			_mm512_mask_storeu_ps( pk +  0, m0, _mm512_mul_ps( kv, v0 ) ); \
+\
+			if ( m1 ) \
+			{ \
+				const __m512 v1 = cvt16( _mm256_maskz_loadu_epi16( m1, ak + 16 ) ); \
+				_mm512_mask_storeu_ps( pk + 16, m1, _mm512_mul_ps( kv, v1 ) ); \
+			} \
+		} \
+	} \
+	else if ( cdim_bcast == 1 && cdim <= MR && lda == 1 ) \
+	{ \
+		const __m256 kv8 = _mm512_castps512_ps256( kv ); \
+\
+		__m256 r0, r1, r2, r3, r4, r5, r6, r7; \
+		__m256 t0, t1, t2, t3, t4, t5, t6, t7; \
+\
+		for ( dim_t k = 0; k < n; k += 8 ) \
+		{ \
+			const dim_t    nk = bli_min( n - k, 8 ); \
+			const __mmask8 mk = ( 1u << nk ) - 1; \
+\
+			for ( dim_t i = 0; i < cdim; i += 8 ) \
+			{ \
+				const dim_t           m_i = bli_min( cdim - i, 8 ); \
+				const __mmask8        mi  = ( 1u << m_i ) - 1; \
+				      float* restrict pi  = p + i; \
+\
+				/* Rows beyond the edge of the micropanel alias the last row
+				   and are discarded by the masked stores. */ \
+				const ctype* restrict ar0 = a + ( i + bli_min( 0, m_i - 1 ) )*inca; \
+				const ctype* restrict ar1 = a + ( i + bli_min( 1, m_i - 1 ) )*inca; \
+				const ctype* restrict ar2 = a + ( i + bli_min( 2, m_i - 1 ) )*inca; \
+				const ctype* restrict ar3 = a + ( i + bli_min( 3, m_i - 1 ) )*inca; \
+				const ctype* restrict ar4 = a + ( i + bli_min( 4, m_i - 1 ) )*inca; \
+				const ctype* restrict ar5 = a + ( i + bli_min( 5, m_i - 1 ) )*inca; \
+				const ctype* restrict ar6 = a + ( i + bli_min( 6, m_i - 1 ) )*inca; \
+				const ctype* restrict ar7 = a + ( i + bli_min( 7, m_i - 1 ) )*inca; \
+\
+				r0 = cvt8( _mm_maskz_loadu_epi16( mk, ar0 + k ) ); \
+				r1 = cvt8( _mm_maskz_loadu_epi16( mk, ar1 + k ) ); \
+				r2 = cvt8( _mm_maskz_loadu_epi16( mk, ar2 + k ) ); \
+				r3 = cvt8( _mm_maskz_loadu_epi16( mk, ar3 + k ) ); \
+				r4 = cvt8( _mm_maskz_loadu_epi16( mk, ar4 + k ) ); \
+				r5 = cvt8( _mm_maskz_loadu_epi16( mk, ar5 + k ) ); \
+				r6 = cvt8( _mm_maskz_loadu_epi16( mk, ar6 + k ) ); \
+				r7 = cvt8( _mm_maskz_loadu_epi16( mk, ar7 + k ) ); \
+\
+				TRANSPOSE_8X8 \
+				FOR_EACH_8( STORE_COL_CVT ) \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		for ( dim_t i = 0; i < cdim; ++i ) \
+		{ \
+			const float alpha = kappa_r * tofloat( a[ i*inca + k*lda ] ); \
+\
+			for ( dim_t d = 0; d < cdim_bcast; ++d ) \
+				p[ i*cdim_bcast + d + k*ldp ] = alpha; \
+		} \
+	} \
+\
+	bli_sset0s_edge \
+	( \
+	  cdim*cdim_bcast, cdim_max*cdim_bcast, \
+	  n, n_max, \
+	  p, ldp \
+	); \
+}
+
+GENTFUNC( bfloat16, sb, packm_skx_int_32x12, CVT16_SB, CVT8_SB, bli_bf16_to_float )
+GENTFUNC( float16,  sh, packm_skx_int_32x12, CVT16_SH, CVT8_SH, bli_f16_to_float )
+
+
+// Load (part of) a row of 8 pairs of the source as 32-bit words.
+#define LOAD_ROW_PAIR( i ) \
+	r##i = _mm256_castsi256_ps( _mm256_maskz_loadu_epi16( mk, ar##i + 2*k ) );
+
+#define STORE_COL_PAIR( j ) \
+	if ( j < nk ) \
+		_mm256_mask_storeu_ps( pi + ( k + j )*ldp, mi, t##j );
+
+void bli_sbpackm_skx_int_32x12_dpbf16
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const uint16_t* restrict a  = a0;
+	      float*    restrict p  = p0;
+	const dim_t              n2 = ( n + 1 ) / 2;
+
+	// NOTE: Within the loops below, p is addressed in units of pairs (i.e.
+	// 32-bit words), so that pair l of row i is found at p[ i + l*ldp ].
+
+	if ( cdim_bcast == 1 && cdim <= MR && inca == 1 )
+	{
+		const __mmask16 m0 = ( 1u << bli_min( cdim,      16 ) ) - 1;
+		const __mmask16 m1 = ( 1u << bli_max( cdim - 16, 0  ) ) - 1;
+
+		for ( dim_t l = 0; l < n2; ++l )
+		{
+			const uint16_t* restrict ak0 = a + ( 2*l     )*lda;
+			const uint16_t* restrict ak1 = a + ( 2*l + 1 )*lda;
+			      float*    restrict pl  = p + l*ldp;
+			const bool               odd = 2*l + 1 == n;
+
+			for ( dim_t h = 0; h < 2; ++h )
+			{
+				const __mmask16 mh = h == 0 ? m0 : m1;
+				if ( !mh ) break;
+
+				__m512i v0 = _mm512_cvtepu16_epi32( _mm256_maskz_loadu_epi16( mh, ak0 + 16*h ) );
+				if ( !odd )
+				{
+					const __m512i v1 = _mm512_cvtepu16_epi32( _mm256_maskz_loadu_epi16( mh, ak1 + 16*h ) );
+					v0 = _mm512_or_si512( v0, _mm512_slli_epi32( v1, 16 ) );
+				}
+
+				_mm512_mask_storeu_ps( pl + 16*h, mh, _mm512_castsi512_ps( v0 ) );
+			}
+		}
+	}
+	else if ( cdim_bcast == 1 && cdim <= MR && lda == 1 )
+	{
+		__m256 r0, r1, r2, r3, r4, r5, r6, r7;
+		__m256 t0, t1, t2, t3, t4, t5, t6, t7;
+
+		// Here k counts pairs; the final pair of an odd n is loaded with its
+		// second element masked to zero.
+		for ( dim_t k = 0; k < n2; k += 8 )
+		{
+			const dim_t     nk = bli_min( n2 - k, 8 );
+			const dim_t     ne = bli_min( n - 2*k, 16 );
+			const __mmask16 mk = ( 1u << ne ) - 1;
+
+			for ( dim_t i = 0; i < cdim; i += 8 )
+			{
+				const dim_t              m_i = bli_min( cdim - i, 8 );
+				const __mmask8           mi  = ( 1u << m_i ) - 1;
+				      float*    restrict pi  = p + i;
+
+				// Rows beyond the edge of the micropanel alias the last row
+				// and are discarded by the masked stores.
+				const uint16_t* restrict ar0 = a + ( i + bli_min( 0, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar1 = a + ( i + bli_min( 1, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar2 = a + ( i + bli_min( 2, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar3 = a + ( i + bli_min( 3, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar4 = a + ( i + bli_min( 4, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar5 = a + ( i + bli_min( 5, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar6 = a + ( i + bli_min( 6, m_i - 1 ) )*inca;
+				const uint16_t* restrict ar7 = a + ( i + bli_min( 7, m_i - 1 ) )*inca;
+
+				FOR_EACH_8( LOAD_ROW_PAIR )
+				TRANSPOSE_8X8
+				FOR_EACH_8( STORE_COL_PAIR )
+			}
+		}
+	}
+	else
+	{
+		uint16_t* restrict p16 = p0;
+
+		for ( dim_t l = 0; l < n2; ++l )
+		for ( dim_t i = 0; i < cdim; ++i )
+		{
+			const uint16_t lo = a[ i*inca + ( 2*l )*lda ];
+			const uint16_t hi = 2*l + 1 < n ? a[ i*inca + ( 2*l + 1 )*lda ] : 0;
+
+			for ( dim_t d = 0; d < cdim_bcast; ++d )
+			{
+				p16[ 2*( i*cdim_bcast + d ) + 0 + 2*l*ldp ] = lo;
+				p16[ 2*( i*cdim_bcast + d ) + 1 + 2*l*ldp ] = hi;
+			}
+		}
+	}
+
+	// Zero the edges, treating each pair as a single 32-bit word. The padded
+	// length n_max is always a whole number of pairs.
+	bli_sset0s_edge
+	(
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n2, n_max / 2,
+	  p, ldp
+	);
+}
+
@@ -0,0 +1,321 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Packing kernels for single precision on AVX-512 hardware, for use with
+   the 32x12 skx gemm and gemmtrsm microkernels.
+
+   Micropanels of up to 32 rows are packed from column-stored sources
+   (inca == 1) with a pair of masked zmm loads and stores per column. For
+   row-stored sources (lda == 1), 8x8 tiles are loaded one row at a time
+   into ymm registers, transposed in registers and stored as eight columns
+   of the micropanel.
+   Sources with general stride, and broadcast packing, fall back to the
+   generic scalar code.
+*/
+
+#define MR 32
+#define NR 12
+
+// Transpose the 8x8 tile held in r0-r7 (one row per register). The columns
+// of the tile are left in t0-t7.
+#define TRANSPOSE_8X8 \
+\
+	t0 = _mm256_unpacklo_ps( r0, r1 ); \
+	t1 = _mm256_unpackhi_ps( r0, r1 ); \
+	t2 = _mm256_unpacklo_ps( r2, r3 ); \
+	t3 = _mm256_unpackhi_ps( r2, r3 ); \
+	t4 = _mm256_unpacklo_ps( r4, r5 ); \
+	t5 = _mm256_unpackhi_ps( r4, r5 ); \
+	t6 = _mm256_unpacklo_ps( r6, r7 ); \
+	t7 = _mm256_unpackhi_ps( r6, r7 ); \
+\
+	r0 = _mm256_shuffle_ps( t0, t2, 0x44 ); \
+	r1 = _mm256_shuffle_ps( t0, t2, 0xee ); \
+	r2 = _mm256_shuffle_ps( t1, t3, 0x44 ); \
+	r3 = _mm256_shuffle_ps( t1, t3, 0xee ); \
+	r4 = _mm256_shuffle_ps( t4, t6, 0x44 ); \
+	r5 = _mm256_shuffle_ps( t4, t6, 0xee ); \
+	r6 = _mm256_shuffle_ps( t5, t7, 0x44 ); \
+	r7 = _mm256_shuffle_ps( t5, t7, 0xee ); \
+\
+	t0 = _mm256_permute2f128_ps( r0, r4, 0x20 ); \
+	t1 = _mm256_permute2f128_ps( r1, r5, 0x20 ); \
+	t2 = _mm256_permute2f128_ps( r2, r6, 0x20 ); \
+	t3 = _mm256_permute2f128_ps( r3, r7, 0x20 ); \
+	t4 = _mm256_permute2f128_ps( r0, r4, 0x31 ); \
+	t5 = _mm256_permute2f128_ps( r1, r5, 0x31 ); \
+	t6 = _mm256_permute2f128_ps( r2, r6, 0x31 ); \
+	t7 = _mm256_permute2f128_ps( r3, r7, 0x31 );
+
+#define LOAD_ROW( i ) \
+	r##i = _mm256_loadu_ps( ar##i + k );
+
+#define LOAD_ROW_MASK( i ) \
+	r##i = _mm256_maskz_loadu_ps( mk, ar##i + k );
+
+#define STORE_COL( j ) \
+	if ( j < nk ) \
+		_mm256_mask_storeu_ps( pi + ( k + j )*ldp, mi, _mm256_mul_ps( kv8, t##j ) );
+
+#define FOR_EACH_8( f ) \
+	f( 0 ) f( 1 ) f( 2 ) f( 3 ) f( 4 ) f( 5 ) f( 6 ) f( 7 )
+
+void bli_spackm_skx_int_32x12
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const float* restrict a  = a0;
+	      float* restrict p  = p0;
+	const __m512           kv = _mm512_set1_ps( *( const float* )kappa );
+
+	if ( cdim_bcast == 1 && cdim <= MR && inca == 1 )
+	{
+		// Full micropanels are copied with unmasked loads and stores;
+		// masked accesses that straddle cache lines are comparatively slow.
+		if ( cdim == MR )
+		{
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const float* restrict ak = a + k*lda;
+				      float* restrict pk = p + k*ldp;
+
+				_mm512_storeu_ps( pk +  0, _mm512_mul_ps( kv, _mm512_loadu_ps( ak +  0 ) ) );
+				_mm512_storeu_ps( pk + 16, _mm512_mul_ps( kv, _mm512_loadu_ps( ak + 16 ) ) );
+			}
+		}
+		else if ( cdim == NR )
+		{
+			const __m256 kv8 = _mm512_castps512_ps256( kv );
+			const __m128 kv4 = _mm512_castps512_ps128( kv );
+
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const float* restrict ak = a + k*lda;
+				      float* restrict pk = p + k*ldp;
+
+				_mm256_storeu_ps( pk + 0, _mm256_mul_ps( kv8, _mm256_loadu_ps( ak + 0 ) ) );
+				_mm_storeu_ps   ( pk + 8, _mm_mul_ps   ( kv4, _mm_loadu_ps   ( ak + 8 ) ) );
+			}
+		}
+		else
+		{
+			const __mmask16 m0 = ( 1u << bli_min( cdim,      16 ) ) - 1;
+			const __mmask16 m1 = ( 1u << bli_max( cdim - 16, 0  ) ) - 1;
+
+			for ( dim_t k = 0; k < n; ++k )
+			{
+				const float* restrict ak = a + k*lda;
+				      float* restrict pk = p + k*ldp;
+
+				_mm512_mask_storeu_ps( pk +  0, m0, _mm512_mul_ps( kv, _mm512_maskz_loadu_ps( m0, ak +  0 ) ) );
+				_mm512_mask_storeu_ps( pk + 16, m1, _mm512_mul_ps( kv, _mm512_maskz_loadu_ps( m1, ak + 16 ) ) );
+			}
+		}
+	}
+	else if ( cdim_bcast == 1 && cdim <= MR && lda == 1 )
+	{
+		const __m256 kv8 = _mm512_castps512_ps256( kv );
+
+		__m256 r0, r1, r2, r3, r4, r5, r6, r7;
+		__m256 t0, t1, t2, t3, t4, t5, t6, t7;
+
+		for ( dim_t k = 0; k < n; k += 8 )
+		{
+			const dim_t    nk = bli_min( n - k, 8 );
+			const __mmask8 mk = ( 1u << nk ) - 1;
+
+			for ( dim_t i = 0; i < cdim; i += 8 )
+			{
+				const dim_t           m_i = bli_min( cdim - i, 8 );
+				const __mmask8        mi  = ( 1u << m_i ) - 1;
+				      float* restrict pi  = p + i;
+
+				// Rows beyond the edge of the micropanel alias the last row
+				// and are discarded by the masked stores.
+				const float* restrict ar0 = a + ( i + bli_min( 0, m_i - 1 ) )*inca;
+				const float* restrict ar1 = a + ( i + bli_min( 1, m_i - 1 ) )*inca;
+				const float* restrict ar2 = a + ( i + bli_min( 2, m_i - 1 ) )*inca;
+				const float* restrict ar3 = a + ( i + bli_min( 3, m_i - 1 ) )*inca;
+				const float* restrict ar4 = a + ( i + bli_min( 4, m_i - 1 ) )*inca;
+				const float* restrict ar5 = a + ( i + bli_min( 5, m_i - 1 ) )*inca;
+				const float* restrict ar6 = a + ( i + bli_min( 6, m_i - 1 ) )*inca;
+				const float* restrict ar7 = a + ( i + bli_min( 7, m_i - 1 ) )*inca;
+
+				if ( nk == 8 ) { FOR_EACH_8( LOAD_ROW ) }
+				else           { FOR_EACH_8( LOAD_ROW_MASK ) }
+
+				TRANSPOSE_8X8
+				FOR_EACH_8( STORE_COL )
+			}
+		}
+	}
+	else
+	{
+		bli_sscal2bbs_mxn
+		(
+		  conja,
+		  cdim,
+		  n,
+		  kappa,
+		  a,       inca, lda,
+		  p, cdim_bcast, ldp
+		);
+	}
+
+	bli_sset0s_edge
+	(
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n, n_max,
+	  p, ldp
+	);
+}
+
+void bli_spackm_diag_skx_int_32x12
+     (
+             struc_t struca,
+             diag_t  diaga,
+             uplo_t  uploa,
+             conj_t  conja,
+             pack_t  schema,
+             bool    invdiag,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const float* restrict a       = a0;
+	      float* restrict p       = p0;
+	const float           kappa_r = *( const float* )kappa;
+	const bool             refl    = bli_is_herm_or_symm( struca );
+	const bool             lower   = bli_is_lower( uploa );
+
+	if ( cdim_bcast == 1 && cdim_max <= MR )
+	{
+		float pt[ MR * MR ];
+
+		// Pack the whole diagonal block as though it were dense (this also
+		// zeroes the edges of p). For symmetric and Hermitian matrices, also
+		// pack its transpose, from which the unstored triangle is taken.
+		bli_spackm_skx_int_32x12
+		(
+		  conja, schema, cdim, cdim_max, 1, cdim, n_max,
+		  kappa, a, inca, lda, p, ldp, params, cntx
+		);
+
+		if ( refl )
+			bli_spackm_skx_int_32x12
+			(
+			  conja, schema, cdim, cdim, 1, cdim, cdim,
+			  kappa, a, lda, inca, pt, MR, params, cntx
+			);
+
+		const uint64_t mall = ( 1ull << cdim ) - 1;
+
+		for ( dim_t k = 0; k < cdim; ++k )
+		{
+			      float* restrict pk    = p  + k*ldp;
+			const float* restrict ptk   = pt + k*MR;
+			const uint64_t         below = mall & ~( ( 2ull << k ) - 1 );
+			const uint64_t         above = ( 1ull << k ) - 1;
+			const uint64_t         other = lower ? above : below;
+
+			for ( dim_t h = 0; h < cdim; h += 16 )
+			{
+				const __mmask16 mh = mall  >> h;
+				const __mmask16 mo = other >> h;
+				      __m512    v  = _mm512_maskz_loadu_ps( mh, pk + h );
+
+				if ( refl ) v = _mm512_mask_loadu_ps( v, mo, ptk + h );
+				else        v = _mm512_mask_mov_ps( v, mo, _mm512_setzero_ps() );
+
+				_mm512_mask_storeu_ps( pk + h, mh, v );
+			}
+
+			float alpha11 = bli_is_unit_diag( diaga ) ? kappa_r : pk[ k ];
+			if ( invdiag ) alpha11 = 1.0f / alpha11;
+			pk[ k ] = alpha11;
+		}
+	}
+	else
+	{
+		bli_tset0s_mxn( s, cdim_max*cdim_bcast, n_max, p, 1, ldp );
+
+		for ( dim_t k = 0; k < cdim; ++k )
+		for ( dim_t i = 0; i < cdim; ++i )
+		{
+			float alpha;
+
+			if ( i == k )
+			{
+				alpha = bli_is_unit_diag( diaga ) ? kappa_r
+				                                  : kappa_r * a[ k*inca + k*lda ];
+				if ( invdiag ) alpha = 1.0f / alpha;
+			}
+			else if ( ( i > k ) == lower ) alpha = kappa_r * a[ i*inca + k*lda ];
+			else if ( refl )               alpha = kappa_r * a[ k*inca + i*lda ];
+			else                           continue;
+
+			for ( dim_t d = 0; d < cdim_bcast; ++d )
+				p[ i*cdim_bcast + d + k*ldp ] = alpha;
+		}
+	}
+
+	// If this is an edge case in both directions, extend the diagonal
+	// with ones.
+	for ( dim_t k = cdim; k < bli_min( cdim_max, n_max ); ++k )
+	for ( dim_t d = 0; d < cdim_bcast; ++d )
+		p[ k*cdim_bcast + d + k*ldp ] = 1.0f;
+}
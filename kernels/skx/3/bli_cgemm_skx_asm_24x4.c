@@ -0,0 +1,329 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "bli_x86_asm_macros.h"
+
+#define A_L1_PREFETCH_DIST 4 // in units of k iterations
+#define B_L1_PREFETCH_DIST 4
+
+#define PREFETCH_A_L1(n) \
+    PREFETCH(0, MEM(RAX, (A_L1_PREFETCH_DIST+n)*24*8 +   0)) \
+    PREFETCH(0, MEM(RAX, (A_L1_PREFETCH_DIST+n)*24*8 +  64)) \
+    PREFETCH(0, MEM(RAX, (A_L1_PREFETCH_DIST+n)*24*8 + 128))
+#define PREFETCH_B_L1(n) \
+    PREFETCH(0, MEM(RBX, (B_L1_PREFETCH_DIST+n)*4*8))
+
+#define LOOP_ALIGN ALIGN32
+
+//
+// The accumulators are organized as follows, for each column j of the
+// microtile (j = 0..3):
+//
+//   ZMM(8+6*j+0..2) += a(0:23,l) * real( b(l,j) )
+//   ZMM(8+6*j+3..5) += a(0:23,l) * imag( b(l,j) )
+//
+// After the k loop, the second set is permuted so that the real and
+// imaginary parts of each element are swapped, and the two sets are
+// combined with fmaddsub to form the complex products.
+//
+
+#define SUBITER_COL(n,j,R0,R1,R2,I0,I1,I2) \
+\
+    VBROADCASTSS(ZMM(3), MEM(RBX,(8*n+2*j+0)*4)) \
+    VBROADCASTSS(ZMM(4), MEM(RBX,(8*n+2*j+1)*4)) \
+    VFMADD231PS(ZMM(R0), ZMM(0), ZMM(3)) \
+    VFMADD231PS(ZMM(R1), ZMM(1), ZMM(3)) \
+    VFMADD231PS(ZMM(R2), ZMM(2), ZMM(3)) \
+    VFMADD231PS(ZMM(I0), ZMM(0), ZMM(4)) \
+    VFMADD231PS(ZMM(I1), ZMM(1), ZMM(4)) \
+    VFMADD231PS(ZMM(I2), ZMM(2), ZMM(4))
+
+#define SUBITER(n) \
+\
+    VMOVAPS(ZMM(0), MEM(RAX,(48*n+ 0)*4)) \
+    VMOVAPS(ZMM(1), MEM(RAX,(48*n+16)*4)) \
+    VMOVAPS(ZMM(2), MEM(RAX,(48*n+32)*4)) \
+    \
+    PREFETCH_A_L1(n) \
+    \
+    SUBITER_COL(n,0, 8, 9,10,11,12,13) \
+    SUBITER_COL(n,1,14,15,16,17,18,19) \
+    \
+    PREFETCH_B_L1(n) \
+    \
+    SUBITER_COL(n,2,20,21,22,23,24,25) \
+    SUBITER_COL(n,3,26,27,28,29,30,31)
+
+// Combine the two sets of accumulators for one vector of the microtile and
+// scale the result by alpha (alpha_r in ZMM(6), alpha_i in ZMM(7)). ZMM(5)
+// holds 1.0 in every element.
+#define COMBINE_SCALE(R,I) \
+\
+    VPERMILPS(ZMM(I), ZMM(I), IMM(0xB1)) \
+    VFMADDSUB213PS(ZMM(R), ZMM(5), ZMM(I)) \
+    VPERMILPS(ZMM(I), ZMM(R), IMM(0xB1)) \
+    VMULPS(ZMM(I), ZMM(I), ZMM(7)) \
+    VFMADDSUB213PS(ZMM(R), ZMM(6), ZMM(I))
+
+#define COMBINE_SCALE_COL(R0,R1,R2,I0,I1,I2) \
+\
+    COMBINE_SCALE(R0,I0) \
+    COMBINE_SCALE(R1,I1) \
+    COMBINE_SCALE(R2,I2)
+
+// Update one column of C (beta_r in ZMM(1), beta_i in ZMM(2)).
+#define UPDATE_C_BETA_C(R0,R1,R2) \
+\
+    VMOVUPS(ZMM(3), MEM(RCX,  0)) \
+    VPERMILPS(ZMM(4), ZMM(3), IMM(0xB1)) \
+    VMULPS(ZMM(4), ZMM(4), ZMM(2)) \
+    VFMADDSUB213PS(ZMM(3), ZMM(1), ZMM(4)) \
+    VADDPS(ZMM(R0), ZMM(R0), ZMM(3)) \
+    VMOVUPS(ZMM(3), MEM(RCX, 64)) \
+    VPERMILPS(ZMM(4), ZMM(3), IMM(0xB1)) \
+    VMULPS(ZMM(4), ZMM(4), ZMM(2)) \
+    VFMADDSUB213PS(ZMM(3), ZMM(1), ZMM(4)) \
+    VADDPS(ZMM(R1), ZMM(R1), ZMM(3)) \
+    VMOVUPS(ZMM(3), MEM(RCX,128)) \
+    VPERMILPS(ZMM(4), ZMM(3), IMM(0xB1)) \
+    VMULPS(ZMM(4), ZMM(4), ZMM(2)) \
+    VFMADDSUB213PS(ZMM(3), ZMM(1), ZMM(4)) \
+    VADDPS(ZMM(R2), ZMM(R2), ZMM(3)) \
+    VMOVUPS(MEM(RCX,  0), ZMM(R0)) \
+    VMOVUPS(MEM(RCX, 64), ZMM(R1)) \
+    VMOVUPS(MEM(RCX,128), ZMM(R2)) \
+    LEA(RCX, MEM(RCX,RDI,1))
+
+// Update one column of C when beta is real (beta_r in ZMM(1)).
+#define UPDATE_C_BETA_R(R0,R1,R2) \
+\
+    VFMADD231PS(ZMM(R0), ZMM(1), MEM(RCX,  0)) \
+    VFMADD231PS(ZMM(R1), ZMM(1), MEM(RCX, 64)) \
+    VFMADD231PS(ZMM(R2), ZMM(1), MEM(RCX,128)) \
+    VMOVUPS(MEM(RCX,  0), ZMM(R0)) \
+    VMOVUPS(MEM(RCX, 64), ZMM(R1)) \
+    VMOVUPS(MEM(RCX,128), ZMM(R2)) \
+    LEA(RCX, MEM(RCX,RDI,1))
+
+#define UPDATE_C_BZ(R0,R1,R2) \
+\
+    VMOVUPS(MEM(RCX,  0), ZMM(R0)) \
+    VMOVUPS(MEM(RCX, 64), ZMM(R1)) \
+    VMOVUPS(MEM(RCX,128), ZMM(R2)) \
+    LEA(RCX, MEM(RCX,RDI,1))
+
+void bli_cgemm_skx_asm_24x4
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k_,
+       const void*      alpha,
+       const void*      a,
+       const void*      b,
+       const void*      beta,
+             void*      c, inc_t rs_c_, inc_t cs_c_,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+    (void)data;
+    (void)cntx;
+
+    const float one = 1.0f;
+
+    int64_t k = k_;
+    int64_t rs_c = rs_c_;
+    int64_t cs_c = cs_c_;
+
+    GEMM_UKR_SETUP_CT( c, 24, 4, false );
+
+    BEGIN_ASM()
+
+    VXORPS(YMM( 8), YMM( 8), YMM( 8)) //clear out registers
+    VXORPS(YMM( 9), YMM( 9), YMM( 9))
+    VXORPS(YMM(10), YMM(10), YMM(10))
+    VXORPS(YMM(11), YMM(11), YMM(11))
+    VXORPS(YMM(12), YMM(12), YMM(12))
+    VXORPS(YMM(13), YMM(13), YMM(13))
+    VXORPS(YMM(14), YMM(14), YMM(14))
+    VXORPS(YMM(15), YMM(15), YMM(15))
+    VXORPS(YMM(16), YMM(16), YMM(16))
+    VXORPS(YMM(17), YMM(17), YMM(17))
+    VXORPS(YMM(18), YMM(18), YMM(18))
+    VXORPS(YMM(19), YMM(19), YMM(19))
+    VXORPS(YMM(20), YMM(20), YMM(20))
+    VXORPS(YMM(21), YMM(21), YMM(21))
+    VXORPS(YMM(22), YMM(22), YMM(22))
+    VXORPS(YMM(23), YMM(23), YMM(23))
+    VXORPS(YMM(24), YMM(24), YMM(24))
+    VXORPS(YMM(25), YMM(25), YMM(25))
+    VXORPS(YMM(26), YMM(26), YMM(26))
+    VXORPS(YMM(27), YMM(27), YMM(27))
+    VXORPS(YMM(28), YMM(28), YMM(28))
+    VXORPS(YMM(29), YMM(29), YMM(29))
+    VXORPS(YMM(30), YMM(30), YMM(30))
+    VXORPS(YMM(31), YMM(31), YMM(31))
+
+    MOV(RSI, VAR(k)) //loop index
+    MOV(RAX, VAR(a)) //load address of a
+    MOV(RBX, VAR(b)) //load address of b
+    MOV(RCX, VAR(c)) //load address of c
+
+    MOV(RDI, VAR(cs_c))
+    LEA(RDI, MEM(,RDI,8)) // cs_c *= sizeof(scomplex)
+
+    // Prefetch the microtile of C.
+    LEA(RDX, MEM(RCX,RDI,2))
+    PREFETCH(0, MEM(RCX,    0))
+    PREFETCH(0, MEM(RCX,   64))
+    PREFETCH(0, MEM(RCX,  128))
+    PREFETCH(0, MEM(RCX,RDI,1,  0))
+    PREFETCH(0, MEM(RCX,RDI,1, 64))
+    PREFETCH(0, MEM(RCX,RDI,1,128))
+    PREFETCH(0, MEM(RDX,    0))
+    PREFETCH(0, MEM(RDX,   64))
+    PREFETCH(0, MEM(RDX,  128))
+    PREFETCH(0, MEM(RDX,RDI,1,  0))
+    PREFETCH(0, MEM(RDX,RDI,1, 64))
+    PREFETCH(0, MEM(RDX,RDI,1,128))
+
+    MOV(R8, RSI)
+    AND(RSI, IMM(3))
+    SAR(R8, IMM(2))
+    JZ(TAIL)
+
+        LOOP_ALIGN
+        LABEL(LOOP)
+
+            SUBITER(0)
+            SUBITER(1)
+            SUB(R8, IMM(1))
+            SUBITER(2)
+            SUBITER(3)
+
+            LEA(RAX, MEM(RAX,4*24*8))
+            LEA(RBX, MEM(RBX,4*4*8))
+
+        JNZ(LOOP)
+
+    LABEL(TAIL)
+
+    TEST(RSI, RSI)
+    JZ(POSTACCUM)
+
+        LOOP_ALIGN
+        LABEL(TAIL_LOOP)
+
+            SUBITER(0)
+
+            LEA(RAX, MEM(RAX,24*8))
+            LEA(RBX, MEM(RBX,4*8))
+
+            SUB(RSI, IMM(1))
+
+        JNZ(TAIL_LOOP)
+
+    LABEL(POSTACCUM)
+
+    MOV(RBX, VAR(alpha))
+    VBROADCASTSS(ZMM(5), VAR(one))
+    VBROADCASTSS(ZMM(6), MEM(RBX))
+    VBROADCASTSS(ZMM(7), MEM(RBX,4))
+
+    COMBINE_SCALE_COL( 8, 9,10,11,12,13)
+    COMBINE_SCALE_COL(14,15,16,17,18,19)
+    COMBINE_SCALE_COL(20,21,22,23,24,25)
+    COMBINE_SCALE_COL(26,27,28,29,30,31)
+
+    MOV(RBX, VAR(beta))
+    VBROADCASTSS(ZMM(1), MEM(RBX))
+    VBROADCASTSS(ZMM(2), MEM(RBX,4))
+
+    VXORPS(YMM(0), YMM(0), YMM(0))
+
+    VUCOMISS(XMM(2), XMM(0))
+    JNE(BETA_COMPLEX)
+    VUCOMISS(XMM(1), XMM(0))
+    JE(BETA_ZERO)
+
+        UPDATE_C_BETA_R( 8, 9,10)
+        UPDATE_C_BETA_R(14,15,16)
+        UPDATE_C_BETA_R(20,21,22)
+        UPDATE_C_BETA_R(26,27,28)
+
+    JMP(END)
+    LABEL(BETA_COMPLEX)
+
+        UPDATE_C_BETA_C( 8, 9,10)
+        UPDATE_C_BETA_C(14,15,16)
+        UPDATE_C_BETA_C(20,21,22)
+        UPDATE_C_BETA_C(26,27,28)
+
+    JMP(END)
+    LABEL(BETA_ZERO)
+
+        UPDATE_C_BZ( 8, 9,10)
+        UPDATE_C_BZ(14,15,16)
+        UPDATE_C_BZ(20,21,22)
+        UPDATE_C_BZ(26,27,28)
+
+    LABEL(END)
+
+    VZEROUPPER()
+
+    END_ASM
+    (
+        : // output operands
+        : // input operands
+          [k]         "m" (k),
+          [a]         "m" (a),
+          [b]         "m" (b),
+          [alpha]     "m" (alpha),
+          [beta]      "m" (beta),
+          [one]       "m" (one),
+          [c]         "m" (c),
+          [rs_c]      "m" (rs_c),
+          [cs_c]      "m" (cs_c)
+        : // register clobber list
+          "rax", "rbx", "rcx", "rdx", "rdi", "rsi", "r8",
+          "zmm0", "zmm1", "zmm2", "zmm3", "zmm4", "zmm5",
+          "zmm6", "zmm7", "zmm8", "zmm9", "zmm10", "zmm11", "zmm12", "zmm13",
+          "zmm14", "zmm15", "zmm16", "zmm17", "zmm18", "zmm19", "zmm20", "zmm21",
+          "zmm22", "zmm23", "zmm24", "zmm25", "zmm26", "zmm27", "zmm28", "zmm29",
+          "zmm30", "zmm31", "memory"
+    )
+
+    GEMM_UKR_FLUSH_CT( c );
+}
@@ -0,0 +1,273 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Fused gemmtrsm microkernels for single precision on AVX-512 hardware,
+   matching the 32x12 skx gemm microkernel.
+
+   The 32x12 product of the packed micropanels a1x and bx1 is accumulated
+   in 24 zmm registers, one pair (rows 0-15 and 16-31) per column, exactly
+   as in the gemm microkernel. The rows of the packed b11 block are gathered
+   into the same layout and combined as alpha * b11 - a1x * bx1, after which
+   the triangular system is solved in registers: for each row i, element i
+   of every column is broadcast across its register (vpermps), scaled by the
+   (inverted) diagonal element, and eliminated from the remaining rows with
+   a masked FMA against column i of the packed a11. The result is scattered
+   back to b11 and stored to the column-stored microtile of C; all other
+   storage of C, and edge cases, go through a temporary microtile.
+*/
+
+#define MR     32
+#define NR     12
+#define PACKMR 32
+#define PACKNR 12
+
+// Expand a macro once for each column of the microtile. (Explicitly naming
+// the accumulators for each column, rather than indexing an array, ensures
+// that they are kept in registers.)
+#define FOR_EACH_COL( f ) \
+	f(  0 ) f(  1 ) f(  2 ) f(  3 ) f(  4 ) f(  5 ) \
+	f(  6 ) f(  7 ) f(  8 ) f(  9 ) f( 10 ) f( 11 )
+
+#ifdef BLIS_ENABLE_TRSM_PREINVERSION
+#define DIAG_SCAL( x, d ) _mm512_mul_ps( x, d )
+#else
+#define DIAG_SCAL( x, d ) _mm512_div_ps( x, d )
+#endif
+
+// b11 = alpha * b11 - a1x * bx1, leaving b11 in the accumulators.
+#define GEMM_B11_PROLOGUE \
+\
+	const float* restrict a  = a1x; \
+	const float* restrict b  = bx1; \
+	      float* restrict bb = b11; \
+\
+	FOR_EACH_COL( DECL_COL ) \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		const __m512 a0 = _mm512_loadu_ps( a      ); \
+		const __m512 a1 = _mm512_loadu_ps( a + 16 ); \
+\
+		FOR_EACH_COL( FMA_COL ) \
+\
+		a += PACKMR; \
+		b += PACKNR; \
+	} \
+\
+	const __m512  alphav = _mm512_set1_ps( *alpha ); \
+	const __m512i vidx   = _mm512_mullo_epi32( _mm512_setr_epi32(  0,  1,  2,  3, \
+	                                                             4,  5,  6,  7, \
+	                                                             8,  9, 10, 11, \
+	                                                            12, 13, 14, 15 ), \
+	                                           _mm512_set1_epi32( PACKNR ) ); \
+\
+	FOR_EACH_COL( LOAD_COL )
+
+#define DECL_COL( j ) \
+	__m512 c##j##_0 = _mm512_setzero_ps(); \
+	__m512 c##j##_1 = _mm512_setzero_ps();
+
+#define FMA_COL( j ) \
+	{ \
+		const __m512 bv = _mm512_set1_ps( b[ j ] ); \
+		c##j##_0 = _mm512_fmadd_ps( a0, bv, c##j##_0 ); \
+		c##j##_1 = _mm512_fmadd_ps( a1, bv, c##j##_1 ); \
+	}
+
+#define LOAD_COL( j ) \
+	c##j##_0 = _mm512_fmsub_ps( alphav, _mm512_i32gather_ps( vidx, bb + j,             4 ), c##j##_0 ); \
+	c##j##_1 = _mm512_fmsub_ps( alphav, _mm512_i32gather_ps( vidx, bb + 16*PACKNR + j, 4 ), c##j##_1 );
+
+// Solve for element i of column j and eliminate it from the rows that are
+// still unsolved (mask_e selects those that share a register with row i).
+// The _LO and _HI variants handle rows held in the first and second register
+// of each column, respectively; the _U variants perform backward (upper)
+// rather than forward (lower) substitution.
+#define SOLVE_COL_LO( j ) \
+	{ \
+		__m512 x = DIAG_SCAL( _mm512_permutexvar_ps( idx, c##j##_0 ), diag ); \
+		c##j##_0 = _mm512_mask_mov_ps( c##j##_0, mask_i, x ); \
+		c##j##_0 = _mm512_mask3_fnmadd_ps( x, ai_0, c##j##_0, mask_e ); \
+		c##j##_1 = _mm512_fnmadd_ps( x, ai_1, c##j##_1 ); \
+	}
+
+#define SOLVE_COL_HI( j ) \
+	{ \
+		__m512 x = DIAG_SCAL( _mm512_permutexvar_ps( idx, c##j##_1 ), diag ); \
+		c##j##_1 = _mm512_mask_mov_ps( c##j##_1, mask_i, x ); \
+		c##j##_1 = _mm512_mask3_fnmadd_ps( x, ai_1, c##j##_1, mask_e ); \
+	}
+
+#define SOLVE_COL_HI_U( j ) \
+	{ \
+		__m512 x = DIAG_SCAL( _mm512_permutexvar_ps( idx, c##j##_1 ), diag ); \
+		c##j##_1 = _mm512_mask_mov_ps( c##j##_1, mask_i, x ); \
+		c##j##_1 = _mm512_mask3_fnmadd_ps( x, ai_1, c##j##_1, mask_e ); \
+		c##j##_0 = _mm512_fnmadd_ps( x, ai_0, c##j##_0 ); \
+	}
+
+#define SOLVE_COL_LO_U( j ) \
+	{ \
+		__m512 x = DIAG_SCAL( _mm512_permutexvar_ps( idx, c##j##_0 ), diag ); \
+		c##j##_0 = _mm512_mask_mov_ps( c##j##_0, mask_i, x ); \
+		c##j##_0 = _mm512_mask3_fnmadd_ps( x, ai_0, c##j##_0, mask_e ); \
+	}
+
+// Write the solution to b11 and c11.
+#define STORE_COL( j ) \
+	_mm512_i32scatter_ps( bb + j,             vidx, c##j##_0, 4 ); \
+	_mm512_i32scatter_ps( bb + 16*PACKNR + j, vidx, c##j##_1, 4 ); \
+	_mm512_storeu_ps( c11 + j*cs_c,      c##j##_0 ); \
+	_mm512_storeu_ps( c11 + j*cs_c + 16, c##j##_1 );
+
+void bli_sgemmtrsm_l_skx_int_32x12
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a10,
+       const void*      a110,
+       const void*      b01,
+             void*      b110,
+             void*      c110, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const float* alpha = alpha0;
+	const float* a1x   = a10;
+	const float* a11   = a110;
+	const float* bx1   = b01;
+	      float* b11   = b110;
+	      float* c11   = c110;
+
+	GEMMTRSM_UKR_SETUP_CT( s, MR, NR, false );
+
+	// b11 = alpha * b11 - a10 * b01;
+	GEMM_B11_PROLOGUE
+
+	// b11 = inv(a11) * b11; (forward substitution)
+	for ( dim_t i = 0; i < 16; ++i )
+	{
+		const float*    ai     = a11 + i*PACKMR;
+		const __m512    ai_0   = _mm512_loadu_ps( ai      );
+		const __m512    ai_1   = _mm512_loadu_ps( ai + 16 );
+		const __m512    diag   = _mm512_set1_ps( ai[ i ] );
+		const __m512i   idx    = _mm512_set1_epi32( i );
+		const __mmask16 mask_i = 1 << i;
+		const __mmask16 mask_e = 0xffff << ( i + 1 );
+
+		FOR_EACH_COL( SOLVE_COL_LO )
+	}
+	for ( dim_t i = 16; i < 32; ++i )
+	{
+		const float*    ai     = a11 + i*PACKMR;
+		const __m512    ai_1   = _mm512_loadu_ps( ai + 16 );
+		const __m512    diag   = _mm512_set1_ps( ai[ i ] );
+		const __m512i   idx    = _mm512_set1_epi32( i - 16 );
+		const __mmask16 mask_i = 1 << ( i - 16 );
+		const __mmask16 mask_e = 0xffff << ( i - 15 );
+
+		FOR_EACH_COL( SOLVE_COL_HI )
+	}
+
+	// c11 = b11;
+	FOR_EACH_COL( STORE_COL )
+
+	GEMMTRSM_UKR_FLUSH_CT( s );
+}
+
+void bli_sgemmtrsm_u_skx_int_32x12
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a12,
+       const void*      a110,
+       const void*      b21,
+             void*      b110,
+             void*      c110, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const float* alpha = alpha0;
+	const float* a1x   = a12;
+	const float* a11   = a110;
+	const float* bx1   = b21;
+	      float* b11   = b110;
+	      float* c11   = c110;
+
+	GEMMTRSM_UKR_SETUP_CT( s, MR, NR, false );
+
+	// b11 = alpha * b11 - a12 * b21;
+	GEMM_B11_PROLOGUE
+
+	// b11 = inv(a11) * b11; (backward substitution)
+	for ( dim_t i = 31; i >= 16; --i )
+	{
+		const float*    ai     = a11 + i*PACKMR;
+		const __m512    ai_0   = _mm512_loadu_ps( ai      );
+		const __m512    ai_1   = _mm512_loadu_ps( ai + 16 );
+		const __m512    diag   = _mm512_set1_ps( ai[ i ] );
+		const __m512i   idx    = _mm512_set1_epi32( i - 16 );
+		const __mmask16 mask_i = 1 << ( i - 16 );
+		const __mmask16 mask_e = mask_i - 1;
+
+		FOR_EACH_COL( SOLVE_COL_HI_U )
+	}
+	for ( dim_t i = 15; i >= 0; --i )
+	{
+		const float*    ai     = a11 + i*PACKMR;
+		const __m512    ai_0   = _mm512_loadu_ps( ai );
+		const __m512    diag   = _mm512_set1_ps( ai[ i ] );
+		const __m512i   idx    = _mm512_set1_epi32( i );
+		const __mmask16 mask_i = 1 << i;
+		const __mmask16 mask_e = mask_i - 1;
+
+		FOR_EACH_COL( SOLVE_COL_LO_U )
+	}
+
+	// c11 = b11;
+	FOR_EACH_COL( STORE_COL )
+
+	GEMMTRSM_UKR_FLUSH_CT( s );
+}
+
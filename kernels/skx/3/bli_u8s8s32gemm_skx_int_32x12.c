@@ -0,0 +1,223 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   Microkernels for the 8-bit integer gemm operation (bli_u8s8s32gemm()) on
+   AVX-512 hardware, with the same 32x12 register blocking as the skx sgemm
+   microkernel.
+
+   Each 32-bit word of the packed micropanels holds a group of four
+   consecutive k indices (see bli_gemm_lp.h), so that one k iteration
+   multiplies two zmm registers of A (uint8) by a broadcast word of B (int8)
+   for each of the 12 columns, accumulating into 24 zmm registers of int32.
+
+   The _vnni kernel does so with a single vpdpbusd instruction (AVX512-VNNI),
+   which is emitted via inline assembly so that no additional compiler flags
+   are needed. The other kernel requires only AVX512BW and uses vpmaddubsw
+   followed by vpmaddwd. Since vpmaddubsw saturates the sum of each pair of
+   products to 16 bits, A is split into its low seven bits and its sign bit,
+   for which the pairwise sums are always exact; both halves are then widened
+   and accumulated separately. The result is therefore identical to that of
+   the _vnni kernel.
+
+   Column-stored microtiles of C (including edge cases) are updated directly
+   with masked loads and stores; other storage goes through a temporary
+   microtile.
+*/
+
+#define MR     32
+#define NR     12
+#define PACKMR 32
+#define PACKNR 12
+
+// Expand a macro once for each column of the microtile.
+#define FOR_EACH_COL( f ) \
+	f(  0 ) f(  1 ) f(  2 ) f(  3 ) f(  4 ) f(  5 ) \
+	f(  6 ) f(  7 ) f(  8 ) f(  9 ) f( 10 ) f( 11 )
+
+#define DECL_COL( j ) \
+	__m512i c##j##_0 = _mm512_setzero_si512(); \
+	__m512i c##j##_1 = _mm512_setzero_si512();
+
+// -- AVX512-VNNI --
+
+#define VNNI_UPDATE_COL( j ) \
+	{ \
+		const __m512i bv = _mm512_set1_epi32( b[ j ] ); \
+		__asm__( "vpdpbusd %2, %1, %0" : "+v"( c##j##_0 ) : "v"( av0 ), "v"( bv ) ); \
+		__asm__( "vpdpbusd %2, %1, %0" : "+v"( c##j##_1 ) : "v"( av1 ), "v"( bv ) ); \
+	}
+
+#define VNNI_ACCUMULATE \
+	for ( dim_t l = 0; l < k4; ++l ) \
+	{ \
+		const __m512i av0 = _mm512_loadu_si512( a      ); \
+		const __m512i av1 = _mm512_loadu_si512( a + 16 ); \
+\
+		FOR_EACH_COL( VNNI_UPDATE_COL ) \
+\
+		a += PACKMR; \
+		b += PACKNR; \
+	}
+
+// -- AVX512BW --
+
+// Since the emulation needs twice as many registers for A, the k loop is
+// run separately for each half of the microtile so that the accumulators
+// are never spilled within it.
+
+#define BW_UPDATE_COL( j, h ) \
+	{ \
+		const __m512i bv = _mm512_set1_epi32( b[ l*PACKNR + j ] ); \
+		c##j##_##h = _mm512_add_epi32( c##j##_##h, _mm512_madd_epi16( _mm512_maddubs_epi16( a_lo, bv ), ones ) ); \
+		c##j##_##h = _mm512_add_epi32( c##j##_##h, _mm512_madd_epi16( _mm512_maddubs_epi16( a_hi, bv ), ones ) ); \
+	}
+
+#define BW_UPDATE_COL_0( j ) BW_UPDATE_COL( j, 0 )
+#define BW_UPDATE_COL_1( j ) BW_UPDATE_COL( j, 1 )
+
+#define BW_LOOP( h ) \
+	for ( dim_t l = 0; l < k4; ++l ) \
+	{ \
+		const __m512i av   = _mm512_loadu_si512( a + l*PACKMR + 16*h ); \
+		const __m512i a_lo = _mm512_and_si512( av, lo7 ); \
+		const __m512i a_hi = _mm512_andnot_si512( lo7, av ); \
+\
+		FOR_EACH_COL( BW_UPDATE_COL_##h ) \
+	}
+
+#define BW_ACCUMULATE \
+	{ \
+		const __m512i lo7  = _mm512_set1_epi8( 0x7f ); \
+		const __m512i ones = _mm512_set1_epi16( 1 ); \
+\
+		BW_LOOP( 0 ) \
+		BW_LOOP( 1 ) \
+	}
+
+// -- Write-back --
+
+#define SCALE_COL( j ) \
+	c##j##_0 = _mm512_mullo_epi32( alphav, c##j##_0 ); \
+	c##j##_1 = _mm512_mullo_epi32( alphav, c##j##_1 );
+
+#define STORE_COL( j ) \
+	if ( j < n ) \
+	{ \
+		_mm512_mask_storeu_epi32( c + j*cs_c,      m0, c##j##_0 ); \
+		_mm512_mask_storeu_epi32( c + j*cs_c + 16, m1, c##j##_1 ); \
+	}
+
+#define UPDATE_COL( j ) \
+	if ( j < n ) \
+	{ \
+		const __m512i cj_0 = _mm512_maskz_loadu_epi32( m0, c + j*cs_c      ); \
+		const __m512i cj_1 = _mm512_maskz_loadu_epi32( m1, c + j*cs_c + 16 ); \
+		c##j##_0 = _mm512_add_epi32( c##j##_0, _mm512_mullo_epi32( betav, cj_0 ) ); \
+		c##j##_1 = _mm512_add_epi32( c##j##_1, _mm512_mullo_epi32( betav, cj_1 ) ); \
+	} \
+	STORE_COL( j )
+
+#define STORE_CT( j ) \
+	_mm512_store_si512( ct + j*MR,      c##j##_0 ); \
+	_mm512_store_si512( ct + j*MR + 16, c##j##_1 );
+
+#undef  GENKER
+#define GENKER( name, accumulate ) \
+\
+void name \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+       const auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const int32_t* restrict a     = a0; \
+	const int32_t* restrict b     = b0; \
+	      int32_t* restrict c     = c0; \
+	const int32_t           alpha = ( int32_t )*( const float* )alpha0; \
+	const int32_t           beta  = ( int32_t )*( const float* )beta0; \
+	const dim_t             k4    = ( k + 3 ) / 4; \
+\
+	( void )data; ( void )cntx; \
+\
+	FOR_EACH_COL( DECL_COL ) \
+\
+	accumulate \
+\
+	if ( alpha != 1 ) \
+	{ \
+		const __m512i alphav = _mm512_set1_epi32( alpha ); \
+\
+		FOR_EACH_COL( SCALE_COL ) \
+	} \
+\
+	if ( rs_c == 1 ) \
+	{ \
+		const __m512i   betav = _mm512_set1_epi32( beta ); \
+		const __mmask16 m0    = ( 1u << bli_min( m,      16 ) ) - 1; \
+		const __mmask16 m1    = ( 1u << bli_max( m - 16, 0  ) ) - 1; \
+\
+		if ( beta == 0 ) { FOR_EACH_COL( STORE_COL ) } \
+		else             { FOR_EACH_COL( UPDATE_COL ) } \
+	} \
+	else \
+	{ \
+		int32_t ct[ MR*NR ] __attribute__((aligned(64))); \
+\
+		FOR_EACH_COL( STORE_CT ) \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			int32_t* restrict cij = c + i*rs_c + j*cs_c; \
+\
+			if ( beta == 0 ) *cij = ct[ i + j*MR ]; \
+			else             *cij = ( int32_t )( ( uint32_t )ct[ i + j*MR ] + \
+			                                     ( uint32_t )beta * ( uint32_t )*cij ); \
+		} \
+	} \
+}
+
+GENKER( bli_u8s8s32gemm_skx_int_32x12,      BW_ACCUMULATE   )
+GENKER( bli_u8s8s32gemm_skx_int_32x12_vnni, VNNI_ACCUMULATE )
@@ -0,0 +1,302 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rd millikernels for single-precision complex sup gemm on AVX-512 hardware.
+
+   These kernels mirror those in bli_gemmsup_rd_skx_int_z6x8.c: a 6x16
+   microtile of C is computed as a sequence of 3x4 blocks, each element of
+   which is accumulated in a pair of zmm registers that are reduced (after
+   the signs implementing conjugation have been applied) to a complex
+   scalar. Here each row of a block is reduced to a single ymm register.
+*/
+
+#define MR 6
+#define NR 16
+
+// Reduce eight zmm accumulators to a single ymm register containing the sum
+// of the elements of each accumulator.
+static inline __attribute__((always_inline)) __m256 bli_cgemmsup_rd_skx_int_hsum8
+     (
+       __m512 x0, __m512 x1, __m512 x2, __m512 x3,
+       __m512 x4, __m512 x5, __m512 x6, __m512 x7
+     )
+{
+	// First fold each accumulator in half.
+	#define FOLD( x ) \
+	_mm256_add_ps( _mm512_castps512_ps256( x ), _mm512_extractf32x8_ps( x, 1 ) )
+
+	const __m256 y0 = FOLD( x0 ), y1 = FOLD( x1 ), y2 = FOLD( x2 ), y3 = FOLD( x3 );
+	const __m256 y4 = FOLD( x4 ), y5 = FOLD( x5 ), y6 = FOLD( x6 ), y7 = FOLD( x7 );
+
+	#undef FOLD
+
+	// Each 128-bit lane of u0 (u1) holds partial sums of y0..y3 (y4..y7).
+	const __m256 u0 = _mm256_hadd_ps( _mm256_hadd_ps( y0, y1 ), _mm256_hadd_ps( y2, y3 ) );
+	const __m256 u1 = _mm256_hadd_ps( _mm256_hadd_ps( y4, y5 ), _mm256_hadd_ps( y6, y7 ) );
+
+	return _mm256_add_ps( _mm256_permute2f128_ps( u0, u1, 0x20 ),
+	                      _mm256_permute2f128_ps( u0, u1, 0x31 ) );
+}
+
+// Multiply each complex element of x by the scalar whose real and imaginary
+// parts have been broadcast into yr and yi, respectively.
+static inline __attribute__((always_inline)) __m256 bli_cgemmsup_rd_skx_int_cmul
+     (
+       __m256 x,
+       __m256 yr,
+       __m256 yi
+     )
+{
+	return _mm256_fmaddsub_ps( x, yr, _mm256_mul_ps( _mm256_permute_ps( x, 0xb1 ), yi ) );
+}
+
+static void bli_cgemmsup_rd_skx_int_tile
+     (
+             conj_t    conja,
+             conj_t    conjb,
+             dim_t     mr,
+             dim_t     nr,
+             dim_t     k,
+       const scomplex* alpha,
+       const scomplex* a, inc_t rs_a,
+       const scomplex* b, inc_t cs_b,
+       const scomplex* beta,
+             scomplex* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t     k_iter = k / 8;
+	const dim_t     k_left = k % 8;
+	const __mmask16 mask_k = ( __mmask16 )( ( 1u << ( 2*k_left ) ) - 1 );
+
+	// The real part of each dot product is the sum of the even lanes of rr
+	// minus the sum of its odd lanes, unless exactly one of a and b is
+	// conjugated. The imaginary part is the sum of the lanes of ri, with
+	// the even (odd) lanes negated if b (a) is conjugated.
+	const float   sgn_r  = ( conja == conjb ) ? -0.0f : 0.0f;
+	const float   sgn_ie = bli_is_conj( conjb ) ? -0.0f : 0.0f;
+	const float   sgn_io = bli_is_conj( conja ) ? -0.0f : 0.0f;
+	const __m512  sgnv_r = _mm512_setr_ps( 0.0f, sgn_r, 0.0f, sgn_r, 0.0f, sgn_r, 0.0f, sgn_r,
+	                                       0.0f, sgn_r, 0.0f, sgn_r, 0.0f, sgn_r, 0.0f, sgn_r );
+	const __m512  sgnv_i = _mm512_setr_ps( sgn_ie, sgn_io, sgn_ie, sgn_io, sgn_ie, sgn_io, sgn_ie, sgn_io,
+	                                       sgn_ie, sgn_io, sgn_ie, sgn_io, sgn_ie, sgn_io, sgn_ie, sgn_io );
+
+	const __m256  alpha_r = _mm256_set1_ps( alpha->real );
+	const __m256  alpha_i = _mm256_set1_ps( alpha->imag );
+	const __m256  beta_r  = _mm256_set1_ps( beta->real );
+	const __m256  beta_i  = _mm256_set1_ps( beta->imag );
+	const bool    beta0   = bli_ceq0( *beta );
+
+	for ( dim_t ib = 0; ib < mr; ib += 3 )
+	for ( dim_t jb = 0; jb < nr; jb += 4 )
+	{
+		const dim_t mb = bli_min( 3, mr - ib );
+		const dim_t nb = bli_min( 4, nr - jb );
+
+		const float* restrict a0 = ( const float* )( a + ( ib + bli_min( 0, mb - 1 ) )*rs_a );
+		const float* restrict a1 = ( const float* )( a + ( ib + bli_min( 1, mb - 1 ) )*rs_a );
+		const float* restrict a2 = ( const float* )( a + ( ib + bli_min( 2, mb - 1 ) )*rs_a );
+
+		const float* restrict b0 = ( const float* )( b + ( jb + bli_min( 0, nb - 1 ) )*cs_b );
+		const float* restrict b1 = ( const float* )( b + ( jb + bli_min( 1, nb - 1 ) )*cs_b );
+		const float* restrict b2 = ( const float* )( b + ( jb + bli_min( 2, nb - 1 ) )*cs_b );
+		const float* restrict b3 = ( const float* )( b + ( jb + bli_min( 3, nb - 1 ) )*cs_b );
+
+		__m512 rr00 = _mm512_setzero_ps(), ri00 = _mm512_setzero_ps(),
+		       rr01 = _mm512_setzero_ps(), ri01 = _mm512_setzero_ps(),
+		       rr02 = _mm512_setzero_ps(), ri02 = _mm512_setzero_ps(),
+		       rr03 = _mm512_setzero_ps(), ri03 = _mm512_setzero_ps(),
+		       rr10 = _mm512_setzero_ps(), ri10 = _mm512_setzero_ps(),
+		       rr11 = _mm512_setzero_ps(), ri11 = _mm512_setzero_ps(),
+		       rr12 = _mm512_setzero_ps(), ri12 = _mm512_setzero_ps(),
+		       rr13 = _mm512_setzero_ps(), ri13 = _mm512_setzero_ps(),
+		       rr20 = _mm512_setzero_ps(), ri20 = _mm512_setzero_ps(),
+		       rr21 = _mm512_setzero_ps(), ri21 = _mm512_setzero_ps(),
+		       rr22 = _mm512_setzero_ps(), ri22 = _mm512_setzero_ps(),
+		       rr23 = _mm512_setzero_ps(), ri23 = _mm512_setzero_ps();
+
+		#define RD_COL( j, load ) \
+		{ \
+			const __m512 bv = load( b##j ); \
+			const __m512 bs = _mm512_permute_ps( bv, 0xb1 ); \
+\
+			rr0##j = _mm512_fmadd_ps( av0, bv, rr0##j ); ri0##j = _mm512_fmadd_ps( av0, bs, ri0##j ); \
+			rr1##j = _mm512_fmadd_ps( av1, bv, rr1##j ); ri1##j = _mm512_fmadd_ps( av1, bs, ri1##j ); \
+			rr2##j = _mm512_fmadd_ps( av2, bv, rr2##j ); ri2##j = _mm512_fmadd_ps( av2, bs, ri2##j ); \
+		}
+
+		#define RD_ITER( load ) \
+		{ \
+			const __m512 av0 = load( a0 ), av1 = load( a1 ), av2 = load( a2 ); \
+\
+			RD_COL( 0, load ) RD_COL( 1, load ) RD_COL( 2, load ) RD_COL( 3, load ) \
+		}
+
+		#define LOADU( p )  _mm512_loadu_ps( p )
+		#define LOADM( p )  _mm512_maskz_loadu_ps( mask_k, p )
+
+		for ( dim_t l = 0; l < k_iter; ++l )
+		{
+			RD_ITER( LOADU );
+
+			a0 += 16; a1 += 16; a2 += 16;
+			b0 += 16; b1 += 16; b2 += 16; b3 += 16;
+		}
+
+		if ( k_left ) RD_ITER( LOADM );
+
+		#undef LOADM
+		#undef LOADU
+		#undef RD_ITER
+		#undef RD_COL
+
+		#define HSUM_ROW( i ) \
+		bli_cgemmsup_rd_skx_int_hsum8( _mm512_xor_ps( rr##i##0, sgnv_r ), _mm512_xor_ps( ri##i##0, sgnv_i ), \
+		                               _mm512_xor_ps( rr##i##1, sgnv_r ), _mm512_xor_ps( ri##i##1, sgnv_i ), \
+		                               _mm512_xor_ps( rr##i##2, sgnv_r ), _mm512_xor_ps( ri##i##2, sgnv_i ), \
+		                               _mm512_xor_ps( rr##i##3, sgnv_r ), _mm512_xor_ps( ri##i##3, sgnv_i ) )
+
+		__m256 ab[ 3 ];
+		ab[ 0 ] = HSUM_ROW( 0 );
+		ab[ 1 ] = HSUM_ROW( 1 );
+		ab[ 2 ] = HSUM_ROW( 2 );
+
+		#undef HSUM_ROW
+
+		scomplex* restrict cb = c + ib*rs_c + jb*cs_c;
+
+		if ( cs_c == 1 )
+		{
+			const __mmask8 mask_n = ( __mmask8 )( ( 1u << ( 2*nb ) ) - 1 );
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				float* restrict ci = ( float* )( cb + i*rs_c );
+				__m256           cv = bli_cgemmsup_rd_skx_int_cmul( ab[ i ], alpha_r, alpha_i );
+
+				if ( !beta0 )
+					cv = _mm256_add_ps( cv, bli_cgemmsup_rd_skx_int_cmul( _mm256_maskz_loadu_ps( mask_n, ci ),
+					                                                      beta_r, beta_i ) );
+
+				_mm256_mask_storeu_ps( ci, mask_n, cv );
+			}
+		}
+		else
+		{
+			scomplex ct[ 4 ] __attribute__((aligned(32)));
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				_mm256_store_ps( ( float* )ct, ab[ i ] );
+
+				for ( dim_t j = 0; j < nb; ++j )
+				{
+					scomplex* restrict cij = cb + i*rs_c + j*cs_c;
+
+					if ( beta0 ) { bli_zscal2s( *alpha, ct[ j ], *cij ); }
+					else         { bli_zaxpbys( *alpha, ct[ j ], *beta, *cij ); }
+				}
+			}
+		}
+	}
+}
+
+void bli_cgemmsup_rd_skx_int_6x16m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const scomplex* restrict ap = a;
+	      scomplex* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		bli_cgemmsup_rd_skx_int_tile( conja, conjb, bli_min( MR, m0 - i ), n0, k0,
+		                              alpha, ap, rs_a, b, cs_b, beta, cp, rs_c, cs_c );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+}
+
+void bli_cgemmsup_rd_skx_int_6x16n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const scomplex* restrict bp = b;
+	      scomplex* restrict cp = c;
+
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t j = 0; j < n0; j += NR )
+	{
+		bli_cgemmsup_rd_skx_int_tile( conja, conjb, m0, bli_min( NR, n0 - j ), k0,
+		                              alpha, a, rs_a, bp, cs_b, beta, cp, rs_c, cs_c );
+
+		bp += ps_b;
+		cp += NR*cs_c;
+	}
+}
@@ -0,0 +1,268 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rd millikernels for double-precision sup gemm on AVX-512 hardware.
+
+   These kernels assume that A is row-stored (cs_a == 1) and B is
+   column-stored (rs_b == 1), so that each element of C is the dot product
+   of two contiguous vectors. A 12x16 microtile of C is computed as a
+   sequence of 4x4 blocks. For each block, sixteen zmm registers accumulate
+   partial dot products along the k dimension (with the k edge handled via
+   masked loads), after which the accumulators are reduced to a single
+   4x4 block of scalars, four to a ymm register. Rows and columns beyond
+   the edge of the microtile are computed redundantly (by repeating the
+   last valid row or column) and then discarded when C is updated.
+*/
+
+#define MR 12
+#define NR 16
+
+// Reduce four zmm accumulators to a single ymm register containing the sum
+// of the elements of each accumulator.
+static inline __attribute__((always_inline)) __m256d bli_dgemmsup_rd_skx_int_hsum4
+     (
+       __m512d x0,
+       __m512d x1,
+       __m512d x2,
+       __m512d x3
+     )
+{
+	// Each 128-bit lane of s01 (s23) holds partial sums of x0 and x1 (x2 and x3).
+	const __m512d s01 = _mm512_add_pd( _mm512_unpacklo_pd( x0, x1 ),
+	                                   _mm512_unpackhi_pd( x0, x1 ) );
+	const __m512d s23 = _mm512_add_pd( _mm512_unpacklo_pd( x2, x3 ),
+	                                   _mm512_unpackhi_pd( x2, x3 ) );
+
+	// Lanes of w: { s01.0 + s01.1, s01.2 + s01.3, s23.0 + s23.1, s23.2 + s23.3 }.
+	const __m512d w   = _mm512_add_pd( _mm512_shuffle_f64x2( s01, s23, 0x88 ),
+	                                   _mm512_shuffle_f64x2( s01, s23, 0xDD ) );
+
+	const __m256d lo  = _mm512_castpd512_pd256( w );
+	const __m256d hi  = _mm512_extractf64x4_pd( w, 1 );
+
+	return _mm256_add_pd( _mm256_permute2f128_pd( lo, hi, 0x20 ),
+	                      _mm256_permute2f128_pd( lo, hi, 0x31 ) );
+}
+
+static void bli_dgemmsup_rd_skx_int_tile
+     (
+             dim_t   mr,
+             dim_t   nr,
+             dim_t   k,
+       const double* alpha,
+       const double* a, inc_t rs_a,
+       const double* b, inc_t cs_b,
+       const double* beta,
+             double* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t    k_iter = k / 8;
+	const dim_t    k_left = k % 8;
+	const __mmask8 mask_k = ( __mmask8 )( ( 1u << k_left ) - 1 );
+
+	const __m256d  alphav = _mm256_set1_pd( *alpha );
+	const __m256d  betav  = _mm256_set1_pd( *beta );
+	const bool     beta0  = bli_deq0( *beta );
+
+	for ( dim_t ib = 0; ib < mr; ib += 4 )
+	for ( dim_t jb = 0; jb < nr; jb += 4 )
+	{
+		const dim_t mb = bli_min( 4, mr - ib );
+		const dim_t nb = bli_min( 4, nr - jb );
+
+		const double* restrict a0 = a + ( ib + bli_min( 0, mb - 1 ) )*rs_a;
+		const double* restrict a1 = a + ( ib + bli_min( 1, mb - 1 ) )*rs_a;
+		const double* restrict a2 = a + ( ib + bli_min( 2, mb - 1 ) )*rs_a;
+		const double* restrict a3 = a + ( ib + bli_min( 3, mb - 1 ) )*rs_a;
+
+		const double* restrict b0 = b + ( jb + bli_min( 0, nb - 1 ) )*cs_b;
+		const double* restrict b1 = b + ( jb + bli_min( 1, nb - 1 ) )*cs_b;
+		const double* restrict b2 = b + ( jb + bli_min( 2, nb - 1 ) )*cs_b;
+		const double* restrict b3 = b + ( jb + bli_min( 3, nb - 1 ) )*cs_b;
+
+		__m512d ab00 = _mm512_setzero_pd(), ab01 = _mm512_setzero_pd(),
+		        ab02 = _mm512_setzero_pd(), ab03 = _mm512_setzero_pd(),
+		        ab10 = _mm512_setzero_pd(), ab11 = _mm512_setzero_pd(),
+		        ab12 = _mm512_setzero_pd(), ab13 = _mm512_setzero_pd(),
+		        ab20 = _mm512_setzero_pd(), ab21 = _mm512_setzero_pd(),
+		        ab22 = _mm512_setzero_pd(), ab23 = _mm512_setzero_pd(),
+		        ab30 = _mm512_setzero_pd(), ab31 = _mm512_setzero_pd(),
+		        ab32 = _mm512_setzero_pd(), ab33 = _mm512_setzero_pd();
+
+		#define RD_ITER( load_a, load_b ) \
+		{ \
+			const __m512d av0 = load_a( a0 ), av1 = load_a( a1 ), \
+			              av2 = load_a( a2 ), av3 = load_a( a3 ); \
+			const __m512d bv0 = load_b( b0 ), bv1 = load_b( b1 ), \
+			              bv2 = load_b( b2 ), bv3 = load_b( b3 ); \
+\
+			ab00 = _mm512_fmadd_pd( av0, bv0, ab00 ); ab01 = _mm512_fmadd_pd( av0, bv1, ab01 ); \
+			ab02 = _mm512_fmadd_pd( av0, bv2, ab02 ); ab03 = _mm512_fmadd_pd( av0, bv3, ab03 ); \
+			ab10 = _mm512_fmadd_pd( av1, bv0, ab10 ); ab11 = _mm512_fmadd_pd( av1, bv1, ab11 ); \
+			ab12 = _mm512_fmadd_pd( av1, bv2, ab12 ); ab13 = _mm512_fmadd_pd( av1, bv3, ab13 ); \
+			ab20 = _mm512_fmadd_pd( av2, bv0, ab20 ); ab21 = _mm512_fmadd_pd( av2, bv1, ab21 ); \
+			ab22 = _mm512_fmadd_pd( av2, bv2, ab22 ); ab23 = _mm512_fmadd_pd( av2, bv3, ab23 ); \
+			ab30 = _mm512_fmadd_pd( av3, bv0, ab30 ); ab31 = _mm512_fmadd_pd( av3, bv1, ab31 ); \
+			ab32 = _mm512_fmadd_pd( av3, bv2, ab32 ); ab33 = _mm512_fmadd_pd( av3, bv3, ab33 ); \
+		}
+
+		#define LOADU( p )  _mm512_loadu_pd( p )
+		#define LOADM( p )  _mm512_maskz_loadu_pd( mask_k, p )
+
+		for ( dim_t l = 0; l < k_iter; ++l )
+		{
+			RD_ITER( LOADU, LOADU );
+
+			a0 += 8; a1 += 8; a2 += 8; a3 += 8;
+			b0 += 8; b1 += 8; b2 += 8; b3 += 8;
+		}
+
+		if ( k_left ) RD_ITER( LOADM, LOADM );
+
+		#undef LOADM
+		#undef LOADU
+		#undef RD_ITER
+
+		__m256d ab[ 4 ];
+		ab[ 0 ] = bli_dgemmsup_rd_skx_int_hsum4( ab00, ab01, ab02, ab03 );
+		ab[ 1 ] = bli_dgemmsup_rd_skx_int_hsum4( ab10, ab11, ab12, ab13 );
+		ab[ 2 ] = bli_dgemmsup_rd_skx_int_hsum4( ab20, ab21, ab22, ab23 );
+		ab[ 3 ] = bli_dgemmsup_rd_skx_int_hsum4( ab30, ab31, ab32, ab33 );
+
+		double* restrict cb = c + ib*rs_c + jb*cs_c;
+
+		if ( cs_c == 1 )
+		{
+			const __mmask8 mask_n = ( __mmask8 )( ( 1u << nb ) - 1 );
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				double* restrict ci = cb + i*rs_c;
+				__m256d          cv = _mm256_mul_pd( alphav, ab[ i ] );
+
+				if ( !beta0 )
+					cv = _mm256_fmadd_pd( betav, _mm256_maskz_loadu_pd( mask_n, ci ), cv );
+
+				_mm256_mask_storeu_pd( ci, mask_n, cv );
+			}
+		}
+		else
+		{
+			double ct[ 4 ] __attribute__((aligned(32)));
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				_mm256_store_pd( ct, _mm256_mul_pd( alphav, ab[ i ] ) );
+
+				for ( dim_t j = 0; j < nb; ++j )
+				{
+					double* restrict cij = cb + i*rs_c + j*cs_c;
+
+					if ( beta0 ) *cij = ct[ j ];
+					else         *cij = *beta * *cij + ct[ j ];
+				}
+			}
+		}
+	}
+}
+
+void bli_dgemmsup_rd_skx_int_12x16m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const double* restrict ap = a;
+	      double* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		bli_dgemmsup_rd_skx_int_tile( bli_min( MR, m0 - i ), n0, k0, alpha,
+		                              ap, rs_a, b, cs_b, beta, cp, rs_c, cs_c );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+}
+
+void bli_dgemmsup_rd_skx_int_12x16n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const double* restrict bp = b;
+	      double* restrict cp = c;
+
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t j = 0; j < n0; j += NR )
+	{
+		bli_dgemmsup_rd_skx_int_tile( m0, bli_min( NR, n0 - j ), k0, alpha,
+		                              a, rs_a, bp, cs_b, beta, cp, rs_c, cs_c );
+
+		bp += ps_b;
+		cp += NR*cs_c;
+	}
+}
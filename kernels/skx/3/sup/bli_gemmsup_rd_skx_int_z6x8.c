@@ -0,0 +1,313 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rd millikernels for double-precision complex sup gemm on AVX-512 hardware.
+
+   These kernels assume that A is row-stored (cs_a == 1) and B is
+   column-stored (rs_b == 1), so that each element of C is the dot product
+   of two contiguous vectors. A 6x8 microtile of C is computed as a
+   sequence of 3x4 blocks. For each element of a block, two zmm registers
+   accumulate the elementwise products of a with b and of a with b with its
+   real and imaginary parts swapped (with the k edge handled via masked
+   loads). Conjugation of a and/or b only changes the signs with which the
+   lanes of these accumulators enter the real and imaginary parts of the dot
+   product, so it is applied after the k loop by flipping the sign bits of
+   the affected lanes, after which each row of the block is reduced to four
+   complex scalars in a single zmm register. Rows and columns beyond the
+   edge of the microtile are computed redundantly (by repeating the last
+   valid row or column) and then discarded when C is updated.
+*/
+
+#define MR 6
+#define NR 8
+
+// Reduce four zmm accumulators to a single ymm register containing the sum
+// of the elements of each accumulator.
+static inline __attribute__((always_inline)) __m256d bli_zgemmsup_rd_skx_int_hsum4
+     (
+       __m512d x0,
+       __m512d x1,
+       __m512d x2,
+       __m512d x3
+     )
+{
+	// Each 128-bit lane of s01 (s23) holds partial sums of x0 and x1 (x2 and x3).
+	const __m512d s01 = _mm512_add_pd( _mm512_unpacklo_pd( x0, x1 ),
+	                                   _mm512_unpackhi_pd( x0, x1 ) );
+	const __m512d s23 = _mm512_add_pd( _mm512_unpacklo_pd( x2, x3 ),
+	                                   _mm512_unpackhi_pd( x2, x3 ) );
+
+	// Lanes of w: { s01.0 + s01.1, s01.2 + s01.3, s23.0 + s23.1, s23.2 + s23.3 }.
+	const __m512d w   = _mm512_add_pd( _mm512_shuffle_f64x2( s01, s23, 0x88 ),
+	                                   _mm512_shuffle_f64x2( s01, s23, 0xDD ) );
+
+	const __m256d lo  = _mm512_castpd512_pd256( w );
+	const __m256d hi  = _mm512_extractf64x4_pd( w, 1 );
+
+	return _mm256_add_pd( _mm256_permute2f128_pd( lo, hi, 0x20 ),
+	                      _mm256_permute2f128_pd( lo, hi, 0x31 ) );
+}
+
+// Multiply each complex element of x by the scalar whose real and imaginary
+// parts have been broadcast into yr and yi, respectively.
+static inline __attribute__((always_inline)) __m512d bli_zgemmsup_rd_skx_int_cmul
+     (
+       __m512d x,
+       __m512d yr,
+       __m512d yi
+     )
+{
+	return _mm512_fmaddsub_pd( x, yr, _mm512_mul_pd( _mm512_permute_pd( x, 0x55 ), yi ) );
+}
+
+static void bli_zgemmsup_rd_skx_int_tile
+     (
+             conj_t    conja,
+             conj_t    conjb,
+             dim_t     mr,
+             dim_t     nr,
+             dim_t     k,
+       const dcomplex* alpha,
+       const dcomplex* a, inc_t rs_a,
+       const dcomplex* b, inc_t cs_b,
+       const dcomplex* beta,
+             dcomplex* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t    k_iter = k / 4;
+	const dim_t    k_left = k % 4;
+	const __mmask8 mask_k = ( __mmask8 )( ( 1u << ( 2*k_left ) ) - 1 );
+
+	// The real part of each dot product is the sum of the even lanes of rr
+	// minus the sum of its odd lanes, unless exactly one of a and b is
+	// conjugated. The imaginary part is the sum of the lanes of ri, with
+	// the even (odd) lanes negated if b (a) is conjugated.
+	const double  sgn_r  = ( conja == conjb ) ? -0.0 : 0.0;
+	const double  sgn_ie = bli_is_conj( conjb ) ? -0.0 : 0.0;
+	const double  sgn_io = bli_is_conj( conja ) ? -0.0 : 0.0;
+	const __m512d sgnv_r = _mm512_setr_pd( 0.0, sgn_r, 0.0, sgn_r,
+	                                       0.0, sgn_r, 0.0, sgn_r );
+	const __m512d sgnv_i = _mm512_setr_pd( sgn_ie, sgn_io, sgn_ie, sgn_io,
+	                                       sgn_ie, sgn_io, sgn_ie, sgn_io );
+
+	const __m512d alpha_r = _mm512_set1_pd( alpha->real );
+	const __m512d alpha_i = _mm512_set1_pd( alpha->imag );
+	const __m512d beta_r  = _mm512_set1_pd( beta->real );
+	const __m512d beta_i  = _mm512_set1_pd( beta->imag );
+	const bool    beta0   = bli_zeq0( *beta );
+
+	for ( dim_t ib = 0; ib < mr; ib += 3 )
+	for ( dim_t jb = 0; jb < nr; jb += 4 )
+	{
+		const dim_t mb = bli_min( 3, mr - ib );
+		const dim_t nb = bli_min( 4, nr - jb );
+
+		const double* restrict a0 = ( const double* )( a + ( ib + bli_min( 0, mb - 1 ) )*rs_a );
+		const double* restrict a1 = ( const double* )( a + ( ib + bli_min( 1, mb - 1 ) )*rs_a );
+		const double* restrict a2 = ( const double* )( a + ( ib + bli_min( 2, mb - 1 ) )*rs_a );
+
+		const double* restrict b0 = ( const double* )( b + ( jb + bli_min( 0, nb - 1 ) )*cs_b );
+		const double* restrict b1 = ( const double* )( b + ( jb + bli_min( 1, nb - 1 ) )*cs_b );
+		const double* restrict b2 = ( const double* )( b + ( jb + bli_min( 2, nb - 1 ) )*cs_b );
+		const double* restrict b3 = ( const double* )( b + ( jb + bli_min( 3, nb - 1 ) )*cs_b );
+
+		__m512d rr00 = _mm512_setzero_pd(), ri00 = _mm512_setzero_pd(),
+		        rr01 = _mm512_setzero_pd(), ri01 = _mm512_setzero_pd(),
+		        rr02 = _mm512_setzero_pd(), ri02 = _mm512_setzero_pd(),
+		        rr03 = _mm512_setzero_pd(), ri03 = _mm512_setzero_pd(),
+		        rr10 = _mm512_setzero_pd(), ri10 = _mm512_setzero_pd(),
+		        rr11 = _mm512_setzero_pd(), ri11 = _mm512_setzero_pd(),
+		        rr12 = _mm512_setzero_pd(), ri12 = _mm512_setzero_pd(),
+		        rr13 = _mm512_setzero_pd(), ri13 = _mm512_setzero_pd(),
+		        rr20 = _mm512_setzero_pd(), ri20 = _mm512_setzero_pd(),
+		        rr21 = _mm512_setzero_pd(), ri21 = _mm512_setzero_pd(),
+		        rr22 = _mm512_setzero_pd(), ri22 = _mm512_setzero_pd(),
+		        rr23 = _mm512_setzero_pd(), ri23 = _mm512_setzero_pd();
+
+		#define RD_COL( j, load ) \
+		{ \
+			const __m512d bv = load( b##j ); \
+			const __m512d bs = _mm512_permute_pd( bv, 0x55 ); \
+\
+			rr0##j = _mm512_fmadd_pd( av0, bv, rr0##j ); ri0##j = _mm512_fmadd_pd( av0, bs, ri0##j ); \
+			rr1##j = _mm512_fmadd_pd( av1, bv, rr1##j ); ri1##j = _mm512_fmadd_pd( av1, bs, ri1##j ); \
+			rr2##j = _mm512_fmadd_pd( av2, bv, rr2##j ); ri2##j = _mm512_fmadd_pd( av2, bs, ri2##j ); \
+		}
+
+		#define RD_ITER( load ) \
+		{ \
+			const __m512d av0 = load( a0 ), av1 = load( a1 ), av2 = load( a2 ); \
+\
+			RD_COL( 0, load ) RD_COL( 1, load ) RD_COL( 2, load ) RD_COL( 3, load ) \
+		}
+
+		#define LOADU( p )  _mm512_loadu_pd( p )
+		#define LOADM( p )  _mm512_maskz_loadu_pd( mask_k, p )
+
+		for ( dim_t l = 0; l < k_iter; ++l )
+		{
+			RD_ITER( LOADU );
+
+			a0 += 8; a1 += 8; a2 += 8;
+			b0 += 8; b1 += 8; b2 += 8; b3 += 8;
+		}
+
+		if ( k_left ) RD_ITER( LOADM );
+
+		#undef LOADM
+		#undef LOADU
+		#undef RD_ITER
+		#undef RD_COL
+
+		#define HSUM_ROW( i ) \
+		_mm512_insertf64x4( _mm512_castpd256_pd512( \
+		  bli_zgemmsup_rd_skx_int_hsum4( _mm512_xor_pd( rr##i##0, sgnv_r ), _mm512_xor_pd( ri##i##0, sgnv_i ), \
+		                                 _mm512_xor_pd( rr##i##1, sgnv_r ), _mm512_xor_pd( ri##i##1, sgnv_i ) ) ), \
+		  bli_zgemmsup_rd_skx_int_hsum4( _mm512_xor_pd( rr##i##2, sgnv_r ), _mm512_xor_pd( ri##i##2, sgnv_i ), \
+		                                 _mm512_xor_pd( rr##i##3, sgnv_r ), _mm512_xor_pd( ri##i##3, sgnv_i ) ), 1 )
+
+		__m512d ab[ 3 ];
+		ab[ 0 ] = HSUM_ROW( 0 );
+		ab[ 1 ] = HSUM_ROW( 1 );
+		ab[ 2 ] = HSUM_ROW( 2 );
+
+		#undef HSUM_ROW
+
+		dcomplex* restrict cb = c + ib*rs_c + jb*cs_c;
+
+		if ( cs_c == 1 )
+		{
+			const __mmask8 mask_n = ( __mmask8 )( ( 1u << ( 2*nb ) ) - 1 );
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				double* restrict ci = ( double* )( cb + i*rs_c );
+				__m512d          cv = bli_zgemmsup_rd_skx_int_cmul( ab[ i ], alpha_r, alpha_i );
+
+				if ( !beta0 )
+					cv = _mm512_add_pd( cv, bli_zgemmsup_rd_skx_int_cmul( _mm512_maskz_loadu_pd( mask_n, ci ),
+					                                                      beta_r, beta_i ) );
+
+				_mm512_mask_storeu_pd( ci, mask_n, cv );
+			}
+		}
+		else
+		{
+			dcomplex ct[ 4 ] __attribute__((aligned(64)));
+
+			for ( dim_t i = 0; i < mb; ++i )
+			{
+				_mm512_store_pd( ( double* )ct, ab[ i ] );
+
+				for ( dim_t j = 0; j < nb; ++j )
+				{
+					dcomplex* restrict cij = cb + i*rs_c + j*cs_c;
+
+					if ( beta0 ) { bli_zscal2s( *alpha, ct[ j ], *cij ); }
+					else         { bli_zaxpbys( *alpha, ct[ j ], *beta, *cij ); }
+				}
+			}
+		}
+	}
+}
+
+void bli_zgemmsup_rd_skx_int_6x8m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const dcomplex* restrict ap = a;
+	      dcomplex* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		bli_zgemmsup_rd_skx_int_tile( conja, conjb, bli_min( MR, m0 - i ), n0, k0,
+		                              alpha, ap, rs_a, b, cs_b, beta, cp, rs_c, cs_c );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+}
+
+void bli_zgemmsup_rd_skx_int_6x8n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const dcomplex* restrict bp = b;
+	      dcomplex* restrict cp = c;
+
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t j = 0; j < n0; j += NR )
+	{
+		bli_zgemmsup_rd_skx_int_tile( conja, conjb, m0, bli_min( NR, n0 - j ), k0,
+		                              alpha, a, rs_a, bp, cs_b, beta, cp, rs_c, cs_c );
+
+		bp += ps_b;
+		cp += NR*cs_c;
+	}
+}
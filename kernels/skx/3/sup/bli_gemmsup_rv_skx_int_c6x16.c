@@ -0,0 +1,330 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rv millikernels for single-precision complex sup gemm on AVX-512 hardware.
+
+   These kernels mirror those in bli_gemmsup_rv_skx_int_z6x8.c: each 6x16
+   microtile of C is held in 24 zmm accumulators, which separately collect
+   the products of the real and imaginary parts of A with each row of B
+   (which must be row-stored), and which are combined, conjugated, and
+   scaled after the k loop. The only structural difference is that when C
+   is column-stored, each (64-bit) element is gathered and scattered as a
+   single lane.
+*/
+
+#define MR 6
+#define NR 16
+
+// Expand a macro once for each row of the microtile. (Explicitly naming the
+// accumulators for each row, rather than indexing an array, ensures that
+// they are kept in registers.)
+#define FOR_EACH_ROW( f ) \
+	f( 0 ) f( 1 ) f( 2 ) f( 3 ) f( 4 ) f( 5 )
+
+// Multiply each complex element of x by the scalar whose real and imaginary
+// parts have been broadcast into yr and yi, respectively.
+static inline __attribute__((always_inline)) __m512 bli_cgemmsup_rv_skx_int_cmul
+     (
+       __m512 x,
+       __m512 yr,
+       __m512 yi
+     )
+{
+	return _mm512_fmaddsub_ps( x, yr, _mm512_mul_ps( _mm512_permute_ps( x, 0xb1 ), yi ) );
+}
+
+// Combine the products of the real (pr) and imaginary (pi) parts of A with
+// B into the complex products, applying the conjugation sign masks.
+static inline __attribute__((always_inline)) __m512 bli_cgemmsup_rv_skx_int_combine
+     (
+       __m512 pr,
+       __m512 pi,
+       __m512 sgn_ai,
+       __m512 sgn_cj
+     )
+{
+	pi = _mm512_permute_ps( _mm512_xor_ps( pi, sgn_ai ), 0xb1 );
+
+	return _mm512_xor_ps( _mm512_fmaddsub_ps( pr, _mm512_set1_ps( 1.0f ), pi ), sgn_cj );
+}
+
+// Update one row of a row-stored microtile of C.
+static inline __attribute__((always_inline)) void bli_cgemmsup_rv_skx_int_store_row
+     (
+             __m512   c0,
+             __m512   c1,
+             __mmask16 mask0,
+             __mmask16 mask1,
+       const scomplex* beta,
+             scomplex* c
+     )
+{
+	float* restrict cd = ( float* )c;
+
+	if ( !bli_ceq0( *beta ) )
+	{
+		const __m512 beta_r = _mm512_set1_ps( beta->real );
+		const __m512 beta_i = _mm512_set1_ps( beta->imag );
+
+		c0 = _mm512_add_ps( c0, bli_cgemmsup_rv_skx_int_cmul( _mm512_maskz_loadu_ps( mask0, cd     ), beta_r, beta_i ) );
+		c1 = _mm512_add_ps( c1, bli_cgemmsup_rv_skx_int_cmul( _mm512_maskz_loadu_ps( mask1, cd + 16 ), beta_r, beta_i ) );
+	}
+
+	_mm512_mask_storeu_ps( cd,     mask0, c0 );
+	_mm512_mask_storeu_ps( cd + 16, mask1, c1 );
+}
+
+// Update one row of a column-stored microtile of C. Each element is gathered
+// (scattered) as a single 64-bit lane. This is kept out of line since the
+// gathers and scatters would otherwise bloat each instance of the microtile
+// function.
+static void bli_cgemmsup_rv_skx_int_scatter_row
+     (
+             __m512    c0,
+             __m512    c1,
+             __mmask8  gmask0,
+             __mmask8  gmask1,
+       const scomplex* beta,
+             scomplex* c, inc_t cs_c
+     )
+{
+	double* restrict cd = ( double* )c;
+
+	const __m512i idx0 = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+	                                         _mm512_set1_epi64( cs_c ) );
+	const __m512i idx1 = _mm512_add_epi64( idx0, _mm512_set1_epi64( 8*cs_c ) );
+
+	if ( !bli_ceq0( *beta ) )
+	{
+		const __m512 beta_r = _mm512_set1_ps( beta->real );
+		const __m512 beta_i = _mm512_set1_ps( beta->imag );
+		const __m512d zero  = _mm512_setzero_pd();
+
+		c0 = _mm512_add_ps( c0, bli_cgemmsup_rv_skx_int_cmul( _mm512_castpd_ps( _mm512_mask_i64gather_pd( zero, gmask0, idx0, cd, 8 ) ), beta_r, beta_i ) );
+		c1 = _mm512_add_ps( c1, bli_cgemmsup_rv_skx_int_cmul( _mm512_castpd_ps( _mm512_mask_i64gather_pd( zero, gmask1, idx1, cd, 8 ) ), beta_r, beta_i ) );
+	}
+
+	_mm512_mask_i64scatter_pd( cd, gmask0, idx0, _mm512_castps_pd( c0 ), 8 );
+	_mm512_mask_i64scatter_pd( cd, gmask1, idx1, _mm512_castps_pd( c1 ), 8 );
+}
+
+static inline __attribute__((always_inline)) void bli_cgemmsup_rv_skx_int_tile
+     (
+             conj_t    conja,
+             conj_t    conjb,
+       const dim_t     mr,
+             dim_t     n,
+             dim_t     k,
+       const scomplex* alpha,
+       const scomplex* a, inc_t rs_a, inc_t cs_a,
+       const scomplex* b, inc_t rs_b,
+       const scomplex* beta,
+             scomplex* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	// Each element of C occupies two lanes of a vector load or store, but a
+	// single lane of a gather or scatter.
+	const __mmask8  gmask0 = n >= 8  ? 0xFF : ( __mmask8 )( ( 1u << n ) - 1 );
+	const __mmask8  gmask1 = n >= NR ? 0xFF :
+	                         n >  8  ? ( __mmask8 )( ( 1u << ( n - 8 ) ) - 1 ) : 0;
+	const __mmask16 mask0  = n >= 8  ? 0xFFFF : ( __mmask16 )( ( 1u << ( 2*n ) ) - 1 );
+	const __mmask16 mask1  = n >= NR ? 0xFFFF :
+	                         n >  8  ? ( __mmask16 )( ( 1u << ( 2*( n - 8 ) ) ) - 1 ) : 0;
+
+	#define DECL_ROW( i ) \
+	__m512 pr0_##i = _mm512_setzero_ps(); \
+	__m512 pr1_##i = _mm512_setzero_ps(); \
+	__m512 pi0_##i = _mm512_setzero_ps(); \
+	__m512 pi1_##i = _mm512_setzero_ps();
+
+	FOR_EACH_ROW( DECL_ROW )
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		const __m512 b0 = _mm512_maskz_loadu_ps( mask0, ( const float* )b     );
+		const __m512 b1 = _mm512_maskz_loadu_ps( mask1, ( const float* )b + 16 );
+
+		#define FMA_ROW( i ) \
+		if ( i < mr ) \
+		{ \
+			const __m512 ar = _mm512_set1_ps( a[ i*rs_a ].real ); \
+			const __m512 ai = _mm512_set1_ps( a[ i*rs_a ].imag ); \
+\
+			pr0_##i = _mm512_fmadd_ps( ar, b0, pr0_##i ); \
+			pr1_##i = _mm512_fmadd_ps( ar, b1, pr1_##i ); \
+			pi0_##i = _mm512_fmadd_ps( ai, b0, pi0_##i ); \
+			pi1_##i = _mm512_fmadd_ps( ai, b1, pi1_##i ); \
+		}
+
+		FOR_EACH_ROW( FMA_ROW )
+
+		a += cs_a;
+		b += rs_b;
+	}
+
+	const __m512 sgn_ai  = _mm512_set1_ps( bli_is_conj( conja ) != bli_is_conj( conjb ) ? -0.0f : 0.0f );
+	const __m512 sgn_cj  = bli_is_conj( conjb ) ? _mm512_set_ps( -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f,
+	                                                             -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f )
+	                                             : _mm512_setzero_ps();
+	const __m512 alpha_r = _mm512_set1_ps( alpha->real );
+	const __m512 alpha_i = _mm512_set1_ps( alpha->imag );
+
+	#define AB_ROW( i, j ) \
+	bli_cgemmsup_rv_skx_int_cmul( bli_cgemmsup_rv_skx_int_combine( pr##j##_##i, pi##j##_##i, \
+	                                                               sgn_ai, sgn_cj ), \
+	                              alpha_r, alpha_i )
+
+	#define STORE_ROW( i ) \
+	if ( i < mr ) \
+		bli_cgemmsup_rv_skx_int_store_row( AB_ROW( i, 0 ), AB_ROW( i, 1 ), \
+		                                   mask0, mask1, beta, \
+		                                   c + i*rs_c );
+
+	#define SCATTER_ROW( i ) \
+	if ( i < mr ) \
+		bli_cgemmsup_rv_skx_int_scatter_row( AB_ROW( i, 0 ), AB_ROW( i, 1 ), \
+		                                     gmask0, gmask1, beta, \
+		                                     c + i*rs_c, cs_c );
+
+	if ( cs_c == 1 ) { FOR_EACH_ROW( STORE_ROW ) }
+	else             { FOR_EACH_ROW( SCATTER_ROW ) }
+
+	#undef SCATTER_ROW
+	#undef STORE_ROW
+	#undef AB_ROW
+	#undef FMA_ROW
+	#undef DECL_ROW
+}
+
+// Invoke the microtile function with a row count that is known at
+// compile-time so that the code for any unused rows is eliminated.
+#define TILE_SWITCH( mr, tile ) \
+	switch ( mr ) \
+	{ \
+		case 6: tile( 6 ); break; \
+		case 5: tile( 5 ); break; \
+		case 4: tile( 4 ); break; \
+		case 3: tile( 3 ); break; \
+		case 2: tile( 2 ); break; \
+		case 1: tile( 1 ); break; \
+		default: break; \
+	}
+
+void bli_cgemmsup_rv_skx_int_6x16m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const scomplex* restrict ap = a;
+	      scomplex* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	const dim_t m_iter = m0 / MR;
+	const dim_t m_left = m0 % MR;
+
+	#define TILE_M( mr ) \
+	bli_cgemmsup_rv_skx_int_tile( conja, conjb, mr, n0, k0, alpha, ap, rs_a, cs_a, \
+	                              b, rs_b, beta, cp, rs_c, cs_c )
+
+	for ( dim_t i = 0; i < m_iter; ++i )
+	{
+		TILE_M( MR );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+
+	TILE_SWITCH( m_left, TILE_M );
+
+	#undef TILE_M
+}
+
+void bli_cgemmsup_rv_skx_int_6x16n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	#define TILE_N( mr ) \
+	{ \
+		const scomplex* restrict bp = b; \
+		      scomplex* restrict cp = c; \
+\
+		for ( dim_t j = 0; j < n0; j += NR ) \
+		{ \
+			bli_cgemmsup_rv_skx_int_tile( conja, conjb, mr, bli_min( NR, n0 - j ), k0, \
+			                              alpha, a, rs_a, cs_a, bp, rs_b, beta, \
+			                              cp, rs_c, cs_c ); \
+\
+			bp += ps_b; \
+			cp += NR*cs_c; \
+		} \
+	}
+
+	TILE_SWITCH( m0, TILE_N );
+
+	#undef TILE_N
+}
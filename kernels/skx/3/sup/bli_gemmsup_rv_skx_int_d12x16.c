@@ -0,0 +1,285 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rv millikernels for double-precision sup gemm on AVX-512 hardware.
+
+   These kernels assume that B is row-stored (cs_b == 1). Each 12x16
+   microtile of C is held in 24 zmm accumulators (two per row); each
+   iteration of the k loop loads one row of B into two registers and
+   broadcasts the twelve corresponding elements of A, which may have any
+   row and column stride. Edge cases in the n dimension are handled with
+   masked loads and stores, while edge cases in the m dimension are handled
+   by instantiating the (inlined) microtile function for each possible
+   number of rows. C may be row-stored, in which case it is updated with
+   (masked) vector loads and stores, or column-stored, in which case it is
+   updated with gathers and scatters.
+*/
+
+#define MR 12
+#define NR 16
+
+// Expand a macro once for each row of the microtile. (Explicitly naming the
+// accumulators for each row, rather than indexing an array, ensures that
+// they are kept in registers.)
+#define FOR_EACH_ROW( f ) \
+	f(  0 ) f(  1 ) f(  2 ) f(  3 ) f(  4 ) f(  5 ) \
+	f(  6 ) f(  7 ) f(  8 ) f(  9 ) f( 10 ) f( 11 )
+
+// Update one row of a row-stored microtile of C.
+static inline __attribute__((always_inline)) void bli_dgemmsup_rv_skx_int_store_row
+     (
+             __m512d  c0,
+             __m512d  c1,
+             __mmask8 mask0,
+             __mmask8 mask1,
+       const double*  beta,
+             double*  c
+     )
+{
+	if ( !bli_deq0( *beta ) )
+	{
+		const __m512d betav = _mm512_set1_pd( *beta );
+
+		c0 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( mask0, c     ), c0 );
+		c1 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( mask1, c + 8 ), c1 );
+	}
+
+	_mm512_mask_storeu_pd( c,     mask0, c0 );
+	_mm512_mask_storeu_pd( c + 8, mask1, c1 );
+}
+
+// Update one row of a column-stored microtile of C. This is kept out of
+// line since the gathers and scatters would otherwise bloat each instance
+// of the microtile function.
+static void bli_dgemmsup_rv_skx_int_scatter_row
+     (
+             __m512d  c0,
+             __m512d  c1,
+             __mmask8 mask0,
+             __mmask8 mask1,
+       const double*  beta,
+             double*  c, inc_t cs_c
+     )
+{
+	const __m512i idx0 = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+	                                         _mm512_set1_epi64( cs_c ) );
+	const __m512i idx1 = _mm512_add_epi64( idx0, _mm512_set1_epi64( 8*cs_c ) );
+
+	if ( !bli_deq0( *beta ) )
+	{
+		const __m512d betav = _mm512_set1_pd( *beta );
+		const __m512d zero  = _mm512_setzero_pd();
+
+		c0 = _mm512_fmadd_pd( betav, _mm512_mask_i64gather_pd( zero, mask0, idx0, c, 8 ), c0 );
+		c1 = _mm512_fmadd_pd( betav, _mm512_mask_i64gather_pd( zero, mask1, idx1, c, 8 ), c1 );
+	}
+
+	_mm512_mask_i64scatter_pd( c, mask0, idx0, c0, 8 );
+	_mm512_mask_i64scatter_pd( c, mask1, idx1, c1, 8 );
+}
+
+static inline __attribute__((always_inline)) void bli_dgemmsup_rv_skx_int_tile
+     (
+       const dim_t   mr,
+             dim_t   n,
+             dim_t   k,
+       const double* alpha,
+       const double* a, inc_t rs_a, inc_t cs_a,
+       const double* b, inc_t rs_b,
+       const double* beta,
+             double* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const __mmask8 mask0 = n >= 8  ? 0xFF : ( __mmask8 )( ( 1u << n ) - 1 );
+	const __mmask8 mask1 = n >= NR ? 0xFF :
+	                       n >  8  ? ( __mmask8 )( ( 1u << ( n - 8 ) ) - 1 ) : 0;
+
+	#define DECL_ROW( i ) \
+	__m512d ab0_##i = _mm512_setzero_pd(); \
+	__m512d ab1_##i = _mm512_setzero_pd();
+
+	FOR_EACH_ROW( DECL_ROW )
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		const __m512d b0 = _mm512_maskz_loadu_pd( mask0, b     );
+		const __m512d b1 = _mm512_maskz_loadu_pd( mask1, b + 8 );
+
+		#define FMA_ROW( i ) \
+		if ( i < mr ) \
+		{ \
+			const __m512d ai = _mm512_set1_pd( a[ i*rs_a ] ); \
+\
+			ab0_##i = _mm512_fmadd_pd( ai, b0, ab0_##i ); \
+			ab1_##i = _mm512_fmadd_pd( ai, b1, ab1_##i ); \
+		}
+
+		FOR_EACH_ROW( FMA_ROW )
+
+		a += cs_a;
+		b += rs_b;
+	}
+
+	const __m512d alphav = _mm512_set1_pd( *alpha );
+
+	#define STORE_ROW( i ) \
+	if ( i < mr ) \
+		bli_dgemmsup_rv_skx_int_store_row( _mm512_mul_pd( alphav, ab0_##i ), \
+		                                   _mm512_mul_pd( alphav, ab1_##i ), \
+		                                   mask0, mask1, beta, \
+		                                   c + i*rs_c );
+
+	#define SCATTER_ROW( i ) \
+	if ( i < mr ) \
+		bli_dgemmsup_rv_skx_int_scatter_row( _mm512_mul_pd( alphav, ab0_##i ), \
+		                                     _mm512_mul_pd( alphav, ab1_##i ), \
+		                                     mask0, mask1, beta, \
+		                                     c + i*rs_c, cs_c );
+
+	if ( cs_c == 1 ) { FOR_EACH_ROW( STORE_ROW ) }
+	else             { FOR_EACH_ROW( SCATTER_ROW ) }
+
+	#undef SCATTER_ROW
+	#undef STORE_ROW
+	#undef FMA_ROW
+	#undef DECL_ROW
+}
+
+// Invoke the microtile function with a row count that is known at
+// compile-time so that the code for any unused rows is eliminated.
+#define TILE_SWITCH( mr, tile ) \
+	switch ( mr ) \
+	{ \
+		case 12: tile( 12 ); break; \
+		case 11: tile( 11 ); break; \
+		case 10: tile( 10 ); break; \
+		case  9: tile(  9 ); break; \
+		case  8: tile(  8 ); break; \
+		case  7: tile(  7 ); break; \
+		case  6: tile(  6 ); break; \
+		case  5: tile(  5 ); break; \
+		case  4: tile(  4 ); break; \
+		case  3: tile(  3 ); break; \
+		case  2: tile(  2 ); break; \
+		case  1: tile(  1 ); break; \
+		default: break; \
+	}
+
+void bli_dgemmsup_rv_skx_int_12x16m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const double* restrict ap = a;
+	      double* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	const dim_t m_iter = m0 / MR;
+	const dim_t m_left = m0 % MR;
+
+	#define TILE_M( mr ) \
+	bli_dgemmsup_rv_skx_int_tile( mr, n0, k0, alpha, ap, rs_a, cs_a, \
+	                              b, rs_b, beta, cp, rs_c, cs_c )
+
+	for ( dim_t i = 0; i < m_iter; ++i )
+	{
+		TILE_M( MR );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+
+	TILE_SWITCH( m_left, TILE_M );
+
+	#undef TILE_M
+}
+
+void bli_dgemmsup_rv_skx_int_12x16n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	#define TILE_N( mr ) \
+	{ \
+		const double* restrict bp = b; \
+		      double* restrict cp = c; \
+\
+		for ( dim_t j = 0; j < n0; j += NR ) \
+		{ \
+			bli_dgemmsup_rv_skx_int_tile( mr, bli_min( NR, n0 - j ), k0, alpha, \
+			                              a, rs_a, cs_a, bp, rs_b, beta, \
+			                              cp, rs_c, cs_c ); \
+\
+			bp += ps_b; \
+			cp += NR*cs_c; \
+		} \
+	}
+
+	TILE_SWITCH( m0, TILE_N );
+
+	#undef TILE_N
+}
@@ -0,0 +1,300 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rv millikernels for single-precision sup gemm on AVX-512 hardware.
+
+   These kernels assume that B is row-stored (cs_b == 1). Each 12x32
+   microtile of C is held in 24 zmm accumulators (two per row); each
+   iteration of the k loop loads one row of B into two registers and
+   broadcasts the twelve corresponding elements of A, which may have any
+   row and column stride. Edge cases in the n dimension are handled with
+   masked loads and stores, while edge cases in the m dimension are handled
+   by instantiating the (inlined) microtile function for each possible
+   number of rows. C may be row-stored, in which case it is updated with
+   (masked) vector loads and stores, or column-stored, in which case it is
+   updated with gathers and scatters.
+*/
+
+#define MR 12
+#define NR 32
+
+// Expand a macro once for each row of the microtile. (Explicitly naming the
+// accumulators for each row, rather than indexing an array, ensures that
+// they are kept in registers.)
+#define FOR_EACH_ROW( f ) \
+	f(  0 ) f(  1 ) f(  2 ) f(  3 ) f(  4 ) f(  5 ) \
+	f(  6 ) f(  7 ) f(  8 ) f(  9 ) f( 10 ) f( 11 )
+
+// Update one row of a row-stored microtile of C.
+static inline __attribute__((always_inline)) void bli_sgemmsup_rv_skx_int_store_row
+     (
+             __m512    c0,
+             __m512    c1,
+             __mmask16 mask0,
+             __mmask16 mask1,
+       const float*    beta,
+             float*    c
+     )
+{
+	if ( !bli_seq0( *beta ) )
+	{
+		const __m512 betav = _mm512_set1_ps( *beta );
+
+		c0 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( mask0, c      ), c0 );
+		c1 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( mask1, c + 16 ), c1 );
+	}
+
+	_mm512_mask_storeu_ps( c,      mask0, c0 );
+	_mm512_mask_storeu_ps( c + 16, mask1, c1 );
+}
+
+// Update one row of a column-stored microtile of C. This is kept out of
+// line since the gathers and scatters would otherwise bloat each instance
+// of the microtile function.
+static void bli_sgemmsup_rv_skx_int_scatter_row
+     (
+             __m512    c0,
+             __m512    c1,
+             __mmask16 mask0,
+             __mmask16 mask1,
+       const float*    beta,
+             float*    c, inc_t cs_c
+     )
+{
+	// Gather and scatter eight elements at a time so that 64-bit indices
+	// may be used (and thus large column strides do not overflow).
+	const __m512i  idx   = _mm512_mullo_epi64( _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ),
+	                                           _mm512_set1_epi64( cs_c ) );
+	const __m256   betav = _mm256_set1_ps( *beta );
+	const bool     beta0 = bli_seq0( *beta );
+
+	const __mmask8 mask[ 4 ] =
+	{
+		( __mmask8 )( mask0 ), ( __mmask8 )( mask0 >> 8 ),
+		( __mmask8 )( mask1 ), ( __mmask8 )( mask1 >> 8 )
+	};
+	__m256 cv[ 4 ] =
+	{
+		_mm512_castps512_ps256( c0 ), _mm512_extractf32x8_ps( c0, 1 ),
+		_mm512_castps512_ps256( c1 ), _mm512_extractf32x8_ps( c1, 1 )
+	};
+
+	for ( dim_t h = 0; h < 4; ++h )
+	{
+		float* restrict ch = c + 8*h*cs_c;
+
+		if ( !beta0 )
+			cv[ h ] = _mm256_fmadd_ps( betav,
+			                           _mm512_mask_i64gather_ps( _mm256_setzero_ps(),
+			                                                     mask[ h ], idx, ch, 4 ),
+			                           cv[ h ] );
+
+		_mm512_mask_i64scatter_ps( ch, mask[ h ], idx, cv[ h ], 4 );
+	}
+}
+
+static inline __attribute__((always_inline)) void bli_sgemmsup_rv_skx_int_tile
+     (
+       const dim_t  mr,
+             dim_t  n,
+             dim_t  k,
+       const float* alpha,
+       const float* a, inc_t rs_a, inc_t cs_a,
+       const float* b, inc_t rs_b,
+       const float* beta,
+             float* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const __mmask16 mask0 = n >= 16 ? 0xFFFF : ( __mmask16 )( ( 1u << n ) - 1 );
+	const __mmask16 mask1 = n >= NR ? 0xFFFF :
+	                        n >  16 ? ( __mmask16 )( ( 1u << ( n - 16 ) ) - 1 ) : 0;
+
+	#define DECL_ROW( i ) \
+	__m512 ab0_##i = _mm512_setzero_ps(); \
+	__m512 ab1_##i = _mm512_setzero_ps();
+
+	FOR_EACH_ROW( DECL_ROW )
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		const __m512 b0 = _mm512_maskz_loadu_ps( mask0, b      );
+		const __m512 b1 = _mm512_maskz_loadu_ps( mask1, b + 16 );
+
+		#define FMA_ROW( i ) \
+		if ( i < mr ) \
+		{ \
+			const __m512 ai = _mm512_set1_ps( a[ i*rs_a ] ); \
+\
+			ab0_##i = _mm512_fmadd_ps( ai, b0, ab0_##i ); \
+			ab1_##i = _mm512_fmadd_ps( ai, b1, ab1_##i ); \
+		}
+
+		FOR_EACH_ROW( FMA_ROW )
+
+		a += cs_a;
+		b += rs_b;
+	}
+
+	const __m512 alphav = _mm512_set1_ps( *alpha );
+
+	#define STORE_ROW( i ) \
+	if ( i < mr ) \
+		bli_sgemmsup_rv_skx_int_store_row( _mm512_mul_ps( alphav, ab0_##i ), \
+		                                   _mm512_mul_ps( alphav, ab1_##i ), \
+		                                   mask0, mask1, beta, \
+		                                   c + i*rs_c );
+
+	#define SCATTER_ROW( i ) \
+	if ( i < mr ) \
+		bli_sgemmsup_rv_skx_int_scatter_row( _mm512_mul_ps( alphav, ab0_##i ), \
+		                                     _mm512_mul_ps( alphav, ab1_##i ), \
+		                                     mask0, mask1, beta, \
+		                                     c + i*rs_c, cs_c );
+
+	if ( cs_c == 1 ) { FOR_EACH_ROW( STORE_ROW ) }
+	else             { FOR_EACH_ROW( SCATTER_ROW ) }
+
+	#undef SCATTER_ROW
+	#undef STORE_ROW
+	#undef FMA_ROW
+	#undef DECL_ROW
+}
+
+// Invoke the microtile function with a row count that is known at
+// compile-time so that the code for any unused rows is eliminated.
+#define TILE_SWITCH( mr, tile ) \
+	switch ( mr ) \
+	{ \
+		case 12: tile( 12 ); break; \
+		case 11: tile( 11 ); break; \
+		case 10: tile( 10 ); break; \
+		case  9: tile(  9 ); break; \
+		case  8: tile(  8 ); break; \
+		case  7: tile(  7 ); break; \
+		case  6: tile(  6 ); break; \
+		case  5: tile(  5 ); break; \
+		case  4: tile(  4 ); break; \
+		case  3: tile(  3 ); break; \
+		case  2: tile(  2 ); break; \
+		case  1: tile(  1 ); break; \
+		default: break; \
+	}
+
+void bli_sgemmsup_rv_skx_int_12x32m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const float* restrict ap = a;
+	      float* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	const dim_t m_iter = m0 / MR;
+	const dim_t m_left = m0 % MR;
+
+	#define TILE_M( mr ) \
+	bli_sgemmsup_rv_skx_int_tile( mr, n0, k0, alpha, ap, rs_a, cs_a, \
+	                              b, rs_b, beta, cp, rs_c, cs_c )
+
+	for ( dim_t i = 0; i < m_iter; ++i )
+	{
+		TILE_M( MR );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+
+	TILE_SWITCH( m_left, TILE_M );
+
+	#undef TILE_M
+}
+
+void bli_sgemmsup_rv_skx_int_12x32n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	#define TILE_N( mr ) \
+	{ \
+		const float* restrict bp = b; \
+		      float* restrict cp = c; \
+\
+		for ( dim_t j = 0; j < n0; j += NR ) \
+		{ \
+			bli_sgemmsup_rv_skx_int_tile( mr, bli_min( NR, n0 - j ), k0, alpha, \
+			                              a, rs_a, cs_a, bp, rs_b, beta, \
+			                              cp, rs_c, cs_c ); \
+\
+			bp += ps_b; \
+			cp += NR*cs_c; \
+		} \
+	}
+
+	TILE_SWITCH( m0, TILE_N );
+
+	#undef TILE_N
+}
@@ -32,10 +32,105 @@
 
 */
 
+// -- level-1v --
+
+AMAXV_KER_PROT( float,    s, amaxv_skx_int )
+AMAXV_KER_PROT( double,   d, amaxv_skx_int )
+AMAXV_KER_PROT( scomplex, c, amaxv_skx_int )
+AMAXV_KER_PROT( dcomplex, z, amaxv_skx_int )
+
+AXPYV_KER_PROT( float,    s, axpyv_skx_int )
+AXPYV_KER_PROT( double,   d, axpyv_skx_int )
+AXPYV_KER_PROT( scomplex, c, axpyv_skx_int )
+AXPYV_KER_PROT( dcomplex, z, axpyv_skx_int )
+
+COPYV_KER_PROT( float,    s, copyv_skx_int )
+COPYV_KER_PROT( double,   d, copyv_skx_int )
+COPYV_KER_PROT( scomplex, c, copyv_skx_int )
+COPYV_KER_PROT( dcomplex, z, copyv_skx_int )
+
+DOTV_KER_PROT( float,    s, dotv_skx_int )
+DOTV_KER_PROT( double,   d, dotv_skx_int )
+DOTV_KER_PROT( scomplex, c, dotv_skx_int )
+DOTV_KER_PROT( dcomplex, z, dotv_skx_int )
+
+DOTXV_KER_PROT( float,    s, dotxv_skx_int )
+DOTXV_KER_PROT( double,   d, dotxv_skx_int )
+DOTXV_KER_PROT( scomplex, c, dotxv_skx_int )
+DOTXV_KER_PROT( dcomplex, z, dotxv_skx_int )
+
+SCALV_KER_PROT( float,    s, scalv_skx_int )
+SCALV_KER_PROT( double,   d, scalv_skx_int )
+SCALV_KER_PROT( scomplex, c, scalv_skx_int )
+SCALV_KER_PROT( dcomplex, z, scalv_skx_int )
+
+SETV_KER_PROT( float,    s, setv_skx_int )
+SETV_KER_PROT( double,   d, setv_skx_int )
+SETV_KER_PROT( scomplex, c, setv_skx_int )
+SETV_KER_PROT( dcomplex, z, setv_skx_int )
+
+SWAPV_KER_PROT( float,    s, swapv_skx_int )
+SWAPV_KER_PROT( double,   d, swapv_skx_int )
+SWAPV_KER_PROT( scomplex, c, swapv_skx_int )
+SWAPV_KER_PROT( dcomplex, z, swapv_skx_int )
+
+// -- level-1f --
+
+AXPYF_KER_PROT( float,    s, axpyf_skx_int_8 )
+AXPYF_KER_PROT( double,   d, axpyf_skx_int_8 )
+AXPYF_KER_PROT( scomplex, c, axpyf_skx_int_8 )
+AXPYF_KER_PROT( dcomplex, z, axpyf_skx_int_8 )
+
+DOTXF_KER_PROT( float,    s, dotxf_skx_int_8 )
+DOTXF_KER_PROT( double,   d, dotxf_skx_int_8 )
+DOTXF_KER_PROT( scomplex, c, dotxf_skx_int_8 )
+DOTXF_KER_PROT( dcomplex, z, dotxf_skx_int_8 )
+
+PACKM_KER_PROT( float,       s, packm_skx_int_32x12 )
+PACKM_KER_PROT( double,      d, packm_skx_int_16x14 )
+
+PACKM_KER_PROT( float,      sb, packm_skx_int_32x12 )
+PACKM_KER_PROT( float,      sh, packm_skx_int_32x12 )
+PACKM_KER_PROT( float,      sb, packm_skx_int_32x12_dpbf16 )
+
+PACKM_DIAG_KER_PROT( float,  s, packm_diag_skx_int_32x12 )
+PACKM_DIAG_KER_PROT( double, d, packm_diag_skx_int_16x14 )
+
 GEMM_UKR_PROT( float ,   s, gemm_skx_asm_32x12_l2 )
 GEMM_UKR_PROT( float ,   s, gemm_skx_asm_12x32_l2 )
+GEMM_UKR_PROT( float ,  sb, gemm_skx_asm_32x12_l2 )
+GEMM_UKR_PROT( int32_t, u8s8s32, gemm_skx_int_32x12 )
+GEMM_UKR_PROT( int32_t, u8s8s32, gemm_skx_int_32x12_vnni )
 
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
+GEMM_UKR_PROT( scomplex, c, gemm_skx_asm_24x4 )
+GEMM_UKR_PROT( dcomplex, z, gemm_skx_asm_12x4 )
+
+GEMMTRSM_UKR_PROT( float,  s, gemmtrsm_l_skx_int_32x12 )
+GEMMTRSM_UKR_PROT( float,  s, gemmtrsm_u_skx_int_32x12 )
+GEMMTRSM_UKR_PROT( double, d, gemmtrsm_l_skx_int_16x14 )
+GEMMTRSM_UKR_PROT( double, d, gemmtrsm_u_skx_int_16x14 )
+
+
+
+GEMMSUP_KER_PROT( float,   s, gemmsup_rv_skx_int_12x32m )
+GEMMSUP_KER_PROT( float,   s, gemmsup_rv_skx_int_12x32n )
+GEMMSUP_KER_PROT( float,   s, gemmsup_rd_skx_int_12x32m )
+GEMMSUP_KER_PROT( float,   s, gemmsup_rd_skx_int_12x32n )
+
+GEMMSUP_KER_PROT( double,  d, gemmsup_rv_skx_int_12x16m )
+GEMMSUP_KER_PROT( double,  d, gemmsup_rv_skx_int_12x16n )
+GEMMSUP_KER_PROT( double,  d, gemmsup_rd_skx_int_12x16m )
+GEMMSUP_KER_PROT( double,  d, gemmsup_rd_skx_int_12x16n )
+
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rv_skx_int_6x16m )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rv_skx_int_6x16n )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rd_skx_int_6x16m )
+GEMMSUP_KER_PROT( scomplex, c, gemmsup_rd_skx_int_6x16n )
 
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rv_skx_int_6x8m )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rv_skx_int_6x8n )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rd_skx_int_6x8m )
+GEMMSUP_KER_PROT( dcomplex, z, gemmsup_rd_skx_int_6x8n )
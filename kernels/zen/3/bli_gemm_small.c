@@ -272,7 +272,8 @@ static err_t bli_sgemm_small
 
         // Get the current size of the buffer pool for A block packing.
         // We will use the same size to avoid pool re-initialization 
-        siz_t buffer_size = bli_pool_block_size(bli_pba_pool(bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
+        siz_t buffer_size = bli_pool_block_size(bli_pba_pool(bli_pba_curr_node(bli_rntm_pba(&rntm)),
+                                                bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
                                                 bli_rntm_pba(&rntm)));
 
         // Based on the available memory in the buffer we will decide if 
@@ -1838,7 +1839,8 @@ static err_t bli_dgemm_small
         // Get the current size of the buffer pool for A block packing.
         // We will use the same size to avoid pool re-initliazaton 
         siz_t buffer_size = bli_pool_block_size(
-            bli_pba_pool(bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
+            bli_pba_pool(bli_pba_curr_node(bli_rntm_pba(&rntm)),
+                            bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
                             bli_rntm_pba(&rntm)));
 
         //
@@ -0,0 +1,296 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rd millikernels for single-precision complex sup gemm on AVX2 hardware.
+
+   These kernels assume that A is row-stored (cs_a == 1) and B is
+   column-stored (rs_b == 1), so that each element of C is the dot product
+   of two contiguous vectors. A 3x8 microtile of C is computed as a sequence
+   of 3x2 blocks. For each element of a block, two ymm registers accumulate
+   the elementwise products of a with b and of a with b with its real and
+   imaginary parts swapped (with the k edge handled via masked loads).
+   Conjugation of a and/or b is applied after the k loop by flipping the
+   sign bits of the affected lanes before the accumulators are reduced (see
+   bli_gemmsup_rd_zen_int_z3x4.c). Rows and columns beyond the edge of the
+   microtile are computed redundantly (by repeating the last valid row or
+   column) and then discarded when C is updated.
+*/
+
+#define MR 3
+#define NR 8
+
+// Reduce the accumulators of two elements to a single xmm register holding
+// the sums of their lanes: { sum(rr0), sum(ri0), sum(rr1), sum(ri1) }.
+static inline __attribute__((always_inline)) __m128 bli_cgemmsup_rd_zen_int_hsum2
+     (
+       __m256 rr0,
+       __m256 ri0,
+       __m256 rr1,
+       __m256 ri1
+     )
+{
+	const __m256 t = _mm256_hadd_ps( _mm256_hadd_ps( rr0, ri0 ),
+	                                 _mm256_hadd_ps( rr1, ri1 ) );
+
+	return _mm_add_ps( _mm256_castps256_ps128( t ),
+	                   _mm256_extractf128_ps( t, 1 ) );
+}
+
+// Multiply each complex element of x by the scalar whose real and imaginary
+// parts have been broadcast into yr and yi, respectively.
+static inline __attribute__((always_inline)) __m128 bli_cgemmsup_rd_zen_int_cmul
+     (
+       __m128 x,
+       __m128 yr,
+       __m128 yi
+     )
+{
+	return _mm_fmaddsub_ps( x, yr, _mm_mul_ps( _mm_permute_ps( x, 0xb1 ), yi ) );
+}
+
+static void bli_cgemmsup_rd_zen_int_tile
+     (
+             conj_t    conja,
+             conj_t    conjb,
+             dim_t     mr,
+             dim_t     nr,
+             dim_t     k,
+       const scomplex* alpha,
+       const scomplex* a, inc_t rs_a,
+       const scomplex* b, inc_t cs_b,
+       const scomplex* beta,
+             scomplex* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t   k_iter = k / 4;
+	const dim_t   k_left = k % 4;
+	const __m256i mask_k = _mm256_cmpgt_epi32( _mm256_set1_epi32( 2*k_left ),
+	                                           _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+
+	// The real part of each dot product is the sum of the even lanes of rr
+	// minus the sum of its odd lanes, unless exactly one of a and b is
+	// conjugated. The imaginary part is the sum of the lanes of ri, with
+	// the even (odd) lanes negated if b (a) is conjugated.
+	const float  sgn_r  = ( conja == conjb ) ? -0.0f : 0.0f;
+	const float  sgn_ie = bli_is_conj( conjb ) ? -0.0f : 0.0f;
+	const float  sgn_io = bli_is_conj( conja ) ? -0.0f : 0.0f;
+	const __m256 sgnv_r = _mm256_setr_ps( 0.0f, sgn_r, 0.0f, sgn_r,
+	                                      0.0f, sgn_r, 0.0f, sgn_r );
+	const __m256 sgnv_i = _mm256_setr_ps( sgn_ie, sgn_io, sgn_ie, sgn_io,
+	                                      sgn_ie, sgn_io, sgn_ie, sgn_io );
+
+	const __m128 alpha_r = _mm_broadcast_ss( &alpha->real );
+	const __m128 alpha_i = _mm_broadcast_ss( &alpha->imag );
+	const __m128 beta_r  = _mm_broadcast_ss( &beta->real );
+	const __m128 beta_i  = _mm_broadcast_ss( &beta->imag );
+	const bool   beta0   = bli_ceq0( *beta );
+
+	const float* restrict a0 = ( const float* )( a + bli_min( 0, mr - 1 )*rs_a );
+	const float* restrict a1 = ( const float* )( a + bli_min( 1, mr - 1 )*rs_a );
+	const float* restrict a2 = ( const float* )( a + bli_min( 2, mr - 1 )*rs_a );
+
+	for ( dim_t jb = 0; jb < nr; jb += 2 )
+	{
+		const dim_t nb = bli_min( 2, nr - jb );
+
+		const float* restrict ap0 = a0;
+		const float* restrict ap1 = a1;
+		const float* restrict ap2 = a2;
+		const float* restrict bp0 = ( const float* )( b + ( jb + bli_min( 0, nb - 1 ) )*cs_b );
+		const float* restrict bp1 = ( const float* )( b + ( jb + bli_min( 1, nb - 1 ) )*cs_b );
+
+		__m256 rr00 = _mm256_setzero_ps(), ri00 = _mm256_setzero_ps(),
+		       rr01 = _mm256_setzero_ps(), ri01 = _mm256_setzero_ps(),
+		       rr10 = _mm256_setzero_ps(), ri10 = _mm256_setzero_ps(),
+		       rr11 = _mm256_setzero_ps(), ri11 = _mm256_setzero_ps(),
+		       rr20 = _mm256_setzero_ps(), ri20 = _mm256_setzero_ps(),
+		       rr21 = _mm256_setzero_ps(), ri21 = _mm256_setzero_ps();
+
+		#define RD_ITER( load ) \
+		{ \
+			const __m256 av0 = load( ap0 ), av1 = load( ap1 ), av2 = load( ap2 ); \
+\
+			const __m256 bv0 = load( bp0 ); \
+			const __m256 bs0 = _mm256_permute_ps( bv0, 0xb1 ); \
+\
+			rr00 = _mm256_fmadd_ps( av0, bv0, rr00 ); ri00 = _mm256_fmadd_ps( av0, bs0, ri00 ); \
+			rr10 = _mm256_fmadd_ps( av1, bv0, rr10 ); ri10 = _mm256_fmadd_ps( av1, bs0, ri10 ); \
+			rr20 = _mm256_fmadd_ps( av2, bv0, rr20 ); ri20 = _mm256_fmadd_ps( av2, bs0, ri20 ); \
+\
+			const __m256 bv1 = load( bp1 ); \
+			const __m256 bs1 = _mm256_permute_ps( bv1, 0xb1 ); \
+\
+			rr01 = _mm256_fmadd_ps( av0, bv1, rr01 ); ri01 = _mm256_fmadd_ps( av0, bs1, ri01 ); \
+			rr11 = _mm256_fmadd_ps( av1, bv1, rr11 ); ri11 = _mm256_fmadd_ps( av1, bs1, ri11 ); \
+			rr21 = _mm256_fmadd_ps( av2, bv1, rr21 ); ri21 = _mm256_fmadd_ps( av2, bs1, ri21 ); \
+		}
+
+		#define LOADU( p )  _mm256_loadu_ps( p )
+		#define LOADM( p )  _mm256_maskload_ps( p, mask_k )
+
+		for ( dim_t l = 0; l < k_iter; ++l )
+		{
+			RD_ITER( LOADU );
+
+			ap0 += 8; ap1 += 8; ap2 += 8;
+			bp0 += 8; bp1 += 8;
+		}
+
+		if ( k_left ) RD_ITER( LOADM );
+
+		#undef LOADM
+		#undef LOADU
+		#undef RD_ITER
+
+		#define HSUM_ROW( i ) \
+		bli_cgemmsup_rd_zen_int_hsum2( _mm256_xor_ps( rr##i##0, sgnv_r ), \
+		                               _mm256_xor_ps( ri##i##0, sgnv_i ), \
+		                               _mm256_xor_ps( rr##i##1, sgnv_r ), \
+		                               _mm256_xor_ps( ri##i##1, sgnv_i ) )
+
+		__m128 ab[ 3 ];
+		ab[ 0 ] = HSUM_ROW( 0 );
+		ab[ 1 ] = HSUM_ROW( 1 );
+		ab[ 2 ] = HSUM_ROW( 2 );
+
+		#undef HSUM_ROW
+
+		scomplex* restrict cb = c + jb*cs_c;
+
+		if ( cs_c == 1 )
+		{
+			const __m128i mask_n = _mm_cmpgt_epi32( _mm_set1_epi32( 2*nb ),
+			                                        _mm_setr_epi32( 0, 1, 2, 3 ) );
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				float* restrict ci = ( float* )( cb + i*rs_c );
+				__m128          cv = bli_cgemmsup_rd_zen_int_cmul( ab[ i ], alpha_r, alpha_i );
+
+				if ( !beta0 )
+					cv = _mm_add_ps( cv, bli_cgemmsup_rd_zen_int_cmul( _mm_maskload_ps( ci, mask_n ),
+					                                                   beta_r, beta_i ) );
+
+				_mm_maskstore_ps( ci, mask_n, cv );
+			}
+		}
+		else
+		{
+			scomplex ct[ 2 ] __attribute__((aligned(16)));
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				_mm_store_ps( ( float* )ct, ab[ i ] );
+
+				for ( dim_t j = 0; j < nb; ++j )
+				{
+					scomplex* restrict cij = cb + i*rs_c + j*cs_c;
+
+					if ( beta0 ) { bli_cscal2s( *alpha, ct[ j ], *cij ); }
+					else         { bli_caxpbys( *alpha, ct[ j ], *beta, *cij ); }
+				}
+			}
+		}
+	}
+}
+
+void bli_cgemmsup_rd_zen_int_3x8m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const scomplex* restrict ap = a;
+	      scomplex* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		bli_cgemmsup_rd_zen_int_tile( conja, conjb, bli_min( MR, m0 - i ), n0, k0,
+		                              alpha, ap, rs_a, b, cs_b, beta, cp, rs_c, cs_c );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+}
+
+void bli_cgemmsup_rd_zen_int_3x8n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const scomplex* restrict bp = b;
+	      scomplex* restrict cp = c;
+
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t j = 0; j < n0; j += NR )
+	{
+		bli_cgemmsup_rd_zen_int_tile( conja, conjb, m0, bli_min( NR, n0 - j ), k0,
+		                              alpha, a, rs_a, bp, cs_b, beta, cp, rs_c, cs_c );
+
+		bp += ps_b;
+		cp += NR*cs_c;
+	}
+}
@@ -0,0 +1,295 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/*
+   rd millikernels for double-precision complex sup gemm on AVX2 hardware.
+
+   These kernels assume that A is row-stored (cs_a == 1) and B is
+   column-stored (rs_b == 1), so that each element of C is the dot product
+   of two contiguous vectors. A 3x4 microtile of C is computed as a pair of
+   3x2 blocks. For each element of a block, two ymm registers accumulate
+   the elementwise products of a with b and of a with b with its real and
+   imaginary parts swapped (with the k edge handled via masked loads).
+   Conjugation of a and/or b only changes the signs with which the lanes of
+   these accumulators enter the real and imaginary parts of the dot product,
+   so it is applied once, after the k loop, by flipping the sign bits of the
+   affected lanes before the accumulators are reduced. Rows and columns beyond
+   the edge of the microtile are computed redundantly (by repeating the last
+   valid row or column) and then discarded when C is updated.
+*/
+
+#define MR 3
+#define NR 4
+
+// Reduce the accumulators of two elements to a single ymm register holding
+// the sums of their lanes: { sum(rr0), sum(ri0), sum(rr1), sum(ri1) }.
+static inline __attribute__((always_inline)) __m256d bli_zgemmsup_rd_zen_int_hsum2
+     (
+       __m256d rr0,
+       __m256d ri0,
+       __m256d rr1,
+       __m256d ri1
+     )
+{
+	const __m256d t0 = _mm256_hadd_pd( rr0, ri0 );
+	const __m256d t1 = _mm256_hadd_pd( rr1, ri1 );
+
+	return _mm256_add_pd( _mm256_permute2f128_pd( t0, t1, 0x20 ),
+	                      _mm256_permute2f128_pd( t0, t1, 0x31 ) );
+}
+
+// Multiply each complex element of x by the scalar whose real and imaginary
+// parts have been broadcast into yr and yi, respectively.
+static inline __attribute__((always_inline)) __m256d bli_zgemmsup_rd_zen_int_cmul
+     (
+       __m256d x,
+       __m256d yr,
+       __m256d yi
+     )
+{
+	return _mm256_fmaddsub_pd( x, yr, _mm256_mul_pd( _mm256_permute_pd( x, 0x5 ), yi ) );
+}
+
+static void bli_zgemmsup_rd_zen_int_tile
+     (
+             conj_t    conja,
+             conj_t    conjb,
+             dim_t     mr,
+             dim_t     nr,
+             dim_t     k,
+       const dcomplex* alpha,
+       const dcomplex* a, inc_t rs_a,
+       const dcomplex* b, inc_t cs_b,
+       const dcomplex* beta,
+             dcomplex* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t   k_iter = k / 2;
+	const dim_t   k_left = k % 2;
+	const __m256i mask_k = _mm256_cmpgt_epi64( _mm256_set1_epi64x( 2*k_left ),
+	                                           _mm256_setr_epi64x( 0, 1, 2, 3 ) );
+
+	// The real part of each dot product is the sum of the even lanes of rr
+	// minus the sum of its odd lanes, unless exactly one of a and b is
+	// conjugated. The imaginary part is the sum of the lanes of ri, with
+	// the even (odd) lanes negated if b (a) is conjugated.
+	const double  sgn_r  = ( conja == conjb ) ? -0.0 : 0.0;
+	const double  sgn_ie = bli_is_conj( conjb ) ? -0.0 : 0.0;
+	const double  sgn_io = bli_is_conj( conja ) ? -0.0 : 0.0;
+	const __m256d sgnv_r = _mm256_setr_pd( 0.0, sgn_r, 0.0, sgn_r );
+	const __m256d sgnv_i = _mm256_setr_pd( sgn_ie, sgn_io, sgn_ie, sgn_io );
+
+	const __m256d alpha_r = _mm256_broadcast_sd( &alpha->real );
+	const __m256d alpha_i = _mm256_broadcast_sd( &alpha->imag );
+	const __m256d beta_r  = _mm256_broadcast_sd( &beta->real );
+	const __m256d beta_i  = _mm256_broadcast_sd( &beta->imag );
+	const bool    beta0   = bli_zeq0( *beta );
+
+	const double* restrict a0 = ( const double* )( a + bli_min( 0, mr - 1 )*rs_a );
+	const double* restrict a1 = ( const double* )( a + bli_min( 1, mr - 1 )*rs_a );
+	const double* restrict a2 = ( const double* )( a + bli_min( 2, mr - 1 )*rs_a );
+
+	for ( dim_t jb = 0; jb < nr; jb += 2 )
+	{
+		const dim_t nb = bli_min( 2, nr - jb );
+
+		const double* restrict ap0 = a0;
+		const double* restrict ap1 = a1;
+		const double* restrict ap2 = a2;
+		const double* restrict bp0 = ( const double* )( b + ( jb + bli_min( 0, nb - 1 ) )*cs_b );
+		const double* restrict bp1 = ( const double* )( b + ( jb + bli_min( 1, nb - 1 ) )*cs_b );
+
+		__m256d rr00 = _mm256_setzero_pd(), ri00 = _mm256_setzero_pd(),
+		        rr01 = _mm256_setzero_pd(), ri01 = _mm256_setzero_pd(),
+		        rr10 = _mm256_setzero_pd(), ri10 = _mm256_setzero_pd(),
+		        rr11 = _mm256_setzero_pd(), ri11 = _mm256_setzero_pd(),
+		        rr20 = _mm256_setzero_pd(), ri20 = _mm256_setzero_pd(),
+		        rr21 = _mm256_setzero_pd(), ri21 = _mm256_setzero_pd();
+
+		#define RD_ITER( load ) \
+		{ \
+			const __m256d av0 = load( ap0 ), av1 = load( ap1 ), av2 = load( ap2 ); \
+\
+			const __m256d bv0 = load( bp0 ); \
+			const __m256d bs0 = _mm256_permute_pd( bv0, 0x5 ); \
+\
+			rr00 = _mm256_fmadd_pd( av0, bv0, rr00 ); ri00 = _mm256_fmadd_pd( av0, bs0, ri00 ); \
+			rr10 = _mm256_fmadd_pd( av1, bv0, rr10 ); ri10 = _mm256_fmadd_pd( av1, bs0, ri10 ); \
+			rr20 = _mm256_fmadd_pd( av2, bv0, rr20 ); ri20 = _mm256_fmadd_pd( av2, bs0, ri20 ); \
+\
+			const __m256d bv1 = load( bp1 ); \
+			const __m256d bs1 = _mm256_permute_pd( bv1, 0x5 ); \
+\
+			rr01 = _mm256_fmadd_pd( av0, bv1, rr01 ); ri01 = _mm256_fmadd_pd( av0, bs1, ri01 ); \
+			rr11 = _mm256_fmadd_pd( av1, bv1, rr11 ); ri11 = _mm256_fmadd_pd( av1, bs1, ri11 ); \
+			rr21 = _mm256_fmadd_pd( av2, bv1, rr21 ); ri21 = _mm256_fmadd_pd( av2, bs1, ri21 ); \
+		}
+
+		#define LOADU( p )  _mm256_loadu_pd( p )
+		#define LOADM( p )  _mm256_maskload_pd( p, mask_k )
+
+		for ( dim_t l = 0; l < k_iter; ++l )
+		{
+			RD_ITER( LOADU );
+
+			ap0 += 4; ap1 += 4; ap2 += 4;
+			bp0 += 4; bp1 += 4;
+		}
+
+		if ( k_left ) RD_ITER( LOADM );
+
+		#undef LOADM
+		#undef LOADU
+		#undef RD_ITER
+
+		#define HSUM_ROW( i ) \
+		bli_zgemmsup_rd_zen_int_hsum2( _mm256_xor_pd( rr##i##0, sgnv_r ), \
+		                               _mm256_xor_pd( ri##i##0, sgnv_i ), \
+		                               _mm256_xor_pd( rr##i##1, sgnv_r ), \
+		                               _mm256_xor_pd( ri##i##1, sgnv_i ) )
+
+		__m256d ab[ 3 ];
+		ab[ 0 ] = HSUM_ROW( 0 );
+		ab[ 1 ] = HSUM_ROW( 1 );
+		ab[ 2 ] = HSUM_ROW( 2 );
+
+		#undef HSUM_ROW
+
+		dcomplex* restrict cb = c + jb*cs_c;
+
+		if ( cs_c == 1 )
+		{
+			const __m256i mask_n = _mm256_cmpgt_epi64( _mm256_set1_epi64x( 2*nb ),
+			                                           _mm256_setr_epi64x( 0, 1, 2, 3 ) );
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				double* restrict ci = ( double* )( cb + i*rs_c );
+				__m256d          cv = bli_zgemmsup_rd_zen_int_cmul( ab[ i ], alpha_r, alpha_i );
+
+				if ( !beta0 )
+					cv = _mm256_add_pd( cv, bli_zgemmsup_rd_zen_int_cmul( _mm256_maskload_pd( ci, mask_n ),
+					                                                      beta_r, beta_i ) );
+
+				_mm256_maskstore_pd( ci, mask_n, cv );
+			}
+		}
+		else
+		{
+			dcomplex ct[ 2 ] __attribute__((aligned(32)));
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				_mm256_store_pd( ( double* )ct, ab[ i ] );
+
+				for ( dim_t j = 0; j < nb; ++j )
+				{
+					dcomplex* restrict cij = cb + i*rs_c + j*cs_c;
+
+					if ( beta0 ) { bli_zscal2s( *alpha, ct[ j ], *cij ); }
+					else         { bli_zaxpbys( *alpha, ct[ j ], *beta, *cij ); }
+				}
+			}
+		}
+	}
+}
+
+void bli_zgemmsup_rd_zen_int_3x4m
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const dcomplex* restrict ap = a;
+	      dcomplex* restrict cp = c;
+
+	// The m dimension is traversed in units of MR rows, with each micropanel
+	// of A separated by the panel stride.
+	const inc_t ps_a = bli_auxinfo_ps_a( data );
+
+	for ( dim_t i = 0; i < m0; i += MR )
+	{
+		bli_zgemmsup_rd_zen_int_tile( conja, conjb, bli_min( MR, m0 - i ), n0, k0,
+		                              alpha, ap, rs_a, b, cs_b, beta, cp, rs_c, cs_c );
+
+		ap += ps_a;
+		cp += MR*rs_c;
+	}
+}
+
+void bli_zgemmsup_rd_zen_int_3x4n
+     (
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a, inc_t cs_a,
+       const void*      b, inc_t rs_b, inc_t cs_b,
+       const void*      beta,
+             void*      c, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const dcomplex* restrict bp = b;
+	      dcomplex* restrict cp = c;
+
+	// The n dimension is traversed in units of NR columns, with each
+	// micropanel of B separated by the panel stride.
+	const inc_t ps_b = bli_auxinfo_ps_b( data );
+
+	for ( dim_t j = 0; j < n0; j += NR )
+	{
+		bli_zgemmsup_rd_zen_int_tile( conja, conjb, m0, bli_min( NR, n0 - j ), k0,
+		                              alpha, a, rs_a, bp, cs_b, beta, cp, rs_c, cs_c );
+
+		bp += ps_b;
+		cp += NR*cs_c;
+	}
+}
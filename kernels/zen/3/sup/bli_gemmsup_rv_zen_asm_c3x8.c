@@ -38,6 +38,17 @@
 #define BLIS_ASM_SYNTAX_ATT
 #include "bli_x86_asm_macros.h"
 
+// Sign masks, indexed by [conja][conjb], that the kernels below xor into
+// their accumulators to implement conjugation. The first element negates
+// the a.imag*b products when exactly one of a and b is conjugated; the
+// remaining pair conjugates the final a*b products when b is conjugated,
+// since a*conj(b) = conj(conj(a)*b).
+static const float bli_cgemmsup_rv_zen_conj_sgn[2][2][3] =
+{
+	{ {  0.0, 0.0,  0.0 }, { -0.0, 0.0, -0.0 } },
+	{ { -0.0, 0.0,  0.0 }, {  0.0, 0.0, -0.0 } },
+};
+
 // assumes beta.r, beta.i have been broadcast into ymm1, ymm2.
 // outputs to ymm0
 #define CGEMM_INPUT_SCALE_CS_BETA_NZ \
@@ -90,18 +101,18 @@
 
 void bli_cgemmsup_rv_zen_asm_2x8
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -123,6 +134,9 @@ void bli_cgemmsup_rv_zen_asm_2x8
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -316,6 +330,13 @@ void bli_cgemmsup_rv_zen_asm_2x8
 
 	// permute even and odd elements
 	// of ymm6/7, ymm10/11
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorps(ymm0, ymm7, ymm7)
+	vxorps(ymm0, ymm10, ymm10)
+	vxorps(ymm0, ymm11, ymm11)
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 	vpermilps(imm(0xb1), ymm7, ymm7)
 	vpermilps(imm(0xb1), ymm10, ymm10)
@@ -328,6 +349,12 @@ void bli_cgemmsup_rv_zen_asm_2x8
 	vaddsubps(ymm10, ymm8, ymm8)
 	vaddsubps(ymm11, ymm9, ymm9)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
+	vxorps(ymm0, ymm5, ymm5)
+	vxorps(ymm0, ymm8, ymm8)
+	vxorps(ymm0, ymm9, ymm9)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastss(mem(rax), ymm0) // load alpha_r and duplicate
@@ -538,7 +565,8 @@ void bli_cgemmsup_rv_zen_asm_2x8
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -554,18 +582,18 @@ void bli_cgemmsup_rv_zen_asm_2x8
 
 void bli_cgemmsup_rv_zen_asm_1x8
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -587,6 +615,9 @@ void bli_cgemmsup_rv_zen_asm_1x8
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -741,6 +772,11 @@ void bli_cgemmsup_rv_zen_asm_1x8
 
 	// permute even and odd elements
 	// of ymm6/7
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorps(ymm0, ymm7, ymm7)
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 	vpermilps(imm(0xb1), ymm7, ymm7)
 
@@ -748,6 +784,10 @@ void bli_cgemmsup_rv_zen_asm_1x8
 	vaddsubps(ymm6, ymm4, ymm4)
 	vaddsubps(ymm7, ymm5, ymm5)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
+	vxorps(ymm0, ymm5, ymm5)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastss(mem(rax), ymm0) // load alpha_r and duplicate
@@ -900,7 +940,8 @@ void bli_cgemmsup_rv_zen_asm_1x8
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -916,18 +957,18 @@ void bli_cgemmsup_rv_zen_asm_1x8
 
 void bli_cgemmsup_rv_zen_asm_2x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -950,6 +991,9 @@ void bli_cgemmsup_rv_zen_asm_2x4
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1127,6 +1171,11 @@ void bli_cgemmsup_rv_zen_asm_2x4
 
 	// permute even and odd elements
 	 // of ymm6/7
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorps(ymm0, ymm10, ymm10)
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 	vpermilps(imm(0xb1), ymm10, ymm10)
 
@@ -1134,6 +1183,9 @@ void bli_cgemmsup_rv_zen_asm_2x4
 	vaddsubps(ymm6, ymm4, ymm4)
 	vaddsubps(ymm10, ymm8, ymm8)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
+	vxorps(ymm0, ymm8, ymm8)
 
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
@@ -1276,7 +1328,8 @@ void bli_cgemmsup_rv_zen_asm_2x4
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1292,18 +1345,18 @@ void bli_cgemmsup_rv_zen_asm_2x4
 
 void bli_cgemmsup_rv_zen_asm_1x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1326,6 +1379,9 @@ void bli_cgemmsup_rv_zen_asm_1x4
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1476,11 +1532,17 @@ void bli_cgemmsup_rv_zen_asm_1x4
 
 	// permute even and odd elements
 	// of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 
 	// subtract/add even/odd elements
 	vaddsubps(ymm6, ymm4, ymm4)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
 
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
@@ -1594,7 +1656,8 @@ void bli_cgemmsup_rv_zen_asm_1x4
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1610,18 +1673,18 @@ void bli_cgemmsup_rv_zen_asm_1x4
 
 void bli_cgemmsup_rv_zen_asm_2x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-	   auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1644,6 +1707,9 @@ void bli_cgemmsup_rv_zen_asm_2x2
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1825,6 +1891,11 @@ void bli_cgemmsup_rv_zen_asm_2x2
 
 	// permute even and odd elements
 	// of xmm6/7
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), xmm0)       // negate the a.imag*b products if
+	vxorps(xmm0, xmm6, xmm6)           // exactly one of a and b is conjugated
+	vxorps(xmm0, xmm10, xmm10)
+
 	vpermilps(imm(0xb1), xmm6, xmm6)
 	vpermilps(imm(0xb1), xmm10, xmm10)
 
@@ -1832,6 +1903,10 @@ void bli_cgemmsup_rv_zen_asm_2x2
 	vaddsubps(xmm6, xmm4, xmm4)
 	vaddsubps(xmm10, xmm8, xmm8)
 
+	vmovddup(mem(rax, 4), xmm0)        // conjugate the a*b products if b
+	vxorps(xmm0, xmm4, xmm4)           // is conjugated
+	vxorps(xmm0, xmm8, xmm8)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastss(mem(rax), xmm0) // load alpha_r and duplicate
@@ -1973,7 +2048,8 @@ void bli_cgemmsup_rv_zen_asm_2x2
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1989,18 +2065,18 @@ void bli_cgemmsup_rv_zen_asm_2x2
 
 void bli_cgemmsup_rv_zen_asm_1x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*  data,
-       cntx_t*     cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -2023,6 +2099,9 @@ void bli_cgemmsup_rv_zen_asm_1x2
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -2174,11 +2253,18 @@ void bli_cgemmsup_rv_zen_asm_1x2
 
 	// permute even and odd elements
 	 // of xmm6
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), xmm0)       // negate the a.imag*b products if
+	vxorps(xmm0, xmm6, xmm6)           // exactly one of a and b is conjugated
+
 	vpermilps(imm(0xb1), xmm6, xmm6)
 
 	// subtract/add even/odd elements
 	vaddsubps(xmm6, xmm4, xmm4)
 
+	vmovddup(mem(rax, 4), xmm0)        // conjugate the a*b products if b
+	vxorps(xmm0, xmm4, xmm4)           // is conjugated
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastss(mem(rax), xmm0) // load alpha_r and duplicate
@@ -2288,7 +2374,8 @@ void bli_cgemmsup_rv_zen_asm_1x2
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -38,6 +38,17 @@
 #define BLIS_ASM_SYNTAX_ATT
 #include "bli_x86_asm_macros.h"
 
+// Sign masks, indexed by [conja][conjb], that the kernels below xor into
+// their accumulators to implement conjugation. The first element negates
+// the a.imag*b products when exactly one of a and b is conjugated; the
+// remaining pair conjugates the final a*b products when b is conjugated,
+// since a*conj(b) = conj(conj(a)*b).
+static const float bli_cgemmsup_rv_zen_conj_sgn[2][2][3] =
+{
+	{ {  0.0, 0.0,  0.0 }, { -0.0, 0.0, -0.0 } },
+	{ { -0.0, 0.0,  0.0 }, {  0.0, 0.0, -0.0 } },
+};
+
 // assumes beta.r, beta.i have been broadcast into ymm1, ymm2.
 // outputs to ymm0
 #define CGEMM_INPUT_SCALE_CS_BETA_NZ \
@@ -113,18 +124,18 @@
 */
 void bli_cgemmsup_rv_zen_asm_3x8m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	uint64_t n_left = n0 % 8;
@@ -133,9 +144,9 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	// dispatch other 3x?m kernels, as needed.
 	if (n_left )
 	{
-		scomplex*  cij = c;
-		scomplex*  bj  = b;
-		scomplex*  ai  = a;
+		      scomplex* cij = ( scomplex* )c;
+		const scomplex* bj  = ( scomplex* )b;
+		const scomplex* ai  = ( scomplex* )a;
 
 		if ( 4 <= n_left )
 		{
@@ -163,12 +174,44 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 		}
 		if ( 1 == n_left )
 		{
-			bli_cgemv_ex
-			(
-			  BLIS_NO_TRANSPOSE, conjb, m0, k0,
-			  alpha, ai, rs_a0, cs_a0, bj, rs_b0,
-			  beta, cij, rs_c0, cntx, NULL
-			);
+			dim_t ps_a0 = bli_auxinfo_ps_a( data );
+
+			if ( ps_a0 == 3 * rs_a0 )
+			{
+				// Since A is not packed, we can use one gemv.
+				bli_cgemv_ex
+				(
+				  ( trans_t )conja, conjb, m0, k0,
+				  alpha, ai, rs_a0, cs_a0, bj, rs_b0,
+				  beta, cij, rs_c0, cntx, NULL
+				);
+			}
+			else
+			{
+				const dim_t mr = 3;
+
+				// Since A is packed into row panels, we must use a loop over
+				// gemv.
+				dim_t m_iter = ( m0 + mr - 1 ) / mr;
+				dim_t m_left =   m0            % mr;
+
+				const scomplex* ai_ii  = ai;
+				      scomplex* cij_ii = cij;
+
+				for ( dim_t ii = 0; ii < m_iter; ii += 1 )
+				{
+					dim_t mr_cur = ( bli_is_not_edge_f( ii, m_iter, m_left )
+					                 ? mr : m_left );
+
+					bli_cgemv_ex
+					(
+					  ( trans_t )conja, conjb, mr_cur, k0,
+					  alpha, ai_ii, rs_a0, cs_a0, bj, rs_b0,
+					  beta, cij_ii, rs_c0, cntx, NULL
+					);
+					cij_ii += mr*rs_c0; ai_ii += ps_a0;
+				}
+			}
 		}
 
 		return;
@@ -193,10 +236,17 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -443,6 +493,15 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorps(ymm0, ymm7, ymm7)
+	vxorps(ymm0, ymm10, ymm10)
+	vxorps(ymm0, ymm11, ymm11)
+	vxorps(ymm0, ymm14, ymm14)
+	vxorps(ymm0, ymm15, ymm15)
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 	vpermilps(imm(0xb1), ymm7, ymm7)
 	vpermilps(imm(0xb1), ymm10, ymm10)
@@ -460,6 +519,14 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	vaddsubps(ymm14, ymm12, ymm12)
 	vaddsubps(ymm15, ymm13, ymm13)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
+	vxorps(ymm0, ymm5, ymm5)
+	vxorps(ymm0, ymm8, ymm8)
+	vxorps(ymm0, ymm9, ymm9)
+	vxorps(ymm0, ymm12, ymm12)
+	vxorps(ymm0, ymm13, ymm13)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax)               // load address of alpha
 	vbroadcastss(mem(rax), ymm0)       // load alpha_r and duplicate
@@ -705,8 +772,8 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X8I)                    // iterate again if ii != 0.
@@ -717,6 +784,7 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 	: // output operands (none)
 	: // input operands
       [m_iter] "m" (m_iter),
+      [ps_a8]  "m" (ps_a8),
       [k_iter] "m" (k_iter),
       [k_left] "m" (k_left),
       [a]      "m" (a),
@@ -729,7 +797,8 @@ void bli_cgemmsup_rv_zen_asm_3x8m
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -750,18 +819,18 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 		const dim_t      nr_cur = 8;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( scomplex* )a + m_iter * ps_a;
+		const scomplex* bj  = ( scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x8,
 		  bli_cgemmsup_rv_zen_asm_2x8,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
@@ -778,18 +847,18 @@ void bli_cgemmsup_rv_zen_asm_3x8m
 
 void bli_cgemmsup_rv_zen_asm_3x4m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -811,10 +880,17 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1029,6 +1105,12 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorps(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorps(ymm0, ymm10, ymm10)
+	vxorps(ymm0, ymm14, ymm14)
+
 	vpermilps(imm(0xb1), ymm6, ymm6)
 	vpermilps(imm(0xb1), ymm10, ymm10)
 	vpermilps(imm(0xb1), ymm14, ymm14)
@@ -1040,6 +1122,11 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 
 	vaddsubps(ymm14, ymm12, ymm12)
 
+	vbroadcastsd(mem(rax, 4), ymm0)    // conjugate the a*b products if b
+	vxorps(ymm0, ymm4, ymm4)           // is conjugated
+	vxorps(ymm0, ymm8, ymm8)
+	vxorps(ymm0, ymm12, ymm12)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax)               // load address of alpha
 	vbroadcastss(mem(rax), ymm0)       // load alpha_r and duplicate
@@ -1196,8 +1283,8 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X4I)                    // iterate again if ii != 0.
@@ -1208,6 +1295,7 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 	: // output operands (none)
 	: // input operands
       [m_iter] "m" (m_iter),
+      [ps_a8]  "m" (ps_a8),
       [k_iter] "m" (k_iter),
       [k_left] "m" (k_left),
       [a]      "m" (a),
@@ -1220,7 +1308,8 @@ void bli_cgemmsup_rv_zen_asm_3x4m
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1241,18 +1330,18 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 		const dim_t      nr_cur = 4;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( scomplex* )a + m_iter * ps_a;
+		const scomplex* bj  = ( scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x4,
 		  bli_cgemmsup_rv_zen_asm_2x4,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
@@ -1267,18 +1356,18 @@ void bli_cgemmsup_rv_zen_asm_3x4m
 
 void bli_cgemmsup_rv_zen_asm_3x2m
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       scomplex*    restrict alpha,
-       scomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       scomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       scomplex*    restrict beta,
-       scomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -1300,10 +1389,17 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	uint64_t rs_c   = rs_c0;
 	uint64_t cs_c   = cs_c0;
 
+	// Query the panel stride of A and convert it to units of bytes.
+	uint64_t ps_a   = bli_auxinfo_ps_a( data );
+	uint64_t ps_a8  = ps_a * sizeof( scomplex );
+
 	if ( m_iter == 0 ) goto consider_edge_cases;
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const float* conj_sgn = bli_cgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1514,6 +1610,12 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 
 	// permute even and odd elements
 	// of xmm6/7, xmm10/11, xmm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastss(mem(rax), xmm0)       // negate the a.imag*b products if
+	vxorps(xmm0, xmm6, xmm6)           // exactly one of a and b is conjugated
+	vxorps(xmm0, xmm10, xmm10)
+	vxorps(xmm0, xmm14, xmm14)
+
 	vpermilps(imm(0xb1), xmm6, xmm6)
 	vpermilps(imm(0xb1), xmm10, xmm10)
 	vpermilps(imm(0xb1), xmm14, xmm14)
@@ -1523,6 +1625,11 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	vaddsubps(xmm10, xmm8, xmm8)
 	vaddsubps(xmm14, xmm12, xmm12)
 
+	vmovddup(mem(rax, 4), xmm0)        // conjugate the a*b products if b
+	vxorps(xmm0, xmm4, xmm4)           // is conjugated
+	vxorps(xmm0, xmm8, xmm8)
+	vxorps(xmm0, xmm12, xmm12)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax)               // load address of alpha
 	vbroadcastss(mem(rax), xmm0)       // load alpha_r and duplicate
@@ -1684,8 +1791,8 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	lea(mem(r12, rdi, 2), r12)
 	lea(mem(r12, rdi, 1), r12)         // c_ii = r12 += 3*rs_c
 
-	lea(mem(r14, r8,  2), r14)
-	lea(mem(r14, r8,  1), r14)         //a_ii = r14 += 3*rs_a
+	mov(var(ps_a8), rax)               // load ps_a8
+	lea(mem(r14, rax, 1), r14)         // a_ii = r14 += ps_a8
 
 	dec(r11)                           // ii -= 1;
 	jne(.SLOOP3X2I)                    // iterate again if ii != 0.
@@ -1696,6 +1803,7 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 	: // output operands (none)
 	: // input operands
       [m_iter] "m" (m_iter),
+      [ps_a8]  "m" (ps_a8),
       [k_iter] "m" (k_iter),
       [k_left] "m" (k_left),
       [a]      "m" (a),
@@ -1708,7 +1816,8 @@ void bli_cgemmsup_rv_zen_asm_3x2m
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1729,18 +1838,18 @@ void bli_cgemmsup_rv_zen_asm_3x2m
 		const dim_t      nr_cur = 2;
 		const dim_t      i_edge = m0 - ( dim_t )m_left;
 
-		scomplex*  cij = c + i_edge*rs_c;
-		scomplex*  ai  = a + i_edge*rs_a;
-		scomplex*  bj  = b;
+		      scomplex* cij = ( scomplex* )c + i_edge*rs_c;
+		const scomplex* ai  = ( scomplex* )a + m_iter * ps_a;
+		const scomplex* bj  = ( scomplex* )b;
 
-		cgemmsup_ker_ft ker_fps[3] =
+		gemmsup_ker_ft ker_fps[3] =
 		{
 		  NULL,
 		  bli_cgemmsup_rv_zen_asm_1x2,
 		  bli_cgemmsup_rv_zen_asm_2x2,
 		};
 
-		cgemmsup_ker_ft ker_fp = ker_fps[ m_left ];
+		gemmsup_ker_ft ker_fp = ker_fps[ m_left ];
 
 		ker_fp
 		(
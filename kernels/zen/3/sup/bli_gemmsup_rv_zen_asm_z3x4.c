@@ -38,6 +38,17 @@
 #define BLIS_ASM_SYNTAX_ATT
 #include "bli_x86_asm_macros.h"
 
+// Sign masks, indexed by [conja][conjb], that the kernels below xor into
+// their accumulators to implement conjugation. The first element negates
+// the a.imag*b products when exactly one of a and b is conjugated; the
+// remaining pair conjugates the final a*b products when b is conjugated,
+// since a*conj(b) = conj(conj(a)*b).
+static const double bli_zgemmsup_rv_zen_conj_sgn[2][2][3] =
+{
+	{ {  0.0, 0.0,  0.0 }, { -0.0, 0.0, -0.0 } },
+	{ { -0.0, 0.0,  0.0 }, {  0.0, 0.0, -0.0 } },
+};
+
 // assumes beta.r, beta.i have been broadcast into ymm1, ymm2.
 // outputs to ymm0
 #define ZGEMM_INPUT_SCALE_CS_BETA_NZ \
@@ -72,18 +83,18 @@
 
 void bli_zgemmsup_rv_zen_asm_2x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -106,6 +117,9 @@ void bli_zgemmsup_rv_zen_asm_2x4
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const double* conj_sgn = bli_zgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -320,6 +334,13 @@ void bli_zgemmsup_rv_zen_asm_2x4
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastsd(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorpd(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorpd(ymm0, ymm7, ymm7)
+	vxorpd(ymm0, ymm10, ymm10)
+	vxorpd(ymm0, ymm11, ymm11)
+
 	vpermilpd(imm(0x5), ymm6, ymm6)
 	vpermilpd(imm(0x5), ymm7, ymm7)
 	vpermilpd(imm(0x5), ymm10, ymm10)
@@ -332,6 +353,12 @@ void bli_zgemmsup_rv_zen_asm_2x4
 	vaddsubpd(ymm10, ymm8, ymm8)
 	vaddsubpd(ymm11, ymm9, ymm9)
 
+	vbroadcastf128(mem(rax, 8), ymm0)  // conjugate the a*b products if b
+	vxorpd(ymm0, ymm4, ymm4)           // is conjugated
+	vxorpd(ymm0, ymm5, ymm5)
+	vxorpd(ymm0, ymm8, ymm8)
+	vxorpd(ymm0, ymm9, ymm9)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastsd(mem(rax), ymm0) // load alpha_r and duplicate
@@ -530,7 +557,8 @@ void bli_zgemmsup_rv_zen_asm_2x4
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -548,18 +576,18 @@ void bli_zgemmsup_rv_zen_asm_2x4
 
 void bli_zgemmsup_rv_zen_asm_1x4
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -583,6 +611,9 @@ void bli_zgemmsup_rv_zen_asm_1x4
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const double* conj_sgn = bli_zgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -759,6 +790,11 @@ void bli_zgemmsup_rv_zen_asm_1x4
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastsd(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorpd(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorpd(ymm0, ymm7, ymm7)
+
 	vpermilpd(imm(0x5), ymm6, ymm6)
 	vpermilpd(imm(0x5), ymm7, ymm7)
 
@@ -766,6 +802,10 @@ void bli_zgemmsup_rv_zen_asm_1x4
 	vaddsubpd(ymm6, ymm4, ymm4)
 	vaddsubpd(ymm7, ymm5, ymm5)
 
+	vbroadcastf128(mem(rax, 8), ymm0)  // conjugate the a*b products if b
+	vxorpd(ymm0, ymm4, ymm4)           // is conjugated
+	vxorpd(ymm0, ymm5, ymm5)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastsd(mem(rax), ymm0) // load alpha_r and duplicate
@@ -916,7 +956,8 @@ void bli_zgemmsup_rv_zen_asm_1x4
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -933,19 +974,18 @@ void bli_zgemmsup_rv_zen_asm_1x4
 
 void bli_zgemmsup_rv_zen_asm_2x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
-
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 	//void*    a_next = bli_auxinfo_next_a( data );
@@ -968,6 +1008,9 @@ void bli_zgemmsup_rv_zen_asm_2x2
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const double* conj_sgn = bli_zgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1155,6 +1198,11 @@ void bli_zgemmsup_rv_zen_asm_2x2
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastsd(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorpd(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+	vxorpd(ymm0, ymm10, ymm10)
+
 	vpermilpd(imm(0x5), ymm6, ymm6)
 	vpermilpd(imm(0x5), ymm10, ymm10)
 
@@ -1163,6 +1211,10 @@ void bli_zgemmsup_rv_zen_asm_2x2
 
 	vaddsubpd(ymm10, ymm8, ymm8)
 
+	vbroadcastf128(mem(rax, 8), ymm0)  // conjugate the a*b products if b
+	vxorpd(ymm0, ymm4, ymm4)           // is conjugated
+	vxorpd(ymm0, ymm8, ymm8)
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastsd(mem(rax), ymm0) // load alpha_r and duplicate
@@ -1304,7 +1356,8 @@ void bli_zgemmsup_rv_zen_asm_2x2
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -1320,19 +1373,18 @@ void bli_zgemmsup_rv_zen_asm_2x2
 
 void bli_zgemmsup_rv_zen_asm_1x2
      (
-       conj_t       conja,
-       conj_t       conjb,
-       dim_t        m0,
-       dim_t        n0,
-       dim_t        k0,
-       dcomplex*    restrict alpha,
-       dcomplex*    restrict a, inc_t rs_a0, inc_t cs_a0,
-       dcomplex*    restrict b, inc_t rs_b0, inc_t cs_b0,
-       dcomplex*    restrict beta,
-       dcomplex*    restrict c, inc_t rs_c0, inc_t cs_c0,
-       auxinfo_t*            data,
-       cntx_t*               cntx
-
+             conj_t     conja,
+             conj_t     conjb,
+             dim_t      m0,
+             dim_t      n0,
+             dim_t      k0,
+       const void*      alpha,
+       const void*      a, inc_t rs_a0, inc_t cs_a0,
+       const void*      b, inc_t rs_b0, inc_t cs_b0,
+       const void*      beta,
+             void*      c, inc_t rs_c0, inc_t cs_c0,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
      )
 {
 
@@ -1356,6 +1408,9 @@ void bli_zgemmsup_rv_zen_asm_1x2
 
 	// -------------------------------------------------------------------------
 
+	// Query the signs that implement the conjugation of a and/or b.
+	const double* conj_sgn = bli_zgemmsup_rv_zen_conj_sgn[ bli_is_conj( conja ) ][ bli_is_conj( conjb ) ];
+
 	begin_asm()
 
 	mov(var(a), r14)                   // load address of a.
@@ -1514,11 +1569,18 @@ void bli_zgemmsup_rv_zen_asm_1x2
 
 	// permute even and odd elements
 	 // of ymm6/7, ymm10/11, ymm/14/15
+	mov(var(conj_sgn), rax)            // load address of conjugation signs
+	vbroadcastsd(mem(rax), ymm0)       // negate the a.imag*b products if
+	vxorpd(ymm0, ymm6, ymm6)           // exactly one of a and b is conjugated
+
 	vpermilpd(imm(0x5), ymm6, ymm6)
 
 	// subtract/add even/odd elements
 	vaddsubpd(ymm6, ymm4, ymm4)
 
+	vbroadcastf128(mem(rax, 8), ymm0)  // conjugate the a*b products if b
+	vxorpd(ymm0, ymm4, ymm4)           // is conjugated
+
 	/* (ar + ai) x AB */
 	mov(var(alpha), rax) // load address of alpha
 	vbroadcastsd(mem(rax), ymm0) // load alpha_r and duplicate
@@ -1640,7 +1702,8 @@ void bli_zgemmsup_rv_zen_asm_1x2
       [beta]   "m" (beta),
       [c]      "m" (c),
       [rs_c]   "m" (rs_c),
-      [cs_c]   "m" (cs_c)/*,
+      [cs_c]   "m" (cs_c),
+      [conj_sgn] "m" (conj_sgn)/*,
       [a_next] "m" (a_next),
       [b_next] "m" (b_next)*/
 	: // register clobber list
@@ -0,0 +1,162 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference packm kernels for the reduced-precision gemm operations (see
+// bli_gemm_lp.h). The bfloat16 or float16 source elements are converted to
+// single precision and packed into the same micropanel format used by the
+// single-precision packm kernels, so that the resulting micropanels may be
+// consumed by the single-precision gemm microkernel. Broadcast packing
+// (cdim_bcast > 1) is not supported.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctypea, cha, opname, arch, suf, tofloat ) \
+\
+void PASTEMAC(cha,opname,arch,suf) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   cdim_bcast, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, inc_t lda, \
+             void*   p,             inc_t ldp, \
+       const void*   params, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const float            kappa_cast = *( const float* )kappa; \
+	const ctypea* restrict alpha1     = a; \
+	      float*  restrict pi1        = p; \
+\
+	( void )conja; ( void )schema; ( void )cdim_bcast; \
+	( void )params; ( void )cntx; \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t k = n; k != 0; --k ) \
+		{ \
+			PRAGMA_SIMD \
+			for ( dim_t mn = 0; mn < cdim; mn++ ) \
+				pi1[ mn ] = kappa_cast * tofloat( alpha1[ mn ] ); \
+\
+			alpha1 += lda; \
+			pi1    += ldp; \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = n; k != 0; --k ) \
+		{ \
+			for ( dim_t mn = 0; mn < cdim; mn++ ) \
+				pi1[ mn ] = kappa_cast * tofloat( alpha1[ mn*inca ] ); \
+\
+			alpha1 += lda; \
+			pi1    += ldp; \
+		} \
+	} \
+\
+	bli_tset0s_edge \
+	( \
+	  s, \
+	  cdim, cdim_max, \
+	  n, n_max, \
+	  ( float* )p, ldp  \
+	); \
+}
+
+GENTFUNC( bfloat16, sb, packm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, bli_bf16_to_float )
+GENTFUNC( float16,  sh, packm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, bli_f16_to_float )
+
+
+//
+// Reference packm kernel for the 8-bit integer gemm operation (see
+// bli_gemm_lp.h). Groups of four consecutive k indices are interleaved so
+// that each group of a row occupies one 32-bit word, and the final group is
+// padded with zeros. The sign bit of every element is flipped if requested
+// via the params (a packm_i8_params_t). Kappa is ignored, since alpha is
+// always applied by the microkernel.
+//
+
+void PASTEMAC(i8,packm,BLIS_CNAME_INFIX,BLIS_REF_SUFFIX)
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   cdim,
+             dim_t   cdim_max,
+             dim_t   cdim_bcast,
+             dim_t   n,
+             dim_t   n_max,
+       const void*   kappa,
+       const void*   a0, inc_t inca, inc_t lda,
+             void*   p0,             inc_t ldp,
+       const void*   params,
+       const cntx_t* cntx
+     )
+{
+	const packm_i8_params_t* i8_params = params;
+
+	const uint8_t* restrict a    = a0;
+	      uint8_t* restrict p    = p0;
+	const uint8_t           mask = i8_params != NULL ? i8_params->xor_mask : 0;
+	const dim_t             n4   = ( n + 3 ) / 4;
+
+	( void )conja; ( void )schema; ( void )kappa; ( void )cntx;
+
+	for ( dim_t l = 0; l < n4; ++l )
+	for ( dim_t i = 0; i < cdim; ++i )
+	for ( dim_t d = 0; d < cdim_bcast; ++d )
+	for ( dim_t g = 0; g < 4; ++g )
+	{
+		const dim_t k = 4*l + g;
+
+		p[ 4*( i*cdim_bcast + d + l*ldp ) + g ] =
+		    k < n ? a[ i*inca + k*lda ] ^ mask : 0;
+	}
+
+	// Zero the edges, treating each group as a single 32-bit word. The padded
+	// length n_max is always a whole number of groups.
+	bli_sset0s_edge
+	(
+	  cdim*cdim_bcast, cdim_max*cdim_bcast,
+	  n4, n_max / 4,
+	  ( float* )p0, ldp
+	);
+}
@@ -0,0 +1,85 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Reference microkernel for the 8-bit integer gemm operation (see
+// bli_gemm_lp.h). The micropanels of A (uint8) and B (int8) store groups of
+// four consecutive k indices in each 32-bit word, with the micropanel
+// dimensions given by the single-precision register blocksizes. Since alpha
+// and beta are passed as single-precision values, they are converted to
+// int32 here; the arithmetic on C wraps around modulo 2^32.
+
+void PASTEMAC(u8s8s32,gemm,BLIS_CNAME_INFIX,BLIS_REF_SUFFIX)
+     (
+             dim_t      m,
+             dim_t      n,
+             dim_t      k,
+       const void*      alpha0,
+       const void*      a0,
+       const void*      b0,
+       const void*      beta0,
+             void*      c0, inc_t rs_c, inc_t cs_c,
+       const auxinfo_t* data,
+       const cntx_t*    cntx
+     )
+{
+	const uint8_t* a     = a0;
+	const int8_t*  b     = b0;
+	      int32_t* c     = c0;
+	const uint32_t alpha = ( int32_t )*( const float* )alpha0;
+	const uint32_t beta  = ( int32_t )*( const float* )beta0;
+
+	const inc_t    packmr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const inc_t    packnr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_NR, cntx );
+	const dim_t    k4     = ( k + 3 ) / 4;
+
+	( void )data;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		uint32_t ab = 0;
+
+		for ( dim_t l = 0; l < k4; ++l )
+		for ( dim_t g = 0; g < 4; ++g )
+			ab += ( uint32_t )( a[ 4*( i + l*packmr ) + g ] *
+			                    b[ 4*( j + l*packnr ) + g ] );
+
+		int32_t* cij = c + i*rs_c + j*cs_c;
+
+		if ( beta == 0 ) *cij = ( int32_t )( alpha * ab );
+		else             *cij = ( int32_t )( alpha * ab + beta * ( uint32_t )*cij );
+	}
+}
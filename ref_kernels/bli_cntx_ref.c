@@ -135,6 +135,11 @@ INSERT_PROTMAC_BASIC( GEMMTRSM_UKR_PROT, gemmtrsm_u_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_l_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_u_ukr_name )
 
+// The 8-bit integer gemm microkernel accumulates in int32 but is stored in
+// the float slot of its func_t (see bli_gemm_lp.h).
+
+GEMM_UKR_PROT( int32_t, u8s8s32, gemm_ukr_name )
+
 
 // -- Level-3 virtual micro-kernel prototype redefinitions ---------------------
 
@@ -203,6 +208,14 @@ INSERT_PROTMAC_MIX_CO( PACKM_DIAG_KER_PROT2, packm_diag_1er_ker_name )
 INSERT_PROTMAC_MIX_CO( PACKM_DIAG_KER_PROT2, packm_diag_ro_ker_name )
 INSERT_PROTMAC_MIX_P ( UNPACKM_KER_PROT2,    unpackm_ker_name )
 
+// The reduced-precision (bfloat16 and float16) packm kernels convert their
+// input to single precision, while the 8-bit integer packm kernel packs its
+// input in groups of four; only the float slots of their func_t are set.
+
+PACKM_KER_PROT( float, sb, packm_ker_name )
+PACKM_KER_PROT( float, sh, packm_ker_name )
+PACKM_KER_PROT( float, i8, packm_ker_name )
+
 
 // -- Level-1f kernel prototype redefinitions ----------------------------------
 
@@ -524,6 +537,17 @@ void GENBARNAME(cntx_init)
 	gen_func_init_mix_co( &func2s[ bli_ker_idx( BLIS_PACKM_DIAG_RO_KER ) ],   packm_diag_ro_ker_name );
 	gen_func_init_mix_p ( &func2s[ bli_ker_idx( BLIS_UNPACKM_KER ) ],         unpackm_ker_name );
 
+	bli_func_init( &funcs[ bli_ker_idx( BLIS_PACKM_BF16_KER ) ], PASTEMAC(sb,packm_ker_name), NULL, NULL, NULL );
+	bli_func_init( &funcs[ bli_ker_idx( BLIS_PACKM_F16_KER ) ],  PASTEMAC(sh,packm_ker_name), NULL, NULL, NULL );
+	bli_func_init( &funcs[ bli_ker_idx( BLIS_PACKM_I8_KER ) ],   PASTEMAC(i8,packm_ker_name), NULL, NULL, NULL );
+
+	// NOTE: The reduced-precision gemm microkernels are left unset so that
+	// the single-precision microkernel is used on converted micropanels. The
+	// 8-bit integer operation has no such fallback, so its reference
+	// microkernel is always set.
+
+	bli_func_init( &funcs[ bli_ker_idx( BLIS_GEMM_U8S8S32_UKR ) ], PASTEMAC(u8s8s32,gemm_ukr_name), NULL, NULL, NULL );
+
 
 	// -- Put the default kernels and their preferences into the context -------
 
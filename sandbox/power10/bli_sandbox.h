@@ -56,50 +56,23 @@ typedef union
     } bits;
 } nibbles;
 
-// brain float16 
-typedef union
-{
-    uint16_t v;
-    struct
-    {
-        uint16_t m:7;
-        uint16_t e:8;
-        uint16_t s:1;
-    } bits;
-} bfloat16;
-
-// ieee float16 
-typedef union
-{
-    uint16_t v;
-    struct
-    {
-        uint16_t m:10;
-        uint16_t e:5;
-        uint16_t s:1;
-    } bits;
-} float16;
+// NOTE: The bfloat16 and float16 types are defined by the framework (see
+// bli_type_defs.h), as are the bli_sbgemm() and bli_shgemm() frontends, which
+// use the POWER10 MMA microkernels registered in the power10 context. The
+// int16 gemm likewise runs on the framework (see i16gemm.c).
 
 #define P10_PG_SIZE 4096
 
 // microkernel prototypes
-GEMM_UKR_PROT2( bfloat16,   float,  sb, gemm_power10_mma_8x16 )
-GEMM_UKR_PROT2(  float16,   float,  sh, gemm_power10_mma_8x16 )
-GEMM_UKR_PROT2(  int16_t, int32_t, i16, gemm_power10_mma_8x16 )
-GEMM_UKR_PROT2(   int8_t, int32_t,  i8, gemm_power10_mma_8x16 )
-GEMM_UKR_PROT2(  nibbles, int32_t,  i4, gemm_power10_mma_8x16 )
+GEMM_UKR_PROT( int32_t,  i8, gemm_power10_mma_8x16 )
+GEMM_UKR_PROT( int32_t,  i4, gemm_power10_mma_8x16 )
 
 // gemm kernel prototypes
-GEMM_FUNC_PROT(  float16,   float,  sh);
-GEMM_FUNC_PROT( bfloat16,   float,  sb);
 GEMM_FUNC_PROT(  int16_t, int32_t, i16);
 GEMM_FUNC_PROT(   int8_t, int32_t,  i8);
 GEMM_FUNC_PROT(  nibbles, int32_t,  i4);
 
 // pack kernel prototypes
-PACK_MACRO_PROTO(sb, bfloat16)
-PACK_MACRO_PROTO(sh, float16)
-PACK_MACRO_PROTO(i16, int16_t)
 PACK_MACRO_PROTO(i8, int8_t)
 PACK_MACRO_PROTO(i4, nibbles)
 
@@ -36,60 +36,6 @@
 #include "bli_sandbox.h"
 
 
-GENERIC_GEMM( 
-    sb, // kernel name prefix 
-    bfloat16, // input type
-    float, // output type    
-    (pb/2 + pb%2), // innermost loop iterations
-    sb_pack_a,
-    sb_pack_b, // pack kernel for B
-    bli_sbgemm_power10_mma_8x16, // microkernel function name
-    2, // K_MMA
-    8, // MR
-    16, // NR
-    384, // MC
-    3328, // KC
-    4096, // NC
-    0, // A_ALIGN
-    0 // B_ALIGN
-);
-
-GENERIC_GEMM( 
-    sh, // kernel name prefix 
-    float16, // input type
-    float, // output type    
-    (pb/2 + pb%2), // innermost loop iterations
-    sh_pack_a, // pack kernel for A
-    sh_pack_b, // pack kernel for B
-    bli_shgemm_power10_mma_8x16, // microkernel function name
-    2, // K_MMA
-    8, // MR
-    16, // NR
-    384, // MC
-    3328, // KC
-    4096, // NC
-    0, // A_ALIGN
-    0 // B_ALIGN
-);
-
-GENERIC_GEMM( 
-    i16, // kernel name prefix 
-    int16_t, // input type
-    int, // output type    
-    (pb/2 + pb%2), // innermost loop iterations
-    i16_pack_a, // pack kernel for A
-    i16_pack_b, // pack kernel for B
-    bli_i16gemm_power10_mma_8x16, // microkernel function name
-    2, // K_MMA
-    8, // MR
-    16, // NR
-    384, // MC
-    3328, // KC
-    4096, // NC
-    0, // A_ALIGN
-    0 // B_ALIGN
-);
-
 GENERIC_GEMM( 
     i8, // kernel name prefix 
     int8_t, // input type
@@ -0,0 +1,151 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// The int16 gemm is computed by the framework's reduced-precision path (see
+// frame/3/gemm/bli_gemm_lp.h), so that it is partitioned, multithreaded, and
+// packed into the memory pools just like bli_gemm(). Since int16 is not a
+// datatype known to the framework, the sandbox registers its own kernel ids
+// on first use and stores the POWER10 kernels in the POWER10 context. A and
+// B are passed as BLIS_FLOAT objects with two-byte elements, and the int32
+// C, alpha, and beta are carried as single-precision values. (The latter is
+// why the operation is marked as having integer C, which keeps the framework
+// from splitting k among threads and reducing their results as floats.)
+
+#include "blis.h"
+
+static kerid_t            i16_packm_ker_id = 0;
+static kerid_t            i16_gemm_ukr_id  = 0;
+static bli_pthread_once_t i16_once         = BLIS_PTHREAD_ONCE_INIT;
+
+static void bli_i16gemm_register( void )
+{
+	if ( bli_gks_register_ukr( &i16_packm_ker_id ) != BLIS_SUCCESS ||
+	     bli_gks_register_ukr( &i16_gemm_ukr_id  ) != BLIS_SUCCESS )
+		bli_abort();
+
+	// Only the POWER10 context provides the kernels. Elsewhere, the slots
+	// remain NULL and bli_gemm_lp_ex() reports that the operation is not
+	// implemented.
+	cntx_t* cntx = ( cntx_t* )bli_gks_lookup_id( BLIS_ARCH_POWER10 );
+	if ( cntx == NULL ) return;
+
+	bli_cntx_set_ukr_dt( ( void_fp )bli_i16packm_power10_int_8x16,
+	                     BLIS_FLOAT, i16_packm_ker_id, cntx );
+	bli_cntx_set_ukr_dt( ( void_fp )bli_i16gemm_power10_mma_8x16,
+	                     BLIS_FLOAT, i16_gemm_ukr_id, cntx );
+}
+
+void bli_i16gemm
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       int16_t* a, inc_t rsa, inc_t csa,
+       int16_t* b, inc_t rsb, inc_t csb,
+       int32_t* beta,
+       int32_t* c, inc_t rsc, inc_t csc
+     )
+{
+	bli_init_once();
+	bli_pthread_once( &i16_once, bli_i16gemm_register );
+
+	if ( bli_zero_dim2( m, n ) ) return;
+
+	// If there is no product to compute, scale C by beta here, since the
+	// framework would do so in single precision.
+	if ( k == 0 || *alpha == 0 )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			int32_t* cij = c + i*rsc + j*csc;
+			*cij = *beta == 0 ? 0 : ( int32_t )( ( uint32_t )*beta * ( uint32_t )*cij );
+		}
+
+		return;
+	}
+
+	// alpha and beta are passed through the framework as single-precision
+	// values, which represent all integers up to 2^24 exactly.
+	const int32_t flt_int_max = 1 << 24;
+	if ( bli_abs( *alpha ) > flt_int_max || bli_abs( *beta ) > flt_int_max )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	const num_t dt      = BLIS_FLOAT;
+	const float alpha_r = *alpha;
+	const float beta_r  = *beta;
+
+	obj_t       alphao  = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t       ao      = BLIS_OBJECT_INITIALIZER;
+	obj_t       bo      = BLIS_OBJECT_INITIALIZER;
+	obj_t       betao   = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t       co      = BLIS_OBJECT_INITIALIZER;
+
+	dim_t       m_a, n_a;
+	dim_t       m_b, n_b;
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	bli_obj_init_finish_1x1( dt, ( void* )&alpha_r, &alphao );
+	bli_obj_init_finish_1x1( dt, ( void* )&beta_r,  &betao  );
+
+	bli_obj_init_finish( dt, m_a, n_a, a, rsa, csa, &ao );
+	bli_obj_init_finish( dt, m_b, n_b, b, rsb, csb, &bo );
+	bli_obj_init_finish( dt, m,   n,   c, rsc, csc, &co );
+
+	bli_obj_set_elem_size( sizeof( int16_t ), &ao );
+	bli_obj_set_elem_size( sizeof( int16_t ), &bo );
+
+	bli_obj_set_onlytrans( transa, &ao );
+	bli_obj_set_onlytrans( transb, &bo );
+
+	bli_gemm_lp_ex
+	(
+	  &alphao,
+	  &ao,
+	  &bo,
+	  &betao,
+	  &co,
+	  i16_packm_ker_id,
+	  i16_gemm_ukr_id,
+	  TRUE,
+	  NULL,
+	  NULL
+	);
+}
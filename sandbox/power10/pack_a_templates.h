@@ -1,97 +1,6 @@
 
 
 
-#define k_even_apack_16(ir) \
-            *adest++ = ap[ (i+ir)*rs_a + p_idx*cs_a ]; \
-            *adest++ = ap[ (i+ir)*rs_a + (p_idx+1)*cs_a ];
-
-#define k_odd_apack_16(ir) \
-            *adest++ = ap[ (i+ir)*rs_a + (k-1)*cs_a ]; \
-            memset(adest, 0, 2); \
-            adest++;
-    
-#define pad_macro_16(dest_matrix) \
-            memset(dest_matrix, 0, 4); \
-            dest_matrix+=2; 
-
-#define BIT16_PACK_A(ch, DTYPE_IN) \
-\
-void PACK_FUNC_NAME(ch, a) \
-    ( \
-        dim_t MR, \
-        int m, int k, \
-        DTYPE_IN* ap, int rs_a, int cs_a, \
-        DTYPE_IN* apack \
-    ) \
-{ \
-    int k_odd = k%2; \
-    int p_idx; \
-\
-    DTYPE_IN* adest = apack; \
-    for (int i=0; i<m; i+=MR) \
-    { \
-        int ib = bli_min(MR, m-i); \
-        if (ib == MR) /* Full size column height */ \
-        { \
-            p_idx = 0; \
-            for (int p=0; p<(k/2); p++) \
-            {  \
-                k_even_apack_16(0); \
-                k_even_apack_16(1); \
-                k_even_apack_16(2); \
-                k_even_apack_16(3); \
-                k_even_apack_16(4); \
-                k_even_apack_16(5); \
-                k_even_apack_16(6); \
-                k_even_apack_16(7); \
-                p_idx += 2; \
-            } \
-\
-            /* In the case that k is odd, we must pad with 0s */ \
-            if(k_odd) \
-            { \
-                k_odd_apack_16(0); \
-                k_odd_apack_16(1); \
-                k_odd_apack_16(2); \
-                k_odd_apack_16(3); \
-                k_odd_apack_16(4); \
-                k_odd_apack_16(5); \
-                k_odd_apack_16(6); \
-                k_odd_apack_16(7); \
-            } \
-        } \
-\
-        else /* Not full size, pad with zeros */ \
-        { \
-            p_idx = 0; \
-            for (int p=0; p<(k/2); p++) \
-            { \
-                for (int ir=0; ir<ib; ir++) \
-                { \
-                    k_even_apack_16(ir); \
-                } \
-                for (int ir=ib; ir<MR; ir++) \
-                { \
-                    pad_macro_16(adest); \
-                } \
-                p_idx += 2; \
-            } \
-\
-            if(k_odd) \
-            { \
-                for (int ir=0; ir<ib; ir++) \
-                { \
-                    k_odd_apack_16(ir); \
-                } \
-                for (int ir=ib; ir<MR; ir++) \
-                { \
-                    pad_macro_16(adest); \
-                } \
-            } \
-        } \
-    } \
-} 
-
 /* 8 bit packing routines */
 
 #define k_even_apack_8(ir) \
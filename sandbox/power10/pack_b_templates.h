@@ -1,112 +1,6 @@
 
 
 
-#define k_even_bpack_16(jr) \
-            *bdest++ = bp[ p_idx*rs_b     + (j+jr)*cs_b ]; \
-            *bdest++ = bp[ (p_idx+1)*rs_b + (j+jr)*cs_b ]; \
-
-#define k_odd_bpack_16(jr) \
-            *bdest++ = bp[ (k-1)*rs_b + (j+jr)*cs_b ]; \
-            memset(bdest, 0, 2); \
-            bdest++; \
-
-#define BIT16_PACK_B(ch, DTYPE_IN) \
-\
-void PACK_FUNC_NAME(ch, b) \
-    ( \
-        dim_t NR, \
-        int k, int n, \
-        DTYPE_IN* bp, int rs_b, int cs_b, \
-        DTYPE_IN* bpack \
-    ) \
-{ \
-\
-    int k_odd = k%2; \
-    int p_idx; \
-\
-    DTYPE_IN* bdest = bpack; \
-\
-    for( int j=0; j<n; j += NR ) \
-    { \
-        int jb = bli_min(NR, n-j); \
-\
-        if ( jb == NR ) /* Full column width micro-panel.*/  \
-        { \
-            p_idx = 0; \
-            for ( int p=0; p<(k/2); p++ ) \
-            { \
-                k_even_bpack_16(0); \
-                k_even_bpack_16(1); \
-                k_even_bpack_16(2); \
-                k_even_bpack_16(3); \
-                k_even_bpack_16(4); \
-                k_even_bpack_16(5); \
-                k_even_bpack_16(6); \
-                k_even_bpack_16(7); \
-                k_even_bpack_16(8); \
-                k_even_bpack_16(9); \
-                k_even_bpack_16(10); \
-                k_even_bpack_16(11); \
-                k_even_bpack_16(12); \
-                k_even_bpack_16(13); \
-                k_even_bpack_16(14); \
-                k_even_bpack_16(15); \
-                p_idx += 2; \
-            } \
-\
-            /* In the case that k is odd, we must pad with 0s */ \
-            if(k_odd) \
-            { \
-                k_odd_bpack_16(0); \
-                k_odd_bpack_16(1); \
-                k_odd_bpack_16(2); \
-                k_odd_bpack_16(3); \
-                k_odd_bpack_16(4); \
-                k_odd_bpack_16(5); \
-                k_odd_bpack_16(6); \
-                k_odd_bpack_16(7); \
-                k_odd_bpack_16(8); \
-                k_odd_bpack_16(9); \
-                k_odd_bpack_16(10); \
-                k_odd_bpack_16(11); \
-                k_odd_bpack_16(12); \
-                k_odd_bpack_16(13); \
-                k_odd_bpack_16(14); \
-                k_odd_bpack_16(15); \
-            } \
-        } \
-\
-        else /* Not a full row size micro-panel.  We pad with zeroes. */ \
-        { \
-            p_idx = 0; \
-            for ( int p=0; p<(k/2); p++ )  \
-            { \
-                for ( int jr=0; jr<jb; jr++ ) \
-                { \
-                    k_even_bpack_16(jr); \
-                } \
-                for ( int jr=jb; jr<NR; jr++ ) \
-                { \
-                    pad_macro_16(bdest); \
-                } \
-                p_idx += 2; \
-            } \
-\
-            if(k_odd) \
-            { \
-                for ( int jr=0; jr<jb; jr++ ) \
-                { \
-                    k_odd_bpack_16(jr); \
-                } \
-                for ( int jr=jb; jr<NR; jr++ ) \
-                { \
-                    pad_macro_16(bdest); \
-                } \
-            } \
-        } \
-    } \
-};
-
 
 #define k_even_bpack_8(jr) \
             *bdest++ = bp[ p_idx*rs_b     + (j+jr)*cs_b ]; \
@@ -115,9 +115,12 @@ fi
 # Number of repeats per problem size.
 nrepeats=3
 
-# The induced method to use ('auto', 'native', or '1m') for executing
-# complex-domain level-3 operations.
-ind="auto"
+# The induced methods to use ('auto', 'native', or '1m') for executing
+# complex-domain level-3 operations. Listing more than one (e.g. to compare
+# native complex microkernels against the 1m method) runs each complex test
+# once per method; real-domain tests always use 'auto'.
+test_inds="auto"
+#test_inds="native 1m"
 
 # Quiet mode?
 #quiet="yes"
@@ -280,28 +283,44 @@ for th in ${threads}; do
 				# Construct the name of the test executable.
 				exec_name="${exec_root}_${opname}_${im}_${tsuf}.x"
 
-				# Construct the name of the output file.
-				out_file="${out_root}_${tsuf}_${dt}${opname}_${oppars}_${im}.m"
-
-				# Use printf for its formatting capabilities.
-				printf 'Running %s %-21s %s %-7s %s %s %s %s > %s\n' \
-				       "${numactl}" "./${exec_name}" "-d ${dt}" \
-				                                     "-c ${oppars}" \
-				                                     "-i ${ind}" \
-				                                     "-p \"${psr}\"" \
-				                                     "-r ${nrepeats}" \
-				                                     "${qv}" \
-				                                     "${out_file}"
-
-				# Run executable with or without numactl, depending on how
-				# the numactl variable was set.
-				if [ "${dryrun}" != "yes" ]; then
-					${numactl} ./${exec_name} -d ${dt} -c ${oppars} -i ${ind} -p "${psr}" -r ${nrepeats} ${qv} > ${out_file}
+				# Induced methods only apply to the complex domain.
+				if [ "${dt}" = "c" ] || [ "${dt}" = "z" ]; then
+					inds="${test_inds}"
+				else
+					inds="auto"
 				fi
 
-				# Bedtime!
-				sleep ${delay}
+				# Iterate over the induced methods.
+				for ind in ${inds}; do
+
+					# Construct the name of the output file. The induced method
+					# is only encoded when it was chosen explicitly.
+					if [ "${ind}" = "auto" ]; then
+						out_file="${out_root}_${tsuf}_${dt}${opname}_${oppars}_${im}.m"
+					else
+						out_file="${out_root}_${tsuf}_${dt}${opname}_${oppars}_${im}_${ind}.m"
+					fi
+
+					# Use printf for its formatting capabilities.
+					printf 'Running %s %-21s %s %-7s %s %s %s %s > %s\n' \
+					       "${numactl}" "./${exec_name}" "-d ${dt}" \
+					                                     "-c ${oppars}" \
+					                                     "-i ${ind}" \
+					                                     "-p \"${psr}\"" \
+					                                     "-r ${nrepeats}" \
+					                                     "${qv}" \
+					                                     "${out_file}"
+
+					# Run executable with or without numactl, depending on how
+					# the numactl variable was set.
+					if [ "${dryrun}" != "yes" ]; then
+						${numactl} ./${exec_name} -d ${dt} -c ${oppars} -i ${ind} -p "${psr}" -r ${nrepeats} ${qv} > ${out_file}
+					fi
+
+					# Bedtime!
+					sleep ${delay}
 
+				done
 			done
 		done
 	done
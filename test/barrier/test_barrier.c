@@ -0,0 +1,137 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "blis.h"
+
+// Time the barriers of thread communicators. For every barrier kind and
+// every team size up to NT_MAX, a team is launched whose threads pass
+// through N_ITER consecutive barriers, and the average time per barrier is
+// reported. Each thread also checks that no other thread has run ahead of
+// it, which would indicate a broken barrier. An optional third argument
+// sets the number of polls after which a waiting thread goes to sleep (the
+// default is BLIS_BARRIER_SPIN_COUNT).
+
+#ifndef NT_MAX
+#define NT_MAX 16
+#endif
+
+#ifndef N_ITER
+#define N_ITER 100000
+#endif
+
+typedef struct
+{
+	dim_t  n_iter;
+	dim_t  spin;
+	dim_t  arrived;
+	double time;
+	bool   failed;
+} bar_params_t;
+
+static void bar_func( thrcomm_t* comm, dim_t tid, const void* params_v )
+{
+	bar_params_t* params = ( bar_params_t* )params_v;
+	const dim_t   nt     = bli_thrcomm_num_threads( comm );
+
+	bli_thrcomm_set_spin( params->spin, comm );
+
+	// Warm up.
+	for ( dim_t i = 0; i < 100; ++i )
+		bli_thrcomm_barrier( tid, comm );
+
+	double t_start = bli_clock();
+
+	for ( dim_t i = 0; i < params->n_iter; ++i )
+	{
+		__atomic_fetch_add( &params->arrived, 1, __ATOMIC_RELAXED );
+
+		bli_thrcomm_barrier( tid, comm );
+
+		// Every thread has arrived at barrier i, and no thread can have
+		// left barrier i + 1.
+		const dim_t arrived = __atomic_load_n( &params->arrived, __ATOMIC_RELAXED );
+
+		if ( arrived < nt * ( i + 1 ) || nt * ( i + 2 ) < arrived )
+			params->failed = TRUE;
+	}
+
+	if ( tid == 0 ) params->time = bli_clock() - t_start;
+}
+
+int main( int argc, char** argv )
+{
+	const timpl_t ti     = bli_thread_get_thread_impl();
+	const dim_t   nt_max = ( 1 < argc ? atoi( argv[1] ) : NT_MAX );
+	const dim_t   n_iter = ( 2 < argc ? atoi( argv[2] ) : N_ITER );
+	const dim_t   spin   = ( 3 < argc ? atoi( argv[3] ) : -1 );
+
+	const char*   kind_str[] = { "central", "tree" };
+	const tbar_t  kinds[]    = { BLIS_BARRIER_CENTRAL, BLIS_BARRIER_TREE };
+
+	if ( ti == BLIS_SINGLE )
+	{
+		printf( "Multithreading is disabled; set BLIS_THREAD_IMPL.\n" );
+		return 1;
+	}
+
+	printf( "%% threading: %s, domain cores: %ld, package domains: %ld\n",
+	        bli_thread_get_thread_impl_str( ti ),
+	        ( long )bli_affinity_domain_cores(),
+	        ( long )bli_affinity_package_domains() );
+	printf( "%% %-8s %4s %12s\n", "barrier", "nt", "ns/barrier" );
+
+	int status = 0;
+
+	for ( int k = 0; k < 2; ++k )
+	{
+		bli_thread_set_barrier( kinds[ k ] );
+
+		for ( dim_t nt = 2; nt <= nt_max; nt *= 2 )
+		{
+			bar_params_t params = { n_iter, spin, 0, 0.0, FALSE };
+
+			bli_thread_launch( ti, nt, bar_func, &params );
+
+			printf( "  %-8s %4ld %12.1f%s\n", kind_str[ k ], ( long )nt,
+			        1.0e9 * params.time / n_iter,
+			        params.failed ? "  FAILED" : "" );
+
+			if ( params.failed ) status = 1;
+		}
+	}
+
+	return status;
+}
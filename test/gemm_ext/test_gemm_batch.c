@@ -0,0 +1,281 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "blis.h"
+
+// Check batched gemm through both of its interfaces:
+// - bli_gemm_batch_ex(), with an array of independent problems of mixed
+//   shapes, transpositions, and scalars, including problems large enough to
+//   be executed by all threads cooperatively (see BLIS_GEMM_BATCH_COOP_MNK);
+// - bli_?gemm_batch_ex(), with groups of typed operands.
+// Each batch is run with several thread counts, and every problem in it is
+// compared against its own reference, computed one column at a time with
+// gemv.
+
+#define N_SHAPES 8
+#define N_PROBS  24
+#define N_GROUPS 3
+
+typedef struct
+{
+	dim_t   m, n, k;
+	trans_t transa, transb;
+} shape_t;
+
+static const shape_t shapes[ N_SHAPES ] =
+{
+	{   1,   1,   1, BLIS_NO_TRANSPOSE,   BLIS_NO_TRANSPOSE   },
+	{   8,   6,  16, BLIS_NO_TRANSPOSE,   BLIS_NO_TRANSPOSE   },
+	{  17,  33,   9, BLIS_TRANSPOSE,      BLIS_NO_TRANSPOSE   },
+	{  64,  64,  64, BLIS_NO_TRANSPOSE,   BLIS_TRANSPOSE      },
+	{   5, 100,  40, BLIS_CONJ_TRANSPOSE, BLIS_NO_TRANSPOSE   },
+	{  99,   3,  77, BLIS_NO_TRANSPOSE,   BLIS_CONJ_TRANSPOSE },
+	{  30,  30,   0, BLIS_NO_TRANSPOSE,   BLIS_NO_TRANSPOSE   },
+	{ 260, 270, 250, BLIS_NO_TRANSPOSE,   BLIS_NO_TRANSPOSE   },
+};
+
+// The typed interface is checked with group g consisting of group_size[ g ]
+// problems of shape g + 1.
+static const dim_t group_size[ N_GROUPS ] = { 2, 5, 1 };
+
+// c := beta * c + alpha * op(a) * op(b), one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Form op(b) explicitly, since gemv only applies the transposition of a.
+	obj_t bt, bj, cj;
+	bli_obj_create( bli_obj_dt( b ), k, n, 0, 0, &bt );
+	bli_copym( b, &bt );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		bli_acquire_mpart( 0, j, k, 1, &bt, &bj );
+		bli_acquire_mpart( 0, j, m, 1, c,   &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+
+	bli_obj_free( &bt );
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F (or ||c - c_ref||_F if c_ref is zero).
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return ( norm_r == 0.0 ? norm_d : norm_d / norm_r );
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t nts[] = { 1, 2, 4 };
+
+	obj_t alpha[ N_PROBS ], a[ N_PROBS ], b[ N_PROBS ], beta[ N_PROBS ];
+	obj_t c[ N_PROBS ], c_orig[ N_PROBS ], c_ref[ N_PROBS ];
+
+	// The arguments of the typed interface. The operand arrays hold one
+	// buffer per problem; all other arrays hold one entry per group.
+	trans_t  transa[ N_GROUPS ], transb[ N_GROUPS ];
+	dim_t    m[ N_GROUPS ], n[ N_GROUPS ], k[ N_GROUPS ];
+	inc_t    rs_a[ N_GROUPS ], cs_a[ N_GROUPS ];
+	inc_t    rs_b[ N_GROUPS ], cs_b[ N_GROUPS ];
+	inc_t    rs_c[ N_GROUPS ], cs_c[ N_GROUPS ];
+	dcomplex alpha_t[ N_GROUPS ], beta_t[ N_GROUPS ];
+	void*    a_t[ N_PROBS ];
+	void*    b_t[ N_PROBS ];
+	void*    c_t[ N_PROBS ];
+
+	int status = 0;
+
+	printf( "%% batched gemm (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt        interface  threads    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t typed = 0; typed < 2; ++typed )
+	{
+		const num_t dt      = dts[ d ];
+		const siz_t dt_size = bli_dt_size( dt );
+
+		// The object interface gets N_PROBS problems that cycle through all
+		// shapes, while the typed one gets the problems of the groups, with
+		// every problem of a group sharing the scalars of the group.
+		const dim_t n_probs = ( typed ? group_size[ 0 ] + group_size[ 1 ] +
+		                                group_size[ 2 ] : N_PROBS );
+
+		for ( dim_t i = 0, g = 0, j = 0; i < n_probs; ++i )
+		{
+			const dim_t    s = ( typed ? g + 1 : i % N_SHAPES );
+			const dim_t    r = ( typed ? g     : i );
+			const shape_t* p = &shapes[ s ];
+
+			bli_obj_scalar_init_detached( dt, &alpha[ i ] );
+			bli_obj_scalar_init_detached( dt, &beta[ i ] );
+			bli_setsc( 1.0 + 0.1 * ( r % 5 ), 0.2, &alpha[ i ] );
+			bli_setsc( ( r % 4 == 0 ? 0.0 : 0.8 ), -0.1, &beta[ i ] );
+
+			if ( bli_does_trans( p->transa ) ) bli_obj_create( dt, p->k, p->m, 0, 0, &a[ i ] );
+			else                               bli_obj_create( dt, p->m, p->k, 0, 0, &a[ i ] );
+			if ( bli_does_trans( p->transb ) ) bli_obj_create( dt, p->n, p->k, 0, 0, &b[ i ] );
+			else                               bli_obj_create( dt, p->k, p->n, 0, 0, &b[ i ] );
+			bli_obj_create( dt, p->m, p->n, 0, 0, &c[ i ] );
+			bli_obj_create( dt, p->m, p->n, 0, 0, &c_orig[ i ] );
+			bli_obj_create( dt, p->m, p->n, 0, 0, &c_ref[ i ] );
+
+			bli_obj_set_conjtrans( p->transa, &a[ i ] );
+			bli_obj_set_conjtrans( p->transb, &b[ i ] );
+
+			bli_randm( &a[ i ] );
+			bli_randm( &b[ i ] );
+			bli_randm( &c_orig[ i ] );
+
+			bli_copym( &c_orig[ i ], &c[ i ] );
+			bli_copym( &c_orig[ i ], &c_ref[ i ] );
+			ref_gemm( &alpha[ i ], &a[ i ], &b[ i ], &beta[ i ], &c_ref[ i ] );
+
+			if ( !typed ) continue;
+
+			a_t[ i ] = bli_obj_buffer( &a[ i ] );
+			b_t[ i ] = bli_obj_buffer( &b[ i ] );
+			c_t[ i ] = bli_obj_buffer( &c[ i ] );
+
+			transa[ g ] = p->transa; transb[ g ] = p->transb;
+			m[ g ] = p->m; n[ g ] = p->n; k[ g ] = p->k;
+			rs_a[ g ] = bli_obj_row_stride( &a[ i ] ); cs_a[ g ] = bli_obj_col_stride( &a[ i ] );
+			rs_b[ g ] = bli_obj_row_stride( &b[ i ] ); cs_b[ g ] = bli_obj_col_stride( &b[ i ] );
+			rs_c[ g ] = bli_obj_row_stride( &c[ i ] ); cs_c[ g ] = bli_obj_col_stride( &c[ i ] );
+			memcpy( ( char* )alpha_t + g * dt_size, bli_obj_buffer( &alpha[ i ] ), dt_size );
+			memcpy( ( char* )beta_t  + g * dt_size, bli_obj_buffer( &beta[ i ] ),  dt_size );
+
+			if ( ++j == group_size[ g ] ) { ++g; j = 0; }
+		}
+
+		for ( dim_t t = 0; t < 3; ++t )
+		{
+			rntm_t rntm;
+
+			// The thread count of a rntm_t is ignored unless it also names
+			// a threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_num_threads( nts[ t ], &rntm );
+
+			if ( !typed )
+				bli_gemm_batch_ex( n_probs, alpha, a, b, beta, c, NULL, &rntm );
+			else if ( bli_is_float( dt ) )
+				bli_sgemm_batch_ex( N_GROUPS, group_size, transa, transb, m, n, k,
+				                    ( float* )alpha_t,
+				                    ( const float* const* )a_t, rs_a, cs_a,
+				                    ( const float* const* )b_t, rs_b, cs_b,
+				                    ( float* )beta_t,
+				                    ( float* const* )c_t, rs_c, cs_c, NULL, &rntm );
+			else if ( bli_is_double( dt ) )
+				bli_dgemm_batch_ex( N_GROUPS, group_size, transa, transb, m, n, k,
+				                    ( double* )alpha_t,
+				                    ( const double* const* )a_t, rs_a, cs_a,
+				                    ( const double* const* )b_t, rs_b, cs_b,
+				                    ( double* )beta_t,
+				                    ( double* const* )c_t, rs_c, cs_c, NULL, &rntm );
+			else if ( bli_is_scomplex( dt ) )
+				bli_cgemm_batch_ex( N_GROUPS, group_size, transa, transb, m, n, k,
+				                    ( scomplex* )alpha_t,
+				                    ( const scomplex* const* )a_t, rs_a, cs_a,
+				                    ( const scomplex* const* )b_t, rs_b, cs_b,
+				                    ( scomplex* )beta_t,
+				                    ( scomplex* const* )c_t, rs_c, cs_c, NULL, &rntm );
+			else
+				bli_zgemm_batch_ex( N_GROUPS, group_size, transa, transb, m, n, k,
+				                    ( dcomplex* )alpha_t,
+				                    ( const dcomplex* const* )a_t, rs_a, cs_a,
+				                    ( const dcomplex* const* )b_t, rs_b, cs_b,
+				                    ( dcomplex* )beta_t,
+				                    ( dcomplex* const* )c_t, rs_c, cs_c, NULL, &rntm );
+
+			// Report the largest error within the batch, and reset each C[i]
+			// so that the batch can be run again.
+			double err = 0.0;
+
+			for ( dim_t i = 0; i < n_probs; ++i )
+			{
+				const double err_i = rel_diff( &c[ i ], &c_ref[ i ] );
+				if ( !( err_i <= err ) ) err = err_i;
+				bli_copym( &c_orig[ i ], &c[ i ] );
+			}
+
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s  %-9s  %7ld  %10.2e%s\n",
+			        bli_dt_string( dt ), typed ? "typed" : "object",
+			        ( long )nts[ t ], err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		for ( dim_t i = 0; i < n_probs; ++i )
+		{
+			bli_obj_free( &a[ i ] );
+			bli_obj_free( &b[ i ] );
+			bli_obj_free( &c[ i ] );
+			bli_obj_free( &c_orig[ i ] );
+			bli_obj_free( &c_ref[ i ] );
+		}
+	}
+
+	return status;
+}
@@ -0,0 +1,293 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "blis.h"
+
+// Check strided batched gemm through bli_gemm_batch_strided_ex() and
+// bli_?gemm_batch_strided_ex(). The problems of a batch live in a single
+// buffer per operand, the i-th one offset by i times the batch stride, which
+// is larger than the matrix so that the problems are not packed tightly.
+// Batches are run with fewer, as many, and more problems than threads, in
+// column- and row-major storage, and with a batch stride of zero for A so
+// that every problem shares it. The reference is computed one column at a
+// time with gemv.
+
+#define N_SHAPES  4
+#define N_TRANS   3
+#define MAX_BATCH 8
+
+static const dim_t   shapes[ N_SHAPES ][ 4 ] = { {   8,   6,  16, FALSE },
+                                                 {  50,  40,  30, FALSE },
+                                                 {  33,  70,  20, TRUE  },
+                                                 { 200, 150, 180, FALSE } };
+static const trans_t trans[ N_TRANS ][ 2 ]   = { { BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE } };
+
+// One batched operand: a single buffer, and one object per problem that
+// aliases its part of that buffer.
+typedef struct
+{
+	void* buf;
+	inc_t rs, cs, stride;
+	obj_t obj[ MAX_BATCH ];
+} batch_t;
+
+// Create a batch of m x n matrices (or, if shared, a single matrix with a
+// batch stride of zero) with their elements padded apart, and randomize it.
+static void batch_create
+     (
+       num_t    dt,
+       dim_t    m,
+       dim_t    n,
+       bool     row_major,
+       bool     shared,
+       dim_t    batch_size,
+       batch_t* x
+     )
+{
+	const siz_t dt_size = bli_dt_size( dt );
+	err_t       r_val;
+
+	x->rs     = ( row_major ? n + 3 : 1 );
+	x->cs     = ( row_major ? 1 : m + 3 );
+
+	const dim_t size = ( row_major ? m * x->rs : n * x->cs );
+
+	x->stride = ( shared ? 0 : size + 5 );
+	x->buf    = bli_malloc_user( ( ( batch_size - 1 ) * x->stride + size ) * dt_size, &r_val );
+
+	for ( dim_t i = 0; i < batch_size; ++i )
+	{
+		bli_obj_create_with_attached_buffer( dt, m, n,
+		                                     ( char* )x->buf + i * x->stride * dt_size,
+		                                     x->rs, x->cs, &x->obj[ i ] );
+		bli_randm( &x->obj[ i ] );
+	}
+}
+
+static char trans_char( trans_t trans )
+{
+	return bli_does_conj( trans )  ? 'c' :
+	       bli_does_trans( trans ) ? 't' : 'n';
+}
+
+// c := beta * c + alpha * op(a) * op(b), one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Form op(b) explicitly, since gemv only applies the transposition of a.
+	obj_t bt, bj, cj;
+	bli_obj_create( bli_obj_dt( b ), k, n, 0, 0, &bt );
+	bli_copym( b, &bt );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		bli_acquire_mpart( 0, j, k, 1, &bt, &bj );
+		bli_acquire_mpart( 0, j, m, 1, c,   &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+
+	bli_obj_free( &bt );
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F.
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return norm_d / norm_r;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[]         = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t batch_sizes[] = { 1, 3, MAX_BATCH };
+	const dim_t nts[]         = { 1, 2, 4 };
+
+	obj_t   alpha, beta;
+	batch_t a, b, c;
+	obj_t   c_orig[ MAX_BATCH ], c_ref[ MAX_BATCH ];
+	int     status = 0;
+
+	printf( "%% strided batched gemm (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt        interface batch a     m    n    k r  ta tb  threads    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	for ( dim_t shared = 0; shared < 2; ++shared )
+	for ( dim_t typed = 0; typed < 2; ++typed )
+	for ( dim_t bs = 0; bs < 3; ++bs )
+	{
+		const num_t   dt         = dts[ d ];
+		const dim_t   m          = shapes[ s ][ 0 ];
+		const dim_t   n          = shapes[ s ][ 1 ];
+		const dim_t   k          = shapes[ s ][ 2 ];
+		const bool    row_major  = shapes[ s ][ 3 ];
+		const trans_t transa     = trans[ t ][ 0 ];
+		const trans_t transb     = trans[ t ][ 1 ];
+		const bool    ta         = bli_does_trans( transa );
+		const bool    tb         = bli_does_trans( transb );
+		const dim_t   batch_size = batch_sizes[ bs ];
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( 1.1, 0.2, &alpha );
+		bli_setsc( 0.7, -0.3, &beta );
+
+		// A and B are stored as they are before being transposed.
+		batch_create( dt, ta ? k : m, ta ? m : k, row_major, shared, batch_size, &a );
+		batch_create( dt, tb ? n : k, tb ? k : n, row_major, FALSE,  batch_size, &b );
+		batch_create( dt, m, n, row_major, FALSE, batch_size, &c );
+
+		for ( dim_t i = 0; i < batch_size; ++i )
+		{
+			bli_obj_set_conjtrans( transa, &a.obj[ i ] );
+			bli_obj_set_conjtrans( transb, &b.obj[ i ] );
+
+			bli_obj_create( dt, m, n, 0, 0, &c_orig[ i ] );
+			bli_obj_create( dt, m, n, 0, 0, &c_ref[ i ] );
+			bli_copym( &c.obj[ i ], &c_orig[ i ] );
+			bli_copym( &c.obj[ i ], &c_ref[ i ] );
+
+			ref_gemm( &alpha, &a.obj[ i ], &b.obj[ i ], &beta, &c_ref[ i ] );
+		}
+
+		for ( dim_t w = 0; w < 3; ++w )
+		{
+			rntm_t rntm;
+
+			// The thread count of a rntm_t is ignored unless it also names
+			// a threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_num_threads( nts[ w ], &rntm );
+
+			void* alpha_p = bli_obj_buffer( &alpha );
+			void* beta_p  = bli_obj_buffer( &beta );
+
+			if ( !typed )
+				bli_gemm_batch_strided_ex( batch_size, &alpha,
+				                           &a.obj[ 0 ], a.stride,
+				                           &b.obj[ 0 ], b.stride,
+				                           &beta,
+				                           &c.obj[ 0 ], c.stride,
+				                           NULL, &rntm );
+			else if ( bli_is_float( dt ) )
+				bli_sgemm_batch_strided_ex( transa, transb, m, n, k, alpha_p,
+				                            a.buf, a.rs, a.cs, a.stride,
+				                            b.buf, b.rs, b.cs, b.stride, beta_p,
+				                            c.buf, c.rs, c.cs, c.stride,
+				                            batch_size, NULL, &rntm );
+			else if ( bli_is_double( dt ) )
+				bli_dgemm_batch_strided_ex( transa, transb, m, n, k, alpha_p,
+				                            a.buf, a.rs, a.cs, a.stride,
+				                            b.buf, b.rs, b.cs, b.stride, beta_p,
+				                            c.buf, c.rs, c.cs, c.stride,
+				                            batch_size, NULL, &rntm );
+			else if ( bli_is_scomplex( dt ) )
+				bli_cgemm_batch_strided_ex( transa, transb, m, n, k, alpha_p,
+				                            a.buf, a.rs, a.cs, a.stride,
+				                            b.buf, b.rs, b.cs, b.stride, beta_p,
+				                            c.buf, c.rs, c.cs, c.stride,
+				                            batch_size, NULL, &rntm );
+			else
+				bli_zgemm_batch_strided_ex( transa, transb, m, n, k, alpha_p,
+				                            a.buf, a.rs, a.cs, a.stride,
+				                            b.buf, b.rs, b.cs, b.stride, beta_p,
+				                            c.buf, c.rs, c.cs, c.stride,
+				                            batch_size, NULL, &rntm );
+
+			// Report the largest error within the batch, and reset each C[i]
+			// so that the batch can be run again.
+			double err = 0.0;
+
+			for ( dim_t i = 0; i < batch_size; ++i )
+			{
+				const double err_i = rel_diff( &c.obj[ i ], &c_ref[ i ] );
+				if ( !( err_i <= err ) ) err = err_i;
+				bli_copym( &c_orig[ i ], &c.obj[ i ] );
+			}
+
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s  %-9s %5ld %c  %4ld %4ld %4ld %c   %c  %c  %7ld  %10.2e%s\n",
+			        bli_dt_string( dt ), typed ? "typed" : "object",
+			        ( long )batch_size, shared ? 'y' : 'n',
+			        ( long )m, ( long )n, ( long )k, row_major ? 'y' : 'n',
+			        trans_char( transa ), trans_char( transb ),
+			        ( long )nts[ w ], err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		for ( dim_t i = 0; i < batch_size; ++i )
+		{
+			bli_obj_free( &c_orig[ i ] );
+			bli_obj_free( &c_ref[ i ] );
+		}
+
+		bli_free_user( a.buf );
+		bli_free_user( b.buf );
+		bli_free_user( c.buf );
+	}
+
+	return status;
+}
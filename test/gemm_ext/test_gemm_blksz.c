@@ -0,0 +1,207 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "blis.h"
+
+// Check the cache blocksizes that the gks derives from the cache topology of
+// the running hardware (see bli_gks_init()). For each datatype, the derived
+// MC, KC, and NC must be positive, no greater than their maximum values, and
+// whole multiples of the register blocksizes. Gemm is then run through the
+// conventional code path on problems whose dimensions fall just below and
+// just above the derived blocksizes, so that every loop sees a partial
+// block, and compared against a reference computed one column at a time with
+// gemv. Running the driver with BLIS_AUTO_CACHE_BLKSZ=0 checks the static
+// blocksizes the same way.
+
+#define N_WAYS 2
+
+static const dim_t ways[ N_WAYS ][ 5 ] = { { 1, 1, 1, 1, 1 },
+                                           { 2, 1, 2, 1, 1 } };
+
+static int check_blksz( num_t dt, kerid_t bs_id, const char* name, dim_t mult, const cntx_t* cntx )
+{
+	const dim_t def = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	const dim_t max = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+	const bool  bad = ( def <= 0 || max < def || def % mult != 0 );
+
+	printf( "  %-8s  %-2s  %6ld%s\n", bli_dt_string( dt ), name, ( long )def,
+	        bad ? "  FAILED" : "" );
+
+	return bad;
+}
+
+// c := beta * c + alpha * a * b, one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	obj_t bj, cj;
+
+	for ( dim_t j = 0; j < bli_obj_width( c ); ++j )
+	{
+		bli_acquire_mpart( 0, j, bli_obj_length( b ), 1, b, &bj );
+		bli_acquire_mpart( 0, j, bli_obj_length( c ), 1, c, &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F.
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return norm_d / norm_r;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t   dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const cntx_t* cntx  = bli_gks_query_cntx();
+
+	obj_t alpha, beta, a, b, c, c_orig, c_ref;
+	int   status = 0;
+
+	printf( "%% gemm cache blocksizes (BLIS_AUTO_CACHE_BLKSZ: %s)\n",
+	        bli_env_get_var( "BLIS_AUTO_CACHE_BLKSZ", BLIS_AUTO_CACHE_BLKSZ_DEF ) != 0 ? "on" : "off" );
+	printf( "%% dt        bs   value\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	{
+		const num_t dt = dts[ d ];
+		const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		const dim_t kr = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, cntx );
+
+		status |= check_blksz( dt, BLIS_MC, "mc", mr, cntx );
+		status |= check_blksz( dt, BLIS_KC, "kc", kr, cntx );
+		status |= check_blksz( dt, BLIS_NC, "nc", nr, cntx );
+	}
+
+	printf( "%% gemm across the cache blocksizes (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt           m     n     k  jc pc ic jr ir    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t s = 0; s < 3; ++s )
+	{
+		const num_t dt = dts[ d ];
+		const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		const dim_t mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+		const dim_t kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+		const dim_t nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+
+		const dim_t shapes[ 3 ][ 3 ] = { {     mc + 1, 3 * nr + 1,     kc + 1 },
+		                                 { 2 * mc - 1,         50, 2 * kc + 3 },
+		                                 {     mr + 1,     nc + 1,     kc - 1 } };
+
+		const dim_t m = shapes[ s ][ 0 ];
+		const dim_t n = shapes[ s ][ 1 ];
+		const dim_t k = shapes[ s ][ 2 ];
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( 1.2, 0.3, &alpha );
+		bli_setsc( 0.9, -0.1, &beta );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_orig );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_orig );
+
+		bli_copym( &c_orig, &c_ref );
+		ref_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation. The sup code path has blocksizes of
+			// its own, so it is disabled.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+			bli_rntm_disable_l3_sup( &rntm );
+
+			bli_copym( &c_orig, &c );
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm );
+
+			const double err    = rel_diff( &c, &c_ref );
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s  %5ld %5ld %5ld   %2ld %2ld %2ld %2ld %2ld  %10.2e%s\n",
+			        bli_dt_string( dt ), ( long )m, ( long )n, ( long )k,
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_orig );
+		bli_obj_free( &c_ref );
+	}
+
+	return status;
+}
@@ -0,0 +1,296 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include "blis.h"
+
+// Check gemm with fused epilogues (bli_gemm_epi_ex()). The reference applies
+// the epilogue element by element to the result of a reference gemm, which
+// is computed one column at a time with gemv. The epilogues combine scale
+// and bias vectors along either dimension of C with each activation
+// function and the clamp (the latter two for real datatypes only). Problems
+// small enough for the sup code path, which applies the epilogue as a
+// separate pass, are mixed with ones that take the conventional path,
+// including one with row-stored C, which the conventional path computes as
+// the transposed product.
+
+#define N_SHAPES 4
+#define N_TRANS  2
+#define N_CFGS   10
+#define N_WAYS   3
+
+typedef struct
+{
+	// 0: none, 1: column vector (one element per row), 2: row vector.
+	int       scale;
+	int       bias;
+	epi_act_t act;
+	bool      clamp;
+} epi_cfg_t;
+
+static const dim_t     shapes[ N_SHAPES ][ 4 ] = { {  20,  30,  10, FALSE },
+                                                   { 300, 200, 150, FALSE },
+                                                   { 157,  61, 300, FALSE },
+                                                   { 130, 250,  90, TRUE  } };
+static const trans_t   trans[ N_TRANS ]        = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE };
+static const epi_cfg_t cfgs[ N_CFGS ]          = { { 0, 0, BLIS_EPI_ACT_NONE,      FALSE },
+                                                   { 1, 0, BLIS_EPI_ACT_NONE,      FALSE },
+                                                   { 0, 2, BLIS_EPI_ACT_NONE,      FALSE },
+                                                   { 2, 1, BLIS_EPI_ACT_NONE,      FALSE },
+                                                   { 2, 1, BLIS_EPI_ACT_RELU,      FALSE },
+                                                   { 0, 1, BLIS_EPI_ACT_GELU,      TRUE  },
+                                                   { 1, 2, BLIS_EPI_ACT_GELU_TANH, FALSE },
+                                                   { 1, 0, BLIS_EPI_ACT_SIGMOID,   FALSE },
+                                                   { 0, 2, BLIS_EPI_ACT_TANH,      TRUE  },
+                                                   { 0, 0, BLIS_EPI_ACT_NONE,      TRUE  } };
+static const dim_t     ways[ N_WAYS ][ 5 ]     = { { 1, 1, 1, 1, 1 },
+                                                   { 1, 1, 2, 2, 1 },
+                                                   { 1, 2, 1, 1, 1 } };
+
+static const char* act_str[ BLIS_NUM_EPI_ACTS ] =
+{
+	"none", "relu", "gelu", "gelu_tanh", "sigmoid", "tanh"
+};
+
+static const char* vec_str = "-cr";
+
+// Create a random m x n matrix stored by rows or by columns.
+static void mat_create( num_t dt, dim_t m, dim_t n, bool row_major, obj_t* x )
+{
+	if ( row_major ) bli_obj_create( dt, m, n, n, 1, x );
+	else             bli_obj_create( dt, m, n, 1, m, x );
+
+	bli_randm( x );
+}
+
+// c := beta * c + alpha * op(a) * b, one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	obj_t bj, cj;
+
+	for ( dim_t j = 0; j < bli_obj_width( c ); ++j )
+	{
+		bli_acquire_mpart( 0, j, bli_obj_length( b ), 1, b, &bj );
+		bli_acquire_mpart( 0, j, bli_obj_length( c ), 1, c, &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+}
+
+// Return the element of the scale or bias vector x that applies to (i,j).
+static void vec_elem( const obj_t* x, int kind, dim_t i, dim_t j, double* re, double* im )
+{
+	if ( kind == 1 ) bli_getijm( i, 0, x, re, im );
+	else             bli_getijm( 0, j, x, re, im );
+}
+
+static double ref_act( epi_act_t act, double x )
+{
+	switch ( act )
+	{
+		case BLIS_EPI_ACT_RELU:      return ( x > 0.0 ? x : 0.0 );
+		case BLIS_EPI_ACT_GELU:      return 0.5 * x * ( 1.0 + erf( x / sqrt( 2.0 ) ) );
+		case BLIS_EPI_ACT_GELU_TANH: return 0.5 * x * ( 1.0 + tanh( sqrt( 2.0 / 3.14159265358979323846 ) *
+		                                                            ( x + 0.044715 * x * x * x ) ) );
+		case BLIS_EPI_ACT_SIGMOID:   return 1.0 / ( 1.0 + exp( -x ) );
+		case BLIS_EPI_ACT_TANH:      return tanh( x );
+		default:                     return x;
+	}
+}
+
+// c := clamp( act( scale .* c + bias ) ), element by element.
+static void ref_epi( const epi_cfg_t* cfg, const gemm_epi_t* epi, obj_t* c )
+{
+	for ( dim_t j = 0; j < bli_obj_width( c ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( c ); ++i )
+	{
+		double re, im, sr, si;
+
+		bli_getijm( i, j, c, &re, &im );
+
+		if ( cfg->scale )
+		{
+			vec_elem( epi->scale, cfg->scale, i, j, &sr, &si );
+			const double t = sr * re - si * im;
+			im = sr * im + si * re;
+			re = t;
+		}
+		if ( cfg->bias )
+		{
+			vec_elem( epi->bias, cfg->bias, i, j, &sr, &si );
+			re += sr;
+			im += si;
+		}
+
+		re = ref_act( cfg->act, re );
+
+		if ( cfg->clamp )
+			re = bli_min( bli_max( re, epi->clamp_lo ), epi->clamp_hi );
+
+		bli_setijm( re, im, i, j, c );
+	}
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F.
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return norm_d / norm_r;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+	obj_t      alpha, beta, a, b, c, c_orig, c_ref;
+	obj_t      scale_c, scale_r, bias_c, bias_r;
+	gemm_epi_t epi;
+	int        status = 0;
+
+	printf( "%% gemm with fused epilogues (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt        scale bias act       clamp    m    n    k r  ta  jc pc ic jr ir    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	for ( dim_t v = 0; v < N_CFGS; ++v )
+	{
+		const num_t      dt        = dts[ d ];
+		const dim_t      m         = shapes[ s ][ 0 ];
+		const dim_t      n         = shapes[ s ][ 1 ];
+		const dim_t      k         = shapes[ s ][ 2 ];
+		const bool       row_major = shapes[ s ][ 3 ];
+		const trans_t    transa    = trans[ t ];
+		const epi_cfg_t* cfg       = &cfgs[ v ];
+
+		// Activations and the clamp only apply to real datatypes.
+		if ( bli_is_complex( dt ) && ( cfg->act != BLIS_EPI_ACT_NONE || cfg->clamp ) )
+			continue;
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( 0.8, 0.1, &alpha );
+		bli_setsc( 0.5, -0.2, &beta );
+
+		if ( bli_does_trans( transa ) ) mat_create( dt, k, m, row_major, &a );
+		else                            mat_create( dt, m, k, row_major, &a );
+		bli_obj_set_conjtrans( transa, &a );
+
+		mat_create( dt, k, n, row_major, &b );
+		mat_create( dt, m, n, row_major, &c );
+		mat_create( dt, m, n, row_major, &c_orig );
+		mat_create( dt, m, 1, FALSE, &scale_c );
+		mat_create( dt, 1, n, FALSE, &scale_r );
+		mat_create( dt, m, 1, FALSE, &bias_c );
+		mat_create( dt, 1, n, FALSE, &bias_r );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		epi = ( gemm_epi_t )BLIS_GEMM_EPI_INITIALIZER;
+
+		epi.scale    = ( cfg->scale == 1 ? &scale_c : cfg->scale == 2 ? &scale_r : NULL );
+		epi.bias     = ( cfg->bias  == 1 ? &bias_c  : cfg->bias  == 2 ? &bias_r  : NULL );
+		epi.act      = cfg->act;
+		epi.clamp    = cfg->clamp;
+		epi.clamp_lo = -0.25;
+		epi.clamp_hi =  0.75;
+
+		bli_copym( &c_orig, &c_ref );
+		ref_gemm( &alpha, &a, &b, &beta, &c_ref );
+		ref_epi( cfg, &epi, &c_ref );
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+
+			bli_copym( &c_orig, &c );
+			bli_gemm_epi_ex( &alpha, &a, &b, &beta, &c, &epi, NULL, &rntm );
+
+			const double err    = rel_diff( &c, &c_ref );
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s  %c     %c    %-9s %c      %4ld %4ld %4ld %c   %c   %2ld %2ld %2ld %2ld %2ld  %10.2e%s\n",
+			        bli_dt_string( dt ), vec_str[ cfg->scale ], vec_str[ cfg->bias ],
+			        act_str[ cfg->act ], cfg->clamp ? 'y' : 'n',
+			        ( long )m, ( long )n, ( long )k, row_major ? 'y' : 'n',
+			        bli_does_trans( transa ) ? 't' : 'n',
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_orig );
+		bli_obj_free( &c_ref );
+		bli_obj_free( &scale_c );
+		bli_obj_free( &scale_r );
+		bli_obj_free( &bias_c );
+		bli_obj_free( &bias_r );
+	}
+
+	return status;
+}
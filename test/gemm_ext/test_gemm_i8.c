@@ -0,0 +1,244 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+// Check the 8-bit integer gemm operation bli_u8s8s32gemm(). The reference
+// computes the product exactly in 64-bit integers and then applies alpha and
+// beta modulo 2^32, as the int32 arithmetic of the operation does, so every
+// element must match exactly. Alpha and beta include values too large to be
+// represented exactly in single precision. Problems cover every combination
+// of transposes, row- and column-stored operands (the latter choice decides
+// whether the framework transposes the operation and flips the sign bits of
+// the operands as they are packed), k that is not a multiple of four, and
+// zero points with and without requantization of C into an unsigned or
+// signed 8-bit Q. When beta is zero, C starts out holding values that must
+// not reach the result.
+
+#define N_SHAPES 8
+#define N_TRANS  4
+#define N_SCALS  4
+#define N_QUANTS 3
+#define N_WAYS   4
+
+typedef struct
+{
+	int32_t a_zp, b_zp;
+	int     quant;    // 0: none, 1: scalar scale (unsigned Q), 2: per-column scale (signed Q)
+	int32_t q_zp;
+} quant_cfg_t;
+
+static const dim_t       shapes[ N_SHAPES ][ 4 ] = { {   1,   1,   1, FALSE },
+                                                     {   7,   5,   3, FALSE },
+                                                     {  33,  13,  17, FALSE },
+                                                     {  64,  48, 130, TRUE  },
+                                                     { 150,  97, 301, FALSE },
+                                                     {   5, 400,  64, TRUE  },
+                                                     { 300, 250, 700, TRUE  },
+                                                     { 300, 250, 699, FALSE } };
+static const trans_t     trans[ N_TRANS ][ 2 ]   = { { BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE },
+                                                     { BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE },
+                                                     { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE    },
+                                                     { BLIS_TRANSPOSE,    BLIS_TRANSPOSE    } };
+static const int32_t     scals[ N_SCALS ][ 2 ]   = { { 1, 0 }, { 3, -2 },
+                                                     { ( 1 << 25 ) + 1, 3 << 25 },
+                                                     { -( 3 << 26 ), 5 } };
+static const quant_cfg_t quants[ N_QUANTS ]      = { {   0,  0, 0,   0 },
+                                                     {   3, -5, 2,  -7 },
+                                                     { 128,  0, 1, 100 } };
+static const dim_t       ways[ N_WAYS ][ 5 ]     = { { 1, 1, 1, 1, 1 },
+                                                     { 1, 1, 2, 2, 1 },
+                                                     { 1, 2, 1, 1, 1 },
+                                                     { 2, 2, 1, 2, 1 } };
+
+// Strides of an m x n matrix stored by rows or by columns.
+static void strides( dim_t m, dim_t n, bool row_major, inc_t* rs, inc_t* cs )
+{
+	*rs = ( row_major ? n : 1 );
+	*cs = ( row_major ? 1 : m );
+}
+
+int main( int argc, char** argv )
+{
+	int status = 0;
+
+	printf( "%% u8s8s32 gemm (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%%       alpha       beta a_zp b_zp q     m    n    k r  ta tb  jc pc ic jr ir  errors\n" );
+
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	for ( dim_t v = 0; v < N_SCALS; ++v )
+	for ( dim_t u = 0; u < N_QUANTS; ++u )
+	{
+		const dim_t        m         = shapes[ s ][ 0 ];
+		const dim_t        n         = shapes[ s ][ 1 ];
+		const dim_t        k         = shapes[ s ][ 2 ];
+		const bool         row_major = shapes[ s ][ 3 ];
+		const trans_t      transa    = trans[ t ][ 0 ];
+		const trans_t      transb    = trans[ t ][ 1 ];
+		const bool         ta        = bli_does_trans( transa );
+		const bool         tb        = bli_does_trans( transb );
+		const int32_t      alpha     = scals[ v ][ 0 ];
+		const int32_t      beta      = scals[ v ][ 1 ];
+		const quant_cfg_t* qc        = &quants[ u ];
+
+		inc_t rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+
+		// A and B are stored as they are before being transposed.
+		strides( ta ? k : m, ta ? m : k, row_major, &rs_a, &cs_a );
+		strides( tb ? n : k, tb ? k : n, row_major, &rs_b, &cs_b );
+		strides( m, n, row_major, &rs_c, &cs_c );
+
+		uint8_t* a       = malloc( m * k * sizeof( uint8_t ) );
+		int8_t*  b       = malloc( k * n * sizeof( int8_t ) );
+		int32_t* c       = malloc( m * n * sizeof( int32_t ) );
+		int32_t* c_orig  = malloc( m * n * sizeof( int32_t ) );
+		int32_t* c_ref   = malloc( m * n * sizeof( int32_t ) );
+		uint8_t* q       = malloc( m * n * sizeof( uint8_t ) );
+		int32_t* q_ref   = malloc( m * n * sizeof( int32_t ) );
+		float*   q_scale = malloc( n * sizeof( float ) );
+
+		for ( dim_t i = 0; i < m * k; ++i ) a[ i ] = ( uint8_t )( rand() % 256 );
+		for ( dim_t i = 0; i < k * n; ++i ) b[ i ] = ( int8_t )( rand() % 256 - 128 );
+		for ( dim_t j = 0; j < n; ++j ) q_scale[ j ] = 1.0e-4f * ( float )( 1 + rand() % 100 );
+
+		gemm_quant_t quant = BLIS_GEMM_QUANT_INITIALIZER;
+
+		quant.a_zp = qc->a_zp;
+		quant.b_zp = qc->b_zp;
+		if ( qc->quant )
+		{
+			quant.q           = q;
+			quant.rs_q        = rs_c;
+			quant.cs_q        = cs_c;
+			quant.q_signed    = ( qc->quant == 2 );
+			quant.q_scale     = q_scale;
+			quant.inc_q_scale = ( qc->quant == 2 ? 1 : 0 );
+			quant.q_zp        = qc->q_zp;
+		}
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			const int32_t cij = ( int32_t )( rand() % 2001 - 1000 ) +
+			                    ( beta == 0 ? 1000000 : 0 );
+			int64_t       ab  = 0;
+
+			for ( dim_t l = 0; l < k; ++l )
+			{
+				const int32_t ail = a[ ta ? l * rs_a + i * cs_a : i * rs_a + l * cs_a ];
+				const int32_t blj = b[ tb ? j * rs_b + l * cs_b : l * rs_b + j * cs_b ];
+
+				ab += ( int64_t )( ail - qc->a_zp ) * ( blj - qc->b_zp );
+			}
+
+			const int32_t rij = ( int32_t )( ( uint32_t )alpha * ( uint32_t )ab +
+			                                 ( beta == 0 ? 0 : ( uint32_t )beta * ( uint32_t )cij ) );
+			const float   sj  = q_scale[ qc->quant == 2 ? j : 0 ];
+			const int64_t lo  = ( qc->quant == 2 ? -128 : 0 );
+			const int64_t hi  = ( qc->quant == 2 ?  127 : 255 );
+			const int64_t qij = ( int64_t )lrintf( sj * ( float )rij ) + qc->q_zp;
+
+			c_orig[ i * rs_c + j * cs_c ] = cij;
+			c_ref[ i + j * m ] = rij;
+			q_ref[ i + j * m ] = ( int32_t )bli_min( bli_max( qij, lo ), hi );
+		}
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+
+			memcpy( c, c_orig, m * n * sizeof( int32_t ) );
+			memset( q, 0xa5, m * n * sizeof( uint8_t ) );
+
+			bli_u8s8s32gemm_ex( transa, transb, m, n, k, &alpha,
+			                    a, rs_a, cs_a, b, rs_b, cs_b, &beta,
+			                    c, rs_c, cs_c,
+			                    ( qc->quant || qc->a_zp || qc->b_zp ? &quant : NULL ),
+			                    NULL, &rntm );
+
+			// Count the elements of C and Q that differ from the reference.
+			long errs = 0;
+
+			for ( dim_t j = 0; j < n; ++j )
+			for ( dim_t i = 0; i < m; ++i )
+			{
+				const dim_t   ij  = i * rs_c + j * cs_c;
+				const int32_t qij = ( qc->quant == 2 ? ( int32_t )( ( int8_t* )q )[ ij ]
+				                                     : ( int32_t )q[ ij ] );
+
+				if ( c[ ij ] != c_ref[ i + j * m ] ) ++errs;
+				if ( qc->quant && qij != q_ref[ i + j * m ] ) ++errs;
+			}
+
+			printf( "  %11d %10d %4d %4d %d  %4ld %4ld %4ld %c   %c  %c   %2ld %2ld %2ld %2ld %2ld  %6ld%s\n",
+			        ( int )alpha, ( int )beta, ( int )qc->a_zp, ( int )qc->b_zp, qc->quant,
+			        ( long )m, ( long )n, ( long )k, row_major ? 'y' : 'n',
+			        ta ? 't' : 'n', tb ? 't' : 'n',
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        errs, errs != 0 ? "  FAILED" : "" );
+
+			if ( errs != 0 ) status = 1;
+		}
+
+		free( a );
+		free( b );
+		free( c );
+		free( c_orig );
+		free( c_ref );
+		free( q );
+		free( q_ref );
+		free( q_scale );
+	}
+
+	return status;
+}
@@ -0,0 +1,228 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "blis.h"
+
+// Check the reduced-precision gemm operations bli_sbgemm() (bfloat16) and
+// bli_shgemm() (float16). The operands are generated in single precision and
+// rounded to the 16-bit format, and the reference computes with the rounded
+// values converted back to single precision, accumulating in double
+// precision. Problems cover every combination of transposes, row- and
+// column-stored operands (the latter choice decides whether the framework
+// transposes the operation), odd k (which the packed format pads), and
+// beta == 0 with a C that holds NaNs, which must not reach the result.
+
+#define N_SHAPES 8
+#define N_TRANS  4
+#define N_SCALS  2
+#define N_WAYS   3
+
+static const dim_t   shapes[ N_SHAPES ][ 4 ] = { {   1,   1,   1, FALSE },
+                                                 {   7,   5,   3, FALSE },
+                                                 {  33,  13,  17, FALSE },
+                                                 {  64,  48, 128, TRUE  },
+                                                 { 150,  97, 301, FALSE },
+                                                 {   5, 400,  64, TRUE  },
+                                                 { 300, 250, 700, TRUE  },
+                                                 { 300, 250, 700, FALSE } };
+static const trans_t trans[ N_TRANS ][ 2 ]   = { { BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE },
+                                                 { BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE },
+                                                 { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE    },
+                                                 { BLIS_TRANSPOSE,    BLIS_TRANSPOSE    } };
+static const float   scals[ N_SCALS ][ 2 ]   = { { 1.0f, 0.0f }, { 0.5f, -1.5f } };
+static const dim_t   ways[ N_WAYS ][ 5 ]     = { { 1, 1, 1, 1, 1 },
+                                                 { 1, 1, 2, 2, 1 },
+                                                 { 1, 2, 1, 1, 1 } };
+
+static float rand_val( void )
+{
+	return 2.0f * ( float )rand() / ( float )RAND_MAX - 1.0f;
+}
+
+// Round x to the 16-bit format, store it in p[ idx ], and return the rounded
+// value in single precision.
+static float store_lp( bool bf16, float x, void* p, dim_t idx )
+{
+	if ( bf16 )
+	{
+		( ( bfloat16* )p )[ idx ] = bli_float_to_bf16( x );
+		return bli_bf16_to_float( ( ( bfloat16* )p )[ idx ] );
+	}
+	else
+	{
+		( ( float16* )p )[ idx ] = bli_float_to_f16( x );
+		return bli_f16_to_float( ( ( float16* )p )[ idx ] );
+	}
+}
+
+// Strides of an m x n matrix stored by rows or by columns.
+static void strides( dim_t m, dim_t n, bool row_major, inc_t* rs, inc_t* cs )
+{
+	*rs = ( row_major ? n : 1 );
+	*cs = ( row_major ? 1 : m );
+}
+
+int main( int argc, char** argv )
+{
+	int status = 0;
+
+	printf( "%% bfloat16/float16 gemm (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% type alpha  beta     m    n    k r  ta tb  jc pc ic jr ir    rel. err\n" );
+
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	for ( dim_t f = 0; f < 2; ++f )
+	for ( dim_t v = 0; v < N_SCALS; ++v )
+	{
+		const dim_t   m         = shapes[ s ][ 0 ];
+		const dim_t   n         = shapes[ s ][ 1 ];
+		const dim_t   k         = shapes[ s ][ 2 ];
+		const bool    row_major = shapes[ s ][ 3 ];
+		const trans_t transa    = trans[ t ][ 0 ];
+		const trans_t transb    = trans[ t ][ 1 ];
+		const bool    ta        = bli_does_trans( transa );
+		const bool    tb        = bli_does_trans( transb );
+		const bool    bf16      = ( f == 0 );
+		const float   alpha     = scals[ v ][ 0 ];
+		const float   beta      = scals[ v ][ 1 ];
+
+		inc_t rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+
+		// A and B are stored as they are before being transposed.
+		strides( ta ? k : m, ta ? m : k, row_major, &rs_a, &cs_a );
+		strides( tb ? n : k, tb ? k : n, row_major, &rs_b, &cs_b );
+		strides( m, n, row_major, &rs_c, &cs_c );
+
+		void*   a      = malloc( m * k * sizeof( bfloat16 ) );
+		void*   b      = malloc( k * n * sizeof( bfloat16 ) );
+		float*  c      = malloc( m * n * sizeof( float ) );
+		float*  c_orig = malloc( m * n * sizeof( float ) );
+		double* c_ref  = malloc( m * n * sizeof( double ) );
+
+		// a_s and b_s hold op(A) and op(B) by columns.
+		float* a_s = malloc( m * k * sizeof( float ) );
+		float* b_s = malloc( k * n * sizeof( float ) );
+
+		for ( dim_t l = 0; l < k; ++l )
+		for ( dim_t i = 0; i < m; ++i )
+			a_s[ i + l * m ] = store_lp( bf16, rand_val(), a,
+			                             ta ? l * rs_a + i * cs_a : i * rs_a + l * cs_a );
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t l = 0; l < k; ++l )
+			b_s[ l + j * k ] = store_lp( bf16, rand_val(), b,
+			                             tb ? j * rs_b + l * cs_b : l * rs_b + j * cs_b );
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			const float cij = ( beta == 0.0f ? NAN : rand_val() );
+			double      ab  = 0.0;
+
+			for ( dim_t l = 0; l < k; ++l )
+				ab += ( double )a_s[ i + l * m ] * ( double )b_s[ l + j * k ];
+
+			c_orig[ i * rs_c + j * cs_c ] = cij;
+			c_ref[ i + j * m ] = alpha * ab + ( beta == 0.0f ? 0.0 : beta * ( double )cij );
+		}
+
+		free( a_s );
+		free( b_s );
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+
+			memcpy( c, c_orig, m * n * sizeof( float ) );
+
+			if ( bf16 )
+				bli_sbgemm_ex( transa, transb, m, n, k, &alpha,
+				               a, rs_a, cs_a, b, rs_b, cs_b, &beta,
+				               c, rs_c, cs_c, NULL, &rntm );
+			else
+				bli_shgemm_ex( transa, transb, m, n, k, &alpha,
+				               a, rs_a, cs_a, b, rs_b, cs_b, &beta,
+				               c, rs_c, cs_c, NULL, &rntm );
+
+			double diff = 0.0, norm = 0.0;
+
+			for ( dim_t j = 0; j < n; ++j )
+			for ( dim_t i = 0; i < m; ++i )
+			{
+				const double r  = c_ref[ i + j * m ];
+				const double dc = c[ i * rs_c + j * cs_c ] - r;
+
+				diff += dc * dc;
+				norm += r * r;
+			}
+
+			const double err    = sqrt( diff / norm );
+			const bool   failed = !( err <= 1.0e-4 );
+
+			printf( "  %-4s %5.1f %5.1f  %4ld %4ld %4ld %c   %c  %c   %2ld %2ld %2ld %2ld %2ld  %10.2e%s\n",
+			        bf16 ? "bf16" : "fp16", alpha, beta,
+			        ( long )m, ( long )n, ( long )k, row_major ? 'y' : 'n',
+			        ta ? 't' : 'n', tb ? 't' : 'n',
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		free( a );
+		free( b );
+		free( c );
+		free( c_orig );
+		free( c_ref );
+	}
+
+	return status;
+}
@@ -0,0 +1,253 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "blis.h"
+
+// Check gemm with operands packed ahead of time by bli_gemm_pack(). For each
+// problem, A, B, or both are packed (after being transposed or conjugated,
+// in some cases) into deliberately misaligned buffers, and each packed
+// operand is then reused for several products with different partners and
+// scalars, under several assignments of ways. Setting BLIS_JRIR_DYNAMIC=1
+// also covers a prepacked A under dynamic scheduling, where no packm barrier
+// separates one ic iteration from the next. The reference is computed one
+// column at a time with gemv.
+
+#define N_SHAPES 4
+#define N_TRANS  3
+#define N_WAYS   4
+#define N_REUSE  3
+
+static const dim_t   shapes[ N_SHAPES ][ 3 ] = { {    7,   5,   3 },
+                                                 {   60,  50, 400 },
+                                                 {  300,  41,  97 },
+                                                 { 1000, 300, 300 } };
+static const trans_t trans[ N_TRANS ][ 2 ]   = { { BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE } };
+static const dim_t   ways[ N_WAYS ][ 5 ]     = { { 1, 1, 1, 1, 1 },
+                                                 { 2, 1, 2, 1, 1 },
+                                                 { 1, 1, 1, 4, 1 },
+                                                 { 1, 2, 1, 2, 1 } };
+
+static char trans_char( trans_t trans )
+{
+	return bli_does_conj( trans )  ? 'c' :
+	       bli_does_trans( trans ) ? 't' : 'n';
+}
+
+// Create a random operand x such that op(x) = trans(x) is m x n.
+static void op_create( num_t dt, dim_t m, dim_t n, trans_t trans, obj_t* x )
+{
+	if ( bli_does_trans( trans ) ) bli_obj_create( dt, n, m, 0, 0, x );
+	else                           bli_obj_create( dt, m, n, 0, 0, x );
+
+	bli_obj_set_conjtrans( trans, x );
+	bli_randm( x );
+}
+
+// c := beta * c + alpha * op(a) * op(b), one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Form op(b) explicitly, since gemv only applies the transposition of a.
+	obj_t bt, bj, cj;
+	bli_obj_create( bli_obj_dt( b ), k, n, 0, 0, &bt );
+	bli_copym( b, &bt );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		bli_acquire_mpart( 0, j, k, 1, &bt, &bj );
+		bli_acquire_mpart( 0, j, m, 1, c,   &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+
+	bli_obj_free( &bt );
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F.
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return norm_d / norm_r;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const char* side_str[] = { "a", "b", "ab" };
+
+	// The operand that is packed is shared by all N_REUSE products, while
+	// the other one changes from one product to the next.
+	obj_t alpha[ N_REUSE ], beta[ N_REUSE ];
+	obj_t a[ N_REUSE ], b[ N_REUSE ], c_orig[ N_REUSE ], c_ref[ N_REUSE ];
+	obj_t ap, bp, c;
+	char* buf_a = NULL;
+	char* buf_b = NULL;
+	err_t r_val;
+	int   status = 0;
+
+	printf( "%% gemm with prepacked operands (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt        packed     m    n    k  ta tb  jc pc ic jr ir    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	for ( dim_t side = 0; side < 3; ++side )
+	{
+		const num_t   dt     = dts[ d ];
+		const dim_t   m      = shapes[ s ][ 0 ];
+		const dim_t   n      = shapes[ s ][ 1 ];
+		const dim_t   k      = shapes[ s ][ 2 ];
+		const trans_t transa = trans[ t ][ 0 ];
+		const trans_t transb = trans[ t ][ 1 ];
+		const bool    pack_a = ( side != 1 );
+		const bool    pack_b = ( side != 0 );
+
+		for ( dim_t r = 0; r < N_REUSE; ++r )
+		{
+			bli_obj_scalar_init_detached( dt, &alpha[ r ] );
+			bli_obj_scalar_init_detached( dt, &beta[ r ] );
+			bli_setsc( 1.0 + 0.5 * r, 0.1, &alpha[ r ] );
+			bli_setsc( ( r == 1 ? 0.0 : 0.6 ), -0.4, &beta[ r ] );
+
+			if ( r == 0 || !pack_a ) op_create( dt, m, k, transa, &a[ r ] );
+			else                     bli_obj_alias_to( &a[ 0 ], &a[ r ] );
+
+			if ( r == 0 || !pack_b ) op_create( dt, k, n, transb, &b[ r ] );
+			else                     bli_obj_alias_to( &b[ 0 ], &b[ r ] );
+
+			bli_obj_create( dt, m, n, 0, 0, &c_orig[ r ] );
+			bli_obj_create( dt, m, n, 0, 0, &c_ref[ r ] );
+			bli_randm( &c_orig[ r ] );
+			bli_copym( &c_orig[ r ], &c_ref[ r ] );
+
+			ref_gemm( &alpha[ r ], &a[ r ], &b[ r ], &beta[ r ], &c_ref[ r ] );
+		}
+
+		bli_obj_create( dt, m, n, 0, 0, &c );
+
+		// Pack into buffers that are offset from the alignment that malloc()
+		// provides, since the caller's buffer need not be aligned.
+		if ( pack_a )
+		{
+			buf_a = bli_malloc_user( bli_gemm_pack_size( BLIS_LEFT, &a[ 0 ], NULL ) + 8, &r_val );
+			bli_gemm_pack( BLIS_LEFT, &a[ 0 ], buf_a + 8, &ap );
+		}
+		if ( pack_b )
+		{
+			buf_b = bli_malloc_user( bli_gemm_pack_size( BLIS_RIGHT, &b[ 0 ], NULL ) + 8, &r_val );
+			bli_gemm_pack( BLIS_RIGHT, &b[ 0 ], buf_b + 8, &bp );
+		}
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+
+			// Report the largest error among the N_REUSE products.
+			double err = 0.0;
+
+			for ( dim_t r = 0; r < N_REUSE; ++r )
+			{
+				bli_copym( &c_orig[ r ], &c );
+				bli_gemm_ex( &alpha[ r ],
+				             pack_a ? &ap : &a[ r ],
+				             pack_b ? &bp : &b[ r ],
+				             &beta[ r ], &c, NULL, &rntm );
+
+				const double err_r = rel_diff( &c, &c_ref[ r ] );
+				if ( !( err_r <= err ) ) err = err_r;
+			}
+
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s  %-6s  %4ld %4ld %4ld  %c  %c   %2ld %2ld %2ld %2ld %2ld  %10.2e%s\n",
+			        bli_dt_string( dt ), side_str[ side ],
+			        ( long )m, ( long )n, ( long )k,
+			        trans_char( transa ), trans_char( transb ),
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		for ( dim_t r = 0; r < N_REUSE; ++r )
+		{
+			if ( r == 0 || !pack_a ) bli_obj_free( &a[ r ] );
+			if ( r == 0 || !pack_b ) bli_obj_free( &b[ r ] );
+			bli_obj_free( &c_orig[ r ] );
+			bli_obj_free( &c_ref[ r ] );
+		}
+
+		bli_obj_free( &c );
+		if ( pack_a ) bli_free_user( buf_a );
+		if ( pack_b ) bli_free_user( buf_b );
+	}
+
+	return status;
+}
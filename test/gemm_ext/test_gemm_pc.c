@@ -0,0 +1,202 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include "blis.h"
+
+// Check gemm with threads assigned to the pc (k dimension) loop. Every pc
+// thread group but the first accumulates into a private copy of C, and the
+// copies are reduced into C at the end, so beta must be applied exactly
+// once; it is therefore nonzero throughout. Each problem is run with several
+// assignments of ways, including ones with more pc ways than k has kc
+// blocks, and with transposed operands. The reference is computed one
+// column at a time with gemv, so it shares no code with gemm.
+
+#define N_SHAPES 5
+#define N_TRANS  3
+#define N_WAYS   6
+
+static const dim_t   shapes[ N_SHAPES ][ 3 ] = { {  37,  29, 1000 },
+                                                 { 100, 100,  700 },
+                                                 {   1, 300,  800 },
+                                                 { 250,   3,  511 },
+                                                 {   5,   5,    3 } };
+static const trans_t trans[ N_TRANS ][ 2 ]   = { { BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_TRANSPOSE,    BLIS_NO_TRANSPOSE   },
+                                                 { BLIS_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE } };
+static const dim_t   ways[ N_WAYS ][ 5 ]     = { { 1, 2, 1, 1, 1 },
+                                                 { 1, 3, 1, 1, 1 },
+                                                 { 1, 4, 1, 1, 1 },
+                                                 { 2, 2, 1, 1, 1 },
+                                                 { 1, 2, 2, 1, 1 },
+                                                 { 1, 2, 1, 2, 1 } };
+
+// c := beta * c + alpha * op(a) * op(b), one column of c at a time.
+static void ref_gemm( obj_t* alpha, obj_t* a, obj_t* b, obj_t* beta, obj_t* c )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Form op(b) explicitly, since gemv only applies the transposition of a.
+	obj_t bt, bj, cj;
+	bli_obj_create( bli_obj_dt( b ), k, n, 0, 0, &bt );
+	bli_copym( b, &bt );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		bli_acquire_mpart( 0, j, k, 1, &bt, &bj );
+		bli_acquire_mpart( 0, j, m, 1, c,   &cj );
+
+		bli_gemv( alpha, a, &bj, beta, &cj );
+	}
+
+	bli_obj_free( &bt );
+}
+
+static char trans_char( trans_t trans )
+{
+	return bli_does_conj( trans )  ? 'c' :
+	       bli_does_trans( trans ) ? 't' : 'n';
+}
+
+// Return ||c - c_ref||_F / ||c_ref||_F.
+static double rel_diff( obj_t* c, obj_t* c_ref )
+{
+	obj_t  d, norm;
+	double norm_d, norm_r, im;
+
+	bli_obj_create( bli_obj_dt( c ), bli_obj_length( c ), bli_obj_width( c ), 0, 0, &d );
+	bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( c ), &norm );
+
+	bli_copym( c, &d );
+	bli_subm( c_ref, &d );
+
+	bli_normfm( &d, &norm );
+	bli_getsc( &norm, &norm_d, &im );
+	bli_normfm( c_ref, &norm );
+	bli_getsc( &norm, &norm_r, &im );
+
+	bli_obj_free( &d );
+
+	return norm_d / norm_r;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+	obj_t alpha, beta, a, b, c, c_orig, c_ref;
+	int   status = 0;
+
+	printf( "%% gemm with pc loop parallelism (threading: %s)\n",
+	        bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() ) );
+	printf( "%% dt        m    n    k  ta tb  jc pc ic jr ir    rel. err\n" );
+
+	for ( dim_t d = 0; d < 4; ++d )
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	for ( dim_t t = 0; t < N_TRANS; ++t )
+	{
+		const num_t   dt     = dts[ d ];
+		const dim_t   m      = shapes[ s ][ 0 ];
+		const dim_t   n      = shapes[ s ][ 1 ];
+		const dim_t   k      = shapes[ s ][ 2 ];
+		const trans_t transa = trans[ t ][ 0 ];
+		const trans_t transb = trans[ t ][ 1 ];
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( 1.2, 0.3, &alpha );
+		bli_setsc( 0.9, -0.2, &beta );
+
+		if ( bli_does_trans( transa ) ) bli_obj_create( dt, k, m, 0, 0, &a );
+		else                            bli_obj_create( dt, m, k, 0, 0, &a );
+		if ( bli_does_trans( transb ) ) bli_obj_create( dt, n, k, 0, 0, &b );
+		else                            bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_orig );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+		bli_obj_set_conjtrans( transa, &a );
+		bli_obj_set_conjtrans( transb, &b );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_orig );
+
+		bli_copym( &c_orig, &c_ref );
+		ref_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+		for ( dim_t w = 0; w < N_WAYS; ++w )
+		{
+			const dim_t* wy = ways[ w ];
+
+			rntm_t rntm;
+
+			// The ways of a rntm_t are ignored unless it also names a
+			// threading implementation.
+			bli_rntm_init_from_global( &rntm );
+			if ( bli_info_get_enable_pthreads() )
+				bli_rntm_set_thread_impl( BLIS_POSIX, &rntm );
+			else if ( bli_info_get_enable_openmp() )
+				bli_rntm_set_thread_impl( BLIS_OPENMP, &rntm );
+			bli_rntm_set_ways( wy[ 0 ], wy[ 1 ], wy[ 2 ], wy[ 3 ], wy[ 4 ], &rntm );
+
+			bli_copym( &c_orig, &c );
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm );
+
+			const double err    = rel_diff( &c, &c_ref );
+			const double thresh = ( bli_dt_prec_is_single( dt ) ? 1.0e-4 : 1.0e-11 );
+			const bool   failed = !( err <= thresh );
+
+			printf( "  %-8s %4ld %4ld %4ld  %c  %c   %2ld %2ld %2ld %2ld %2ld  %10.2e%s\n",
+			        bli_dt_string( dt ), ( long )m, ( long )n, ( long )k,
+			        trans_char( transa ), trans_char( transb ),
+			        ( long )wy[ 0 ], ( long )wy[ 1 ], ( long )wy[ 2 ],
+			        ( long )wy[ 3 ], ( long )wy[ 4 ],
+			        err, failed ? "  FAILED" : "" );
+
+			if ( failed ) status = 1;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_orig );
+		bli_obj_free( &c_ref );
+	}
+
+	return status;
+}